@@ -14,11 +14,13 @@ namespace lsp
     {
         protected:
             JACKWrapper        *pWrapper;
+            size_t              nIndex;
 
         public:
             JACKPort(const port_t *meta, JACKWrapper *w): IPort(meta)
             {
                 pWrapper        = w;
+                nIndex          = 0;
             }
 
             virtual ~JACKPort()
@@ -35,6 +37,11 @@ namespace lsp
             virtual void destroy()
             {
             }
+
+        public:
+            inline JACKWrapper *wrapper()               { return pWrapper;      }
+            inline size_t index() const                 { return nIndex;        }
+            inline void set_index(size_t index)         { nIndex = index;       }
     };
 
     class JACKPortGroup: public JACKPort
@@ -313,9 +320,16 @@ namespace lsp
                 return fCurrValue;
             }
 
-            void updateValue(float value)
+            /**
+             * Update value of the port, should be called from DSP thread
+             * @param value new value
+             * @return true if previous update has not been applied yet and was overridden
+             */
+            bool updateValue(float value)
             {
-                fNewValue   = limit_value(pMetadata, value);
+                bool coalesced  = (fNewValue != fCurrValue);
+                fNewValue       = limit_value(pMetadata, value);
+                return coalesced;
             }
     };
 
@@ -324,12 +338,14 @@ namespace lsp
         private:
             float       fValue;
             bool        bForce;
+            size_t      nUpdates;
 
         public:
             JACKMeterPort(const port_t *meta, JACKWrapper *w) : JACKPort(meta, w)
             {
                 fValue      = meta->start;
                 bForce      = true;
+                nUpdates    = 0;
             }
 
             virtual ~JACKMeterPort()
@@ -357,12 +373,17 @@ namespace lsp
                 }
                 else
                     fValue = value;
+
+                ++nUpdates;
             }
 
+            inline size_t updates() const   { return nUpdates; }
+
             float syncValue()
             {
                 float value = fValue;
-                bForce  = true;
+                bForce      = true;
+                nUpdates    = 0;
                 return value;
             }
     };
@@ -10,6 +10,28 @@
 
 namespace lsp
 {
+    /**
+     * Port update transferred between UI and DSP
+     */
+    typedef struct jack_port_event_t
+    {
+        uint32_t    nPort;          // Index of the port
+        float       fValue;         // Value of the port
+    } jack_port_event_t;
+
+    /**
+     * Statistics of port synchronization between UI and DSP
+     */
+    typedef struct jack_sync_stats_t
+    {
+        size_t      nUISent;        // Number of updates sent by UI to DSP
+        size_t      nUIDropped;     // Number of UI updates rejected due to queue overflow and re-submitted later
+        size_t      nUICoalesced;   // Number of UI updates overridden by newer ones before being applied
+        size_t      nDSPSent;       // Number of meter values sent by DSP to UI
+        size_t      nDSPDropped;    // Number of meter values dropped due to queue overflow
+        size_t      nDSPCoalesced;  // Number of meter values merged by DSP between two UI requests
+    } jack_sync_stats_t;
+
     typedef struct jack_path_t: public path_t
     {
         enum flags_t
@@ -36,11 +36,15 @@ namespace lsp
     {
         private:
             JACKPortGroup          *pPG;
+            float                   fValue;
+            bool                    bPending;
 
         public:
             JACKUIPortGroup(JACKPortGroup *port) : JACKUIPort(port)
             {
                 pPG                 = port;
+                fValue              = port->getValue();
+                bPending            = false;
             }
 
             virtual ~JACKUIPortGroup()
@@ -50,12 +54,23 @@ namespace lsp
         public:
             virtual float get_value()
             {
-                return pPort->getValue();
+                return fValue;
             }
 
             virtual void set_value(float value)
             {
-                pPort->setValue(value);
+                int32_t v = value;
+                if ((v < 0) || (v >= ssize_t(pPG->rows())))
+                    return;
+
+                fValue      = v;
+                bPending    = !pPort->wrapper()->submit_ui_event(pPort, fValue);
+            }
+
+            virtual void resync()
+            {
+                if (bPending)
+                    bPending    = !pPort->wrapper()->submit_ui_event(pPort, fValue);
             }
 
         public:
@@ -67,11 +82,13 @@ namespace lsp
     {
         protected:
             float           fValue;
+            bool            bPending;
 
         public:
             JACKUIControlPort(JACKPort *port): JACKUIPort(port)
             {
                 fValue      = port->getValue();
+                bPending    = false;
             }
 
             virtual ~JACKUIControlPort()
@@ -87,18 +104,24 @@ namespace lsp
 
             virtual void set_value(float value)
             {
-                fValue  = limit_value(pMetadata, value);
-                static_cast<JACKControlPort *>(pPort)->updateValue(fValue);
+                fValue      = limit_value(pMetadata, value);
+                bPending    = !pPort->wrapper()->submit_ui_event(pPort, fValue);
             }
 
             virtual void write(const void *buffer, size_t size)
             {
                 if (size == sizeof(float))
                 {
-                    fValue  = *reinterpret_cast<const float *>(buffer);
-                    static_cast<JACKControlPort *>(pPort)->updateValue(fValue);
+                    fValue      = *reinterpret_cast<const float *>(buffer);
+                    bPending    = !pPort->wrapper()->submit_ui_event(pPort, fValue);
                 }
             }
+
+            virtual void resync()
+            {
+                if (bPending)
+                    bPending    = !pPort->wrapper()->submit_ui_event(pPort, fValue);
+            }
     };
 
     class JACKUIMeterPort: public JACKUIPort
@@ -123,19 +146,16 @@ namespace lsp
                 return fValue;
             }
 
-            virtual bool sync()
+            /**
+             * Commit the value received from DSP
+             * @param value value of the meter
+             * @return true if value has changed
+             */
+            bool commit(float value)
             {
-                float value = fValue;
-
-                if (pMetadata->flags & F_PEAK)
-                {
-                    JACKMeterPort *mp = static_cast<JACKMeterPort *>(pPort);
-                    fValue      = mp->syncValue();
-                }
-                else
-                    fValue      = pPort->getValue();
-
-                return fValue != value;
+                bool changed    = (fValue != value);
+                fValue          = value;
+                return changed;
             }
     };
 
@@ -13,7 +13,8 @@
 #include <core/alloc.h>
 #include <core/IWrapper.h>
 #include <core/IPort.h>
-#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/WorkStealingExecutor.h>
+#include <core/ipc/SPSCQueue.h>
 #include <core/ICanvas.h>
 #include <container/CairoCanvas.h>
 
@@ -22,13 +23,18 @@
 
 #include <data/cvector.h>
 
+#include <container/jack/types.h>
+
 #define JACK_INLINE_DISPLAY_SIZE        128
+#define JACK_SYNC_QUEUE_SIZE            1024
 
 namespace lsp
 {
     class JACKPort;
     class JACKUIPort;
     class JACKDataPort;
+    class JACKMeterPort;
+    class JACKUIMeterPort;
     class JACKPositionPort;
 
     class JACKWrapper: public IWrapper, public IUIWrapper
@@ -62,8 +68,19 @@ namespace lsp
             cvector<JACKDataPort>   vDataPorts;
             cvector<JACKUIPort>     vUIPorts;
             cvector<JACKUIPort>     vSyncPorts;
+            cvector<JACKMeterPort>  vMeterPorts;
+            cvector<JACKUIMeterPort> vUIMeterPorts;
             cvector<port_t>         vGenMetadata;   // Generated metadata
 
+            ipc::SPSCQueue<jack_port_event_t>   sUIQueue;       // Port updates from UI to DSP
+            ipc::SPSCQueue<jack_port_event_t>   sDSPQueue;      // Meter values from DSP to UI
+            volatile uatomic_t      nSyncRequest;   // Number of meter transfers requested by UI
+            uatomic_t               nSyncDone;      // Last meter transfer request served by DSP
+            volatile uatomic_t      nUICoalesced;   // Number of UI updates overridden before being applied
+            volatile uatomic_t      nDSPCoalesced;  // Number of meter values merged between UI requests
+            size_t                  nDropReported;  // Number of dropped updates already reported
+            bool                    bUIPending;     // Some UI updates were rejected and should be re-submitted
+
         public:
             JACKWrapper(plugin_t *plugin, plugin_ui *ui)
             {
@@ -78,6 +95,12 @@ namespace lsp
                 nState          = S_CREATED;
                 nCounter        = 0;
                 nLatency        = 0;
+                nSyncRequest    = 1;
+                nSyncDone       = 0;
+                nUICoalesced    = 0;
+                nDSPCoalesced   = 0;
+                nDropReported   = 0;
+                bUIPending      = false;
 
                 position_t::init(&sPosition);
             }
@@ -100,6 +123,9 @@ namespace lsp
             static void shutdown(void *arg);
 
             int run(size_t samples);
+            void apply_ui_events();
+            void transfer_meters();
+            void receive_meters();
             int sync_position(jack_transport_state_t state, const jack_position_t *pos);
             int latency_callback(jack_latency_callback_mode_t mode);
 
@@ -118,6 +144,20 @@ namespace lsp
             void destroy();
             bool transfer_dsp_to_ui();
 
+            /**
+             * Submit new value of the port to DSP, should be called from UI thread only
+             * @param port port to update
+             * @param value new value of the port
+             * @return true on success, false if the queue is full and the value should be re-submitted later
+             */
+            bool submit_ui_event(JACKPort *port, float value);
+
+            /**
+             * Get statistics of port synchronization between UI and DSP
+             * @param stats pointer to store statistics
+             */
+            void get_sync_stats(jack_sync_stats_t *stats);
+
             inline bool initialized() const     { return nState != S_CREATED;       }
             inline bool connected() const       { return nState == S_CONNECTED;     }
             inline bool disconnected() const    { return nState == S_DISCONNECTED;  }
@@ -148,7 +188,6 @@ namespace lsp
 }
 
 #include <container/jack/defs.h>
-#include <container/jack/types.h>
 #include <container/jack/ports.h>
 #include <container/jack/ui_ports.h>
 
@@ -239,8 +278,59 @@ namespace lsp
         return 0;
     }
 
+    void JACKWrapper::apply_ui_events()
+    {
+        jack_port_event_t ev;
+
+        while (sUIQueue.pop(&ev))
+        {
+            JACKPort *port = vPorts.get(ev.nPort);
+            if (port == NULL)
+                continue;
+
+            if (port->metadata()->role == R_PORT_SET)
+            {
+                port->setValue(ev.fValue);
+                bUpdateSettings = true;
+            }
+            else if (port->metadata()->role == R_CONTROL)
+            {
+                if (static_cast<JACKControlPort *>(port)->updateValue(ev.fValue))
+                    ++nUICoalesced;
+            }
+        }
+    }
+
+    void JACKWrapper::transfer_meters()
+    {
+        // Transfer values only when UI has requested them, DSP merges all values
+        // produced between two requests
+        uatomic_t request   = nSyncRequest;
+        if (request == nSyncDone)
+            return;
+
+        jack_port_event_t ev;
+        for (size_t i=0, n=vMeterPorts.size(); i<n; ++i)
+        {
+            JACKMeterPort *mp   = vMeterPorts.at(i);
+            size_t updates      = mp->updates();
+            if (updates > 1)
+                nDSPCoalesced      += updates - 1;
+
+            ev.nPort            = i;
+            ev.fValue           = mp->syncValue();
+            if (!sDSPQueue.push(ev))
+                break;
+        }
+
+        nSyncDone           = request;
+    }
+
     int JACKWrapper::run(size_t samples)
     {
+        // Apply changes of ports made by UI
+        apply_ui_events();
+
         // Prepare ports
         size_t n_ports  = vPorts.size();
 
@@ -285,6 +375,10 @@ namespace lsp
             if (port != NULL)
                 port->post_process(samples);
         }
+
+        // Pass values of meters to UI
+        transfer_meters();
+
         return 0;
     }
 
@@ -337,16 +431,22 @@ namespace lsp
                 break;
 
             case R_METER:
-                jp      = new JACKMeterPort(port, this);
-                jup     = new JACKUIMeterPort(jp);
-                vSyncPorts.add(jup);
+            {
+                JACKMeterPort *jmp      = new JACKMeterPort(port, this);
+                JACKUIMeterPort *jump   = new JACKUIMeterPort(jmp);
+                vMeterPorts.add(jmp);
+                vUIMeterPorts.add(jump);
+                jp      = jmp;
+                jup     = jump;
                 break;
+            }
 
             case R_PORT_SET:
             {
                 char postfix_buf[LSP_MAX_PARAM_ID_BYTES];
                 JACKPortGroup       *pg      = new JACKPortGroup(port, this);
                 pg->init();
+                pg->set_index(vPorts.size());
                 vPorts.add(pg);
                 pPlugin->add_port(pg);
 
@@ -401,6 +501,7 @@ namespace lsp
                 }
             #endif /* LSP_DEBUG */
 
+            jp->set_index(vPorts.size());
             vPorts.add(jp);
             pPlugin->add_port(jp);
         }
@@ -417,6 +518,13 @@ namespace lsp
         for (const port_t *meta = pPlugin->get_metadata()->ports ; meta->id != NULL; ++meta)
             create_port(meta, NULL);
 
+        // Create synchronization queues, DSP should be able to transfer all meters at once
+        size_t dsp_queue_size   = vMeterPorts.size() * 2;
+        if (dsp_queue_size < JACK_SYNC_QUEUE_SIZE)
+            dsp_queue_size          = JACK_SYNC_QUEUE_SIZE;
+        if ((!sUIQueue.init(JACK_SYNC_QUEUE_SIZE)) || (!sDSPQueue.init(dsp_queue_size)))
+            return STATUS_NO_MEM;
+
         // Initialize plugin and UI
         if (pPlugin != NULL)
             pPlugin->init(this);
@@ -627,6 +735,20 @@ namespace lsp
         // Clear all other port containers
         vDataPorts.clear();
         vSyncPorts.clear();
+        vMeterPorts.clear();
+        vUIMeterPorts.clear();
+
+        // Destroy synchronization queues
+        #ifdef LSP_TRACE
+            jack_sync_stats_t stats;
+            get_sync_stats(&stats);
+            lsp_trace("UI -> DSP: sent=%d, dropped=%d, coalesced=%d",
+                    int(stats.nUISent), int(stats.nUIDropped), int(stats.nUICoalesced));
+            lsp_trace("DSP -> UI: sent=%d, dropped=%d, coalesced=%d",
+                    int(stats.nDSPSent), int(stats.nDSPDropped), int(stats.nDSPCoalesced));
+        #endif /* LSP_TRACE */
+        sUIQueue.destroy();
+        sDSPQueue.destroy();
 
         // Forget plugin and UI
         pUI     = NULL;
@@ -658,6 +780,17 @@ namespace lsp
         dsp::context_t ctx;
         dsp::start(&ctx);
 
+        // Re-submit changes of ports rejected due to queue overflow
+        if (bUIPending)
+        {
+            bUIPending      = false;
+            for (size_t i=0, n=vUIPorts.size(); i<n; ++i)
+                vUIPorts.at(i)->resync();
+        }
+
+        // Receive values of meters and request the next transfer
+        receive_meters();
+
         // Transfer the values of the ports to the UI
         size_t sync = vSyncPorts.size();
         for (size_t i=0; i<sync; ++i)
@@ -709,14 +842,59 @@ namespace lsp
         return true;
     }
 
+    void JACKWrapper::receive_meters()
+    {
+        jack_port_event_t ev;
+
+        while (sDSPQueue.pop(&ev))
+        {
+            JACKUIMeterPort *jup    = vUIMeterPorts.get(ev.nPort);
+            if ((jup != NULL) && (jup->commit(ev.fValue)))
+                jup->notify_all();
+        }
+
+        atomic_add(&nSyncRequest, 1);
+
+        // Report lost updates
+        size_t dropped  = sUIQueue.dropped() + sDSPQueue.dropped();
+        if (dropped != nDropReported)
+        {
+            lsp_warn("Port synchronization queue overflow: %d updates dropped", int(dropped - nDropReported));
+            nDropReported   = dropped;
+        }
+    }
+
+    bool JACKWrapper::submit_ui_event(JACKPort *port, float value)
+    {
+        jack_port_event_t ev;
+        ev.nPort        = port->index();
+        ev.fValue       = value;
+
+        if (sUIQueue.push(ev))
+            return true;
+
+        bUIPending      = true;
+        return false;
+    }
+
+    void JACKWrapper::get_sync_stats(jack_sync_stats_t *stats)
+    {
+        stats->nUISent          = sUIQueue.pushed();
+        stats->nUIDropped       = sUIQueue.dropped();
+        stats->nUICoalesced     = nUICoalesced;
+        stats->nDSPSent         = sDSPQueue.pushed();
+        stats->nDSPDropped      = sDSPQueue.dropped();
+        stats->nDSPCoalesced    = nDSPCoalesced;
+    }
+
     ipc::IExecutor *JACKWrapper::get_executor()
     {
         lsp_trace("executor = %p", reinterpret_cast<void *>(pExecutor));
         if (pExecutor != NULL)
             return pExecutor;
 
-        lsp_trace("Creating native executor service");
-        ipc::NativeExecutor *exec = new ipc::NativeExecutor();
+        lsp_trace("Creating work-stealing executor service");
+        ipc::WorkStealingExecutor *exec = new ipc::WorkStealingExecutor();
         if (exec == NULL)
             return NULL;
         if (exec->start() != STATUS_OK)
@@ -0,0 +1,341 @@
+/*
+ * baseline.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef INCLUDE_CONTAINER_TEST_BASELINE_H_
+#define INCLUDE_CONTAINER_TEST_BASELINE_H_
+
+#include <core/types.h>
+#include <core/status.h>
+#include <core/stdlib/stdio.h>
+#include <data/cstorage.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#define BASELINE_LINE_MAX       0x2000
+
+namespace lsp
+{
+    /**
+     * Baseline of performance test results loaded from the file written by
+     * the test launcher with --outformat json or --outformat csv
+     */
+    class PerformanceBaseline
+    {
+        protected:
+            typedef struct record_t
+            {
+                char       *test;           /* Full name of the test */
+                char       *key;            /* The loop indicator */
+                double      ips;            /* Performance [iterations per second] */
+            } record_t;
+
+        private:
+            cstorage<record_t>  vRecords;
+
+        protected:
+            static char        *json_string(const char *line, const char *field);
+            static bool         json_number(const char *line, const char *field, double *value);
+            static size_t       csv_split(char *line, char **fields, size_t max);
+
+            status_t            parse_json(const char *line);
+            status_t            parse_csv(char *line, ssize_t *columns);
+            status_t            add(char *test, char *key, double ips);
+
+        public:
+            explicit PerformanceBaseline() {}
+            ~PerformanceBaseline()          { clear(); }
+
+        public:
+            /**
+             * Load baseline file, the format is detected automatically
+             * @param path path to the file
+             * @return status of operation
+             */
+            status_t    load(const char *path);
+
+            /**
+             * Find performance of the test case
+             * @param test full name of the test
+             * @param key the loop indicator
+             * @param ips pointer to store performance in iterations per second
+             * @return true if the test case is present in the baseline
+             */
+            bool        find(const char *test, const char *key, double *ips);
+
+            /**
+             * Get number of records in the baseline
+             * @return number of records
+             */
+            inline size_t size() const      { return vRecords.size(); }
+
+            void        clear();
+    };
+
+    char *PerformanceBaseline::json_string(const char *line, const char *field)
+    {
+        const char *p = strstr(line, field);
+        if (p == NULL)
+            return NULL;
+        p  += strlen(field);
+        if (*(p++) != '\"')
+            return NULL;
+
+        char *buf = reinterpret_cast<char *>(malloc(strlen(p) + 1));
+        if (buf == NULL)
+            return NULL;
+
+        char *dst = buf;
+        for ( ; *p != '\"'; ++p)
+        {
+            if (*p == '\0')
+            {
+                free(buf);
+                return NULL;
+            }
+            else if (*p == '\\')
+            {
+                switch (*(++p))
+                {
+                    case 'n': *(dst++) = '\n'; break;
+                    case 'r': *(dst++) = '\r'; break;
+                    case 't': *(dst++) = '\t'; break;
+                    case 'u':
+                        // Only control characters are encoded as \uXXXX by the launcher
+                    {
+                        char hex[5];
+                        if (strlen(p) < 5)
+                        {
+                            free(buf);
+                            return NULL;
+                        }
+                        memcpy(hex, p + 1, 4);
+                        hex[4]   = '\0';
+                        *(dst++) = char(strtol(hex, NULL, 16) & 0xff);
+                        p       += 4;
+                        break;
+                    }
+                    case '\0':
+                        free(buf);
+                        return NULL;
+                    default:
+                        *(dst++) = *p;
+                        break;
+                }
+            }
+            else
+                *(dst++) = *p;
+        }
+        *dst = '\0';
+
+        return buf;
+    }
+
+    bool PerformanceBaseline::json_number(const char *line, const char *field, double *value)
+    {
+        const char *p = strstr(line, field);
+        if (p == NULL)
+            return false;
+        p      += strlen(field);
+
+        errno           = 0;
+        char *end       = NULL;
+        *value          = strtod(p, &end);
+        return (errno == 0) && (end != p);
+    }
+
+    size_t PerformanceBaseline::csv_split(char *line, char **fields, size_t max)
+    {
+        size_t n = 0;
+
+        while (n < max)
+        {
+            char *dst       = line;
+            fields[n++]     = line;
+
+            if (*line == '\"')
+            {
+                // Quoted field, doubled quotes are decoded
+                for (++line; *line != '\0'; ++line)
+                {
+                    if (*line == '\"')
+                    {
+                        if (line[1] != '\"')
+                        {
+                            ++line;
+                            break;
+                        }
+                        ++line;
+                    }
+                    *(dst++)    = *line;
+                }
+            }
+
+            while ((*line != ',') && (*line != '\0') && (*line != '\n') && (*line != '\r'))
+                *(dst++)    = *(line++);
+
+            bool last       = (*line != ',');
+            *dst            = '\0';
+            if (last)
+                break;
+            ++line;
+        }
+
+        return n;
+    }
+
+    status_t PerformanceBaseline::add(char *test, char *key, double ips)
+    {
+        record_t *rec   = vRecords.add();
+        if (rec == NULL)
+        {
+            free(test);
+            free(key);
+            return STATUS_NO_MEM;
+        }
+
+        rec->test       = test;
+        rec->key        = key;
+        rec->ips        = ips;
+        return STATUS_OK;
+    }
+
+    status_t PerformanceBaseline::parse_json(const char *line)
+    {
+        double ips;
+        if (!json_number(line, "\"ips\":", &ips))
+            return STATUS_CORRUPTED_FILE;
+
+        char *test      = json_string(line, "\"test\":");
+        char *key       = json_string(line, "\"case\":");
+        if ((test == NULL) || (key == NULL))
+        {
+            if (test != NULL)
+                free(test);
+            if (key != NULL)
+                free(key);
+            return STATUS_CORRUPTED_FILE;
+        }
+
+        return add(test, key, ips);
+    }
+
+    status_t PerformanceBaseline::parse_csv(char *line, ssize_t *columns)
+    {
+        char *fields[32];
+        size_t n = csv_split(line, fields, sizeof(fields)/sizeof(char *));
+
+        // The header defines positions of columns
+        if (columns[0] < 0)
+        {
+            for (size_t i=0; i<n; ++i)
+            {
+                if (!strcmp(fields[i], "test"))
+                    columns[0]  = i;
+                else if (!strcmp(fields[i], "case"))
+                    columns[1]  = i;
+                else if (!strcmp(fields[i], "ips"))
+                    columns[2]  = i;
+            }
+
+            return ((columns[0] >= 0) && (columns[1] >= 0) && (columns[2] >= 0)) ?
+                    STATUS_OK : STATUS_BAD_FORMAT;
+        }
+
+        if ((columns[0] >= ssize_t(n)) || (columns[1] >= ssize_t(n)) || (columns[2] >= ssize_t(n)))
+            return STATUS_CORRUPTED_FILE;
+
+        errno           = 0;
+        char *end       = NULL;
+        double ips      = strtod(fields[columns[2]], &end);
+        if ((errno != 0) || (end == fields[columns[2]]))
+            return STATUS_CORRUPTED_FILE;
+
+        char *test      = strdup(fields[columns[0]]);
+        char *key       = strdup(fields[columns[1]]);
+        if ((test == NULL) || (key == NULL))
+        {
+            if (test != NULL)
+                free(test);
+            if (key != NULL)
+                free(key);
+            return STATUS_NO_MEM;
+        }
+
+        return add(test, key, ips);
+    }
+
+    status_t PerformanceBaseline::load(const char *path)
+    {
+        clear();
+
+        FILE *fd = fopen(path, "r");
+        if (fd == NULL)
+            return STATUS_NOT_FOUND;
+
+        status_t res    = STATUS_OK;
+        ssize_t columns[3] = { -1, -1, -1 };
+        char line[BASELINE_LINE_MAX];
+
+        while (fgets(line, sizeof(line), fd) != NULL)
+        {
+            if ((strchr(line, '\n') == NULL) && (!feof(fd)))
+            {
+                res     = STATUS_OVERFLOW;
+                break;
+            }
+
+            // Skip empty lines
+            const char *p = line;
+            while ((*p == ' ') || (*p == '\t'))
+                ++p;
+            if ((*p == '\0') || (*p == '\n') || (*p == '\r'))
+                continue;
+
+            res = (*p == '{') ? parse_json(p) : parse_csv(line, columns);
+            if (res != STATUS_OK)
+                break;
+        }
+
+        fclose(fd);
+
+        if ((res == STATUS_OK) && (vRecords.size() <= 0))
+            res     = STATUS_NO_DATA;
+        if (res != STATUS_OK)
+            clear();
+
+        return res;
+    }
+
+    bool PerformanceBaseline::find(const char *test, const char *key, double *ips)
+    {
+        for (size_t i=0, n=vRecords.size(); i<n; ++i)
+        {
+            const record_t *rec = vRecords.at(i);
+            if ((!strcmp(rec->test, test)) && (!strcmp(rec->key, key)))
+            {
+                *ips    = rec->ips;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void PerformanceBaseline::clear()
+    {
+        for (size_t i=0, n=vRecords.size(); i<n; ++i)
+        {
+            record_t *rec = vRecords.at(i);
+            free(rec->test);
+            free(rec->key);
+        }
+        vRecords.flush();
+    }
+}
+
+#endif /* INCLUDE_CONTAINER_TEST_BASELINE_H_ */
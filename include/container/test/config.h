@@ -27,6 +27,13 @@ namespace lsp
         MTEST
     };
 
+    enum out_format_t
+    {
+        OUT_TEXT,
+        OUT_JSON,
+        OUT_CSV
+    };
+
     typedef struct config_t
     {
         public:
@@ -40,8 +47,11 @@ namespace lsp
             bool                        sysinfo;
             bool                        is_child;
             size_t                      threads;
+            out_format_t                outformat;
+            double                      threshold;
             const char                 *executable;
             const char                 *outfile;
+            const char                 *baseline;
             const char                 *tracepath;
             cvector<char>               list;
             cvector<char>               ignore;
@@ -74,6 +84,8 @@ namespace lsp
         fputs("    mtest                 Manual testing subsystem\n", out);
         fputs("  Additional arguments:\n", out);
         fputs("    -a, --args [args...]  Pass arguments to test\n", out);
+        fputs("    -b, --baseline file   Compare performance test results with the baseline file\n", out);
+        fputs("                          previously written with --outformat json or csv\n", out);
         fputs("    -d, --debug           Disable time restrictions for unit tests\n", out);
         fputs("                          for debugging purposes\n", out);
         fputs("    -e, --execute         Launch tests specified after this switch\n", out);
@@ -92,9 +104,13 @@ namespace lsp
     #endif /* PLATFORM_LINUX */
         fputs("    -nsi, --nosysinfo     Do not output system information\n", out);
         fputs("    -o, --outfile file    Output performance test statistics to specified file\n", out);
+        fputs("    -of, --outformat fmt  Format of the output file: text (default), json\n", out);
+        fputs("                          (one JSON object per line) or csv\n", out);
         fputs("    -s, --silent          Do not output additional information from tests\n", out);
         fputs("    -si, --sysinfo        Output system information\n", out);
         fputs("    -t, --tracepath path  Override default trace path with specified value\n", out);
+        fputs("    -th, --threshold pct  Performance drop relative to the baseline in percent\n", out);
+        fputs("                          treated as regression (default 5)\n", out);
         fputs("    -v, --verbose         Output additional information from tests\n", out);
 
         return STATUS_INSUFFICIENT;
@@ -200,6 +216,53 @@ namespace lsp
                 }
                 outfile     = argv[i];
             }
+            else if ((!strcmp(argv[i], "--outformat")) || (!strcmp(argv[i], "-of")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified format of output file\n");
+                    return STATUS_INVALID_VALUE;
+                }
+
+                if (!strcasecmp(argv[i], "text"))
+                    outformat   = OUT_TEXT;
+                else if (!strcasecmp(argv[i], "json"))
+                    outformat   = OUT_JSON;
+                else if (!strcasecmp(argv[i], "csv"))
+                    outformat   = OUT_CSV;
+                else
+                {
+                    fprintf(stderr, "Invalid value for --outformat parameter: %s\n", argv[i]);
+                    return STATUS_INVALID_VALUE;
+                }
+            }
+            else if ((!strcmp(argv[i], "--baseline")) || (!strcmp(argv[i], "-b")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified name of baseline file\n");
+                    return STATUS_INVALID_VALUE;
+                }
+                baseline    = argv[i];
+            }
+            else if ((!strcmp(argv[i], "--threshold")) || (!strcmp(argv[i], "-th")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified value for --threshold parameter\n");
+                    return STATUS_INVALID_VALUE;
+                }
+
+                errno           = 0;
+                char *end       = NULL;
+                double value    = strtod(argv[i], &end);
+                if ((errno != 0) || ((*end) != '\0') || (value < 0.0) || (value >= 100.0))
+                {
+                    fprintf(stderr, "Invalid value for --threshold parameter: %s\n", argv[i]);
+                    return STATUS_INVALID_VALUE;
+                }
+                threshold       = value;
+            }
             else if ((!strcmp(argv[i], "--args")) || (!strcmp(argv[i], "-a")))
             {
                 while (++i < argc)
@@ -259,6 +322,9 @@ namespace lsp
         executable  = NULL;
         tracepath   = "/tmp/lsp-plugins-trace";
         outfile     = NULL;
+        baseline    = NULL;
+        outformat   = OUT_TEXT;
+        threshold   = 5.0;
         threads     = 1;
 
 #if defined(PLATFORM_WINDOWS)
@@ -10,6 +10,7 @@
 
 #include <container/test/types.h>
 #include <container/test/config.h>
+#include <container/test/baseline.h>
 #include <data/cstorage.h>
 #include <core/io/charset.h>
 #include <errno.h>
@@ -35,6 +36,7 @@ namespace lsp
             task_t             *vTasks;
             config_t           *pCfg;
             stats_t            *pStats;
+            PerformanceBaseline sBaseline;
 #ifdef PLATFORM_WINDOWS
             HANDLE              hThread;
             HANDLE              hTimer;
@@ -47,6 +49,7 @@ namespace lsp
             status_t    launch(test::UnitTest *test);
             status_t    launch(test::PerformanceTest *test);
             status_t    launch(test::ManualTest *test);
+            status_t    compare_with_baseline(test::PerformanceTest *test);
 
             // Platform-dependent routines
             status_t    submit_task(task_t *task);
@@ -136,6 +139,18 @@ namespace lsp
         pCfg        = config;
         pStats      = stats;
 
+        // Load baseline for comparison of performance test results
+        if ((config->mode == PTEST) && (config->baseline != NULL))
+        {
+            status_t res    = sBaseline.load(config->baseline);
+            if (res != STATUS_OK)
+            {
+                fprintf(stderr, "Error loading baseline file '%s', code=%d\n", config->baseline, int(res));
+                fflush(stderr);
+                return res;
+            }
+        }
+
         return STATUS_OK;
     }
 
@@ -171,6 +186,10 @@ namespace lsp
                 else
                     pStats->failed.add(test);
             }
+
+            // Performance regression fails the test but does not stop execution of other tests
+            if ((res == STATUS_FAILED) && (!pCfg->is_child))
+                return STATUS_OK;
             return res;
         }
 
@@ -290,18 +309,76 @@ namespace lsp
             FILE *fd = fopen(pCfg->outfile, "a");
             if (fd != NULL)
             {
-                fprintf(fd, "--------------------------------------------------------------------------------\n");
-                fprintf(fd, "Statistics of performance test '%s':\n\n", test->full_name());
-                test->dump_stats(fd);
-                fprintf(fd, "\n");
+                dsp::info_t *info = (pCfg->outformat != OUT_TEXT) ? dsp::info() : NULL;
+
+                switch (pCfg->outformat)
+                {
+                    case OUT_JSON:
+                        test->dump_json(fd, info);
+                        break;
+                    case OUT_CSV:
+                        test->dump_csv(fd, info);
+                        break;
+                    default:
+                        fprintf(fd, "--------------------------------------------------------------------------------\n");
+                        fprintf(fd, "Statistics of performance test '%s':\n\n", test->full_name());
+                        test->dump_stats(fd);
+                        fprintf(fd, "\n");
+                        break;
+                }
+
+                if (info != NULL)
+                    free(info);
                 fflush(fd);
                 fclose(fd);
             }
         }
 
+        // Compare with baseline
+        status_t res = (sBaseline.size() > 0) ? compare_with_baseline(test) : STATUS_OK;
+
         test->free_stats();
 
-        return STATUS_OK;
+        return res;
+    }
+
+    status_t TestExecutor::compare_with_baseline(test::PerformanceTest *test)
+    {
+        size_t regressions  = 0;
+        double threshold    = 1.0 - pCfg->threshold * 0.01;
+
+        printf("\nComparison of performance test '%s' with baseline (threshold: %.2f%%):\n",
+                test->full_name(), pCfg->threshold);
+
+        for (size_t i=0, n=test->stats_count(); i<n; ++i)
+        {
+            const test::PerformanceTest::stats_t *stats = test->stats_at(i);
+            if ((stats->key == NULL) || (stats->count <= 0) || (stats->seconds <= 0.0))
+                continue;
+
+            double ips      = stats->count / stats->seconds;
+            double base     = 0.0;
+            if (!sBaseline.find(test->full_name(), stats->key, &base))
+            {
+                printf("  %-40s %12s i/s -> %12.2f i/s\n", stats->key, "n/a", ips);
+                continue;
+            }
+
+            bool regression = ips < (base * threshold);
+            if (regression)
+                ++regressions;
+
+            printf("  %-40s %12.2f i/s -> %12.2f i/s %+8.2f%%%s\n",
+                    stats->key, base, ips, (base > 0.0) ? 100.0 * (ips - base) / base : 0.0,
+                    (regression) ? "  REGRESSION" : "");
+        }
+
+        if (regressions <= 0)
+            return STATUS_OK;
+
+        printf("Performance test '%s' has %d regression(s) relative to baseline\n",
+                test->full_name(), int(regressions));
+        return STATUS_FAILED;
     }
 
     status_t TestExecutor::launch(test::ManualTest *test)
@@ -517,6 +594,27 @@ namespace lsp
             res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--outfile");
             if (res == STATUS_OK)
                 res     = cmdline_append_escaped(&cmdbuf, &len, &cap, pCfg->outfile);
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--outformat");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap,
+                        (pCfg->outformat == OUT_JSON) ? "json" :
+                        (pCfg->outformat == OUT_CSV) ? "csv" :
+                        "text"
+                    );
+        }
+        if ((res == STATUS_OK) && (pCfg->baseline != NULL))
+        {
+            char threshold[32];
+            snprintf(threshold, sizeof(threshold), "%f", pCfg->threshold);
+
+            res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--baseline");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, pCfg->baseline);
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--threshold");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, threshold);
         }
         if (res == STATUS_OK)
             res     = cmdline_append_escaped(&cmdbuf, &len, &cap, task->test->full_name());
@@ -73,6 +73,13 @@ namespace lsp
              */
             inline size_t size() const { return sRays.size();  }
 
+            /** Get raytrace stored in the stack without extracting it
+             *
+             * @param index index of the raytrace, zero is the bottom of the stack
+             * @return pointer to raytrace or NULL if index is out of range
+             */
+            inline raytrace3d_t *get(size_t index) { return sRays.get(index); }
+
             /** Get current capacity of the raytrace stack
              *
              * @return current capacity of the raytrace stack
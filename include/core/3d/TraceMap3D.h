@@ -13,8 +13,10 @@
 #include <core/3d/Object3D.h>
 #include <core/3d/TraceCapture3D.h>
 #include <core/3d/RaySource3D.h>
+#include <core/ipc/Semaphore.h>
 
 #include <data/cvector.h>
+#include <data/cstorage.h>
 
 namespace lsp
 {
@@ -40,14 +42,71 @@ namespace lsp
                 segment_t      *pSeg[DSP_3D_MAXISECT];
             } capture3d_t;
 
+            typedef struct bvh_ref_t
+            {
+                triangle3d_t   *pTriangle;      // Triangle
+                segment_t      *pSeg;           // Segment that holds triangle
+                point3d_t       sMin;           // Minimum coordinates of triangle
+                point3d_t       sMax;           // Maximum coordinates of triangle
+                point3d_t       sCenter;        // Centroid of triangle bounds
+            } bvh_ref_t;
+
+            typedef struct bvh_node_t
+            {
+                point3d_t       sMin;           // Minimum coordinates of node bounds
+                point3d_t       sMax;           // Maximum coordinates of node bounds
+                size_t          nFirst;         // Leaf: index of first reference, inner node: index of right child
+                size_t          nCount;         // Leaf: number of references, inner node: zero
+            } bvh_node_t;
+
+            typedef struct bvh_ray_t
+            {
+                float           vOrigin[3];     // Ray origin
+                float           vDir[3];        // Ray direction
+                float           vInvDir[3];     // Inverted ray direction
+                float           fScale;         // Squared length of direction vector
+            } bvh_ray_t;
+
+            typedef struct capture_event_t
+            {
+                TraceCapture3D *pCapture;       // Capture that has been triggered
+                vector3d_t      sDirection;     // Direction vector
+                float           fAmplitude;     // Amplitude of the signal
+                float           fDelay;         // Delay of the signal in seconds
+            } capture_event_t;
+
+            typedef struct worker_t
+            {
+                TraceMap3D                 *pMap;       // Trace map
+                RayTrace3D                 *pRays;      // Shared set of primary rays
+                size_t                      nFirst;     // First primary ray in processing order
+                size_t                      nCount;     // Number of primary rays to process
+                Scene3D                    *pScene;     // Scene for debugging
+                cstorage<capture_event_t>   vEvents;    // Private capture buffer of the current batch
+                ipc::Semaphore              sStart;     // Next batch of rays is ready or worker should exit
+                ipc::Semaphore              sDone;      // Batch of rays has been processed
+                status_t                    nResult;    // Result of batch processing
+                bool                        bExit;      // Worker thread should exit
+            } worker_t;
+
         protected:
             segment_t              *pRoot;
+            bvh_ref_t              *vBvhRefs;
+            bvh_node_t             *vBvhNodes;
+            size_t                  nBvhNodes;
+            size_t                  nThreads;
             cvector<RaySource3D>    vSources;
             cvector<TraceCapture3D> vCaptures;
 
         protected:
             static bool has_triangle(const intersection3d_t *is, const triangle3d_t *t);
+            static float check_bvh_node(const bvh_node_t *node, const bvh_ray_t *r);
+            size_t  build_bvh_node(size_t first, size_t count, size_t depth);
+            bool    build_bvh();
+            void    destroy_bvh();
             void    raytrace_step(capture3d_t *ix, const raytrace3d_t *rt);
+            status_t raytrace_rays(worker_t *w);
+            static status_t worker_proc(void *arg);
 
         public:
             TraceMap3D();
@@ -69,7 +128,22 @@ namespace lsp
              */
             bool    add_source(RaySource3D *rs);
 
-            /** Execute raytracing algorithm
+            /** Set number of threads used for raytracing
+             *
+             * @param threads number of threads, zero means the number of system cores
+             */
+            inline void set_threads(size_t threads) { nThreads = threads; }
+
+            /** Get number of threads used for raytracing
+             *
+             * @return number of threads, zero means the number of system cores
+             */
+            inline size_t get_threads() const { return nThreads; }
+
+            /** Execute raytracing algorithm. Primary rays are processed in batches,
+             * each batch is split into contiguous ranges between worker threads and
+             * captures are applied in the order of primary rays after the batch has
+             * been processed, so the result does not depend on the number of threads
              * @param rays number of rays to use
              * @param s 3D scene for interactive debugging, NULL if no debugging needed
              * @return status of operation
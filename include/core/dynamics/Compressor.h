@@ -9,6 +9,7 @@
 #define CORE_DYNAMICS_COMPRESSOR_H_
 
 #include <core/types.h>
+#include <dsp/dsp.h>
 
 namespace lsp
 {
@@ -41,6 +42,7 @@ namespace lsp
             float       fKS;            // Knee start
             float       fKE;            // Knee end
             float       fLogTH;         // Logarithmic threshold
+            dsp::dyn_knee_t sKnee;          // Gain curve
 
             // Additional parameters
             size_t      nSampleRate;
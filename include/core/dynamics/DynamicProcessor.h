@@ -14,6 +14,7 @@ namespace lsp
 {
     #define DYNAMIC_PROCESSOR_DOTS      4
     #define DYNAMIC_PROCESSOR_RANGES    (DYNAMIC_PROCESSOR_DOTS + 1)
+    #define DYNAMIC_PROCESSOR_BUF_SIZE  0x100
     
     typedef struct dyndot_t
     {
@@ -81,6 +82,8 @@ namespace lsp
             void                    sort_reactions(reaction_t *s, size_t count);
             void                    sort_splines(spline_t *s, size_t count);
             static inline float     solve_reaction(const reaction_t *s, float x, size_t count);
+            void                    amp_gain(float *lx, size_t count);
+            void                    model_gain(float *lx, size_t count);
 
         public:
             DynamicProcessor();
@@ -9,6 +9,7 @@
 #define CORE_DYNAMICS_EXPANDER_H_
 
 #include <core/types.h>
+#include <dsp/dsp.h>
 
 namespace lsp
 {
@@ -37,6 +38,7 @@ namespace lsp
             float       fLogKS;         // Knee start
             float       fLogKE;         // Knee end
             float       fLogTH;         // Logarithmic threshold
+            dsp::dyn_knee_t sKnee;          // Gain curve
 
             // Additional parameters
             size_t      nSampleRate;
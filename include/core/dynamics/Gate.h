@@ -9,6 +9,7 @@
 #define CORE_DYNAMICS_GATE_H_
 
 #include <core/types.h>
+#include <dsp/dsp.h>
 
 namespace lsp
 {
@@ -24,6 +25,7 @@ namespace lsp
                 float       fLogZS;
                 float       fLogZE;
                 float       vHermite[4];
+                dsp::dyn_knee_t sKnee;      // Gain curve
             } curve_t;
 
         protected:
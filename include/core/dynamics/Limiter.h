@@ -14,6 +14,7 @@
 #define LIMITER_PATCHES_MAX         256
 #define LIMITER_PEAKS_MAX           32
 #define LIMITER_LOG_PATCHES_MAX     128
+#define LIMITER_PEAK_BLOCK          64
 
 namespace lsp
 {
@@ -140,6 +141,8 @@ namespace lsp
             // Pre-calculated parameters
             float      *vGainBuf;
             float      *vTmpBuf;
+            float      *vPeakBuf;           // Sidechain signal multiplied by gain
+            float      *vPeakTree;          // Segment tree of maximums of vPeakBuf blocks
             uint8_t    *vData;
 
             Delay       sDelay;
@@ -176,6 +179,12 @@ namespace lsp
 //            void            process_exp(float *dst, float *gain, const float *src, const float *sc, size_t samples);
 //            void            process_line(float *dst, float *gain, const float *src, const float *sc, size_t samples);
 
+            void            build_peak_tree(const float *gbuf, size_t samples);
+            void            update_peak_tree(const float *gbuf, ssize_t first, ssize_t last, size_t samples);
+            size_t          find_peaks(peak_t *peaks, size_t samples);
+            void            apply_patch(float *gbuf, ssize_t time, float amp, size_t samples);
+            void            limit_peaks(float *gbuf, size_t samples, float knee);
+
             void            process_patch(float *dst, float *gain, const float *src, const float *sc, size_t samples);
             void            process_mixed(float *dst, float *gain, const float *src, const float *sc, size_t samples);
 
@@ -32,6 +32,20 @@ namespace lsp
                 float      *vChannels[];
             } temporary_buffer_t;
 
+            typedef struct resampler_t
+            {
+                const float        *vKernel;        // Polyphase kernel table, rows of nTaps samples
+                size_t              nPhases;        // Interpolation factor
+                size_t              nStep;          // Decimation factor
+                size_t              nTaps;          // Number of kernel taps per phase, multiple of 4
+                size_t              nHalf;          // Half-length of the kernel in taps
+                bool                bScatter;       // Scatter source samples instead of gathering output samples
+                const file_content_t *pSrc;         // Source data
+                file_content_t     *pDst;           // Destination data
+                size_t              nFirst;         // First output sample to process
+                size_t              nCount;         // Number of output samples to process
+            } resampler_t;
+
             file_content_t *pData;
 
         protected:
@@ -44,10 +58,10 @@ namespace lsp
             static size_t fill_temporary_buffer(temporary_buffer_t *buffer, size_t max_samples);
             static void destroy_temporary_buffer(temporary_buffer_t *buffer);
 
-            status_t fast_downsample(size_t new_sample_rate);
-            status_t fast_upsample(size_t new_sample_rate);
-            status_t complex_upsample(size_t new_sample_rate);
-            status_t complex_downsample(size_t new_sample_rate);
+            static status_t resample_worker(void *arg);
+            static void resample_range(const resampler_t *r);
+            static void scatter_range(const resampler_t *r);
+            static void gather_range(const resampler_t *r);
 
             status_t load_lspc(const char *path, float max_duration);
             status_t load_sndfile(const char *path, float max_duration);
@@ -141,7 +155,8 @@ namespace lsp
              */
             bool reverse(ssize_t track_id = -1);
 
-            /** Resample file
+            /** Resample file using the polyphase Lanczos filter of the rational ratio
+             * between sample rates, long files are processed by several threads
              *
              * @param new_sample_rate new sample rate
              * @return status of operation
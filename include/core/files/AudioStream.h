@@ -0,0 +1,138 @@
+/*
+ * AudioStream.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_FILES_AUDIOSTREAM_H_
+#define CORE_FILES_AUDIOSTREAM_H_
+
+#include <core/types.h>
+#include <core/files/LSPCFile.h>
+#include <core/files/lspc/LSPCAudioReader.h>
+#include <dsp/atomic.h>
+
+namespace lsp
+{
+    /**
+     * Disk-backed audio file: only the head of the file is decoded and kept
+     * in memory, the rest of the file is read on demand by the I/O thread
+     * (see AudioStreamer). The random-access read() method is not thread-safe
+     * and should be called from one thread only.
+     */
+    class AudioStream
+    {
+        private:
+            size_t              nChannels;
+            size_t              nSamples;       // Total number of samples per channel
+            size_t              nSampleRate;
+            size_t              nHead;          // Number of samples in the resident head
+
+            float              *vHead;          // Resident head, nHead samples per channel
+            float              *vFrames;        // Buffer for interleaved frames
+            uint8_t            *pData;
+
+            void               *hSndFile;       // libsndfile handle
+            LSPCFile           *pFile;          // LSPC file
+            LSPCAudioReader    *pReader;        // LSPC audio reader
+            uint32_t            nChunkId;       // LSPC audio chunk identifier
+            size_t              nSkip;          // Number of frames to skip at the beginning of LSPC audio chunk
+            size_t              nPosition;      // Current read position in frames
+
+            volatile atomic_t   nReferences;    // Number of streamer cursors using the stream
+
+        protected:
+            status_t            open_lspc(const char *path);
+            status_t            open_sndfile(const char *path);
+            status_t            init_buffers(size_t head);
+            status_t            seek(size_t offset);
+            ssize_t             read_frames(size_t count);
+
+        public:
+            AudioStream();
+            ~AudioStream();
+
+        public:
+            /** Open the file for streaming and load the head of the file into memory
+             *
+             * @param path path to the file
+             * @param head number of samples per channel to keep resident
+             * @return status of operation
+             */
+            status_t open(const char *path, size_t head);
+
+            /** Close the file and free all allocated resources
+             *
+             * @return status of operation, STATUS_BAD_STATE if the stream is still used by a streamer
+             */
+            status_t close();
+
+            /** Read the data of the single channel directly from the file,
+             * should be called from the I/O thread only
+             *
+             * @param channel channel to read
+             * @param dst destination buffer
+             * @param offset offset of the first sample from the beginning of the file
+             * @param count number of samples to read
+             * @return number of samples read or negative error code
+             */
+            ssize_t read(size_t channel, float *dst, size_t offset, size_t count);
+
+            /** Return number of channels
+             *
+             * @return number of channels
+             */
+            inline size_t channels() const { return nChannels; }
+
+            /** Return number of samples per channel
+             *
+             * @return number of samples per channel
+             */
+            inline size_t samples() const { return nSamples; }
+
+            /** Return sample rate of the file
+             *
+             * @return sample rate
+             */
+            inline size_t sample_rate() const { return nSampleRate; }
+
+            /** Return number of samples per channel kept resident in memory
+             *
+             * @return length of the resident head
+             */
+            inline size_t head_length() const { return nHead; }
+
+            /** Get resident head of the channel
+             *
+             * @param channel channel number
+             * @return pointer to the head data or NULL
+             */
+            inline const float *head(size_t channel) const { return (channel < nChannels) ? &vHead[channel * nHead] : NULL; }
+
+            /** Check that the stream is opened
+             *
+             * @return true if the stream is opened
+             */
+            inline bool valid() const { return (vHead != NULL) && (nChannels > 0) && (nSamples > 0); }
+
+            /** Check that the stream is currently referenced by streamer cursors
+             *
+             * @return true if the stream can not be closed yet
+             */
+            inline bool in_use() const { return nReferences > 0; }
+
+            /** Increment number of references to the stream
+             *
+             */
+            inline void acquire() { atomic_add(&nReferences, 1); }
+
+            /** Decrement number of references to the stream
+             *
+             */
+            inline void release() { atomic_add(&nReferences, -1); }
+    };
+
+} /* namespace lsp */
+
+#endif /* CORE_FILES_AUDIOSTREAM_H_ */
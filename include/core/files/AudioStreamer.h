@@ -0,0 +1,147 @@
+/*
+ * AudioStreamer.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_FILES_AUDIOSTREAMER_H_
+#define CORE_FILES_AUDIOSTREAMER_H_
+
+#include <core/types.h>
+#include <core/ipc/Thread.h>
+#include <core/files/AudioStream.h>
+#include <dsp/atomic.h>
+
+namespace lsp
+{
+    /**
+     * Background I/O thread that prefetches fixed-size blocks of audio streams
+     * for the real-time thread. Each playing voice acquires a cursor which owns
+     * a ring of blocks following the playback position, so the memory consumed by
+     * the streamer does not depend on the length of streamed files.
+     *
+     * The acquire(), release() and read() methods are lock-free and should be called
+     * from the single real-time thread.
+     */
+    class AudioStreamer
+    {
+        protected:
+            enum block_state_t
+            {
+                BS_IDLE,                        // Block is not used
+                BS_REQUEST,                     // Block is requested by the real-time thread
+                BS_LOADING,                     // Block is being loaded by the I/O thread
+                BS_READY                        // Block contains valid data
+            };
+
+            enum cursor_state_t
+            {
+                CS_FREE,                        // Cursor is free
+                CS_SETUP,                       // Cursor is being initialized by the real-time thread
+                CS_ACTIVE,                      // Cursor is served by the I/O thread
+                CS_RELEASED                     // Cursor is released by the real-time thread but still references the stream
+            };
+
+            typedef struct block_t
+            {
+                volatile atomic_t   nState;     // State of the block
+                volatile size_t     nIndex;     // Requested block index
+                size_t              nLoaded;    // Index of the loaded block
+                size_t              nLength;    // Number of valid samples in the block
+                float              *vData;      // Block data
+            } block_t;
+
+        public:
+            typedef struct cursor_t
+            {
+                volatile atomic_t   nState;     // State of the cursor
+                AudioStream        *pStream;    // Stream
+                size_t              nChannel;   // Channel of the stream
+                volatile size_t     nFirst;     // Index of the first block in the prefetch window
+                block_t            *vBlocks;    // Ring of prefetched blocks
+            } cursor_t;
+
+        private:
+            cursor_t           *vCursors;
+            size_t              nCursors;
+            size_t              nBlocks;        // Number of blocks per cursor
+            size_t              nBlockSize;     // Size of block in samples
+            ipc::Thread        *pWorker;        // Background I/O thread
+            volatile atomic_t   nUnderruns;     // Number of samples not delivered in time
+            uint8_t            *pData;
+
+        protected:
+            static status_t     worker(void *arg);
+
+            bool                serve(cursor_t *c);
+            void                move_window(cursor_t *c, size_t first);
+
+        public:
+            AudioStreamer();
+            ~AudioStreamer();
+
+        public:
+            /** Initialize streamer and start the I/O thread
+             *
+             * @param cursors maximum number of simultaneously streamed voices
+             * @param blocks number of prefetched blocks per voice
+             * @param block_size size of each block in samples
+             * @return status of operation
+             */
+            status_t init(size_t cursors, size_t blocks, size_t block_size);
+
+            /** Stop the I/O thread and free all allocated resources
+             *
+             */
+            void destroy();
+
+            /** Acquire cursor for streaming the channel of the audio stream
+             *
+             * @param stream audio stream
+             * @param channel channel of the stream
+             * @return cursor or NULL if there are no free cursors
+             */
+            cursor_t *acquire(AudioStream *stream, size_t channel);
+
+            /** Release the cursor, the stream reference will be dropped by the I/O thread
+             *
+             * @param c cursor to release
+             */
+            void release(cursor_t *c);
+
+            /** Read data of the stream, the head of the stream is read from memory,
+             * the rest from the prefetched blocks. Samples of blocks that have not
+             * been loaded yet are replaced by zeros. The offset should not decrease
+             * between subsequent calls.
+             *
+             * @param c cursor
+             * @param dst destination buffer
+             * @param offset offset of the first sample from the beginning of the stream
+             * @param count number of samples to read
+             * @return number of samples located before the end of the stream
+             */
+            size_t read(cursor_t *c, float *dst, size_t offset, size_t count);
+
+            /** Get number of blocks that are requested but not loaded yet
+             *
+             * @return number of pending blocks
+             */
+            size_t pending() const;
+
+            /** Get total number of samples that were not delivered in time
+             *
+             * @return number of underrun samples
+             */
+            inline size_t underruns() const { return nUnderruns; }
+
+            /** Get size of the prefetch block
+             *
+             * @return size of the prefetch block in samples
+             */
+            inline size_t block_size() const { return nBlockSize; }
+    };
+
+} /* namespace lsp */
+
+#endif /* CORE_FILES_AUDIOSTREAMER_H_ */
@@ -41,10 +41,13 @@ namespace lsp
         protected:
             filter_t           *vFilters;           // Array of filters
             f_cascade_t        *vCascades;          // Analog filter cascade bank
+            f_cascade_t        *vKeys;              // Key analog filter cascades for interpolation
+            float              *vKeyGain;           // Gain values for key cascades
             float              *vMemory;            // Filter memory
             biquad_bank_t       vBiquads;           // Biquad bank
             size_t              nFilters;           // Number of filters
             size_t              nSampleRate;        // Sample rate
+            size_t              nStep;              // Interpolation step
             void               *pData;              // Aligned pointer data
             bool                bClearMem;          // Clear memory
 
@@ -77,6 +80,21 @@ namespace lsp
              */
             void set_sample_rate(size_t sr);
 
+            /** Set interpolation step. Exact filter coefficients will be computed only
+             * for each step'th sample, coefficients of other samples will be linearly
+             * interpolated
+             *
+             * @param step interpolation step in samples, values less than 2 enable
+             *      computation of exact coefficients for each sample
+             */
+            void set_interpolation(size_t step);
+
+            /** Get interpolation step
+             *
+             * @return interpolation step in samples
+             */
+            inline size_t get_interpolation() const { return nStep; }
+
             /** Destroy the dynamic filters set
              *
              */
@@ -14,6 +14,13 @@ namespace lsp
 {
     class FilterBank
     {
+        public:
+            enum constants_t
+            {
+                MAX_CHANNELS    = 8,        // Maximum number of channels processed in lockstep
+                BUF_SIZE        = 0x100     // Size of interleave buffer in frames
+            };
+
         protected:
             biquad_t           *vFilters;   // Optimized list of filters
             biquad_x1_t        *vChains;    // List of biquad banks
@@ -21,10 +28,16 @@ namespace lsp
             size_t              nMaxItems;  // Maximum number of biquad_x1 filters
             size_t              nLastItems; // Previous number of biquad_x1 filters
             float              *vBackup;    // Delay backup to take online impulse response
+            float              *vBuffer;    // Interleave buffer for multi-channel mode
+            size_t              nChannels;  // Number of channels
+            size_t              nLanes;     // Number of SIMD lanes used for multi-channel processing
+            size_t              vChItems[MAX_CHANNELS]; // Current number of biquad_x1 filters per channel
             uint8_t            *vData;      // Unaligned data
 
         protected:
             void        clear_delays();
+            size_t      banks() const;
+            void        end_multichannel();
 
         public:
             FilterBank();
@@ -33,10 +46,13 @@ namespace lsp
         public:
             /** Initialize filter bank
              *
-             * @param filters number of biquad filters
+             * @param filters number of biquad filters (per channel)
+             * @param channels number of channels processed in lockstep, 1 to MAX_CHANNELS.
+             *      For more than one channel, the same cascade structure is applied to
+             *      all channels at once, each channel occupies it's own SIMD lane
              * @return true on success
              */
-            bool                init(size_t filters);
+            bool                init(size_t filters, size_t channels = 1);
 
             /** Destroy filter bank
              *
@@ -50,6 +66,8 @@ namespace lsp
             {
                 nLastItems      = nItems;
                 nItems          = 0;
+                for (size_t i=0; i<nChannels; ++i)
+                    vChItems[i]     = 0;
             }
 
             /** Add cascade to biquad filter
@@ -58,12 +76,20 @@ namespace lsp
              */
             biquad_x1_t        *add_chain();
 
+            /** Add cascade to biquad filter of the specified channel
+             * in multi-channel mode
+             *
+             * @param channel channel number
+             * @return added cascade or NULL on invalid channel
+             */
+            biquad_x1_t        *add_chain(size_t channel);
+
             /** Optimize structure of filter bank
              * @param clear force to clear delays
              */
             void                end(bool clear = false);
 
-            /** Process samples
+            /** Process samples in single-channel mode
              *
              * @param out output buffer
              * @param in input buffer
@@ -71,6 +97,14 @@ namespace lsp
              */
             void                process(float *out, const float *in, size_t samples);
 
+            /** Process samples of all channels in multi-channel mode
+             *
+             * @param out list of output buffers, one per channel
+             * @param in list of input buffers, one per channel
+             * @param samples number of samples to process
+             */
+            void                process(float **out, const float **in, size_t samples);
+
             /** Get impulse response of the bank
              *
              * @param out output buffer to store impulse response
@@ -78,12 +112,28 @@ namespace lsp
              */
             void                impulse_response(float *out, size_t samples);
 
+            /** Get impulse response of the bank for the specified channel
+             * in multi-channel mode
+             *
+             * @param out output buffer to store impulse response
+             * @param samples length of buffer in samples
+             * @param channel channel number
+             */
+            void                impulse_response(float *out, size_t samples, size_t channel);
+
             /** Get number of biquad filters
              *
-             * @return number of biquad filters
+             * @return number of biquad filters, maximum number of filters
+             *      per channel in multi-channel mode
              */
             inline size_t       size() const { return nItems; }
 
+            /** Get number of channels
+             *
+             * @return number of channels
+             */
+            inline size_t       channels() const { return nChannels; }
+
             /** Reset internal state of filters (clear filter memory)
              *
              */
@@ -37,19 +37,11 @@ namespace lsp
                     return next;
                 }
 
-                static inline void run_task(ITask *task)
-                {
-                    // Enable DSP context for executor service
-                    dsp::context_t ctx;
-                    dsp::start(&ctx);
-
-                    task->nState    = ITask::TS_RUNNING;
-                    task->nCode     = 0;
-                    task->nCode     = task->run();
-                    task->nState    = ITask::TS_COMPLETED;
-
-                    dsp::finish(&ctx);
-                }
+                /** Execute the task and the chain of it's continuations
+                 *
+                 * @param task task to execute
+                 */
+                static void run_task(ITask *task);
 
             private:
                 IExecutor &operator = (const IExecutor &src);       // Deny copying
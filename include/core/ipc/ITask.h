@@ -15,6 +15,17 @@ namespace lsp
 {
     namespace ipc
     {
+        class ITask;
+
+        /**
+         * Task completion callback, called by the executor in the executor's thread
+         * after the task has finished and before the task state is set to completed
+         *
+         * @param task the task that has finished
+         * @param arg the argument passed to ITask::set_callback()
+         */
+        typedef void (* task_callback_t)(ITask *task, void *arg);
+
         class ITask: public IRunnable
         {
             public:
@@ -33,6 +44,12 @@ namespace lsp
 
                 // Task state
                 volatile task_state_t    nState;
+                volatile bool            bCancelled;
+
+                // Continuation and completion callback
+                ITask              *pContinuation;
+                task_callback_t     pCallback;
+                void               *pCallbackArg;
 
                 // Executor service
                 friend class IExecutor;
@@ -89,7 +106,68 @@ namespace lsp
                  */
                 inline task_state_t state() const {return nState;                   };
 
-                /** Reset task state
+                /** Check that cancellation of the task has been requested,
+                 * long-running tasks should periodically check the flag and
+                 * return STATUS_CANCELLED as soon as possible
+                 *
+                 * @return true if cancellation has been requested
+                 */
+                inline bool cancelled() const   { return bCancelled;                };
+
+                /** Request cancellation of the task. Submitted task is completed
+                 * with STATUS_CANCELLED code without being executed, running task
+                 * should check the cancelled() flag by itself
+                 *
+                 * @return false if the task is already completed
+                 */
+                inline bool cancel()
+                {
+                    if (nState == TS_COMPLETED)
+                        return false;
+                    bCancelled  = true;
+                    return true;
+                }
+
+                /** Get continuation of the task
+                 *
+                 * @return continuation of the task or NULL
+                 */
+                inline ITask *continuation() const { return pContinuation;          };
+
+                /** Set continuation of the task: the task that will be executed by
+                 * the same executor right after this task has successfully completed.
+                 * If this task fails or is cancelled, the continuation is completed
+                 * without being executed with the same code. Continuations can be
+                 * chained, the continuation should be in idle state when this task
+                 * completes, otherwise it is ignored
+                 *
+                 * @param task continuation task or NULL to clear continuation
+                 * @return false if the task is not idle
+                 */
+                inline bool set_continuation(ITask *task)
+                {
+                    if (nState != TS_IDLE)
+                        return false;
+                    pContinuation   = task;
+                    return true;
+                }
+
+                /** Set completion callback of the task
+                 *
+                 * @param callback callback or NULL to clear callback
+                 * @param arg argument passed to the callback
+                 * @return false if the task is not idle
+                 */
+                inline bool set_callback(task_callback_t callback, void *arg = NULL)
+                {
+                    if (nState != TS_IDLE)
+                        return false;
+                    pCallback       = callback;
+                    pCallbackArg    = arg;
+                    return true;
+                }
+
+                /** Reset task state and cancellation flag
                  *
                  * @return task state
                  */
@@ -98,6 +176,7 @@ namespace lsp
                     if (nState != TS_COMPLETED)
                         return false;
                     nState      = TS_IDLE;
+                    bCancelled  = false;
                     return true;
                 }
         };
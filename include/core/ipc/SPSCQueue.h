@@ -0,0 +1,170 @@
+/*
+ * SPSCQueue.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_IPC_SPSCQUEUE_H_
+#define CORE_IPC_SPSCQUEUE_H_
+
+#include <core/types.h>
+#include <core/sugar.h>
+#include <dsp/atomic.h>
+
+namespace lsp
+{
+    namespace ipc
+    {
+        /**
+         * Wait-free queue of fixed capacity for single producer and single consumer.
+         * Exactly one thread may call push() and exactly one thread may call pop(),
+         * none of them blocks or allocates memory, so both sides may be real-time threads.
+         * Items are copied with the assignment operator, so they should be plain data.
+         */
+        template <class T>
+            class SPSCQueue
+            {
+                private:
+                    SPSCQueue(const SPSCQueue &);
+                    SPSCQueue & operator = (const SPSCQueue &);
+
+                private:
+                    T                  *vItems;         // Storage
+                    uatomic_t           nMask;          // Capacity - 1
+                    uint8_t            *pData;          // Allocated data
+
+                    // Producer side
+                    volatile uatomic_t  nTail;          // Write position, modified by producer only
+                    uatomic_t           nHeadCache;     // Last observed read position
+                    volatile uatomic_t  nPushed;        // Number of pushed items
+                    volatile uatomic_t  nDropped;       // Number of items not pushed due to overflow
+                    uint8_t             vPadding[0x40];  // Keep consumer data in another cache line
+
+                    // Consumer side
+                    volatile uatomic_t  nHead;          // Read position, modified by consumer only
+                    uatomic_t           nTailCache;     // Last observed write position
+
+                public:
+                    explicit SPSCQueue()
+                    {
+                        vItems          = NULL;
+                        nMask           = 0;
+                        pData           = NULL;
+                        nTail           = 0;
+                        nHeadCache      = 0;
+                        nPushed         = 0;
+                        nDropped        = 0;
+                        nHead           = 0;
+                        nTailCache      = 0;
+                    }
+
+                    ~SPSCQueue()
+                    {
+                        destroy();
+                    }
+
+                public:
+                    /**
+                     * Initialize queue, should not be called while any side is active
+                     * @param capacity minimum capacity of the queue, is rounded up to the power of two
+                     * @return true on success
+                     */
+                    bool init(size_t capacity)
+                    {
+                        destroy();
+
+                        size_t cap      = 1;
+                        while (cap < capacity)
+                            cap           <<= 1;
+
+                        vItems          = alloc_aligned<T>(pData, cap);
+                        if (vItems == NULL)
+                            return false;
+
+                        nMask           = cap - 1;
+                        return true;
+                    }
+
+                    /**
+                     * Destroy queue, should not be called while any side is active
+                     */
+                    void destroy()
+                    {
+                        free_aligned(pData);
+                        vItems          = NULL;
+                        nMask           = 0;
+                        nTail           = 0;
+                        nHeadCache      = 0;
+                        nPushed         = 0;
+                        nDropped        = 0;
+                        nHead           = 0;
+                        nTailCache      = 0;
+                    }
+
+                    /**
+                     * Push item to the queue, should be called by producer only
+                     * @param item item to push
+                     * @return true on success, false if queue is full and item has been dropped
+                     */
+                    bool push(const T &item)
+                    {
+                        uatomic_t tail  = nTail;
+                        if (((tail - nHeadCache) > nMask) || (vItems == NULL))
+                        {
+                            nHeadCache      = atomic_add(&nHead, 0);
+                            if (((tail - nHeadCache) > nMask) || (vItems == NULL))
+                            {
+                                ++nDropped;
+                                return false;
+                            }
+                        }
+
+                        vItems[tail & nMask]    = item;
+                        atomic_add(&nTail, 1);  // Publish the item
+                        ++nPushed;
+                        return true;
+                    }
+
+                    /**
+                     * Pop item from the queue, should be called by consumer only
+                     * @param item pointer to store the item
+                     * @return true on success, false if queue is empty
+                     */
+                    bool pop(T *item)
+                    {
+                        uatomic_t head  = nHead;
+                        if (head == nTailCache)
+                        {
+                            nTailCache      = atomic_add(&nTail, 0);
+                            if (head == nTailCache)
+                                return false;
+                        }
+
+                        *item           = vItems[head & nMask];
+                        atomic_add(&nHead, 1);  // Release the slot
+                        return true;
+                    }
+
+                    /**
+                     * Get capacity of the queue
+                     * @return capacity of the queue
+                     */
+                    inline size_t capacity() const      { return (vItems != NULL) ? nMask + 1 : 0; }
+
+                    /**
+                     * Get number of successfully pushed items, may be called by any thread
+                     * @return number of pushed items
+                     */
+                    inline uatomic_t pushed() const     { return nPushed; }
+
+                    /**
+                     * Get number of dropped items, may be called by any thread
+                     * @return number of dropped items
+                     */
+                    inline uatomic_t dropped() const    { return nDropped; }
+            };
+    }
+}
+
+#endif /* CORE_IPC_SPSCQUEUE_H_ */
@@ -0,0 +1,77 @@
+/*
+ * Semaphore.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef INCLUDE_CORE_IPC_SEMAPHORE_H_
+#define INCLUDE_CORE_IPC_SEMAPHORE_H_
+
+#include <core/types.h>
+#include <dsp/atomic.h>
+
+#if defined(PLATFORM_WINDOWS)
+    #include <synchapi.h>
+#elif defined(PLATFORM_LINUX)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <errno.h>
+#else
+    #include <pthread.h>
+    #include <errno.h>
+#endif
+
+namespace lsp
+{
+    namespace ipc
+    {
+        /**
+         * Counting semaphore. The post() method does not block on Windows and Linux,
+         * so it can be used to wake up worker threads from the real-time thread
+         */
+        class Semaphore
+        {
+            private:
+#if defined(PLATFORM_WINDOWS)
+                HANDLE                          hSem;       // Semaphore object
+#elif defined(PLATFORM_LINUX)
+                volatile atomic_t               nCount;     // Semaphore counter
+                volatile atomic_t               nWaiters;   // Number of waiters
+#else
+                pthread_mutex_t                 sMutex;     // Mutex
+                pthread_cond_t                  sCond;      // Condition variable
+                size_t                          nCount;     // Semaphore counter
+#endif
+
+            private:
+                Semaphore & operator = (const Semaphore & m);       // Deny copying
+
+            public:
+                explicit Semaphore();
+                ~Semaphore();
+
+            public:
+                /** Increment the counter and wake up one of waiting threads
+                 *
+                 * @return true on success
+                 */
+                bool post();
+
+                /** Wait until the counter becomes positive and decrement it
+                 *
+                 * @return true on success
+                 */
+                bool wait();
+
+                /** Try to decrement the counter without waiting
+                 *
+                 * @return true if the counter was decremented
+                 */
+                bool try_wait();
+        };
+    } /* namespace ipc */
+} /* namespace lsp */
+
+#endif /* INCLUDE_CORE_IPC_SEMAPHORE_H_ */
@@ -15,6 +15,7 @@
     #include <processthreadsapi.h>
 #else
     #include <pthread.h>
+    #include <sched.h>
 #endif /* PLATFORM_WINDOWS */
 
 #include <core/ipc/IRunnable.h>
@@ -117,6 +118,19 @@ namespace lsp
                  */
                 static status_t sleep(wsize_t millis);
 
+                /**
+                 * Give the rest of the time slice of current thread to other threads
+                 */
+                static void yield();
+
+                /**
+                 * Switch current thread to real-time scheduling with the lowest real-time priority:
+                 * the thread preempts regular threads but not real-time threads of the audio backend.
+                 * The thread keeps it's previous priority if real-time scheduling is not permitted
+                 * @return status of operation
+                 */
+                static status_t set_realtime();
+
                 /**
                  * Return the current thread
                  * @return current thread or NULL if current thread is not an instance of ipc::Thread class
@@ -0,0 +1,127 @@
+/*
+ * WorkStealingExecutor.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_IPC_WORKSTEALINGEXECUTOR_H_
+#define CORE_IPC_WORKSTEALINGEXECUTOR_H_
+
+#include <dsp/atomic.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/IExecutor.h>
+#include <core/ipc/ITask.h>
+
+namespace lsp
+{
+    namespace ipc
+    {
+        /**
+         * Executor service with a pool of worker threads. Each worker has it's own
+         * task deque: the worker takes tasks from the bottom of the deque, idle workers
+         * steal tasks from the top of deques of other workers.
+         *
+         * Tasks submitted from outside of the pool are placed to the top of deques,
+         * so they are executed in the order of submission. Tasks forked by the running
+         * task are placed to the bottom of the deque of the current worker and are
+         * executed first.
+         */
+        class WorkStealingExecutor: public IExecutor
+        {
+            private:
+                enum constants_t
+                {
+                    QUEUE_SIZE      = 256,              // Maximum number of tasks in the worker's deque
+                    IDLE_MAX_DELAY  = 64                // Maximum delay of idle worker in milliseconds
+                };
+
+                typedef struct worker_t
+                {
+                    WorkStealingExecutor   *pExecutor;  // Owner of the worker
+                    Thread                 *pThread;    // Worker thread
+                    size_t                  nIndex;     // Index of the worker
+                    atomic_t                nLock;      // Deque lock
+                    volatile size_t         nTop;       // Index of the top of the deque
+                    volatile size_t         nCount;     // Number of tasks in the deque
+                    ITask                  *vTasks[QUEUE_SIZE];
+                } worker_t;
+
+            private:
+                worker_t           *vWorkers;
+                size_t              nWorkers;
+                size_t              nThreads;
+                volatile atomic_t   nPending;           // Number of submitted but not completed tasks
+                volatile atomic_t   nNext;              // Round-robin counter for submission
+
+            private:
+                static status_t     execute(void *params);
+                void                run(worker_t *w);
+                worker_t           *current_worker();
+                ITask              *pop_task(worker_t *w);
+                ITask              *steal_task(worker_t *w);
+                void                process_task(ITask *task);
+                void                destroy();
+
+            private:
+                WorkStealingExecutor &operator = (const WorkStealingExecutor &src); // Deny copying
+
+            public:
+                /** Create executor
+                 *
+                 * @param threads number of worker threads, zero means the number of system cores
+                 */
+                explicit WorkStealingExecutor(size_t threads = 0);
+                virtual ~WorkStealingExecutor();
+
+            public:
+                /** Start worker threads
+                 *
+                 * @return status of operation
+                 */
+                status_t start();
+
+                /** Submit task for execution, the method does not block and can be called
+                 * from the real-time thread
+                 *
+                 * @param task task to execute
+                 * @return true if task was submitted, false if task is not idle or all deques are busy
+                 */
+                virtual bool submit(ITask *task);
+
+                /** Fork the child task. If the method is called from the worker thread of the
+                 * executor, the task is placed to the deque of the current worker, otherwise
+                 * it is submitted as a regular task
+                 *
+                 * @param task task to execute
+                 * @return true if task was submitted
+                 */
+                bool fork(ITask *task);
+
+                /** Wait for the task completion. If the method is called from the worker thread
+                 * of the executor, it executes pending tasks while waiting
+                 *
+                 * @param task task to wait for
+                 * @return true if the task is completed, false if the task was not submitted
+                 */
+                bool wait(ITask *task);
+
+                virtual void shutdown();
+
+            public:
+                /** Get number of worker threads
+                 *
+                 * @return number of worker threads
+                 */
+                inline size_t threads() const   { return nWorkers;  }
+
+                /** Get number of submitted but not completed tasks
+                 *
+                 * @return number of pending tasks
+                 */
+                inline size_t pending() const   { return nPending;  }
+        };
+    }
+}
+
+#endif /* CORE_IPC_WORKSTEALINGEXECUTOR_H_ */
@@ -9,6 +9,7 @@
 #define CORE_SAMPLING_SAMPLE_H_
 
 #include <core/types.h>
+#include <core/files/AudioStream.h>
 
 namespace lsp
 {
@@ -19,18 +20,20 @@ namespace lsp
             size_t      nLength;
             size_t      nMaxLength;
             size_t      nChannels;
+            AudioStream *pStream;       // Streamed data, not owned by the sample
 
         public:
             Sample();
             ~Sample();
 
         public:
-            inline bool valid() const { return (vBuffer != NULL) && (nChannels > 0) && (nLength > 0) && (nMaxLength > 0); }
+            inline bool valid() const { return (nChannels > 0) && (nLength > 0) && ((pStream != NULL) || ((vBuffer != NULL) && (nMaxLength > 0))); }
             inline size_t length() const { return nLength; }
             inline size_t max_length() const { return nMaxLength; }
             inline float *getBuffer(size_t channel) { return &vBuffer[nMaxLength * channel]; }
             inline float *getBuffer(size_t channel, size_t offset) { return &vBuffer[nMaxLength * channel + offset]; }
             inline size_t channels() const { return nChannels; };
+            inline AudioStream *stream() { return pStream; }
 
             /** Set length of sample
              *
@@ -84,6 +87,16 @@ namespace lsp
              */
             bool resize(size_t channels, size_t max_length, size_t length = 0);
 
+            /** Initialize sample as streamed from disk, all previously allocated data will be lost.
+             * The data of streamed sample is not available via getBuffer(), the sample should
+             * be played by the SamplePlayer with the bound AudioStreamer. The stream should
+             * stay opened until the sample is destroyed.
+             *
+             * @param stream opened audio stream
+             * @return true on success
+             */
+            bool init_stream(AudioStream *stream);
+
             /** Drop sample contents
              *
              */
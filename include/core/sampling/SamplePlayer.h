@@ -9,46 +9,53 @@
 #define CORE_SAMPLING_SAMPLEPLAYER_H_
 
 #include <core/sampling/Sample.h>
+#include <core/files/AudioStreamer.h>
 
 namespace lsp
 {
     class SamplePlayer
     {
         protected:
+            // Structure of arrays that holds the state of all playbacks, active
+            // playbacks occupy the first nActive items of each array
             typedef struct playback_t
             {
-                Sample     *pSample;    // Pointer to the sample
-                ssize_t     nID;        // ID of playback
-                size_t      nChannel;   // Channel to play
-                ssize_t     nOffset;    // Current offset
-                ssize_t     nFadeout;   // Fadeout (cancelling)
-                ssize_t     nFadeOffset;// Fadeout offset
-                float       nVolume;    // The volume of the sample
-                playback_t *pNext;      // Pointer to the next playback in the list
-                playback_t *pPrev;      // Pointer to the previous playback in the list
+                Sample                    **vSample;        // Pointer to the sample
+                ssize_t                    *vID;            // ID of playback
+                size_t                     *vChannel;       // Channel to play
+                ssize_t                    *vOffset;        // Current offset
+                ssize_t                    *vFadeout;       // Fadeout (cancelling)
+                ssize_t                    *vFadeOffset;    // Fadeout offset
+                float                      *vVolume;        // The volume of the sample
+                AudioStreamer::cursor_t   **vCursor;        // Streaming cursor for streamed samples
             } playback_t;
 
-            typedef struct list_t
+            // Group of playbacks that cover the whole processed block and are mixed at once
+            typedef struct group_t
             {
-                playback_t *pHead;      // The head of the list
-                playback_t *pTail;      // The tail of the list
-            } list_t;
+                const float    *vSrc[4];    // Source data
+                float           vGain[4];   // Gain of each source
+                size_t          nItems;     // Number of items in group
+            } group_t;
 
         private:
             Sample        **vSamples;
             size_t          nSamples;
-            playback_t     *vPlayback;
+            playback_t      sPlayback;
             size_t          nPlayback;
-            list_t          sActive;
-            list_t          sInactive;
+            size_t          nActive;
+            size_t          nPolyphony;
             float           fGain;
+            AudioStreamer  *pStreamer;
+            float          *vBuffer;
+            uint8_t        *pData;
 
         protected:
-            static inline void cleanup(playback_t *pb);
-            static inline void list_remove(list_t *list, playback_t *pb);
-            static inline playback_t *list_remove_first(list_t *list);
-            static inline void list_add_first(list_t *list, playback_t *pb);
-            static inline void list_insert_from_tail(list_t *list, playback_t *pb);
+            void cleanup(size_t idx);
+            void release(size_t idx);
+            size_t steal();
+            void mix(size_t idx, float *dst, const float *src, size_t count);
+            static void flush(group_t *g, float *dst, size_t count);
             void do_process(float *dst, size_t samples);
 
         public:
@@ -62,6 +69,34 @@ namespace lsp
              */
             inline void set_gain(float gain) { fGain = gain; }
 
+            /** Set maximum number of simultaneously played samples. When the limit is
+             * reached, the new playback steals the oldest one, cancelled playbacks are
+             * stolen first.
+             *
+             * @param polyphony maximum number of playbacks, zero means the value passed to init()
+             */
+            void set_polyphony(size_t polyphony);
+
+            /** Get maximum number of simultaneously played samples
+             *
+             * @return maximum number of simultaneously played samples
+             */
+            inline size_t get_polyphony() const { return nPolyphony; }
+
+            /** Get number of active playbacks
+             *
+             * @return number of active playbacks
+             */
+            inline size_t active() const { return nActive; }
+
+            /** Set streamer used for playing samples streamed from disk. If no streamer
+             * is set or the streamer has no free cursors, only the resident head of the
+             * streamed sample is played. Should be called when there are no active playbacks.
+             *
+             * @param streamer streamer to use
+             */
+            inline void set_streamer(AudioStreamer *streamer) { pStreamer = streamer; }
+
             /** Initialize player
              *
              * @param max_samples maximum available samples
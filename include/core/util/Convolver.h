@@ -10,6 +10,7 @@
 
 #include <core/types.h>
 #include <core/util/ShiftBuffer.h>
+#include <dsp/atomic.h>
 
 
 //#define CONVOLVER_RANK_FFT_SMALL    5                               /* for test purposes                        */
@@ -17,34 +18,115 @@
 //#define CONVOLVER_RANK_FFT_SMALL    4                               /* buffer of 16 samples (8 effective)      */
 #define CONVOLVER_RANK_MIN          (CONVOLVER_RANK_FFT_SMALL+1)    /* buffer of 512 samples (256 effective)    */
 #define CONVOLVER_RANK_MAX          16                              /* buffer of 8192 samples (4096 effective)  */
+#define CONVOLVER_RT_BLOCKS         2                               /* number of tail blocks always processed in RT thread */
 
 namespace lsp
 {
+    class ConvolverCache;
+    class ConvolverPool;
+
+    /** Prepared impulse response data (spectrum) of the convolver,
+     * the data is immutable after creation and can be shared between several convolvers
+     */
+    class ConvolverData
+    {
+        private:
+            friend class Convolver;
+            friend class ConvolverCache;
+
+        private:
+            ConvolverData      *pNext;                  // Next item in the cache
+            size_t              nReferences;            // Number of references, guarded by the cache lock
+            uint64_t            nHash;                  // Hash of impulse response
+            float              *vSamples;               // Copy of impulse response for cache lookups, NULL if not cached
+            size_t              nLength;                // Length of impulse response
+            size_t              nRank;                  // FFT rank for convolution
+            size_t              nSteps;                 // Number of raising steps
+            size_t              nBlocks;                // Number of tail blocks
+            size_t              nDirectSize;            // Direct convolution size
+            size_t              nFrameMax;              // Maximum frame size
+            float              *vConvFirst;             // First part of convolution in non-FFT mode
+            float              *vConv;                  // Convolution (real + imaginary)
+            uint8_t            *vData;
+
+        private:
+            ConvolverData & operator = (const ConvolverData &);     // Deny copying
+
+            ConvolverData();
+            ~ConvolverData();
+
+        public:
+            /** Compute the convolution data for the impulse response,
+             * the returned data has one reference and is not stored in cache
+             *
+             * @param data impulse response
+             * @param count number of samples in impulse response
+             * @param rank convolution rank
+             * @return pointer to convolution data or NULL on error
+             */
+            static ConvolverData   *create(const float *data, size_t count, size_t rank);
+
+            /** Get the actual convolution rank for the requested one
+             *
+             * @param rank requested convolution rank
+             * @return actual convolution rank
+             */
+            static size_t           clamp_rank(size_t rank);
+
+        public:
+            inline size_t           length() const      { return nLength;       }
+            inline size_t           rank() const        { return nRank;         }
+    };
+
     class Convolver
     {
+        private:
+            friend class ConvolverPool;
+
         private:
             size_t      nFrameSize;             // Current frame size
             size_t      nFrameMax;              // Maximum frame size
 
             float      *vFrame;                 // Input signal frame
             float      *vTempBuf;               // Temporary buffer (real + imaginary)
-            float      *vConv;                  // Convolution (real + imaginary)
+            const float *vConv;                 // Convolution (real + imaginary)
             float      *vBufferHead;            // Buffer Head
             float      *vBufferTail;            // Buffer Tail
             float      *vBufferPtr;             // Current pointer
             float      *vBufferEnd;             // Buffer End
-            float      *vConvFirst;             // First part of convolution in non-FFT mode
-            float      *vTask;                  // Task for post-processing (real + imaginary)
+            const float *vConvFirst;            // First part of convolution in non-FFT mode
+            float      *vTask;                  // Accumulated tail spectrum for the next frame (real + imaginary)
+            float      *vFdl;                   // Frequency-domain delay line of input spectra (real + imaginary)
 
             size_t      nRank;                  // FFT rank for convolution
             size_t      nSteps;                 // Number of raising steps
             size_t      nBlocks;                // Number of blocks
             size_t      nBlocksDone;            // Number of blocks done
             size_t      nDirectSize;            // Direct convolution size
-            float      *pConv;                  // Task convolution (real + imaginary)
-            float      *pTargetPtr;             // Target pointer for task
+            size_t      nFdlHead;               // Position of the most recent input spectrum in delay line
+            const float *pConv;                 // Tail convolution (real + imaginary)
+            size_t      nRtBlocks;              // Number of tail blocks processed in RT thread
+
+            float      *vBgTask;                // Two tail spectra accumulated by background worker (real + imaginary)
+            size_t      nBgBlocks;              // Number of tail blocks processed in background
+            size_t      nBgGen;                 // Generation of background job (frame counter)
+            volatile atomic_t   nBgNext;        // Ticket of the next background tail block: generation and block index
+            volatile atomic_t   nBgDone;        // Ticket that follows the last background tail block processed by worker
+            volatile atomic_t   nBgOwner;       // Non-zero if the convolver is processed by the worker of the pool
+            Convolver          *pBgNext;        // Next convolver attached to the pool
+            bool                bBackground;    // Convolver is attached to the pool
+
+            ConvolverData      *pData;          // Convolution data
             uint8_t    *vData;
 
+        protected:
+            bool                bg_pending() const;
+            atomic_t            claim_block();
+            void                process_block(atomic_t ticket);
+            void                accumulate_block(float *dst, size_t idx);
+            void                complete_background();
+            void                start_background();
+
         public:
             Convolver();
             ~Convolver();
@@ -55,15 +137,34 @@ namespace lsp
              * @param data convolution data
              * @param count number of samples in convolution
              * @param rank convolution rank
+             * @param phase initial phase of the frame
+             * @param background process long tail blocks by worker threads of ConvolverPool,
+             *        the first CONVOLVER_RT_BLOCKS tail blocks are always processed in the caller's thread
+             * @return true on success
+             */
+            bool init(const float *data, size_t count, size_t rank, float phase, bool background = false);
+
+            /** Initialize convolver with prepared convolution data, the data is shared
+             * between the convolver and other owners until the convolver is destroyed
+             *
+             * @param data convolution data, may be obtained from ConvolverCache
+             * @param phase initial phase of the frame
+             * @param background process long tail blocks by worker threads of ConvolverPool
              * @return true on success
              */
-            bool init(const float *data, size_t count, size_t rank, float phase);
+            bool init(ConvolverData *data, float phase, bool background = false);
 
-            /** Destroy convolver
+            /** Destroy convolver, detaches it from the pool of background workers
              *
              */
             void destroy();
 
+            /** Check that convolver processes tail blocks in background
+             *
+             * @return true if convolver processes tail blocks in background
+             */
+            inline bool background() const { return bBackground; }
+
             /** Process samples
              *
              * @param dst destination buffer
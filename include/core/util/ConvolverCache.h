@@ -0,0 +1,69 @@
+/*
+ * ConvolverCache.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_UTIL_CONVOLVERCACHE_H_
+#define CORE_UTIL_CONVOLVERCACHE_H_
+
+#include <core/types.h>
+#include <core/util/Convolver.h>
+
+namespace lsp
+{
+    /** Process-wide reference-counted cache of prepared convolution data.
+     * The data is looked up by the contents of impulse response and the
+     * convolution rank, so any combination of file, track, sample rate,
+     * cut and fade parameters that renders the same impulse response
+     * shares the same spectrum. Cached items keep a copy of impulse response
+     * which is compared entirely on lookup. Items are removed from cache as
+     * soon as the last reference is released. References of both cached and
+     * uncached data are counted under the cache lock, so acquire() and
+     * release() should not be called from the real-time thread.
+     */
+    class ConvolverCache
+    {
+        private:
+            ConvolverCache & operator = (const ConvolverCache &);   // Deny copying
+
+            static ConvolverData   *find(uint64_t hash, const float *data, size_t count, size_t rank);
+
+        public:
+            /** Get convolution data for the impulse response, compute and store it
+             * in the cache if there is no such data yet. Should not be called from
+             * the real-time thread.
+             *
+             * @param data impulse response
+             * @param count number of samples in impulse response
+             * @param rank convolution rank
+             * @return acquired convolution data that should be released by release() call,
+             *   NULL if there is no data or not enough memory
+             */
+            static ConvolverData   *get(const float *data, size_t count, size_t rank);
+
+            /** Acquire additional reference to the convolution data
+             *
+             * @param data convolution data
+             * @return pointer to convolution data
+             */
+            static ConvolverData   *acquire(ConvolverData *data);
+
+            /** Release reference to the convolution data, the data is destroyed
+             * and removed from cache when there are no references
+             *
+             * @param data convolution data
+             */
+            static void             release(ConvolverData *data);
+
+            /** Get number of items stored in cache
+             *
+             * @return number of items stored in cache
+             */
+            static size_t           size();
+    };
+
+} /* namespace lsp */
+
+#endif /* CORE_UTIL_CONVOLVERCACHE_H_ */
@@ -0,0 +1,79 @@
+/*
+ * ConvolverPool.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_UTIL_CONVOLVERPOOL_H_
+#define CORE_UTIL_CONVOLVERPOOL_H_
+
+#include <core/types.h>
+#include <core/util/Convolver.h>
+
+#define CONVOLVER_POOL_THREADS_MAX  4                               /* Maximum number of worker threads in the pool */
+
+namespace lsp
+{
+    /** Process-wide pool of worker threads that process long tail blocks of
+     * convolvers in background. Worker threads are started when the first
+     * convolver is attached and stopped when the last one is detached. Each
+     * worker tries to switch to real-time scheduling, so it preempts regular
+     * threads but not the real-time threads of the audio backend. Each convolver
+     * is processed by one worker at a time, different convolvers are processed
+     * in parallel. The attach() and detach() methods should not be called from
+     * the real-time thread, the wakeup() method can be.
+     */
+    class ConvolverPool
+    {
+        private:
+            ConvolverPool & operator = (const ConvolverPool &);     // Deny copying
+
+            static status_t         worker(void *arg);
+            static Convolver       *acquire_job();
+            static void             process_job(Convolver *cv);
+            static void             stop();
+
+        public:
+            /** Attach convolver to the pool, start worker threads if they are not started yet
+             *
+             * @param cv convolver to attach
+             * @return true on success
+             */
+            static bool             attach(Convolver *cv);
+
+            /** Detach convolver from the pool and wait until workers stop processing it,
+             * stop worker threads if there are no more attached convolvers
+             *
+             * @param cv convolver to detach
+             */
+            static void             detach(Convolver *cv);
+
+            /** Wake up a worker to process the job started by convolver, does not block
+             *
+             */
+            static void             wakeup();
+
+            /** Suspend the pool: a worker that has claimed a tail block stalls until
+             * the pool is resumed, so the real-time threads process all remaining
+             * blocks by themselves. Intended for testing of the worst case, detach()
+             * waits until the pool is resumed if the convolver is stalled
+             *
+             */
+            static void             suspend();
+
+            /** Resume the pool after suspend()
+             *
+             */
+            static void             resume();
+
+            /** Get number of worker threads
+             *
+             * @return number of worker threads
+             */
+            static size_t           threads();
+    };
+
+} /* namespace lsp */
+
+#endif /* CORE_UTIL_CONVOLVERPOOL_H_ */
@@ -9,7 +9,7 @@
 #define CORE_UTIL_DITHER_H_
 
 #include <core/types.h>
-#include <core/util/Randomizer.h>
+#include <dsp/dsp.h>
 
 namespace lsp
 {
@@ -19,17 +19,23 @@ namespace lsp
             size_t      nBits;
             float       fGain;
             float       fDelta;
-            Randomizer  sRandom;
+            dsp::prng_t sRandom;
 
         public:
             Dither();
             ~Dither();
 
         public:
+            /** Initialize dither, take current time as seed
+             *
+             */
+            void init();
+
             /** Initialize dither
              *
+             * @param seed seed of the random generator
              */
-            inline void init() { sRandom.init(); };
+            void init(uint32_t seed);
 
             /** Set number of bits per sample
              *
@@ -98,6 +98,19 @@ namespace lsp
                 float           fBLPeakAtten;           // Value of attenuation to bring peak of band limited wave to 1.0f.
             } parabolic_t;
 
+            typedef struct wavetable_t
+            {
+                bool            bEnabled;               // Wavetable synthesis is enabled
+                bool            bRebuild;               // Wave tables need to be rebuilt
+                size_t          nLevels;                // Number of valid mip levels
+                float          *vTable;                 // Mip levels of the table, each level contains one period of the wave
+                const float    *pLevel;                 // Currently selected mip level
+                uint8_t         nShift;                 // Shift of phase accumulator value to the 32-bit phase
+                uint32_t        nOffset;                // Phase offset of the table lookup
+                float           fScale;                 // Scale of table values
+                float           fDC;                    // DC offset added to scaled table values
+            } wavetable_t;
+
         private:
             fg_function_t       enFunction;             // Function for the oscillator.
             float               fAmplitude;             // Amplitude of the oscillator. [ Gain ]
@@ -123,6 +136,7 @@ namespace lsp
             trapezoid_t         sTrapezoid;
             pulse_t             sPulse;
             parabolic_t         sParabolic;
+            wavetable_t         sWaveTable;
 
             float              *vProcessBuffer;         // Buffers
             float              *vSynthBuffer;
@@ -209,8 +223,9 @@ namespace lsp
                 if ((function < FG_SINE) || (function >= FG_MAX))
                     return;
 
-                enFunction  = function;
-                bSync       = true;
+                enFunction              = function;
+                sWaveTable.bRebuild     = true;
+                bSync                   = true;
             }
 
             /** Set the frequency of the oscillator:
@@ -314,7 +329,8 @@ namespace lsp
                     return;
 
                 sRectangular.fDutyRatio = dutyRatio;
-                bSync = true;
+                sWaveTable.bRebuild     = true;
+                bSync                   = true;
             }
 
             /** Set the width for sawtooth waves
@@ -330,8 +346,9 @@ namespace lsp
                 if (sSawtooth.fWidth == width)
                     return;
 
-                sSawtooth.fWidth = width;
-                bSync = true;
+                sSawtooth.fWidth        = width;
+                sWaveTable.bRebuild     = true;
+                bSync                   = true;
             }
 
             /** Set raise and fall ratios for the trapezoid wave
@@ -356,6 +373,7 @@ namespace lsp
 
                 sTrapezoid.fRaiseRatio      = raise;
                 sTrapezoid.fFallRatio       = fall;
+                sWaveTable.bRebuild         = true;
                 bSync                       = true;
 
             }
@@ -382,6 +400,7 @@ namespace lsp
 
                 sPulse.fPosWidthRatio   = posWidthRatio;
                 sPulse.fNegWidthRatio   = negWidthRatio;
+                sWaveTable.bRebuild     = true;
                 bSync                   = true;
 
             }
@@ -401,9 +420,35 @@ namespace lsp
                     return;
 
                 sParabolic.fWidth   = width;
+                sWaveTable.bRebuild = true;
                 bSync               = true;
             }
 
+            /** Enable or disable wavetable synthesis. In this mode sinusoidal and band limited
+             * waves are read from precomputed mip-mapped tables with linear interpolation instead
+             * of being computed analytically, the oversampler is not used for band limited waves
+             *
+             * @param enable enable wavetable synthesis
+             */
+            inline void set_wavetable(bool enable)
+            {
+                if (sWaveTable.bEnabled == enable)
+                    return;
+
+                sWaveTable.bEnabled     = enable;
+                sWaveTable.bRebuild     = true;
+                bSync                   = true;
+            }
+
+            /** Check that wavetable synthesis is enabled
+             *
+             * @return true if wavetable synthesis is enabled
+             */
+            inline bool wavetable() const
+            {
+                return sWaveTable.bEnabled;
+            }
+
             /** Set Oversampler mode
              *
              * @param mode oversampler mode
@@ -475,6 +520,30 @@ namespace lsp
              */
             void do_process(Oversampler *os, float * dst, size_t count);
 
+            /** Check that the current function can be synthesized from the wave table
+             *
+             * @return true if the current function can be synthesized from the wave table
+             */
+            bool wavetable_supported() const;
+
+            /** Compute one period of the non band limited wave for the current function
+             *
+             * @param dst destination buffer
+             * @param count number of samples in the period
+             */
+            void build_period(float *dst, size_t count);
+
+            /** Build mip levels of the wave table for the current function
+             *
+             */
+            void build_wavetable();
+
+            /** Update phase parameters of the wave table and select the mip level
+             * for the current frequency
+             *
+             */
+            void update_wavetable();
+
     };
 
 }
@@ -44,7 +44,15 @@ namespace lsp
         OM_LANCZOS_6X2,
         OM_LANCZOS_6X3,
         OM_LANCZOS_8X2,
-        OM_LANCZOS_8X3
+        OM_LANCZOS_8X3,
+
+        // Cascaded polyphase half-band filters
+        OM_HALFBAND_2X,
+        OM_HALFBAND_4X,
+        OM_HALFBAND_8X,
+        OM_HALFBAND_IIR_2X,
+        OM_HALFBAND_IIR_4X,
+        OM_HALFBAND_IIR_8X
     };
 
     /** Oversampler class
@@ -62,6 +70,23 @@ namespace lsp
                 UP_ALL          = UP_MODE | UP_OTHER | UP_SAMPLE_RATE
             };
 
+            enum halfband_t
+            {
+                HB_STAGES_MAX   = 3
+            };
+
+            typedef struct hb_stage_t
+            {
+                float                  *vUp;            // Upsampling buffer: history + data
+                float                  *vDown;          // Downsampling buffer: history + data
+                float                  *vState;         // IIR filter state: upsampling + downsampling
+                float                  *vUpCoeffs;      // Upsampling coefficients
+                const float            *vDownCoeffs;    // Downsampling coefficients
+                size_t                  nCoeffs;        // Number of coefficients
+                size_t                  nUpHistory;     // Size of upsampling history, zero for IIR filter
+                size_t                  nDownHistory;   // Size of downsampling history, zero for IIR filter
+            } hb_stage_t;
+
         protected:
             IOversamplerCallback   *pCallback;
             float                  *fUpBuffer;
@@ -73,10 +98,17 @@ namespace lsp
             Filter                  sFilter;
             uint8_t                *bData;
             bool                    bFilter;
+            size_t                  nStages;
+            hb_stage_t              vStages[HB_STAGES_MAX];
 
 //        protected:
 //            static void do_filter(float *out, const float *in, size_t count);
 
+        protected:
+            void                    configure_halfband();
+            void                    halfband_upsample(float *dst, const float *src, size_t samples);
+            void                    halfband_downsample(float *dst, const float *src, size_t samples);
+
         public:
             Oversampler();
             virtual ~Oversampler();
@@ -115,15 +147,16 @@ namespace lsp
             {
                 if (mode < OM_NONE)
                     mode = OM_NONE;
-                else if (mode > OM_LANCZOS_8X3)
-                    mode = OM_LANCZOS_8X3;
+                else if (mode > OM_HALFBAND_IIR_8X)
+                    mode = OM_HALFBAND_IIR_8X;
                 if (nMode == mode)
                     return;
                 nMode      = mode;
                 nUpdate   |= UP_MODE;
             }
 
-            /** Enable/disable low-pass filter when performing downsampling
+            /** Enable/disable low-pass filter when performing downsampling,
+             * half-band modes do not use this filter since they perform filtering by design
              *
              * @param filter enables/diables low-pass filter
              */
@@ -192,7 +225,8 @@ namespace lsp
             }
 
             /**
-             * Get oversampler latency
+             * Get oversampler latency. For half-band FIR modes the latency is exact,
+             * for half-band IIR modes it is the rounded group delay at low frequencies
              * @return oversampler latency in normal (non-oversampled) samples
              */
             size_t latency() const;
@@ -11,6 +11,8 @@
 #include <core/types.h>
 #include <core/util/ShiftBuffer.h>
 
+#define SIDECHAIN_REFRESH_RATE      0x1000
+
 namespace lsp
 {
     // Sidechain signal source
@@ -38,8 +40,20 @@ namespace lsp
 
     class Sidechain
     {
+        protected:
+            typedef struct peak_t
+            {
+                float           fValue;             // Peak value
+                size_t          nTime;              // Time of the peak (in samples)
+            } peak_t;
+
         protected:
             ShiftBuffer     sBuffer;                // Shift buffer for history
+            peak_t         *vPeaks;                 // Monotonic deque of peaks for the sliding maximum
+            size_t          nPeakHead;              // Head of the peak deque
+            size_t          nPeakCount;             // Number of items in the peak deque
+            size_t          nPeakMask;              // Mask of the peak deque capacity
+            size_t          nTime;                  // Current time (in samples)
             size_t          nReactivity;            // Reactivity (in samples)
             float           fReactivity;            // Reactivity (in time)
             float           fTau;                   // Tau for RMS
@@ -57,6 +71,7 @@ namespace lsp
         protected:
             void            update_settings();
             void            refresh_processing();
+            void            update_peaks(float *dst, const float *src, size_t count);
 
         public:
             Sidechain();
@@ -119,6 +134,9 @@ namespace lsp
                     return;
                 fRmsValue       = 0.0f;
                 nMode           = mode;
+                nPeakHead       = 0;
+                nPeakCount      = 0;
+                nRefresh        = SIDECHAIN_REFRESH_RATE; // Force the function to be refreshed
             }
 
             /** Set-up pre-amplification gain
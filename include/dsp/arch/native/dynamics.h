@@ -0,0 +1,139 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_NATIVE_DYNAMICS_H_
+#define DSP_ARCH_NATIVE_DYNAMICS_H_
+
+#ifndef __DSP_NATIVE_IMPL
+    #error "This header should not be included directly"
+#endif /* __DSP_NATIVE_IMPL */
+
+#define DYN_KNEE_BUF_SIZE       0x100
+
+namespace native
+{
+    /**
+     * Compute logarithm of the gain for the block of samples, the transcendental
+     * functions are computed by the vectorized dsp::loge1 and dsp::exp1 kernels
+     *
+     * @param dst destination buffer to store logarithm of the gain
+     * @param x buffer to store absolute values of source samples
+     * @param src source samples
+     * @param c gain curve
+     * @param count number of samples, should not be greater than DYN_KNEE_BUF_SIZE
+     */
+    static void dyn_knee_log_gain(float *dst, float *x, const float *src, const dsp::dyn_knee_t *c, size_t count)
+    {
+        float lx[DYN_KNEE_BUF_SIZE] __lsp_aligned16;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float s     = fabs(src[i]);
+            x[i]        = s;
+            lx[i]       = (s < DYN_KNEE_X_MIN) ? DYN_KNEE_X_MIN :
+                          (s > DYN_KNEE_X_MAX) ? DYN_KNEE_X_MAX : s;
+        }
+
+        dsp::loge1(lx, count);
+
+        // Evaluate all polynomials and select the result without branches
+        float lo0 = c->lo[0], lo1 = c->lo[1], lo2 = c->lo[2], lo3 = c->lo[3];
+        float kn0 = c->knee[0], kn1 = c->knee[1], kn2 = c->knee[2], kn3 = c->knee[3];
+        float hi0 = c->hi[0], hi1 = c->hi[1], hi2 = c->hi[2], hi3 = c->hi[3];
+        float start = c->start, end = c->end;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float s     = x[i];
+            float l     = lx[i];
+            float el    = ((lo0*l + lo1)*l + lo2)*l + lo3;
+            float ek    = ((kn0*l + kn1)*l + kn2)*l + kn3;
+            float eh    = ((hi0*l + hi1)*l + hi2)*l + hi3;
+            float e     = (s < start) ? el : (s > end) ? eh : ek;
+            e           = (e < DYN_KNEE_LOG_MIN) ? DYN_KNEE_LOG_MIN : e;
+            dst[i]      = (e > DYN_KNEE_LOG_MAX) ? DYN_KNEE_LOG_MAX : e;
+        }
+    }
+
+    /**
+     * Check that all samples of the block lie in the same region of the curve
+     * where the gain does not depend on the level
+     *
+     * @param src source samples
+     * @param c gain curve
+     * @param count number of samples
+     * @return the gain of the region or negative value if it should be computed for each sample
+     */
+    static float dyn_knee_flat_gain(const float *src, const dsp::dyn_knee_t *c, size_t count)
+    {
+        float min, max;
+        dsp::abs_minmax(src, count, &min, &max);
+
+        const float *p  = (max < c->start) ? c->lo :
+                          (min > c->end) ? c->hi : NULL;
+        if ((p == NULL) || (p[0] != 0.0f) || (p[1] != 0.0f) || (p[2] != 0.0f))
+            return -1.0f;
+
+        float e         = (p[3] < DYN_KNEE_LOG_MIN) ? DYN_KNEE_LOG_MIN :
+                          (p[3] > DYN_KNEE_LOG_MAX) ? DYN_KNEE_LOG_MAX : p[3];
+        return expf(e);
+    }
+
+    void dyn_gain(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count)
+    {
+        float x[DYN_KNEE_BUF_SIZE] __lsp_aligned16;
+
+        while (count > 0)
+        {
+            size_t to_do    = (count > DYN_KNEE_BUF_SIZE) ? DYN_KNEE_BUF_SIZE : count;
+
+            float g         = dyn_knee_flat_gain(src, knee, to_do);
+            if (g >= 0.0f)
+                dsp::fill(dst, g, to_do);
+            else
+            {
+                dyn_knee_log_gain(dst, x, src, knee, to_do);
+                dsp::exp1(dst, to_do);
+            }
+
+            dst            += to_do;
+            src            += to_do;
+            count          -= to_do;
+        }
+    }
+
+    void dyn_curve(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count)
+    {
+        float x[DYN_KNEE_BUF_SIZE] __lsp_aligned16;
+
+        while (count > 0)
+        {
+            size_t to_do    = (count > DYN_KNEE_BUF_SIZE) ? DYN_KNEE_BUF_SIZE : count;
+
+            float g         = dyn_knee_flat_gain(src, knee, to_do);
+            if (g >= 0.0f)
+            {
+                dsp::abs2(dst, src, to_do);
+                dsp::scale2(dst, g, to_do);
+            }
+            else
+            {
+                dyn_knee_log_gain(dst, x, src, knee, to_do);
+                dsp::exp1(dst, to_do);
+                dsp::mul2(dst, x, to_do);
+            }
+
+            dst            += to_do;
+            src            += to_do;
+            count          -= to_do;
+        }
+    }
+}
+
+#undef DYN_KNEE_BUF_SIZE
+
+#endif /* DSP_ARCH_NATIVE_DYNAMICS_H_ */
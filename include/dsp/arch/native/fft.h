@@ -1040,10 +1040,10 @@ namespace native
                 // s1' = s0 - s1
                 float s1_re     = src[2];
                 float s1_im     = src[3];
-                dst[2]          = src[0] - s1_re;
-                dst[3]          = src[1] - s1_im;
-                dst[0]          = src[0] + s1_re;
-                dst[1]          = src[1] + s1_im;
+                dst[2]          = (src[0] - s1_re) * 0.5f;
+                dst[3]          = (src[1] - s1_im) * 0.5f;
+                dst[0]          = (src[0] + s1_re) * 0.5f;
+                dst[1]          = (src[1] + s1_im) * 0.5f;
             }
             else
             {
@@ -1160,6 +1160,203 @@ namespace native
         repack_normalize_fft(dst, rank);
     }
 
+    static void real_fft_split(float *dst, size_t rank)
+    {
+        // Z is the spectrum of complex signal z[n] = x[2n] + j*x[2n+1]:
+        //   E[k]   = (Z[k] + conj(Z[M-k]))/2           - spectrum of even samples
+        //   O[k]   = (Z[k] - conj(Z[M-k]))/(2*j)       - spectrum of odd samples
+        //   X[k]   = E[k] + W^k * O[k]
+        //   X[M-k] = conj(E[k] - W^k * O[k])
+        // where W = exp(-2*pi*j/N) = c - j*s
+        size_t half     = size_t(1) << (rank - 2);
+        float *a        = &dst[2];
+        float *b        = &dst[(half << 2) - 2];
+
+        // DC and Nyquist harmonics
+        float z_re      = dst[0];
+        float z_im      = dst[1];
+        dst[0]          = z_re + z_im;
+        dst[1]          = z_re - z_im;
+
+        if (rank < 4)
+        {
+            // Scalar processing
+            float c         = XFFT_DW[(rank - 1) << 1];
+            float s         = XFFT_DW[((rank - 1) << 1) + 1];
+            float w_re      = c, w_im = s;
+
+            for (size_t k=1; k <= half; ++k)
+            {
+                float er        = (a[0] + b[0]) * 0.5f;
+                float ei        = (a[1] - b[1]) * 0.5f;
+                float or_       = (a[1] + b[1]) * 0.5f;
+                float oi        = (b[0] - a[0]) * 0.5f;
+                float tr        = w_re*or_ + w_im*oi;
+                float ti        = w_re*oi - w_im*or_;
+
+                a[0]            = er + tr;
+                a[1]            = ei + ti;
+                b[0]            = er - tr;
+                b[1]            = ti - ei;
+
+                // Rotate twiddle factor
+                float nw_re     = w_re*c - w_im*s;
+                w_im            = w_re*s + w_im*c;
+                w_re            = nw_re;
+                a              += 2;
+                b              -= 2;
+            }
+            return;
+        }
+
+        // Initialize twiddle factors W^1 .. W^4 and the rotation step W^4
+        float w_re[4], w_im[4], c_re[4], c_im[4], x_re[4], x_im[4];
+        const float *dw     = &XFFT_DW[(rank - 1) << 1];
+        const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+        const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+        const float *sw     = &XFFT_DW[(rank - 3) << 1];
+
+        for (size_t i=0; i<4; ++i)
+        {
+            w_re[i]         = iw_re[i]*dw[0] - iw_im[i]*dw[1];
+            w_im[i]         = iw_re[i]*dw[1] + iw_im[i]*dw[0];
+        }
+
+        b                  -= 6;
+
+        for (size_t k=0; ; )
+        {
+            // Load values in reverse order from the tail
+            for (size_t i=0; i<4; ++i)
+            {
+                float er        = (a[i*2] + b[6-i*2]) * 0.5f;
+                float ei        = (a[i*2+1] - b[7-i*2]) * 0.5f;
+                float or_       = (a[i*2+1] + b[7-i*2]) * 0.5f;
+                float oi        = (b[6-i*2] - a[i*2]) * 0.5f;
+                float tr        = w_re[i]*or_ + w_im[i]*oi;
+                float ti        = w_re[i]*oi - w_im[i]*or_;
+
+                c_re[i]         = er + tr;
+                c_im[i]         = ei + ti;
+                x_re[i]         = er - tr;
+                x_im[i]         = ti - ei;
+            }
+
+            // Store values
+            for (size_t i=0; i<4; ++i)
+            {
+                a[i*2]          = c_re[i];
+                a[i*2+1]        = c_im[i];
+                b[6-i*2]        = x_re[i];
+                b[7-i*2]        = x_im[i];
+            }
+
+            a              += 8;
+            b              -= 8;
+
+            if ((k += 4) >= half)
+                break;
+
+            // Rotate twiddle factors
+            for (size_t i=0; i<4; ++i)
+            {
+                float nw_re     = w_re[i]*sw[0] - w_im[i]*sw[1];
+                w_im[i]         = w_re[i]*sw[1] + w_im[i]*sw[0];
+                w_re[i]         = nw_re;
+            }
+        }
+    }
+
+    static void real_fft_join(float *dst, const float *src, size_t rank)
+    {
+        // Restore Z[k] = E[k] + j*O[k] of complex signal z[n] = x[2n] + j*x[2n+1]:
+        //   E[k]   = (X[k] + conj(X[M-k]))/2
+        //   O[k]   = (X[k] - conj(X[M-k])) * conj(W^k)/2
+        //   Z[M-k] = conj(E[k]) + j*conj(O[k])
+        // where W = exp(-2*pi*j/N) = c - j*s
+        size_t half     = size_t(1) << (rank - 2);
+        const float *sa = &src[2];
+        const float *sb = &src[(half << 2) - 2];
+        float *a        = &dst[2];
+        float *b        = &dst[(half << 2) - 2];
+        float c         = XFFT_DW[(rank - 1) << 1];
+        float s         = XFFT_DW[((rank - 1) << 1) + 1];
+        float w_re      = c, w_im = s;
+
+        // DC and Nyquist harmonics
+        float x_re      = src[0];
+        float x_im      = src[1];
+        dst[0]          = (x_re + x_im) * 0.5f;
+        dst[1]          = (x_re - x_im) * 0.5f;
+
+        for (size_t k=1; k <= half; ++k)
+        {
+            float er        = (sa[0] + sb[0]) * 0.5f;
+            float ei        = (sa[1] - sb[1]) * 0.5f;
+            float dr        = (sa[0] - sb[0]) * 0.5f;
+            float di        = (sa[1] + sb[1]) * 0.5f;
+            float or_       = dr*w_re - di*w_im;
+            float oi        = dr*w_im + di*w_re;
+
+            a[0]            = er - oi;
+            a[1]            = ei + or_;
+            b[0]            = er + oi;
+            b[1]            = or_ - ei;
+
+            // Rotate twiddle factor
+            float nw_re     = w_re*c - w_im*s;
+            w_im            = w_re*s + w_im*c;
+            w_re            = nw_re;
+            sa             += 2;
+            sb             -= 2;
+            a              += 2;
+            b              -= 2;
+        }
+    }
+
+    void real_direct_fft(float *dst, const float *src, size_t rank)
+    {
+        // Check bounds
+        if (rank <= 1)
+        {
+            if (rank == 1)
+            {
+                float s0        = src[0];
+                float s1        = src[1];
+                dst[0]          = s0 + s1;
+                dst[1]          = s0 - s1;
+            }
+            else
+                dst[0]          = src[0];
+            return;
+        }
+
+        // Real signal of 2^rank samples is a packed complex signal of 2^(rank-1) samples
+        packed_direct_fft(dst, src, rank - 1);
+        real_fft_split(dst, rank);
+    }
+
+    void real_reverse_fft(float *dst, const float *src, size_t rank)
+    {
+        // Check bounds
+        if (rank <= 1)
+        {
+            if (rank == 1)
+            {
+                float s0        = src[0];
+                float s1        = src[1];
+                dst[0]          = (s0 + s1) * 0.5f;
+                dst[1]          = (s0 - s1) * 0.5f;
+            }
+            else
+                dst[0]          = src[0];
+            return;
+        }
+
+        real_fft_join(dst, src, rank);
+        packed_reverse_fft(dst, dst, rank - 1);
+    }
+
     static void center_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
     {
         if (rank == 0)
@@ -0,0 +1,305 @@
+/*
+ * plan.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_NATIVE_FFT_PLAN_H_
+#define DSP_ARCH_NATIVE_FFT_PLAN_H_
+
+#ifndef __DSP_NATIVE_IMPL
+    #error "This header should not be included directly"
+#endif /* __DSP_NATIVE_IMPL */
+
+/*
+ * The planned FFT is a decimation-in-frequency radix-2^2 algorithm: each radix-4 pass
+ * performs two radix-2 stages at once, so the data is read and written only
+ * rank/2 times. For odd ranks one radix-2 pass is performed first. The result of
+ * passes is stored in bit-reversed order and is permuted by the final pass.
+ *
+ * Twiddle factors are stored in the plan in groups of 4 angles for SIMD processing:
+ *   - radix-2 pass (only for odd ranks): c[4], s[4] for angles 2*pi*j/n, j < n/2
+ *   - each radix-4 pass of quarter q >= 4: c1[4], s1[4], c2[4], s2[4], c3[4], s3[4]
+ *     for angles 2*pi*j/(4*q), 4*pi*j/(4*q) and 6*pi*j/(4*q), j < q
+ * where c is the cosine and s is the sine of the angle. Since q is always a power
+ * of 4, the last radix-4 pass of quarter q = 1 does not need twiddle factors.
+ */
+
+namespace native
+{
+    bool init_fft_plan(dsp::fft_plan_t *plan, size_t rank)
+    {
+        plan->rank      = rank;
+        plan->tw        = NULL;
+        plan->rev       = NULL;
+        plan->data      = NULL;
+        if (rank <= 1)
+            return true;
+
+        // Estimate size of twiddle factors
+        size_t items    = size_t(1) << rank;
+        size_t q        = (rank & 1) ? items >> 3 : items >> 2;
+        size_t tw_size  = (rank & 1) ? items : 0;
+        for (size_t i=q; i >= 4; i >>= 2)
+            tw_size        += i * 6;
+
+        // Allocate data
+        float *tw       = alloc_aligned<float>(plan->data, tw_size + items, DEFAULT_ALIGN);
+        if (tw == NULL)
+            return false;
+        plan->tw        = tw;
+        plan->rev       = reinterpret_cast<uint32_t *>(&tw[tw_size]);
+
+        // Compute twiddle factors of radix-2 pass
+        if (rank & 1)
+        {
+            size_t h        = items >> 1;
+            double k        = (2.0 * M_PI) / items;
+            for (size_t j=0; j<h; ++j)
+            {
+                float *w        = &tw[(j & ~3) << 1];
+                w[j & 3]        = cos(k * j);
+                w[(j & 3) + 4]  = sin(k * j);
+            }
+            tw         += items;
+        }
+
+        // Compute twiddle factors of radix-4 passes
+        for (; q >= 4; q >>= 2)
+        {
+            double k        = (2.0 * M_PI) / (q << 2);
+            for (size_t j=0; j<q; ++j)
+            {
+                float *w        = &tw[(j & ~3) * 6 + (j & 3)];
+                w[0]            = cos(k * j);
+                w[4]            = sin(k * j);
+                w[8]            = cos(k * j * 2);
+                w[12]           = sin(k * j * 2);
+                w[16]           = cos(k * j * 3);
+                w[20]           = sin(k * j * 3);
+            }
+            tw         += q * 6;
+        }
+
+        // Compute bit-reverse permutation table
+        uint32_t *rev   = plan->rev;
+        for (size_t i=0; i<items; ++i)
+        {
+            uint32_t r      = 0;
+            for (size_t j=0, v=i; j<rank; ++j, v >>= 1)
+                r               = (r << 1) | (v & 1);
+            rev[i]          = r;
+        }
+
+        return true;
+    }
+
+    void destroy_fft_plan(dsp::fft_plan_t *plan)
+    {
+        free_aligned(plan->data);
+        plan->tw        = NULL;
+        plan->rev       = NULL;
+    }
+
+    /**
+     * Radix-2 pass: a' = a + b, b' = (a - b) * w
+     * ks is the sign of the imaginary part of the rotation: -1 for direct FFT, +1 for reverse FFT
+     */
+    static void planned_fft_radix2(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            const float *tw, size_t h, float ks)
+    {
+        for (size_t j=0; j<h; ++j)
+        {
+            const float *w  = &tw[((j & ~3) << 1) + (j & 3)];
+            float a_re      = src_re[j];
+            float a_im      = src_im[j];
+            float b_re      = src_re[j + h];
+            float b_im      = src_im[j + h];
+            float c         = w[0];
+            float s         = w[4] * ks;
+
+            float d_re      = a_re - b_re;
+            float d_im      = a_im - b_im;
+
+            dst_re[j]       = a_re + b_re;
+            dst_im[j]       = a_im + b_im;
+            dst_re[j + h]   = d_re * c - d_im * s;
+            dst_im[j + h]   = d_re * s + d_im * c;
+        }
+    }
+
+    /**
+     * Radix-4 pass over all blocks of size 4*q:
+     *   y0 = (x0 + x2) + (x1 + x3)
+     *   y1 = ((x0 + x2) - (x1 + x3)) * w^2j
+     *   y2 = ((x0 - x2) + ks*j*(x1 - x3)) * w^j
+     *   y3 = ((x0 - x2) - ks*j*(x1 - x3)) * w^3j
+     */
+    static void planned_fft_radix4(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            const float *tw, size_t q, size_t items, float ks)
+    {
+        for (size_t p=0; p<items; p += (q << 2))
+        {
+            const float *sr = &src_re[p];
+            const float *si = &src_im[p];
+            float *dr       = &dst_re[p];
+            float *di       = &dst_im[p];
+
+            for (size_t j=0; j<q; ++j)
+            {
+                float a0_re     = sr[j] + sr[j + q*2];
+                float a0_im     = si[j] + si[j + q*2];
+                float a1_re     = sr[j + q] + sr[j + q*3];
+                float a1_im     = si[j + q] + si[j + q*3];
+                float t_re      = sr[j] - sr[j + q*2];
+                float t_im      = si[j] - si[j + q*2];
+                float u_re      = (si[j + q*3] - si[j + q]) * ks;
+                float u_im      = (sr[j + q] - sr[j + q*3]) * ks;
+
+                float b1_re     = a0_re - a1_re;
+                float b1_im     = a0_im - a1_im;
+                float b2_re     = t_re + u_re;
+                float b2_im     = t_im + u_im;
+                float b3_re     = t_re - u_re;
+                float b3_im     = t_im - u_im;
+
+                const float *w  = &tw[(j & ~3) * 6 + (j & 3)];
+                float c1        = w[0];
+                float s1        = w[4] * ks;
+                float c2        = w[8];
+                float s2        = w[12] * ks;
+                float c3        = w[16];
+                float s3        = w[20] * ks;
+
+                dr[j]           = a0_re + a1_re;
+                di[j]           = a0_im + a1_im;
+                dr[j + q]       = b1_re * c2 - b1_im * s2;
+                di[j + q]       = b1_re * s2 + b1_im * c2;
+                dr[j + q*2]     = b2_re * c1 - b2_im * s1;
+                di[j + q*2]     = b2_re * s1 + b2_im * c1;
+                dr[j + q*3]     = b3_re * c3 - b3_im * s3;
+                di[j + q*3]     = b3_re * s3 + b3_im * c3;
+            }
+        }
+    }
+
+    /**
+     * Last radix-4 pass of quarter q = 1, all twiddle factors are equal to 1
+     */
+    static void planned_fft_last(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            size_t items, float ks)
+    {
+        for (size_t p=0; p<items; p += 4)
+        {
+            float a0_re     = src_re[0] + src_re[2];
+            float a0_im     = src_im[0] + src_im[2];
+            float a1_re     = src_re[1] + src_re[3];
+            float a1_im     = src_im[1] + src_im[3];
+            float t_re      = src_re[0] - src_re[2];
+            float t_im      = src_im[0] - src_im[2];
+            float u_re      = (src_im[3] - src_im[1]) * ks;
+            float u_im      = (src_re[1] - src_re[3]) * ks;
+
+            dst_re[0]       = a0_re + a1_re;
+            dst_im[0]       = a0_im + a1_im;
+            dst_re[1]       = a0_re - a1_re;
+            dst_im[1]       = a0_im - a1_im;
+            dst_re[2]       = t_re + u_re;
+            dst_im[2]       = t_im + u_im;
+            dst_re[3]       = t_re - u_re;
+            dst_im[3]       = t_im - u_im;
+
+            src_re         += 4;
+            src_im         += 4;
+            dst_re         += 4;
+            dst_im         += 4;
+        }
+    }
+
+    static void planned_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            const dsp::fft_plan_t *plan, float ks)
+    {
+        size_t rank     = plan->rank;
+        size_t items    = size_t(1) << rank;
+        const float *tw = plan->tw;
+        size_t q        = items >> 2;
+
+        // First pass reads source data, all other passes work in-place
+        if (rank & 1)
+        {
+            planned_fft_radix2(dst_re, dst_im, src_re, src_im, tw, items >> 1, ks);
+            tw             += items;
+            q             >>= 1;
+            src_re          = dst_re;
+            src_im          = dst_im;
+        }
+
+        for (; q >= 4; q >>= 2)
+        {
+            planned_fft_radix4(dst_re, dst_im, src_re, src_im, tw, q, items, ks);
+            tw             += q * 6;
+            src_re          = dst_re;
+            src_im          = dst_im;
+        }
+
+        planned_fft_last(dst_re, dst_im, src_re, src_im, items, ks);
+    }
+
+    void planned_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan)
+    {
+        if (plan->rank <= 1)
+        {
+            direct_fft(dst_re, dst_im, src_re, src_im, plan->rank);
+            return;
+        }
+
+        planned_fft(dst_re, dst_im, src_re, src_im, plan, -1.0f);
+
+        // Permute the result
+        size_t items        = size_t(1) << plan->rank;
+        const uint32_t *rev = plan->rev;
+        for (size_t i=0; i<items; ++i)
+        {
+            size_t j            = rev[i];
+            if (i >= j)
+                continue;
+            float re            = dst_re[i];
+            float im            = dst_im[i];
+            dst_re[i]           = dst_re[j];
+            dst_im[i]           = dst_im[j];
+            dst_re[j]           = re;
+            dst_im[j]           = im;
+        }
+    }
+
+    void planned_reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan)
+    {
+        if (plan->rank <= 1)
+        {
+            reverse_fft(dst_re, dst_im, src_re, src_im, plan->rank);
+            return;
+        }
+
+        planned_fft(dst_re, dst_im, src_re, src_im, plan, 1.0f);
+
+        // Permute and normalize the result
+        size_t items        = size_t(1) << plan->rank;
+        const uint32_t *rev = plan->rev;
+        float k             = 1.0f / items;
+        for (size_t i=0; i<items; ++i)
+        {
+            size_t j            = rev[i];
+            if (i > j)
+                continue;
+            float re            = dst_re[i];
+            float im            = dst_im[i];
+            dst_re[i]           = dst_re[j] * k;
+            dst_im[i]           = dst_im[j] * k;
+            dst_re[j]           = re * k;
+            dst_im[j]           = im * k;
+        }
+    }
+}
+
+#endif /* DSP_ARCH_NATIVE_FFT_PLAN_H_ */
@@ -375,6 +375,52 @@ namespace native
             d          += 4;
         }
     }
+
+    static void biquad_process_mc(float *dst, const float *src, size_t count, float *d,
+            const float *a0, const float *a1, const float *a2, const float *b1, const float *b2, size_t lanes)
+    {
+        float *d1   = &d[lanes];
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<lanes; ++j)
+            {
+                float s     = src[j];
+                float s2    = a0[j]*s + d[j];
+                float p1    = a1[j]*s + b1[j]*s2;
+                float p2    = a2[j]*s + b2[j]*s2;
+
+                dst[j]      = s2;
+
+                // Shift buffer
+                d[j]        = d1[j] + p1;
+                d1[j]       = p2;
+            }
+
+            src        += lanes;
+            dst        += lanes;
+        }
+    }
+
+    void biquad_process_mc4(float *dst, const float *src, size_t count, biquad_t *f, size_t stages)
+    {
+        for (size_t i=0; i<stages; ++i, ++f)
+        {
+            biquad_x4_t *bq = &f->x4;
+            biquad_process_mc(dst, src, count, f->d, bq->a0, bq->a1, bq->a2, bq->b1, bq->b2, 4);
+            src         = dst; // actual data for the next stage is in output buffer now
+        }
+    }
+
+    void biquad_process_mc8(float *dst, const float *src, size_t count, biquad_t *f, size_t stages)
+    {
+        for (size_t i=0; i<stages; ++i, ++f)
+        {
+            biquad_x8_t *bq = &f->x8;
+            biquad_process_mc(dst, src, count, f->d, bq->a0, bq->a1, bq->a2, bq->b1, bq->b2, 8);
+            src         = dst; // actual data for the next stage is in output buffer now
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_FILTERS_STATIC_H_ */
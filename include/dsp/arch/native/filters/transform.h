@@ -769,6 +769,39 @@ namespace native
             bc          += 8;
         } // for i
     }
+
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count)
+    {
+        float k         = 1.0f / step;
+        float DT[4], DB[4];
+
+        while (count > 0)
+        {
+            const f_cascade_t *a = keys;
+            keys           += stride;
+
+            // Calculate increments
+            for (size_t j=0; j<4; ++j)
+            {
+                DT[j]           = (keys->t[j] - a->t[j]) * k;
+                DB[j]           = (keys->b[j] - a->b[j]) * k;
+            }
+
+            // Generate cascades
+            size_t n        = (count > step) ? step : count;
+            for (size_t i=0; i<n; ++i, dst += stride)
+            {
+                float x         = i;
+                for (size_t j=0; j<4; ++j)
+                {
+                    dst->t[j]       = a->t[j] + DT[j] * x;
+                    dst->b[j]       = a->b[j] + DB[j] * x;
+                }
+            }
+
+            count          -= n;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_FILTERS_TRANSFORM_H_ */
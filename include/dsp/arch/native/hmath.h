@@ -54,6 +54,28 @@ namespace native
         }
         return result;
     }
+
+    float sliding_mean(float *dst, const float *head, const float *tail, float sum, float k, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            sum        += head[i] - tail[i];
+            dst[i]      = ((sum > 0.0f) ? sum : 0.0f) * k; // Same as max(sum, 0) in SIMD code, also for NaN
+        }
+        return sum;
+    }
+
+    float sliding_rms(float *dst, const float *head, const float *tail, float sum, float k, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float h     = head[i];
+            float t     = tail[i];
+            sum        += h*h - t*t;
+            dst[i]      = sqrtf(((sum > 0.0f) ? sum : 0.0f) * k); // Same as max(sum, 0) in SIMD code, also for NaN
+        }
+        return sum;
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_HMATH_H_ */
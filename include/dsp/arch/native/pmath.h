@@ -319,6 +319,15 @@ namespace native
         for (size_t i=0; i<count; ++i)
             dst[i] = expf(x[i] * logf(v[i]));
     }
+
+    void lramp_add2(float *dst, const float *src, float v1, float v2, size_t count)
+    {
+        if (count <= 0)
+            return;
+        float delta = (v2 - v1) / count;
+        for (size_t i=0; i<count; ++i)
+            dst[i] += src[i] * (v1 + delta * i);
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_PMATH_H_ */
@@ -0,0 +1,118 @@
+/*
+ * random.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_NATIVE_RANDOM_H_
+#define DSP_ARCH_NATIVE_RANDOM_H_
+
+#ifndef __DSP_NATIVE_IMPL
+    #error "This header should not be included directly"
+#endif /* __DSP_NATIVE_IMPL */
+
+#define PRNG_K_UNIFORM          (1.0f / 16777216.0f)
+#define PRNG_K_GAUSSIAN         (1.7320508f / 16777216.0f)
+#define PRNG_B_GAUSSIAN         (-2.0f * 1.7320508f)
+
+namespace native
+{
+    /**
+     * Advance all four generators and return 24 most significant bits of each value
+     *
+     * @param v destination to store four values
+     * @param rnd generator state
+     */
+    static inline void prng_step(int32_t *v, dsp::prng_t *rnd)
+    {
+        for (size_t i=0; i<4; ++i)
+        {
+            uint32_t t      = rnd->x[i] ^ (rnd->x[i] << 11);
+            uint32_t w      = rnd->w[i];
+            rnd->x[i]       = rnd->y[i];
+            rnd->y[i]       = rnd->z[i];
+            rnd->z[i]       = w;
+            w               = w ^ (w >> 19) ^ t ^ (t >> 8);
+            rnd->w[i]       = w;
+            v[i]            = w >> 8;
+        }
+    }
+
+    void init_prng(dsp::prng_t *rnd, uint32_t seed)
+    {
+        uint32_t *v[4]  = { rnd->x, rnd->y, rnd->z, rnd->w };
+
+        for (size_t j=0; j<4; ++j)
+        {
+            uint32_t *s     = v[j];
+            for (size_t i=0; i<4; ++i)
+            {
+                seed            = seed * 1664525 + 1013904223;
+                s[i]            = seed ^ (seed >> 16);
+            }
+        }
+
+        // Each xorshift generator should have non-zero state
+        for (size_t i=0; i<4; ++i)
+            rnd->w[i]      |= 1;
+    }
+
+    void rand_uniform(float *dst, dsp::prng_t *rnd, size_t count)
+    {
+        int32_t a[4];
+
+        for ( ; count > 0; dst += 4)
+        {
+            prng_step(a, rnd);
+
+            size_t n    = (count > 4) ? 4 : count;
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = a[i] * PRNG_K_UNIFORM;
+            count      -= n;
+        }
+    }
+
+    void rand_triangle(float *dst, dsp::prng_t *rnd, size_t count)
+    {
+        int32_t a[4], b[4];
+
+        for ( ; count > 0; dst += 4)
+        {
+            prng_step(a, rnd);
+            prng_step(b, rnd);
+
+            size_t n    = (count > 4) ? 4 : count;
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = (a[i] - b[i]) * PRNG_K_UNIFORM;
+            count      -= n;
+        }
+    }
+
+    void rand_gaussian(float *dst, dsp::prng_t *rnd, size_t count)
+    {
+        int32_t a[4], b[4];
+
+        for ( ; count > 0; dst += 4)
+        {
+            prng_step(a, rnd);
+            for (size_t j=1; j<4; ++j)
+            {
+                prng_step(b, rnd);
+                for (size_t i=0; i<4; ++i)
+                    a[i]       += b[i];
+            }
+
+            size_t n    = (count > 4) ? 4 : count;
+            for (size_t i=0; i<n; ++i)
+                dst[i]      = float(a[i]) * PRNG_K_GAUSSIAN + PRNG_B_GAUSSIAN;
+            count      -= n;
+        }
+    }
+}
+
+#undef PRNG_K_UNIFORM
+#undef PRNG_K_GAUSSIAN
+#undef PRNG_B_GAUSSIAN
+
+#endif /* DSP_ARCH_NATIVE_RANDOM_H_ */
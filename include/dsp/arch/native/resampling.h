@@ -446,6 +446,102 @@ namespace native
             src     += 8;
         }
     }
+
+    void halfband_upsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count)
+    {
+        src        += n - 1;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            const float *p1 = &src[i];
+            const float *p2 = &src[i+1];
+            float s         = 0.0f;
+            for (size_t k=0; k<n; ++k)
+                s              += c[k] * (p1[-ssize_t(k)] + p2[k]);
+
+            dst[0]          = p1[0];
+            dst[1]          = s;
+            dst            += 2;
+        }
+    }
+
+    void halfband_downsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count)
+    {
+        src        += (n << 1) - 1;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            const float *p1 = &src[-1];
+            const float *p2 = &src[1];
+            float s         = 0.0f;
+            for (size_t k=0; k<n; ++k)
+                s              += c[k] * (p1[-ssize_t(k << 1)] + p2[k << 1]);
+
+            dst[i]          = 0.5f * src[0] + s;
+            src            += 2;
+        }
+    }
+
+    void halfband_iir_upsample_2x(float *dst, const float *src, float *state, const float *c, size_t n, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float s0        = src[i];
+            float s1        = s0;
+            float *x        = state;
+
+            // Process both polyphase paths
+            for (size_t k=0; k<n; k += 2, x += 4)
+            {
+                float t         = (s0 - x[1]) * c[k] + x[0];
+                x[0]            = s0;
+                x[1]            = t;
+                s0              = t;
+
+                if ((k + 1) >= n)
+                    break;
+
+                t               = (s1 - x[3]) * c[k+1] + x[2];
+                x[2]            = s1;
+                x[3]            = t;
+                s1              = t;
+            }
+
+            dst[0]          = s0;
+            dst[1]          = s1;
+            dst            += 2;
+        }
+    }
+
+    void halfband_iir_downsample_2x(float *dst, const float *src, float *state, const float *c, size_t n, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float s0        = src[1];
+            float s1        = src[0];
+            float *x        = state;
+
+            // Process both polyphase paths
+            for (size_t k=0; k<n; k += 2, x += 4)
+            {
+                float t         = (s0 - x[1]) * c[k] + x[0];
+                x[0]            = s0;
+                x[1]            = t;
+                s0              = t;
+
+                if ((k + 1) >= n)
+                    break;
+
+                t               = (s1 - x[3]) * c[k+1] + x[2];
+                x[2]            = s1;
+                x[3]            = t;
+                s1              = t;
+            }
+
+            dst[i]          = 0.5f * (s0 + s1);
+            src            += 2;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_RESAMPLING_H_ */
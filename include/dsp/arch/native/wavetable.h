@@ -0,0 +1,31 @@
+/*
+ * wavetable.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_NATIVE_WAVETABLE_H_
+#define DSP_ARCH_NATIVE_WAVETABLE_H_
+
+#ifndef __DSP_NATIVE_IMPL
+    #error "This header should not be included directly"
+#endif /* __DSP_NATIVE_IMPL */
+
+namespace native
+{
+    void wavetable(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count)
+    {
+        size_t shift    = 32 - rank;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            const float *p  = &table[phase >> shift];
+            float f         = uint32_t(phase << rank) * (1.0f / 4294967296.0f);
+            dst[i]          = (p[0] + (p[1] - p[0]) * f) * k + b;
+            phase          += step;
+        }
+    }
+}
+
+#endif /* DSP_ARCH_NATIVE_WAVETABLE_H_ */
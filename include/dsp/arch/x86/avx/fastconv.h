@@ -0,0 +1,170 @@
+/*
+ * fastconv.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX_FASTCONV_H_
+#define DSP_ARCH_X86_AVX_FASTCONV_H_
+
+#ifndef DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX_IMPL */
+
+#ifdef ARCH_X86_64
+
+#include <dsp/arch/x86/avx/fft/const.h>
+
+/*
+ * All complex numbers are stored in the following format:
+ *   [r0 r1 r2 r3 i0 i1 i2 i3  r4 r5 r6 r7 i4 i5 i6 i7  ... ]
+ * so each 8-float block fits exactly one ymm register. Angles of two adjacent
+ * blocks are kept in registers:
+ *   ymm8  = wr[0..3] wr[0..3]      ymm9  = wi[0..3] wi[0..3] (with sign mask applied)
+ *   ymm10 = wr[4..7] wr[4..7]      ymm11 = wi[4..7] wi[4..7] (with sign mask applied)
+ *   ymm12 = c                      ymm13 = s (with sign mask applied)
+ * Angles are rotated block by block in the same order as the native implementation
+ * does, so the rounding error of the result is the same.
+ */
+
+/* Rotate angle stored in (sr, si) by (c, s) and store the result to (dr, di) */
+#define FASTCONV_ROTATE(dr, di, sr, si) \
+    __ASM_EMIT("vmulps          %%ymm12, %%ymm" sr ", %%ymm" dr)        /* dr   = wr*c */ \
+    __ASM_EMIT("vmulps          %%ymm13, %%ymm" si ", %%ymm0")          /* ymm0 = wi*s */ \
+    __ASM_EMIT("vmulps          %%ymm13, %%ymm" sr ", %%ymm" di)        /* di   = wr*s */ \
+    __ASM_EMIT("vmulps          %%ymm12, %%ymm" si ", %%ymm1")          /* ymm1 = wi*c */ \
+    __ASM_EMIT("vsubps          %%ymm0, %%ymm" dr ", %%ymm" dr)         /* dr   = wr*c - wi*s */ \
+    __ASM_EMIT("vaddps          %%ymm1, %%ymm" di ", %%ymm" di)         /* di   = wr*s + wi*c */
+
+/* Load initial angles of two blocks and the rotation step, mask specifies sign of the imaginary part */
+#define FASTCONV_ANGLE_INIT(mask) \
+    __ASM_EMIT("vbroadcastf128  0x00(%[ak]), %%ymm8")                   /* ymm8  = wr0 */ \
+    __ASM_EMIT("vbroadcastf128  0x10(%[ak]), %%ymm9")                   /* ymm9  = wi0 */ \
+    __ASM_EMIT("vbroadcastss    0x00(%[dw]), %%ymm12")                  /* ymm12 = c */ \
+    __ASM_EMIT("vbroadcastss    0x04(%[dw]), %%ymm13")                  /* ymm13 = s */ \
+    __ASM_EMIT("vxorps          " mask ", %%ymm9, %%ymm9")              /* ymm9  = wi0 ^ mask */ \
+    __ASM_EMIT("vxorps          " mask ", %%ymm13, %%ymm13")            /* ymm13 = s ^ mask */ \
+    FASTCONV_ROTATE("10", "11", "8", "9")                               /* ymm10 = wr1, ymm11 = wi1 */
+
+/* Rotate angles of both blocks to the next pair of blocks */
+#define FASTCONV_ANGLE_STEP \
+    FASTCONV_ROTATE("8", "9", "10", "11") \
+    FASTCONV_ROTATE("10", "11", "8", "9")
+
+/* Two last stages of direct FFT for one block stored in ymm(x) */
+#define FASTCONV_DIRECT_LAST(x, t0, t1, mask) \
+    __ASM_EMIT("vshufps         $0x50, %%ymm" x ", %%ymm" x ", %%ymm" t0)   /* t0 = r0 r0 r1 r1 i0 i0 i1 i1 */ \
+    __ASM_EMIT("vshufps         $0xfa, %%ymm" x ", %%ymm" x ", %%ymm" x)    /* x  = r2 r2 r3 r3 i2 i2 i3 i3 */ \
+    __ASM_EMIT("vaddsubps       %%ymm" x ", %%ymm" t0 ", %%ymm" t0)         /* t0 = r1k r0k r3k r2k i1k i0k i3k i2k */ \
+    __ASM_EMIT("vperm2f128      $0x01, %%ymm" t0 ", %%ymm" t0 ", %%ymm" t1) /* t1 = i1k i0k i3k i2k r1k r0k r3k r2k */ \
+    __ASM_EMIT("vshufps         $0xaf, %%ymm" t1 ", %%ymm" t0 ", %%ymm" t1) /* t1 = r2k r2k i3k i3k i2k i2k r3k r3k */ \
+    __ASM_EMIT("vshufps         $0x05, %%ymm" t0 ", %%ymm" t0 ", %%ymm" t0) /* t0 = r0k r0k r1k r1k i0k i0k i1k i1k */ \
+    __ASM_EMIT("vxorps          %%ymm" mask ", %%ymm" t1 ", %%ymm" t1)      /* t1 = -r2k -r2k -i3k -i3k -i2k -i2k r3k r3k */ \
+    __ASM_EMIT("vaddsubps       %%ymm" t1 ", %%ymm" t0 ", %%ymm" x)         /* x  = r0k+r2k r0k-r2k r1k+i3k r1k-i3k i0k+i2k i0k-i2k i1k-r3k i1k+r3k */
+
+/* Two first stages of reverse FFT for one block stored in ymm(x) */
+#define FASTCONV_REVERSE_FIRST(x, t0, t1, mask) \
+    __ASM_EMIT("vshufps         $0xa0, %%ymm" x ", %%ymm" x ", %%ymm" t0)   /* t0 = r0 r0 r2 r2 i0 i0 i2 i2 */ \
+    __ASM_EMIT("vshufps         $0xf5, %%ymm" x ", %%ymm" x ", %%ymm" x)    /* x  = r1 r1 r3 r3 i1 i1 i3 i3 */ \
+    __ASM_EMIT("vaddsubps       %%ymm" x ", %%ymm" t0 ", %%ymm" t0)         /* t0 = r1k r0k r3k r2k i1k i0k i3k i2k */ \
+    __ASM_EMIT("vperm2f128      $0x01, %%ymm" t0 ", %%ymm" t0 ", %%ymm" t1) /* t1 = i1k i0k i3k i2k r1k r0k r3k r2k */ \
+    __ASM_EMIT("vshufps         $0xaf, %%ymm" t1 ", %%ymm" t0 ", %%ymm" t1) /* t1 = r2k r2k i3k i3k i2k i2k r3k r3k */ \
+    __ASM_EMIT("vshufps         $0x05, %%ymm" t0 ", %%ymm" t0 ", %%ymm" t0) /* t0 = r0k r0k r1k r1k i0k i0k i1k i1k */ \
+    __ASM_EMIT("vxorps          %%ymm" mask ", %%ymm" t1 ", %%ymm" t1)      /* t1 = -r2k -r2k i3k i3k -i2k -i2k -r3k -r3k */ \
+    __ASM_EMIT("vaddsubps       %%ymm" t1 ", %%ymm" t0 ", %%ymm" x)         /* x  = r0k+r2k r0k-r2k r1k-i3k r1k+i3k i0k+i2k i0k-i2k i1k+r3k i1k-r3k */ \
+    __ASM_EMIT("vpermilps       $0xd8, %%ymm" x ", %%ymm" x)                /* x  = r0k+r2k r1k-i3k r0k-r2k r1k+i3k i0k+i2k i1k+r3k i0k-i2k i1k-r3k */
+
+/* Complex multiplication: ymm0 = ymm2*ymm4 - ymm3*ymm5, ymm3 = ymm2*ymm5 + ymm3*ymm4 */
+#define FASTCONV_CMUL \
+    __ASM_EMIT("vmulps          %%ymm4, %%ymm2, %%ymm0")            /* ymm0 = ar*br */ \
+    __ASM_EMIT("vmulps          %%ymm5, %%ymm3, %%ymm1")            /* ymm1 = ai*bi */ \
+    __ASM_EMIT("vmulps          %%ymm5, %%ymm2, %%ymm2")            /* ymm2 = ar*bi */ \
+    __ASM_EMIT("vmulps          %%ymm4, %%ymm3, %%ymm3")            /* ymm3 = ai*br */ \
+    __ASM_EMIT("vsubps          %%ymm1, %%ymm0, %%ymm0")            /* ymm0 = ar*br - ai*bi */ \
+    __ASM_EMIT("vaddps          %%ymm2, %%ymm3, %%ymm3")            /* ymm3 = ar*bi + ai*br */
+
+/* Normalize and store the output of reverse FFT */
+#define FASTCONV_STORE(x, kn, d) \
+    __ASM_EMIT("vmulps          %%" kn ", %%" x ", %%" x) \
+    __ASM_EMIT("vmovups         %%" x ", " d)
+
+/* Normalize and add the output of reverse FFT to the destination */
+#define FASTCONV_ADD(x, kn, d) \
+    __ASM_EMIT("vmulps          %%" kn ", %%" x ", %%" x) \
+    __ASM_EMIT("vaddps          " d ", %%" x ", %%" x) \
+    __ASM_EMIT("vmovups         %%" x ", " d)
+
+namespace avx
+{
+    static inline void fastconv_direct_last(float *dst, size_t items)
+    {
+        ARCH_X86_64_ASM
+        (
+            __ASM_EMIT("vmovaps         %[mask], %%ymm7")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         0x00(%[dst]), %%ymm0")
+            __ASM_EMIT("vmovups         0x20(%[dst]), %%ymm1")
+            FASTCONV_DIRECT_LAST("0", "2", "3", "7")
+            FASTCONV_DIRECT_LAST("1", "4", "5", "7")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst])")
+            __ASM_EMIT("add             $0x40, %[dst]")
+            __ASM_EMIT("sub             $16, %[items]")
+            __ASM_EMIT("jnz             1b")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [items] "+r" (items)
+            : [mask] "m" (XFFT_SIGN_DLAST)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm7"
+        );
+    }
+
+    static inline void fastconv_reverse_first(float *dst, size_t items)
+    {
+        ARCH_X86_64_ASM
+        (
+            __ASM_EMIT("vmovaps         %[mask], %%ymm7")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         0x00(%[dst]), %%ymm0")
+            __ASM_EMIT("vmovups         0x20(%[dst]), %%ymm1")
+            FASTCONV_REVERSE_FIRST("0", "2", "3", "7")
+            FASTCONV_REVERSE_FIRST("1", "4", "5", "7")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst])")
+            __ASM_EMIT("add             $0x40, %[dst]")
+            __ASM_EMIT("sub             $16, %[items]")
+            __ASM_EMIT("jnz             1b")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [items] "+r" (items)
+            : [mask] "m" (XFFT_SIGN_RFIRST)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm7"
+        );
+    }
+
+    #define DSP_ARCH_X86_AVX_FASTCONV_IMPL
+
+    #include <dsp/arch/x86/avx/fastconv/parse.h>
+    #include <dsp/arch/x86/avx/fastconv/restore.h>
+    #include <dsp/arch/x86/avx/fastconv/apply.h>
+
+    #undef DSP_ARCH_X86_AVX_FASTCONV_IMPL
+}
+
+#undef FASTCONV_ADD
+#undef FASTCONV_STORE
+#undef FASTCONV_CMUL
+#undef FASTCONV_REVERSE_FIRST
+#undef FASTCONV_DIRECT_LAST
+#undef FASTCONV_ANGLE_STEP
+#undef FASTCONV_ANGLE_INIT
+#undef FASTCONV_ROTATE
+
+#endif /* ARCH_X86_64 */
+
+#endif /* DSP_ARCH_X86_AVX_FASTCONV_H_ */
@@ -0,0 +1,151 @@
+/*
+ * apply.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX_FASTCONV_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX_FASTCONV_IMPL */
+
+void x64_fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank)
+{
+    // Parse convolution data
+    fastconv_parse_internal(tmp, src, rank);
+
+    // Complete direct FFT, do complex multiplication and prepare reverse FFT
+    size_t items        = size_t(1) << (rank + 1);
+    float *d            = tmp;
+
+    ARCH_X86_64_ASM
+    (
+        __ASM_EMIT("vmovaps         %[dmask], %%ymm14")
+        __ASM_EMIT("vmovaps         %[rmask], %%ymm15")
+
+        __ASM_EMIT("1:")
+        __ASM_EMIT("vmovups         0x00(%[d]), %%ymm0")
+        __ASM_EMIT("vmovups         0x20(%[d]), %%ymm1")
+        FASTCONV_DIRECT_LAST("0", "2", "3", "14")
+        FASTCONV_DIRECT_LAST("1", "4", "5", "14")
+        __ASM_EMIT("vmovups         0x00(%[c]), %%xmm4")
+        __ASM_EMIT("vmovups         0x10(%[c]), %%xmm5")
+        __ASM_EMIT("vperm2f128      $0x20, %%ymm1, %%ymm0, %%ymm2")     /* ymm2 = ar0 ar1 */
+        __ASM_EMIT("vperm2f128      $0x31, %%ymm1, %%ymm0, %%ymm3")     /* ymm3 = ai0 ai1 */
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[c]), %%ymm4, %%ymm4")    /* ymm4 = br0 br1 */
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[c]), %%ymm5, %%ymm5")    /* ymm5 = bi0 bi1 */
+        FASTCONV_CMUL
+        __ASM_EMIT("vperm2f128      $0x20, %%ymm3, %%ymm0, %%ymm1")     /* ymm1 = r0 i0 */
+        __ASM_EMIT("vperm2f128      $0x31, %%ymm3, %%ymm0, %%ymm2")     /* ymm2 = r1 i1 */
+        FASTCONV_REVERSE_FIRST("1", "4", "5", "15")
+        FASTCONV_REVERSE_FIRST("2", "6", "7", "15")
+        __ASM_EMIT("vmovups         %%ymm1, 0x00(%[d])")
+        __ASM_EMIT("vmovups         %%ymm2, 0x20(%[d])")
+        __ASM_EMIT("add             $0x40, %[d]")
+        __ASM_EMIT("add             $0x40, %[c]")
+        __ASM_EMIT("sub             $16, %[items]")
+        __ASM_EMIT("jnz             1b")
+        __ASM_EMIT("vzeroupper")
+
+        : [d] "+r" (d), [c] "+r" (c), [items] "+r" (items)
+        : [dmask] "m" (XFFT_SIGN_DLAST), [rmask] "m" (XFFT_SIGN_RFIRST)
+        : "cc", "memory",
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+          "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+          "%xmm14", "%xmm15"
+    );
+
+    // Do reverse FFT transformation
+    fastconv_restore_internal(dst, tmp, rank);
+}
+
+void x64_fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank)
+{
+    // Do complex multiplication and prepare reverse FFT
+    size_t items        = size_t(1) << (rank + 1);
+    float *d            = tmp;
+
+    ARCH_X86_64_ASM
+    (
+        __ASM_EMIT("vmovaps         %[rmask], %%ymm15")
+
+        __ASM_EMIT("1:")
+        __ASM_EMIT("vmovups         0x00(%[c1]), %%xmm2")
+        __ASM_EMIT("vmovups         0x10(%[c1]), %%xmm3")
+        __ASM_EMIT("vmovups         0x00(%[c2]), %%xmm4")
+        __ASM_EMIT("vmovups         0x10(%[c2]), %%xmm5")
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[c1]), %%ymm2, %%ymm2")   /* ymm2 = ar0 ar1 */
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[c1]), %%ymm3, %%ymm3")   /* ymm3 = ai0 ai1 */
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[c2]), %%ymm4, %%ymm4")   /* ymm4 = br0 br1 */
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[c2]), %%ymm5, %%ymm5")   /* ymm5 = bi0 bi1 */
+        FASTCONV_CMUL
+        __ASM_EMIT("vperm2f128      $0x20, %%ymm3, %%ymm0, %%ymm1")     /* ymm1 = r0 i0 */
+        __ASM_EMIT("vperm2f128      $0x31, %%ymm3, %%ymm0, %%ymm2")     /* ymm2 = r1 i1 */
+        FASTCONV_REVERSE_FIRST("1", "4", "5", "15")
+        FASTCONV_REVERSE_FIRST("2", "6", "7", "15")
+        __ASM_EMIT("vmovups         %%ymm1, 0x00(%[d])")
+        __ASM_EMIT("vmovups         %%ymm2, 0x20(%[d])")
+        __ASM_EMIT("add             $0x40, %[d]")
+        __ASM_EMIT("add             $0x40, %[c1]")
+        __ASM_EMIT("add             $0x40, %[c2]")
+        __ASM_EMIT("sub             $16, %[items]")
+        __ASM_EMIT("jnz             1b")
+        __ASM_EMIT("vzeroupper")
+
+        : [d] "+r" (d), [c1] "+r" (c1), [c2] "+r" (c2), [items] "+r" (items)
+        : [rmask] "m" (XFFT_SIGN_RFIRST)
+        : "cc", "memory",
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+          "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+          "%xmm15"
+    );
+
+    // Do reverse FFT transformation
+    fastconv_restore_internal(dst, tmp, rank);
+}
+
+void x64_fastconv_accumulate(float *dst, const float *c1, const float *c2, size_t rank)
+{
+    size_t items        = size_t(1) << (rank + 1);
+
+    ARCH_X86_64_ASM
+    (
+        __ASM_EMIT("1:")
+        __ASM_EMIT("vmovups         0x00(%[dst]), %%xmm0")
+        __ASM_EMIT("vmovups         0x10(%[dst]), %%xmm1")
+        __ASM_EMIT("vmovups         0x00(%[c1]), %%xmm2")
+        __ASM_EMIT("vmovups         0x10(%[c1]), %%xmm3")
+        __ASM_EMIT("vmovups         0x00(%[c2]), %%xmm4")
+        __ASM_EMIT("vmovups         0x10(%[c2]), %%xmm5")
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[dst]), %%ymm0, %%ymm0")  /* ymm0 = dr0 dr1 */
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[dst]), %%ymm1, %%ymm1")  /* ymm1 = di0 di1 */
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[c1]), %%ymm2, %%ymm2")   /* ymm2 = ar0 ar1 */
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[c1]), %%ymm3, %%ymm3")   /* ymm3 = ai0 ai1 */
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[c2]), %%ymm4, %%ymm4")   /* ymm4 = br0 br1 */
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[c2]), %%ymm5, %%ymm5")   /* ymm5 = bi0 bi1 */
+        __ASM_EMIT("vmulps          %%ymm4, %%ymm2, %%ymm6")            /* ymm6 = ar*br */
+        __ASM_EMIT("vmulps          %%ymm5, %%ymm3, %%ymm7")            /* ymm7 = ai*bi */
+        __ASM_EMIT("vmulps          %%ymm5, %%ymm2, %%ymm2")            /* ymm2 = ar*bi */
+        __ASM_EMIT("vmulps          %%ymm4, %%ymm3, %%ymm3")            /* ymm3 = ai*br */
+        __ASM_EMIT("vsubps          %%ymm7, %%ymm6, %%ymm6")            /* ymm6 = ar*br - ai*bi */
+        __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm2")            /* ymm2 = ar*bi + ai*br */
+        __ASM_EMIT("vaddps          %%ymm6, %%ymm0, %%ymm0")            /* ymm0 = dr + ar*br - ai*bi */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm1, %%ymm1")            /* ymm1 = di + ar*bi + ai*br */
+        __ASM_EMIT("vmovups         %%xmm0, 0x00(%[dst])")
+        __ASM_EMIT("vmovups         %%xmm1, 0x10(%[dst])")
+        __ASM_EMIT("vextractf128    $1, %%ymm0, 0x20(%[dst])")
+        __ASM_EMIT("vextractf128    $1, %%ymm1, 0x30(%[dst])")
+        __ASM_EMIT("add             $0x40, %[dst]")
+        __ASM_EMIT("add             $0x40, %[c1]")
+        __ASM_EMIT("add             $0x40, %[c2]")
+        __ASM_EMIT("sub             $16, %[items]")
+        __ASM_EMIT("jnz             1b")
+        __ASM_EMIT("vzeroupper")
+
+        : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2), [items] "+r" (items)
+        :
+        : "cc", "memory",
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+          "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+    );
+}
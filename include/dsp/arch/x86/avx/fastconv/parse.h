@@ -0,0 +1,176 @@
+/*
+ * parse.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX_FASTCONV_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX_FASTCONV_IMPL */
+
+static inline void fastconv_direct_prepare(float *dst, const float *src, const float *ak, const float *dw, size_t n)
+{
+    // First butterfly: a' = s, b' = s * w, imaginary part of s is zero
+    float *b            = &dst[n];
+    size_t k            = n * sizeof(float);
+
+    ARCH_X86_64_ASM
+    (
+        FASTCONV_ANGLE_INIT("%[mask]")
+        __ASM_EMIT("sub             $0x40, %[k]")
+        __ASM_EMIT("jb              2f")
+
+        /* 2x blocks */
+        __ASM_EMIT("1:")
+        __ASM_EMIT("vmovups         0x00(%[src]), %%xmm0")              /* ymm0 = s0 0 */
+        __ASM_EMIT("vmovups         0x10(%[src]), %%xmm1")              /* ymm1 = s1 0 */
+        __ASM_EMIT("vinsertf128     $1, %%xmm0, %%ymm0, %%ymm2")        /* ymm2 = s0 s0 */
+        __ASM_EMIT("vinsertf128     $1, %%xmm1, %%ymm1, %%ymm3")        /* ymm3 = s1 s1 */
+        __ASM_EMIT("vblendps        $0xf0, %%ymm9, %%ymm8, %%ymm4")     /* ymm4 = wr0 -wi0 */
+        __ASM_EMIT("vblendps        $0xf0, %%ymm11, %%ymm10, %%ymm5")   /* ymm5 = wr1 -wi1 */
+        __ASM_EMIT("vmulps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = s0*wr0 -s0*wi0 */
+        __ASM_EMIT("vmulps          %%ymm5, %%ymm3, %%ymm3")            /* ymm3 = s1*wr1 -s1*wi1 */
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[a])")
+        __ASM_EMIT("vmovups         %%ymm1, 0x20(%[a])")
+        __ASM_EMIT("vmovups         %%ymm2, 0x00(%[b])")
+        __ASM_EMIT("vmovups         %%ymm3, 0x20(%[b])")
+        __ASM_EMIT("add             $0x20, %[src]")
+        __ASM_EMIT("add             $0x40, %[a]")
+        __ASM_EMIT("add             $0x40, %[b]")
+        __ASM_EMIT("sub             $0x40, %[k]")
+        __ASM_EMIT("jb              2f")
+        FASTCONV_ANGLE_STEP
+        __ASM_EMIT("jmp             1b")
+
+        /* 1x block */
+        __ASM_EMIT("2:")
+        __ASM_EMIT("add             $0x20, %[k]")
+        __ASM_EMIT("jl              4f")
+        __ASM_EMIT("vmovups         0x00(%[src]), %%xmm0")              /* ymm0 = s0 0 */
+        __ASM_EMIT("vinsertf128     $1, %%xmm0, %%ymm0, %%ymm2")        /* ymm2 = s0 s0 */
+        __ASM_EMIT("vblendps        $0xf0, %%ymm9, %%ymm8, %%ymm4")     /* ymm4 = wr0 -wi0 */
+        __ASM_EMIT("vmulps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = s0*wr0 -s0*wi0 */
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[a])")
+        __ASM_EMIT("vmovups         %%ymm2, 0x00(%[b])")
+
+        __ASM_EMIT("4:")
+        __ASM_EMIT("vzeroupper")
+
+        : [a] "+r" (dst), [b] "+r" (b), [src] "+r" (src), [k] "+r" (k)
+        : [ak] "r" (ak), [dw] "r" (dw),
+          [mask] "m" (XFFT_SIGN_IM)
+        : "cc", "memory",
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+          "%xmm4", "%xmm5",
+          "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+          "%xmm12", "%xmm13"
+    );
+}
+
+static inline void fastconv_direct_butterfly(float *dst, const float *ak, const float *dw, size_t n, size_t items)
+{
+    // c = a - b, a' = a + b, b' = c * w
+    // Butterflies of all groups that share the same angle are computed at once
+    float *end          = &dst[items];
+    float *a, *b;
+    size_t k            = n * sizeof(float);
+
+    ARCH_X86_64_ASM
+    (
+        FASTCONV_ANGLE_INIT("%[mask]")
+        __ASM_EMIT("cmp             $0x20, %[k]")
+        __ASM_EMIT("je              4f")
+
+        /* 2x blocks */
+        __ASM_EMIT("1:")
+        __ASM_EMIT("mov             %[dst], %[a]")
+        __ASM_EMIT("2:")
+        __ASM_EMIT("lea             (%[a], %[n]), %[b]")
+        __ASM_EMIT("vmovups         0x00(%[a]), %%ymm0")                /* ymm0 = a0 */
+        __ASM_EMIT("vmovups         0x20(%[a]), %%ymm1")                /* ymm1 = a1 */
+        __ASM_EMIT("vmovups         0x00(%[b]), %%ymm2")                /* ymm2 = b0 */
+        __ASM_EMIT("vmovups         0x20(%[b]), %%ymm3")                /* ymm3 = b1 */
+        __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm4")            /* ymm4 = cr0 ci0 = a0 - b0 */
+        __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm5")            /* ymm5 = cr1 ci1 = a1 - b1 */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = a0 + b0 */
+        __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm1")            /* ymm1 = a1 + b1 */
+        __ASM_EMIT("vperm2f128      $0x01, %%ymm4, %%ymm4, %%ymm2")     /* ymm2 = ci0 cr0 */
+        __ASM_EMIT("vperm2f128      $0x01, %%ymm5, %%ymm5, %%ymm3")     /* ymm3 = ci1 cr1 */
+        __ASM_EMIT("vmulps          %%ymm8, %%ymm4, %%ymm4")            /* ymm4 = wr0*cr0 wr0*ci0 */
+        __ASM_EMIT("vmulps          %%ymm10, %%ymm5, %%ymm5")           /* ymm5 = wr1*cr1 wr1*ci1 */
+        __ASM_EMIT("vmulps          %%ymm9, %%ymm2, %%ymm2")            /* ymm2 = wi0*ci0 -wi0*cr0 */
+        __ASM_EMIT("vmulps          %%ymm11, %%ymm3, %%ymm3")           /* ymm3 = wi1*ci1 -wi1*cr1 */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm4, %%ymm2")            /* ymm2 = b0' */
+        __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm3")            /* ymm3 = b1' */
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[a])")
+        __ASM_EMIT("vmovups         %%ymm1, 0x20(%[a])")
+        __ASM_EMIT("vmovups         %%ymm2, 0x00(%[b])")
+        __ASM_EMIT("vmovups         %%ymm3, 0x20(%[b])")
+        __ASM_EMIT("add             %[bs], %[a]")
+        __ASM_EMIT("cmp             %[end], %[a]")
+        __ASM_EMIT("jb              2b")
+        __ASM_EMIT("add             $0x40, %[dst]")
+        __ASM_EMIT("sub             $0x40, %[k]")
+        __ASM_EMIT("jz              6f")
+        FASTCONV_ANGLE_STEP
+        __ASM_EMIT("jmp             1b")
+
+        /* 1x block */
+        __ASM_EMIT("4:")
+        __ASM_EMIT("vmovups         0x00(%[dst]), %%ymm0")              /* ymm0 = a0 */
+        __ASM_EMIT("vmovups         0x20(%[dst]), %%ymm2")              /* ymm2 = b0 */
+        __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm4")            /* ymm4 = cr0 ci0 = a0 - b0 */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = a0 + b0 */
+        __ASM_EMIT("vperm2f128      $0x01, %%ymm4, %%ymm4, %%ymm2")     /* ymm2 = ci0 cr0 */
+        __ASM_EMIT("vmulps          %%ymm8, %%ymm4, %%ymm4")            /* ymm4 = wr0*cr0 wr0*ci0 */
+        __ASM_EMIT("vmulps          %%ymm9, %%ymm2, %%ymm2")            /* ymm2 = wi0*ci0 -wi0*cr0 */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm4, %%ymm2")            /* ymm2 = b0' */
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+        __ASM_EMIT("vmovups         %%ymm2, 0x20(%[dst])")
+        __ASM_EMIT("add             $0x40, %[dst]")
+        __ASM_EMIT("cmp             %[end], %[dst]")
+        __ASM_EMIT("jb              4b")
+
+        __ASM_EMIT("6:")
+        __ASM_EMIT("vzeroupper")
+
+        : [dst] "+r" (dst), [a] "=&r" (a), [b] "=&r" (b), [k] "+&r" (k)
+        : [n] "r" (n * sizeof(float)), [bs] "r" (n * sizeof(float) * 2),
+          [end] "r" (end),
+          [ak] "r" (ak), [dw] "r" (dw),
+          [mask] "m" (XFFT_SIGN_IM)
+        : "cc", "memory",
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+          "%xmm4", "%xmm5",
+          "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+          "%xmm12", "%xmm13"
+    );
+}
+
+static inline void fastconv_parse_internal(float *dst, const float *src, size_t rank)
+{
+    const float *ak     = &XFFT_A[(rank - 3) << 3];
+    const float *dw     = &XFFT_DW[(rank - 3) << 1];
+    size_t items        = size_t(1) << (rank + 1);
+    size_t n            = items >> 1;
+
+    // Iterate first cycle
+    fastconv_direct_prepare(dst, src, ak, dw, n);
+
+    // Iterate butterflies
+    for (n >>= 1; n >= 8; n >>= 1)
+    {
+        ak     -= 8;
+        dw     -= 2;
+        fastconv_direct_butterfly(dst, ak, dw, n, items);
+    }
+}
+
+void x64_fastconv_parse(float *dst, const float *src, size_t rank)
+{
+    fastconv_parse_internal(dst, src, rank);
+
+    // Add two last stages
+    fastconv_direct_last(dst, size_t(1) << (rank + 1));
+}
@@ -0,0 +1,213 @@
+/*
+ * restore.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX_FASTCONV_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX_FASTCONV_IMPL */
+
+static inline void fastconv_reverse_butterfly(float *dst, const float *ak, const float *dw, size_t n, size_t items)
+{
+    // c = b * w, a' = a + c, b' = a - c
+    // Butterflies of all groups that share the same angle are computed at once
+    float *end          = &dst[items];
+    float *a, *b;
+    size_t k            = n * sizeof(float);
+
+    ARCH_X86_64_ASM
+    (
+        FASTCONV_ANGLE_INIT("%[mask]")
+        __ASM_EMIT("cmp             $0x20, %[k]")
+        __ASM_EMIT("je              4f")
+
+        /* 2x blocks */
+        __ASM_EMIT("1:")
+        __ASM_EMIT("mov             %[dst], %[a]")
+        __ASM_EMIT("2:")
+        __ASM_EMIT("lea             (%[a], %[n]), %[b]")
+        __ASM_EMIT("vmovups         0x00(%[b]), %%ymm2")                /* ymm2 = br0 bi0 */
+        __ASM_EMIT("vmovups         0x20(%[b]), %%ymm3")                /* ymm3 = br1 bi1 */
+        __ASM_EMIT("vperm2f128      $0x01, %%ymm2, %%ymm2, %%ymm4")     /* ymm4 = bi0 br0 */
+        __ASM_EMIT("vperm2f128      $0x01, %%ymm3, %%ymm3, %%ymm5")     /* ymm5 = bi1 br1 */
+        __ASM_EMIT("vmulps          %%ymm8, %%ymm2, %%ymm2")            /* ymm2 = wr0*br0 wr0*bi0 */
+        __ASM_EMIT("vmulps          %%ymm10, %%ymm3, %%ymm3")           /* ymm3 = wr1*br1 wr1*bi1 */
+        __ASM_EMIT("vmulps          %%ymm9, %%ymm4, %%ymm4")            /* ymm4 = -wi0*bi0 wi0*br0 */
+        __ASM_EMIT("vmulps          %%ymm11, %%ymm5, %%ymm5")           /* ymm5 = -wi1*bi1 wi1*br1 */
+        __ASM_EMIT("vaddps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = c0 = w0 * b0 */
+        __ASM_EMIT("vaddps          %%ymm5, %%ymm3, %%ymm3")            /* ymm3 = c1 = w1 * b1 */
+        __ASM_EMIT("vmovups         0x00(%[a]), %%ymm0")                /* ymm0 = a0 */
+        __ASM_EMIT("vmovups         0x20(%[a]), %%ymm1")                /* ymm1 = a1 */
+        __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm4")            /* ymm4 = a0 - c0 */
+        __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm5")            /* ymm5 = a1 - c1 */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = a0 + c0 */
+        __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm1")            /* ymm1 = a1 + c1 */
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[a])")
+        __ASM_EMIT("vmovups         %%ymm1, 0x20(%[a])")
+        __ASM_EMIT("vmovups         %%ymm4, 0x00(%[b])")
+        __ASM_EMIT("vmovups         %%ymm5, 0x20(%[b])")
+        __ASM_EMIT("add             %[bs], %[a]")
+        __ASM_EMIT("cmp             %[end], %[a]")
+        __ASM_EMIT("jb              2b")
+        __ASM_EMIT("add             $0x40, %[dst]")
+        __ASM_EMIT("sub             $0x40, %[k]")
+        __ASM_EMIT("jz              6f")
+        FASTCONV_ANGLE_STEP
+        __ASM_EMIT("jmp             1b")
+
+        /* 1x block */
+        __ASM_EMIT("4:")
+        __ASM_EMIT("vmovups         0x20(%[dst]), %%ymm2")              /* ymm2 = br0 bi0 */
+        __ASM_EMIT("vperm2f128      $0x01, %%ymm2, %%ymm2, %%ymm4")     /* ymm4 = bi0 br0 */
+        __ASM_EMIT("vmulps          %%ymm8, %%ymm2, %%ymm2")            /* ymm2 = wr0*br0 wr0*bi0 */
+        __ASM_EMIT("vmulps          %%ymm9, %%ymm4, %%ymm4")            /* ymm4 = -wi0*bi0 wi0*br0 */
+        __ASM_EMIT("vaddps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = c0 = w0 * b0 */
+        __ASM_EMIT("vmovups         0x00(%[dst]), %%ymm0")              /* ymm0 = a0 */
+        __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm4")            /* ymm4 = a0 - c0 */
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = a0 + c0 */
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+        __ASM_EMIT("vmovups         %%ymm4, 0x20(%[dst])")
+        __ASM_EMIT("add             $0x40, %[dst]")
+        __ASM_EMIT("cmp             %[end], %[dst]")
+        __ASM_EMIT("jb              4b")
+
+        __ASM_EMIT("6:")
+        __ASM_EMIT("vzeroupper")
+
+        : [dst] "+r" (dst), [a] "=&r" (a), [b] "=&r" (b), [k] "+&r" (k)
+        : [n] "r" (n * sizeof(float)), [bs] "r" (n * sizeof(float) * 2),
+          [end] "r" (end),
+          [ak] "r" (ak), [dw] "r" (dw),
+          [mask] "m" (XFFT_SIGN_RE)
+        : "cc", "memory",
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+          "%xmm4", "%xmm5",
+          "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+          "%xmm12", "%xmm13"
+    );
+}
+
+// Last butterfly: only real part of the result is computed and normalized
+#define FASTCONV_REVERSE_UNPACK(STORE) \
+    float *b            = &tmp[n]; \
+    float *d2           = &dst[n >> 1]; \
+    size_t k            = n * sizeof(float); \
+    float kn            = 1.0f / n; \
+    \
+    ARCH_X86_64_ASM \
+    ( \
+        FASTCONV_ANGLE_INIT("%[mask]") \
+        __ASM_EMIT("vbroadcastss    %[kn], %%ymm7")                     /* ymm7 = kn */ \
+        __ASM_EMIT("sub             $0x40, %[k]") \
+        __ASM_EMIT("jb              2f") \
+        \
+        /* 2x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("vmovups         0x00(%[b]), %%xmm2") \
+        __ASM_EMIT("vmovups         0x10(%[b]), %%xmm3") \
+        __ASM_EMIT("vmovups         0x00(%[a]), %%xmm0") \
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[b]), %%ymm2, %%ymm2")    /* ymm2 = br0 br1 */ \
+        __ASM_EMIT("vinsertf128     $1, 0x30(%[b]), %%ymm3, %%ymm3")    /* ymm3 = bi0 bi1 */ \
+        __ASM_EMIT("vinsertf128     $1, 0x20(%[a]), %%ymm0, %%ymm0")    /* ymm0 = ar0 ar1 */ \
+        __ASM_EMIT("vperm2f128      $0x20, %%ymm10, %%ymm8, %%ymm4")    /* ymm4 = wr0 wr1 */ \
+        __ASM_EMIT("vperm2f128      $0x20, %%ymm11, %%ymm9, %%ymm5")    /* ymm5 = -wi0 -wi1 */ \
+        __ASM_EMIT("vmulps          %%ymm4, %%ymm2, %%ymm2")            /* ymm2 = wr*br */ \
+        __ASM_EMIT("vmulps          %%ymm5, %%ymm3, %%ymm3")            /* ymm3 = -wi*bi */ \
+        __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm2")            /* ymm2 = cr = wr*br - wi*bi */ \
+        __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm1")            /* ymm1 = ar - cr */ \
+        __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = ar + cr */ \
+        STORE("ymm0", "ymm7", "0x00(%[d1])") \
+        STORE("ymm1", "ymm7", "0x00(%[d2])") \
+        __ASM_EMIT("add             $0x40, %[a]") \
+        __ASM_EMIT("add             $0x40, %[b]") \
+        __ASM_EMIT("add             $0x20, %[d1]") \
+        __ASM_EMIT("add             $0x20, %[d2]") \
+        __ASM_EMIT("sub             $0x40, %[k]") \
+        __ASM_EMIT("jb              2f") \
+        FASTCONV_ANGLE_STEP \
+        __ASM_EMIT("jmp             1b") \
+        \
+        /* 1x block */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add             $0x20, %[k]") \
+        __ASM_EMIT("jl              4f") \
+        __ASM_EMIT("vmovups         0x00(%[b]), %%xmm2")                /* xmm2 = br0 */ \
+        __ASM_EMIT("vmovups         0x10(%[b]), %%xmm3")                /* xmm3 = bi0 */ \
+        __ASM_EMIT("vmovups         0x00(%[a]), %%xmm0")                /* xmm0 = ar0 */ \
+        __ASM_EMIT("vmulps          %%xmm8, %%xmm2, %%xmm2")            /* xmm2 = wr*br */ \
+        __ASM_EMIT("vmulps          %%xmm9, %%xmm3, %%xmm3")            /* xmm3 = -wi*bi */ \
+        __ASM_EMIT("vaddps          %%xmm3, %%xmm2, %%xmm2")            /* xmm2 = cr = wr*br - wi*bi */ \
+        __ASM_EMIT("vsubps          %%xmm2, %%xmm0, %%xmm1")            /* xmm1 = ar - cr */ \
+        __ASM_EMIT("vaddps          %%xmm2, %%xmm0, %%xmm0")            /* xmm0 = ar + cr */ \
+        STORE("xmm0", "xmm7", "0x00(%[d1])") \
+        STORE("xmm1", "xmm7", "0x00(%[d2])") \
+        \
+        __ASM_EMIT("4:") \
+        __ASM_EMIT("vzeroupper") \
+        \
+        : [a] "+r" (tmp), [b] "+r" (b), [d1] "+r" (dst), [d2] "+r" (d2), \
+          [k] "+r" (k) \
+        : [ak] "r" (ak), [dw] "r" (dw), \
+          [kn] "m" (kn), \
+          [mask] "m" (XFFT_SIGN_RE) \
+        : "cc", "memory", \
+          "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+          "%xmm4", "%xmm5", "%xmm7", \
+          "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+          "%xmm12", "%xmm13" \
+    );
+
+static inline void fastconv_reverse_unpack(float *dst, float *tmp, const float *ak, const float *dw, size_t n)
+{
+    FASTCONV_REVERSE_UNPACK(FASTCONV_STORE)
+}
+
+static inline void fastconv_reverse_unpack_adding(float *dst, float *tmp, const float *ak, const float *dw, size_t n)
+{
+    FASTCONV_REVERSE_UNPACK(FASTCONV_ADD)
+}
+
+#undef FASTCONV_REVERSE_UNPACK
+
+static inline void fastconv_restore_internal(float *dst, float *tmp, size_t rank)
+{
+    const float *ak     = XFFT_A;
+    const float *dw     = XFFT_DW;
+    size_t last         = size_t(1) << rank;
+    size_t items        = last << 1;
+
+    // Iterate butterflies
+    for (size_t n=8; n < last; n <<= 1)
+    {
+        fastconv_reverse_butterfly(tmp, ak, dw, n, items);
+        ak     += 8;
+        dw     += 2;
+    }
+
+    // Add the result to the target
+    fastconv_reverse_unpack_adding(dst, tmp, ak, dw, last);
+}
+
+void x64_fastconv_restore(float *dst, float *tmp, size_t rank)
+{
+    const float *ak     = XFFT_A;
+    const float *dw     = XFFT_DW;
+    size_t last         = size_t(1) << rank;
+    size_t items        = last << 1;
+
+    // Add two first stages
+    fastconv_reverse_first(tmp, items);
+
+    // Iterate butterflies
+    for (size_t n=8; n < last; n <<= 1)
+    {
+        fastconv_reverse_butterfly(tmp, ak, dw, n, items);
+        ak     += 8;
+        dw     += 2;
+    }
+
+    // Store the result to the target
+    fastconv_reverse_unpack(dst, tmp, ak, dw, last);
+}
@@ -0,0 +1,87 @@
+/*
+ * const.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX_FFT_CONST_H_
+#define DSP_ARCH_X86_AVX_FFT_CONST_H_
+
+#ifndef DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX_IMPL */
+
+namespace avx
+{
+    /* Rotation angles: [re, im] of exp(j*pi/2^r) */
+    static const float XFFT_DW[] __lsp_aligned32 =
+    {
+        // Re, Im
+        0.0000000000000000f, 1.0000000000000000f,
+        0.0000000000000000f, 1.0000000000000000f,
+        0.7071067811865475f, 0.7071067811865475f,
+        0.9238795325112868f, 0.3826834323650898f,
+        0.9807852804032305f, 0.1950903220161283f,
+        0.9951847266721969f, 0.0980171403295606f,
+        0.9987954562051724f, 0.0490676743274180f,
+        0.9996988186962042f, 0.0245412285229123f,
+        0.9999247018391445f, 0.0122715382857199f,
+        0.9999811752826011f, 0.0061358846491545f,
+        0.9999952938095762f, 0.0030679567629660f,
+        0.9999988234517019f, 0.0015339801862848f,
+        0.9999997058628822f, 0.0007669903187427f,
+        0.9999999264657179f, 0.0003834951875714f,
+        0.9999999816164293f, 0.0001917475973107f,
+        0.9999999954041073f, 0.0000958737990960f,
+        0.9999999988510268f, 0.0000479368996031f
+    };
+
+    /* Initial angles: [re0 re1 re2 re3 im0 im1 im2 im3] of exp(j*i*pi/2^(r+2)) */
+    static const float XFFT_A[] __lsp_aligned32 =
+    {
+        1.0000000000000000f, 0.7071067811865475f, 0.0000000000000000f, -0.7071067811865475f,0.0000000000000000f, 0.7071067811865475f, 1.0000000000000000f, 0.7071067811865476f,
+        1.0000000000000000f, 0.9238795325112868f, 0.7071067811865475f, 0.3826834323650898f, 0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+        1.0000000000000000f, 0.9807852804032305f, 0.9238795325112868f, 0.8314696123025452f, 0.0000000000000000f, 0.1950903220161283f, 0.3826834323650898f, 0.5555702330196022f,
+        1.0000000000000000f, 0.9951847266721969f, 0.9807852804032305f, 0.9569403357322089f, 0.0000000000000000f, 0.0980171403295606f, 0.1950903220161283f, 0.2902846772544624f,
+        1.0000000000000000f, 0.9987954562051724f, 0.9951847266721969f, 0.9891765099647810f, 0.0000000000000000f, 0.0490676743274180f, 0.0980171403295606f, 0.1467304744553617f,
+        1.0000000000000000f, 0.9996988186962042f, 0.9987954562051724f, 0.9972904566786902f, 0.0000000000000000f, 0.0245412285229123f, 0.0490676743274180f, 0.0735645635996674f,
+        1.0000000000000000f, 0.9999247018391445f, 0.9996988186962042f, 0.9993223845883495f, 0.0000000000000000f, 0.0122715382857199f, 0.0245412285229123f, 0.0368072229413588f,
+        1.0000000000000000f, 0.9999811752826011f, 0.9999247018391445f, 0.9998305817958234f, 0.0000000000000000f, 0.0061358846491545f, 0.0122715382857199f, 0.0184067299058048f,
+        1.0000000000000000f, 0.9999952938095762f, 0.9999811752826011f, 0.9999576445519639f, 0.0000000000000000f, 0.0030679567629660f, 0.0061358846491545f, 0.0092037547820598f,
+        1.0000000000000000f, 0.9999988234517019f, 0.9999952938095762f, 0.9999894110819284f, 0.0000000000000000f, 0.0015339801862848f, 0.0030679567629660f, 0.0046019261204486f,
+        1.0000000000000000f, 0.9999997058628822f, 0.9999988234517019f, 0.9999973527669782f, 0.0000000000000000f, 0.0007669903187427f, 0.0015339801862848f, 0.0023009691514258f,
+        1.0000000000000000f, 0.9999999264657179f, 0.9999997058628822f, 0.9999993381915255f, 0.0000000000000000f, 0.0003834951875714f, 0.0007669903187427f, 0.0011504853371138f,
+        1.0000000000000000f, 0.9999999816164293f, 0.9999999264657179f, 0.9999998345478677f, 0.0000000000000000f, 0.0001917475973107f, 0.0003834951875714f, 0.0005752427637321f,
+        1.0000000000000000f, 0.9999999954041073f, 0.9999999816164293f, 0.9999999586369661f, 0.0000000000000000f, 0.0000958737990960f, 0.0001917475973107f, 0.0002876213937629f,
+        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f, 0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f
+    };
+
+    /* Sign masks for 256-bit [re0 re1 re2 re3 im0 im1 im2 im3] vectors */
+    static const uint32_t XFFT_SIGN_IM[] __lsp_aligned32 =
+    {
+        0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        0x80000000, 0x80000000, 0x80000000, 0x80000000
+    };
+
+    static const uint32_t XFFT_SIGN_RE[] __lsp_aligned32 =
+    {
+        0x80000000, 0x80000000, 0x80000000, 0x80000000,
+        0x00000000, 0x00000000, 0x00000000, 0x00000000
+    };
+
+    /* Sign masks for two last direct and two first reverse in-block stages */
+    static const uint32_t XFFT_SIGN_DLAST[] __lsp_aligned32 =
+    {
+        0x80000000, 0x80000000, 0x80000000, 0x80000000,
+        0x80000000, 0x80000000, 0x00000000, 0x00000000
+    };
+
+    static const uint32_t XFFT_SIGN_RFIRST[] __lsp_aligned32 =
+    {
+        0x80000000, 0x80000000, 0x00000000, 0x00000000,
+        0x80000000, 0x80000000, 0x80000000, 0x80000000
+    };
+}
+
+#endif /* DSP_ARCH_X86_AVX_FFT_CONST_H_ */
@@ -0,0 +1,249 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE_DYNAMICS_H_
+#define DSP_ARCH_X86_SSE_DYNAMICS_H_
+
+#ifndef DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE_IMPL */
+
+#define DYN_KNEE_BUF_SIZE       0x100       /* The ASM code addresses second half of buffer at offset 0x400 */
+
+namespace sse
+{
+#define X4VEC(x)    x, x, x, x
+
+IF_ARCH_X86(
+    static const uint32_t DYN_KNEE_XC[] __lsp_aligned16 =
+    {
+        X4VEC(0x7fffffff),      // abs
+        X4VEC(0x0da24260),      // DYN_KNEE_X_MIN = 1e-30
+        X4VEC(0x501502f9)       // DYN_KNEE_X_MAX = 1e+10
+    };
+)
+
+#undef X4VEC
+
+#define DYN_KNEE_ABS_BODY(N, MOV) \
+    __ASM_EMIT(MOV "       0x00(%[src], %[off]), %%xmm0")   /* xmm0 = s */ \
+    __ASM_EMIT("andps       0x00 + %[XC], %%xmm0")          /* xmm0 = x = abs(s) */ \
+    __ASM_EMIT("movaps      %%xmm0, %%xmm1")                /* xmm1 = x */ \
+    __ASM_EMIT(MOV "       %%xmm0, 0x400(%[buf], %[off])") \
+    __ASM_EMIT("maxps       0x10 + %[XC], %%xmm1")          /* xmm1 = max(x, X_MIN) */ \
+    __ASM_EMIT("minps       0x20 + %[XC], %%xmm1")          /* xmm1 = min(max(x, X_MIN), X_MAX) */ \
+    __ASM_EMIT(MOV "       %%xmm1, 0x000(%[buf], %[off])") \
+    __ASM_EMIT("add         $" N ", %[off]")
+
+#define DYN_KNEE_POLY_BODY(N, MOV) \
+    __ASM_EMIT(MOV "       0x000(%[buf], %[off]), %%xmm0")  /* xmm0 = l */ \
+    __ASM_EMIT("movaps      0x00(%[K]), %%xmm1")            /* xmm1 = lo0 */ \
+    __ASM_EMIT("movaps      0x40(%[K]), %%xmm2")            /* xmm2 = kn0 */ \
+    __ASM_EMIT("movaps      0x80(%[K]), %%xmm3")            /* xmm3 = hi0 */ \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm2") \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm3") \
+    __ASM_EMIT("addps       0x10(%[K]), %%xmm1")            /* xmm1 = lo0*l + lo1 */ \
+    __ASM_EMIT("addps       0x50(%[K]), %%xmm2")            /* xmm2 = kn0*l + kn1 */ \
+    __ASM_EMIT("addps       0x90(%[K]), %%xmm3")            /* xmm3 = hi0*l + hi1 */ \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm2") \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm3") \
+    __ASM_EMIT("addps       0x20(%[K]), %%xmm1")            /* xmm1 = (lo0*l + lo1)*l + lo2 */ \
+    __ASM_EMIT("addps       0x60(%[K]), %%xmm2")            /* xmm2 = (kn0*l + kn1)*l + kn2 */ \
+    __ASM_EMIT("addps       0xa0(%[K]), %%xmm3")            /* xmm3 = (hi0*l + hi1)*l + hi2 */ \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm2") \
+    __ASM_EMIT("mulps       %%xmm0, %%xmm3") \
+    __ASM_EMIT(MOV "       0x400(%[buf], %[off]), %%xmm4")  /* xmm4 = x */ \
+    __ASM_EMIT("movaps      0xd0(%[K]), %%xmm5")            /* xmm5 = end */ \
+    __ASM_EMIT("addps       0x30(%[K]), %%xmm1")            /* xmm1 = el */ \
+    __ASM_EMIT("addps       0x70(%[K]), %%xmm2")            /* xmm2 = ek */ \
+    __ASM_EMIT("addps       0xb0(%[K]), %%xmm3")            /* xmm3 = eh */ \
+    __ASM_EMIT("cmpltps     %%xmm4, %%xmm5")                /* xmm5 = [end < x] */ \
+    __ASM_EMIT("cmpltps     0xc0(%[K]), %%xmm4")            /* xmm4 = [x < start] */ \
+    __ASM_EMIT("andps       %%xmm5, %%xmm3")                /* xmm3 = eh & [end < x] */ \
+    __ASM_EMIT("andnps      %%xmm2, %%xmm5")                /* xmm5 = ek & [end >= x] */ \
+    __ASM_EMIT("orps        %%xmm3, %%xmm5")                /* xmm5 = e = (x > end) ? eh : ek */ \
+    __ASM_EMIT("andps       %%xmm4, %%xmm1")                /* xmm1 = el & [x < start] */ \
+    __ASM_EMIT("andnps      %%xmm5, %%xmm4")                /* xmm4 = e & [x >= start] */ \
+    __ASM_EMIT("orps        %%xmm1, %%xmm4")                /* xmm4 = (x < start) ? el : e */ \
+    __ASM_EMIT("maxps       0xe0(%[K]), %%xmm4")            /* xmm4 = max(e, LOG_MIN) */ \
+    __ASM_EMIT("minps       0xf0(%[K]), %%xmm4")            /* xmm4 = min(max(e, LOG_MIN), LOG_MAX) */ \
+    __ASM_EMIT(MOV "       %%xmm4, 0x00(%[dst], %[off])") \
+    __ASM_EMIT("add         $" N ", %[off]")
+
+    /**
+     * Compute logarithm of the gain for the block of samples, the transcendental
+     * functions are computed by the dsp::loge1 and dsp::exp1 kernels
+     *
+     * @param dst destination buffer to store logarithm of the gain
+     * @param buf temporary buffer of DYN_KNEE_BUF_SIZE*2 elements, the second half
+     *   stores absolute values of source samples
+     * @param src source samples
+     * @param c gain curve
+     * @param count number of samples, should not be greater than DYN_KNEE_BUF_SIZE
+     */
+    static void dyn_knee_log_gain(float *dst, float *buf, const float *src, const dsp::dyn_knee_t *c, size_t count)
+    {
+        float k[0x40] __lsp_aligned16;
+        IF_ARCH_X86(size_t off, n);
+
+        // Prepare the broadcasted parameters of the curve
+        for (size_t i=0; i<4; ++i)
+        {
+            for (size_t j=0; j<4; ++j)
+            {
+                k[0x00 + i*4 + j]   = c->lo[i];
+                k[0x10 + i*4 + j]   = c->knee[i];
+                k[0x20 + i*4 + j]   = c->hi[i];
+            }
+            k[0x30 + i]         = c->start;
+            k[0x34 + i]         = c->end;
+            k[0x38 + i]         = DYN_KNEE_LOG_MIN;
+            k[0x3c + i]         = DYN_KNEE_LOG_MAX;
+        }
+
+        // Compute absolute values and limit them
+        IF_ARCH_X86(n = count);
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("sub         $4, %[n]")
+            __ASM_EMIT("jb          2f")
+            __ASM_EMIT("1:")
+            DYN_KNEE_ABS_BODY("0x10", "movups")
+            __ASM_EMIT("sub         $4, %[n]")
+            __ASM_EMIT("jae         1b")
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add         $3, %[n]")
+            __ASM_EMIT("jl          4f")
+            __ASM_EMIT("3:")
+            DYN_KNEE_ABS_BODY("0x04", "movss ")
+            __ASM_EMIT("dec         %[n]")
+            __ASM_EMIT("jge         3b")
+            __ASM_EMIT("4:")
+
+            : [off] "=&r" (off), [n] "+r" (n)
+            : [src] "r" (src), [buf] "r" (buf),
+              [XC] "o" (DYN_KNEE_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm1"
+        );
+
+        dsp::loge1(buf, count);
+
+        // Evaluate all polynomials and select the result by masks
+        IF_ARCH_X86(n = count);
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("sub         $4, %[n]")
+            __ASM_EMIT("jb          2f")
+            __ASM_EMIT("1:")
+            DYN_KNEE_POLY_BODY("0x10", "movups")
+            __ASM_EMIT("sub         $4, %[n]")
+            __ASM_EMIT("jae         1b")
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add         $3, %[n]")
+            __ASM_EMIT("jl          4f")
+            __ASM_EMIT("3:")
+            DYN_KNEE_POLY_BODY("0x04", "movss ")
+            __ASM_EMIT("dec         %[n]")
+            __ASM_EMIT("jge         3b")
+            __ASM_EMIT("4:")
+
+            : [off] "=&r" (off), [n] "+r" (n)
+            : [dst] "r" (dst), [buf] "r" (buf),
+              [K] "r" (k)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+    }
+
+#undef DYN_KNEE_ABS_BODY
+#undef DYN_KNEE_POLY_BODY
+
+    /**
+     * Check that all samples of the block lie in the same region of the curve
+     * where the gain does not depend on the level
+     *
+     * @param src source samples
+     * @param c gain curve
+     * @param count number of samples
+     * @return the gain of the region or negative value if it should be computed for each sample
+     */
+    static float dyn_knee_flat_gain(const float *src, const dsp::dyn_knee_t *c, size_t count)
+    {
+        float min, max;
+        dsp::abs_minmax(src, count, &min, &max);
+
+        const float *p  = (max < c->start) ? c->lo :
+                          (min > c->end) ? c->hi : NULL;
+        if ((p == NULL) || (p[0] != 0.0f) || (p[1] != 0.0f) || (p[2] != 0.0f))
+            return -1.0f;
+
+        float e         = (p[3] < DYN_KNEE_LOG_MIN) ? DYN_KNEE_LOG_MIN :
+                          (p[3] > DYN_KNEE_LOG_MAX) ? DYN_KNEE_LOG_MAX : p[3];
+        return expf(e);
+    }
+
+    void dyn_gain(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count)
+    {
+        float buf[DYN_KNEE_BUF_SIZE*2] __lsp_aligned16;
+
+        while (count > 0)
+        {
+            size_t to_do    = (count > DYN_KNEE_BUF_SIZE) ? DYN_KNEE_BUF_SIZE : count;
+
+            float g         = dyn_knee_flat_gain(src, knee, to_do);
+            if (g >= 0.0f)
+                dsp::fill(dst, g, to_do);
+            else
+            {
+                dyn_knee_log_gain(dst, buf, src, knee, to_do);
+                dsp::exp1(dst, to_do);
+            }
+
+            dst            += to_do;
+            src            += to_do;
+            count          -= to_do;
+        }
+    }
+
+    void dyn_curve(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count)
+    {
+        float buf[DYN_KNEE_BUF_SIZE*2] __lsp_aligned16;
+
+        while (count > 0)
+        {
+            size_t to_do    = (count > DYN_KNEE_BUF_SIZE) ? DYN_KNEE_BUF_SIZE : count;
+
+            float g         = dyn_knee_flat_gain(src, knee, to_do);
+            if (g >= 0.0f)
+            {
+                dsp::abs2(dst, src, to_do);
+                dsp::scale2(dst, g, to_do);
+            }
+            else
+            {
+                dyn_knee_log_gain(dst, buf, src, knee, to_do);
+                dsp::exp1(dst, to_do);
+                dsp::mul2(dst, &buf[DYN_KNEE_BUF_SIZE], to_do);
+            }
+
+            dst            += to_do;
+            src            += to_do;
+            count          -= to_do;
+        }
+    }
+}
+
+#undef DYN_KNEE_BUF_SIZE
+
+#endif /* DSP_ARCH_X86_SSE_DYNAMICS_H_ */
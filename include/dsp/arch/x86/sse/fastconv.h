@@ -289,6 +289,49 @@ namespace sse
                 fastconv_restore_uu(dst, src, rank);
         }
     }
+
+    void fastconv_accumulate(float *dst, const float *c1, const float *c2, size_t rank)
+    {
+        size_t items    = size_t(1) << (rank + 1);
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT(".align 16")
+            __ASM_EMIT("1:")
+            /* Load data */
+            __ASM_EMIT("movups      0x00(%[c1]), %%xmm0")           /* xmm0 = ar */
+            __ASM_EMIT("movups      0x10(%[c1]), %%xmm1")           /* xmm1 = ai */
+            __ASM_EMIT("movups      0x00(%[c2]), %%xmm2")           /* xmm2 = br */
+            __ASM_EMIT("movups      0x10(%[c2]), %%xmm3")           /* xmm3 = bi */
+            /* Calc multiplication */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")                /* xmm4 = ar */
+            __ASM_EMIT("movaps      %%xmm1, %%xmm5")                /* xmm5 = ai */
+            __ASM_EMIT("mulps       %%xmm2, %%xmm0")                /* xmm0 = ar*br */
+            __ASM_EMIT("mulps       %%xmm3, %%xmm4")                /* xmm4 = ar*bi */
+            __ASM_EMIT("mulps       %%xmm3, %%xmm1")                /* xmm1 = ai*bi */
+            __ASM_EMIT("mulps       %%xmm2, %%xmm5")                /* xmm5 = ai*br */
+            __ASM_EMIT("movups      0x00(%[dst]), %%xmm2")          /* xmm2 = dr */
+            __ASM_EMIT("movups      0x10(%[dst]), %%xmm3")          /* xmm3 = di */
+            __ASM_EMIT("subps       %%xmm1, %%xmm0")                /* xmm0 = ar*br - ai*bi = r */
+            __ASM_EMIT("addps       %%xmm5, %%xmm4")                /* xmm4 = ar*bi + ai*br = i */
+            __ASM_EMIT("addps       %%xmm0, %%xmm2")                /* xmm2 = dr + r */
+            __ASM_EMIT("addps       %%xmm4, %%xmm3")                /* xmm3 = di + i */
+            /* Store */
+            __ASM_EMIT("movups      %%xmm2, 0x00(%[dst])")
+            __ASM_EMIT("movups      %%xmm3, 0x10(%[dst])")
+            /* Repeat loop */
+            __ASM_EMIT("add         $0x20, %[c1]")
+            __ASM_EMIT("add         $0x20, %[c2]")
+            __ASM_EMIT("add         $0x20, %[dst]")
+            __ASM_EMIT("sub         $8, %[items]")
+            __ASM_EMIT("jnz         1b")
+
+            : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2), [items] "+r" (items)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_FASTCONV_H_ */
@@ -295,6 +295,8 @@ namespace sse
     #define FFT_MODE                            u
     #include <dsp/arch/x86/sse/fft/p_switch.h>
 
+    #include <dsp/arch/x86/sse/fft/real.h>
+
 
     void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
     {
@@ -303,15 +305,15 @@ namespace sse
         {
             if (rank == 2)
             {
-                float s0_re     = src_re[0] + src_re[1];
-                float s1_re     = src_re[0] - src_re[1];
-                float s2_re     = src_re[2] + src_re[3];
-                float s3_re     = src_re[2] - src_re[3];
+                float s0_re     = src_re[0] + src_re[2];
+                float s1_re     = src_re[0] - src_re[2];
+                float s2_re     = src_re[1] + src_re[3];
+                float s3_re     = src_re[1] - src_re[3];
 
-                float s0_im     = src_im[0] + src_im[1];
-                float s1_im     = src_im[0] - src_im[1];
-                float s2_im     = src_im[2] + src_im[3];
-                float s3_im     = src_im[2] - src_im[3];
+                float s0_im     = src_im[0] + src_im[2];
+                float s1_im     = src_im[0] - src_im[2];
+                float s2_im     = src_im[1] + src_im[3];
+                float s3_im     = src_im[1] - src_im[3];
 
                 dst_re[0]       = s0_re + s2_re;
                 dst_re[1]       = s1_re + s3_im;
@@ -386,15 +388,15 @@ namespace sse
         {
             if (rank == 2)
             {
-                float s0_re     = dst[0] + dst[2];
-                float s1_re     = dst[0] - dst[2];
-                float s0_im     = dst[1] + dst[3];
-                float s1_im     = dst[1] - dst[3];
+                float s0_re     = src[0] + src[4];
+                float s1_re     = src[0] - src[4];
+                float s0_im     = src[1] + src[5];
+                float s1_im     = src[1] - src[5];
 
-                float s2_re     = dst[4] + dst[6];
-                float s3_re     = dst[4] - dst[6];
-                float s2_im     = dst[5] + dst[7];
-                float s3_im     = dst[5] - dst[7];
+                float s2_re     = src[2] + src[6];
+                float s3_re     = src[2] - src[6];
+                float s2_im     = src[3] + src[7];
+                float s3_im     = src[3] - src[7];
 
                 dst[0]          = s0_re + s2_re;
                 dst[1]          = s0_im + s2_im;
@@ -453,15 +455,15 @@ namespace sse
         {
             if (rank == 2)
             {
-                float s0_re     = src_re[0] + src_re[1];
-                float s1_re     = src_re[0] - src_re[1];
-                float s2_re     = src_re[2] + src_re[3];
-                float s3_re     = src_re[2] - src_re[3];
+                float s0_re     = src_re[0] + src_re[2];
+                float s1_re     = src_re[0] - src_re[2];
+                float s2_re     = src_re[1] + src_re[3];
+                float s3_re     = src_re[1] - src_re[3];
 
-                float s0_im     = src_im[0] + src_im[1];
-                float s1_im     = src_im[0] - src_im[1];
-                float s2_im     = src_im[2] + src_im[3];
-                float s3_im     = src_im[2] - src_im[3];
+                float s0_im     = src_im[0] + src_im[2];
+                float s1_im     = src_im[0] - src_im[2];
+                float s2_im     = src_im[1] + src_im[3];
+                float s3_im     = src_im[1] - src_im[3];
 
                 dst_re[0]       = (s0_re + s2_re)*0.25f;
                 dst_re[1]       = (s1_re - s3_im)*0.25f;
@@ -538,15 +540,15 @@ namespace sse
         {
             if (rank == 2)
             {
-                float s0_re     = src[0] + src[2];
-                float s1_re     = src[0] - src[2];
-                float s2_re     = src[4] + src[6];
-                float s3_re     = src[4] - src[6];
+                float s0_re     = src[0] + src[4];
+                float s1_re     = src[0] - src[4];
+                float s2_re     = src[2] + src[6];
+                float s3_re     = src[2] - src[6];
 
-                float s0_im     = src[1] + src[3];
-                float s1_im     = src[1] - src[3];
-                float s2_im     = src[5] + src[7];
-                float s3_im     = src[5] - src[7];
+                float s0_im     = src[1] + src[5];
+                float s1_im     = src[1] - src[5];
+                float s2_im     = src[3] + src[7];
+                float s3_im     = src[3] - src[7];
 
                 dst[0]          = (s0_re + s2_re)*0.25f;
                 dst[1]          = (s0_im + s2_im)*0.25f;
@@ -564,10 +566,10 @@ namespace sse
                 // s1' = s0 - s1
                 float s1_re     = src[2];
                 float s1_im     = src[3];
-                dst[2]          = src[0] - s1_re;
-                dst[3]          = src[1] - s1_im;
-                dst[0]          = src[0] + s1_re;
-                dst[1]          = src[1] + s1_im;
+                dst[2]          = (src[0] - s1_re) * 0.5f;
+                dst[3]          = (src[1] - s1_im) * 0.5f;
+                dst[0]          = (src[0] + s1_re) * 0.5f;
+                dst[1]          = (src[1] + s1_im) * 0.5f;
             }
             else
             {
@@ -597,6 +599,51 @@ namespace sse
             packed_fft_repack_normalize_u(dst, rank);
         }
     }
+
+    void real_direct_fft(float *dst, const float *src, size_t rank)
+    {
+        // Check bounds
+        if (rank <= 1)
+        {
+            if (rank == 1)
+            {
+                float s0        = src[0];
+                float s1        = src[1];
+                dst[0]          = s0 + s1;
+                dst[1]          = s0 - s1;
+            }
+            else
+                dst[0]          = src[0];
+            return;
+        }
+
+        // Real signal of 2^rank samples is a packed complex signal of 2^(rank-1) samples
+        packed_direct_fft(dst, src, rank - 1);
+        real_fft_split(dst, rank);
+    }
+
+    void real_reverse_fft(float *dst, const float *src, size_t rank)
+    {
+        // Check bounds
+        if (rank <= 1)
+        {
+            if (rank == 1)
+            {
+                float s0        = src[0];
+                float s1        = src[1];
+                dst[0]          = (s0 + s1) * 0.5f;
+                dst[1]          = (s0 - s1) * 0.5f;
+            }
+            else
+                dst[0]          = src[0];
+            return;
+        }
+
+        real_fft_join(dst, src, rank);
+        packed_reverse_fft(dst, dst, rank - 1);
+    }
+
+    #include <dsp/arch/x86/sse/fft/plan.h>
 }
 
 #endif /* DSP_ARCH_X86_SSE_FFT_H_ */
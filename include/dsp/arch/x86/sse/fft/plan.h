@@ -0,0 +1,108 @@
+/*
+ * plan.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE_FFT_PLAN_H_
+#define DSP_ARCH_X86_SSE_FFT_PLAN_H_
+
+#ifndef DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE_IMPL */
+
+    /*
+     * The layout of twiddle factors in the plan is described in native/fft/plan.h,
+     * passes need all 16 XMM registers, so the implementation is available for x86_64 only
+     */
+    #ifdef ARCH_X86_64
+
+    /* Transpose 4x4 matrix stored in registers x0..x3, t0 and t1 are temporary registers */
+    #define FFT_PLAN_TRANSPOSE(x0, x1, x2, x3, t0, t1) \
+        __ASM_EMIT("movaps          %%" x0 ", %%" t0)                       /* t0   = a0 a1 a2 a3 */ \
+        __ASM_EMIT("movaps          %%" x2 ", %%" t1)                       /* t1   = c0 c1 c2 c3 */ \
+        __ASM_EMIT("unpcklps        %%" x1 ", %%" x0)                       /* x0   = a0 b0 a1 b1 */ \
+        __ASM_EMIT("unpckhps        %%" x1 ", %%" t0)                       /* t0   = a2 b2 a3 b3 */ \
+        __ASM_EMIT("unpcklps        %%" x3 ", %%" x2)                       /* x2   = c0 d0 c1 d1 */ \
+        __ASM_EMIT("unpckhps        %%" x3 ", %%" t1)                       /* t1   = c2 d2 c3 d3 */ \
+        __ASM_EMIT("movaps          %%" x2 ", %%" x1)                       /* x1   = c0 d0 c1 d1 */ \
+        __ASM_EMIT("movhlps         %%" x0 ", %%" x1)                       /* x1   = a1 b1 c1 d1 */ \
+        __ASM_EMIT("movlhps         %%" x2 ", %%" x0)                       /* x0   = a0 b0 c0 d0 */ \
+        __ASM_EMIT("movaps          %%" t0 ", %%" x2)                       /* x2   = a2 b2 a3 b3 */ \
+        __ASM_EMIT("movlhps         %%" t1 ", %%" x2)                       /* x2   = a2 b2 c2 d2 */ \
+        __ASM_EMIT("movaps          %%" t1 ", %%" x3)                       /* x3   = c2 d2 c3 d3 */ \
+        __ASM_EMIT("movhlps         %%" t0 ", %%" x3)                       /* x3   = a3 b3 c3 d3 */
+
+    #define FFT_PLAN_NAME(name)     name ## _direct
+    #define FFT_PLAN_OPA            "addps"
+    #define FFT_PLAN_OPB            "subps"
+    #include <dsp/arch/x86/sse/fft/plan_pass.h>
+
+    #define FFT_PLAN_NAME(name)     name ## _reverse
+    #define FFT_PLAN_OPA            "subps"
+    #define FFT_PLAN_OPB            "addps"
+    #include <dsp/arch/x86/sse/fft/plan_pass.h>
+
+    #undef FFT_PLAN_TRANSPOSE
+
+    void x64_planned_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan)
+    {
+        size_t rank         = plan->rank;
+        if (rank < 4)
+        {
+            direct_fft(dst_re, dst_im, src_re, src_im, rank);
+            return;
+        }
+
+        x64_planned_fft_direct(dst_re, dst_im, src_re, src_im, plan);
+
+        // Permute the result
+        size_t items        = size_t(1) << rank;
+        const uint32_t *rev = plan->rev;
+        for (size_t i=0; i<items; ++i)
+        {
+            size_t j            = rev[i];
+            if (i >= j)
+                continue;
+            float re            = dst_re[i];
+            float im            = dst_im[i];
+            dst_re[i]           = dst_re[j];
+            dst_im[i]           = dst_im[j];
+            dst_re[j]           = re;
+            dst_im[j]           = im;
+        }
+    }
+
+    void x64_planned_reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan)
+    {
+        size_t rank         = plan->rank;
+        if (rank < 4)
+        {
+            reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+            return;
+        }
+
+        x64_planned_fft_reverse(dst_re, dst_im, src_re, src_im, plan);
+
+        // Permute and normalize the result
+        size_t items        = size_t(1) << rank;
+        const uint32_t *rev = plan->rev;
+        float k             = 1.0f / items;
+        for (size_t i=0; i<items; ++i)
+        {
+            size_t j            = rev[i];
+            if (i > j)
+                continue;
+            float re            = dst_re[i];
+            float im            = dst_im[i];
+            dst_re[i]           = dst_re[j] * k;
+            dst_im[i]           = dst_im[j] * k;
+            dst_re[j]           = re * k;
+            dst_im[j]           = im * k;
+        }
+    }
+
+    #endif /* ARCH_X86_64 */
+
+#endif /* DSP_ARCH_X86_SSE_FFT_PLAN_H_ */
@@ -0,0 +1,258 @@
+/*
+ * plan_pass.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+/*
+ * Passes of planned FFT, the header is included once for direct and once for reverse FFT:
+ *   FFT_PLAN_NAME      the name of the pass function with direction suffix
+ *   FFT_PLAN_OPA       "addps" for direct FFT, "subps" for reverse FFT
+ *   FFT_PLAN_OPB       "subps" for direct FFT, "addps" for reverse FFT
+ *
+ * Rotation of complex number b by the twiddle factor (c, s):
+ *   direct:  re = br*c + bi*s, im = bi*c - br*s
+ *   reverse: re = br*c - bi*s, im = bi*c + br*s
+ */
+
+    /* Rotate (br, bi) by the twiddle factor at offset (off) of tw, t0..t3 are temporary registers */
+    #define FFT_PLAN_ROTATE(off_c, off_s, br, bi, t0, t1, t2, t3) \
+        __ASM_EMIT("movaps          " off_c "(%[tw]), %%" t2)               /* t2   = c */ \
+        __ASM_EMIT("movaps          " off_s "(%[tw]), %%" t3)               /* t3   = s */ \
+        __ASM_EMIT("movaps          %%" br ", %%" t0)                       /* t0   = br */ \
+        __ASM_EMIT("movaps          %%" bi ", %%" t1)                       /* t1   = bi */ \
+        __ASM_EMIT("mulps           %%" t2 ", %%" br)                       /* br   = br*c */ \
+        __ASM_EMIT("mulps           %%" t3 ", %%" t1)                       /* t1   = bi*s */ \
+        __ASM_EMIT("mulps           %%" t3 ", %%" t0)                       /* t0   = br*s */ \
+        __ASM_EMIT("mulps           %%" t2 ", %%" bi)                       /* bi   = bi*c */ \
+        __ASM_EMIT(FFT_PLAN_OPA "           %%" t1 ", %%" br)               /* br   = br*c +- bi*s */ \
+        __ASM_EMIT(FFT_PLAN_OPB "           %%" t0 ", %%" bi)               /* bi   = bi*c -+ br*s */
+
+    static inline void FFT_PLAN_NAME(x64_planned_fft_radix2)(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            const float *tw, size_t h)
+    {
+        size_t off      = 0;
+        size_t hb       = h * sizeof(float);
+
+        ARCH_X86_64_ASM
+        (
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups          (%[sr], %[off]), %%xmm0")           /* xmm0 = ar */
+            __ASM_EMIT("movups          (%[si], %[off]), %%xmm1")           /* xmm1 = ai */
+            __ASM_EMIT("add             %[hb], %[off]")
+            __ASM_EMIT("movups          (%[sr], %[off]), %%xmm2")           /* xmm2 = br */
+            __ASM_EMIT("movups          (%[si], %[off]), %%xmm3")           /* xmm3 = bi */
+            __ASM_EMIT("sub             %[hb], %[off]")
+            __ASM_EMIT("movaps          %%xmm0, %%xmm4")
+            __ASM_EMIT("movaps          %%xmm1, %%xmm5")
+            __ASM_EMIT("addps           %%xmm2, %%xmm0")                    /* xmm0 = ar + br */
+            __ASM_EMIT("addps           %%xmm3, %%xmm1")                    /* xmm1 = ai + bi */
+            __ASM_EMIT("subps           %%xmm2, %%xmm4")                    /* xmm4 = dr = ar - br */
+            __ASM_EMIT("subps           %%xmm3, %%xmm5")                    /* xmm5 = di = ai - bi */
+            __ASM_EMIT("movups          %%xmm0, (%[dr], %[off])")
+            __ASM_EMIT("movups          %%xmm1, (%[di], %[off])")
+            FFT_PLAN_ROTATE("0x00", "0x10", "xmm4", "xmm5", "xmm2", "xmm3", "xmm6", "xmm7")
+            __ASM_EMIT("add             %[hb], %[off]")
+            __ASM_EMIT("movups          %%xmm4, (%[dr], %[off])")
+            __ASM_EMIT("movups          %%xmm5, (%[di], %[off])")
+            __ASM_EMIT("sub             %[hb], %[off]")
+            __ASM_EMIT("add             $0x20, %[tw]")
+            __ASM_EMIT("add             $0x10, %[off]")
+            __ASM_EMIT("cmp             %[hb], %[off]")
+            __ASM_EMIT("jb              1b")
+
+            : [off] "+r" (off), [tw] "+r" (tw)
+            : [sr] "r" (src_re), [si] "r" (src_im),
+              [dr] "r" (dst_re), [di] "r" (dst_im),
+              [hb] "r" (hb)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    static inline void FFT_PLAN_NAME(x64_planned_fft_radix4)(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            const float *tw, size_t q)
+    {
+        size_t off      = 0;
+        size_t qb       = q * sizeof(float);
+        size_t q3b      = qb * 3;
+
+        ARCH_X86_64_ASM
+        (
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups          (%[sr]), %%xmm0")                   /* xmm0 = r0 */
+            __ASM_EMIT("movups          (%[si]), %%xmm1")                   /* xmm1 = i0 */
+            __ASM_EMIT("movups          (%[sr], %[qb]), %%xmm2")            /* xmm2 = r1 */
+            __ASM_EMIT("movups          (%[si], %[qb]), %%xmm3")            /* xmm3 = i1 */
+            __ASM_EMIT("movups          (%[sr], %[qb], 2), %%xmm4")         /* xmm4 = r2 */
+            __ASM_EMIT("movups          (%[si], %[qb], 2), %%xmm5")         /* xmm5 = i2 */
+            __ASM_EMIT("movups          (%[sr], %[q3b]), %%xmm6")           /* xmm6 = r3 */
+            __ASM_EMIT("movups          (%[si], %[q3b]), %%xmm7")           /* xmm7 = i3 */
+            /* First radix-2 stage */
+            __ASM_EMIT("movaps          %%xmm0, %%xmm8")
+            __ASM_EMIT("movaps          %%xmm1, %%xmm9")
+            __ASM_EMIT("movaps          %%xmm2, %%xmm10")
+            __ASM_EMIT("movaps          %%xmm3, %%xmm11")
+            __ASM_EMIT("addps           %%xmm4, %%xmm0")                    /* xmm0 = a0r = r0 + r2 */
+            __ASM_EMIT("addps           %%xmm5, %%xmm1")                    /* xmm1 = a0i = i0 + i2 */
+            __ASM_EMIT("subps           %%xmm4, %%xmm8")                    /* xmm8 = tr = r0 - r2 */
+            __ASM_EMIT("subps           %%xmm5, %%xmm9")                    /* xmm9 = ti = i0 - i2 */
+            __ASM_EMIT("addps           %%xmm6, %%xmm2")                    /* xmm2 = a1r = r1 + r3 */
+            __ASM_EMIT("addps           %%xmm7, %%xmm3")                    /* xmm3 = a1i = i1 + i3 */
+            __ASM_EMIT("subps           %%xmm6, %%xmm10")                   /* xmm10 = dr = r1 - r3 */
+            __ASM_EMIT("subps           %%xmm7, %%xmm11")                   /* xmm11 = di = i1 - i3 */
+            /* Second radix-2 stage */
+            __ASM_EMIT("movaps          %%xmm0, %%xmm4")
+            __ASM_EMIT("movaps          %%xmm1, %%xmm5")
+            __ASM_EMIT("movaps          %%xmm8, %%xmm6")
+            __ASM_EMIT("movaps          %%xmm9, %%xmm7")
+            __ASM_EMIT("addps           %%xmm2, %%xmm0")                    /* xmm0 = y0r = a0r + a1r */
+            __ASM_EMIT("addps           %%xmm3, %%xmm1")                    /* xmm1 = y0i = a0i + a1i */
+            __ASM_EMIT("subps           %%xmm2, %%xmm4")                    /* xmm4 = b1r = a0r - a1r */
+            __ASM_EMIT("subps           %%xmm3, %%xmm5")                    /* xmm5 = b1i = a0i - a1i */
+            __ASM_EMIT(FFT_PLAN_OPA "           %%xmm11, %%xmm8")           /* xmm8 = b2r = tr +- di */
+            __ASM_EMIT(FFT_PLAN_OPB "           %%xmm10, %%xmm9")           /* xmm9 = b2i = ti -+ dr */
+            __ASM_EMIT(FFT_PLAN_OPB "           %%xmm11, %%xmm6")           /* xmm6 = b3r = tr -+ di */
+            __ASM_EMIT(FFT_PLAN_OPA "           %%xmm10, %%xmm7")           /* xmm7 = b3i = ti +- dr */
+            __ASM_EMIT("movups          %%xmm0, (%[dr])")
+            __ASM_EMIT("movups          %%xmm1, (%[di])")
+            /* Apply twiddle factors */
+            FFT_PLAN_ROTATE("0x20", "0x30", "xmm4", "xmm5", "xmm0", "xmm1", "xmm2", "xmm3")
+            FFT_PLAN_ROTATE("0x00", "0x10", "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13")
+            FFT_PLAN_ROTATE("0x40", "0x50", "xmm6", "xmm7", "xmm0", "xmm1", "xmm14", "xmm15")
+            __ASM_EMIT("movups          %%xmm4, (%[dr], %[qb])")
+            __ASM_EMIT("movups          %%xmm5, (%[di], %[qb])")
+            __ASM_EMIT("movups          %%xmm8, (%[dr], %[qb], 2)")
+            __ASM_EMIT("movups          %%xmm9, (%[di], %[qb], 2)")
+            __ASM_EMIT("movups          %%xmm6, (%[dr], %[q3b])")
+            __ASM_EMIT("movups          %%xmm7, (%[di], %[q3b])")
+            /* Move pointers */
+            __ASM_EMIT("add             $0x10, %[sr]")
+            __ASM_EMIT("add             $0x10, %[si]")
+            __ASM_EMIT("add             $0x10, %[dr]")
+            __ASM_EMIT("add             $0x10, %[di]")
+            __ASM_EMIT("add             $0x60, %[tw]")
+            __ASM_EMIT("add             $0x10, %[off]")
+            __ASM_EMIT("cmp             %[qb], %[off]")
+            __ASM_EMIT("jb              1b")
+
+            : [off] "+r" (off), [tw] "+r" (tw),
+              [sr] "+r" (src_re), [si] "+r" (src_im),
+              [dr] "+r" (dst_re), [di] "+r" (dst_im)
+            : [qb] "r" (qb), [q3b] "r" (q3b)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+              "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+              "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+        );
+    }
+
+    static inline void FFT_PLAN_NAME(x64_planned_fft_last)(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            size_t items)
+    {
+        // Each iteration processes 4 blocks of 4 complex numbers, blocks are transposed
+        // before and after the butterfly so each register contains one point of 4 blocks
+        ARCH_X86_64_ASM
+        (
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups          0x00(%[sr]), %%xmm0")
+            __ASM_EMIT("movups          0x10(%[sr]), %%xmm1")
+            __ASM_EMIT("movups          0x20(%[sr]), %%xmm2")
+            __ASM_EMIT("movups          0x30(%[sr]), %%xmm3")
+            __ASM_EMIT("movups          0x00(%[si]), %%xmm4")
+            __ASM_EMIT("movups          0x10(%[si]), %%xmm5")
+            __ASM_EMIT("movups          0x20(%[si]), %%xmm6")
+            __ASM_EMIT("movups          0x30(%[si]), %%xmm7")
+            FFT_PLAN_TRANSPOSE("xmm0", "xmm1", "xmm2", "xmm3", "xmm8", "xmm9")    /* xmm0..xmm3 = r0 r1 r2 r3 */
+            FFT_PLAN_TRANSPOSE("xmm4", "xmm5", "xmm6", "xmm7", "xmm8", "xmm9")    /* xmm4..xmm7 = i0 i1 i2 i3 */
+            /* First radix-2 stage */
+            __ASM_EMIT("movaps          %%xmm0, %%xmm8")
+            __ASM_EMIT("movaps          %%xmm4, %%xmm9")
+            __ASM_EMIT("movaps          %%xmm1, %%xmm10")
+            __ASM_EMIT("movaps          %%xmm5, %%xmm11")
+            __ASM_EMIT("addps           %%xmm2, %%xmm0")                    /* xmm0 = a0r = r0 + r2 */
+            __ASM_EMIT("addps           %%xmm6, %%xmm4")                    /* xmm4 = a0i = i0 + i2 */
+            __ASM_EMIT("subps           %%xmm2, %%xmm8")                    /* xmm8 = tr = r0 - r2 */
+            __ASM_EMIT("subps           %%xmm6, %%xmm9")                    /* xmm9 = ti = i0 - i2 */
+            __ASM_EMIT("addps           %%xmm3, %%xmm1")                    /* xmm1 = a1r = r1 + r3 */
+            __ASM_EMIT("addps           %%xmm7, %%xmm5")                    /* xmm5 = a1i = i1 + i3 */
+            __ASM_EMIT("subps           %%xmm3, %%xmm10")                   /* xmm10 = dr = r1 - r3 */
+            __ASM_EMIT("subps           %%xmm7, %%xmm11")                   /* xmm11 = di = i1 - i3 */
+            /* Second radix-2 stage */
+            __ASM_EMIT("movaps          %%xmm0, %%xmm2")
+            __ASM_EMIT("movaps          %%xmm4, %%xmm6")
+            __ASM_EMIT("movaps          %%xmm8, %%xmm3")
+            __ASM_EMIT("movaps          %%xmm9, %%xmm7")
+            __ASM_EMIT("addps           %%xmm1, %%xmm0")                    /* xmm0 = y0r = a0r + a1r */
+            __ASM_EMIT("addps           %%xmm5, %%xmm4")                    /* xmm4 = y0i = a0i + a1i */
+            __ASM_EMIT("subps           %%xmm1, %%xmm2")                    /* xmm2 = y1r = a0r - a1r */
+            __ASM_EMIT("subps           %%xmm5, %%xmm6")                    /* xmm6 = y1i = a0i - a1i */
+            __ASM_EMIT(FFT_PLAN_OPA "           %%xmm11, %%xmm8")           /* xmm8 = y2r = tr +- di */
+            __ASM_EMIT(FFT_PLAN_OPB "           %%xmm10, %%xmm9")           /* xmm9 = y2i = ti -+ dr */
+            __ASM_EMIT(FFT_PLAN_OPB "           %%xmm11, %%xmm3")           /* xmm3 = y3r = tr -+ di */
+            __ASM_EMIT(FFT_PLAN_OPA "           %%xmm10, %%xmm7")           /* xmm7 = y3i = ti +- dr */
+            FFT_PLAN_TRANSPOSE("xmm0", "xmm2", "xmm8", "xmm3", "xmm10", "xmm11")
+            FFT_PLAN_TRANSPOSE("xmm4", "xmm6", "xmm9", "xmm7", "xmm10", "xmm11")
+            __ASM_EMIT("movups          %%xmm0, 0x00(%[dr])")
+            __ASM_EMIT("movups          %%xmm2, 0x10(%[dr])")
+            __ASM_EMIT("movups          %%xmm8, 0x20(%[dr])")
+            __ASM_EMIT("movups          %%xmm3, 0x30(%[dr])")
+            __ASM_EMIT("movups          %%xmm4, 0x00(%[di])")
+            __ASM_EMIT("movups          %%xmm6, 0x10(%[di])")
+            __ASM_EMIT("movups          %%xmm9, 0x20(%[di])")
+            __ASM_EMIT("movups          %%xmm7, 0x30(%[di])")
+            __ASM_EMIT("add             $0x40, %[sr]")
+            __ASM_EMIT("add             $0x40, %[si]")
+            __ASM_EMIT("add             $0x40, %[dr]")
+            __ASM_EMIT("add             $0x40, %[di]")
+            __ASM_EMIT("sub             $16, %[items]")
+            __ASM_EMIT("jnz             1b")
+
+            : [sr] "+r" (src_re), [si] "+r" (src_im),
+              [dr] "+r" (dst_re), [di] "+r" (dst_im),
+              [items] "+r" (items)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+              "%xmm8", "%xmm9", "%xmm10", "%xmm11"
+        );
+    }
+
+    static void FFT_PLAN_NAME(x64_planned_fft)(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            const dsp::fft_plan_t *plan)
+    {
+        size_t rank     = plan->rank;
+        size_t items    = size_t(1) << rank;
+        const float *tw = plan->tw;
+        size_t q        = items >> 2;
+
+        // First pass reads source data, all other passes work in-place
+        if (rank & 1)
+        {
+            FFT_PLAN_NAME(x64_planned_fft_radix2)(dst_re, dst_im, src_re, src_im, tw, items >> 1);
+            tw             += items;
+            q             >>= 1;
+            src_re          = dst_re;
+            src_im          = dst_im;
+        }
+
+        for (; q >= 4; q >>= 2)
+        {
+            for (size_t p=0; p<items; p += (q << 2))
+                FFT_PLAN_NAME(x64_planned_fft_radix4)(&dst_re[p], &dst_im[p], &src_re[p], &src_im[p], tw, q);
+            tw             += q * 6;
+            src_re          = dst_re;
+            src_im          = dst_im;
+        }
+
+        FFT_PLAN_NAME(x64_planned_fft_last)(dst_re, dst_im, src_re, src_im, items);
+    }
+
+    #undef FFT_PLAN_ROTATE
+    #undef FFT_PLAN_NAME
+    #undef FFT_PLAN_OPA
+    #undef FFT_PLAN_OPB
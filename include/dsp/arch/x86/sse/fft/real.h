@@ -0,0 +1,307 @@
+/*
+ * real.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE_FFT_REAL_H_
+#define DSP_ARCH_X86_SSE_FFT_REAL_H_
+
+#ifndef DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE_IMPL */
+
+    static void real_fft_split(float *dst, size_t rank)
+    {
+        // Z is the spectrum of complex signal z[n] = x[2n] + j*x[2n+1]:
+        //   X[k]   = E[k] + W^k * O[k]
+        //   X[M-k] = conj(E[k] - W^k * O[k])
+        // where E[k] = (Z[k] + conj(Z[M-k]))/2, O[k] = (Z[k] - conj(Z[M-k]))/(2*j)
+        size_t half     = size_t(1) << (rank - 2);
+        float *a        = &dst[2];
+        float *b        = &dst[(half << 2) - 2];
+
+        // DC and Nyquist harmonics
+        float z_re      = dst[0];
+        float z_im      = dst[1];
+        dst[0]          = z_re + z_im;
+        dst[1]          = z_re - z_im;
+
+        if (rank < 4)
+        {
+            float c         = XFFT_W_RE[(rank - 1) << 2];
+            float s         = XFFT_W_IM[(rank - 1) << 2];
+            float w_re      = c, w_im = s;
+
+            for (size_t k=1; k <= half; ++k)
+            {
+                float er        = (a[0] + b[0]) * 0.5f;
+                float ei        = (a[1] - b[1]) * 0.5f;
+                float or_       = (a[1] + b[1]) * 0.5f;
+                float oi        = (b[0] - a[0]) * 0.5f;
+                float tr        = w_re*or_ + w_im*oi;
+                float ti        = w_re*oi - w_im*or_;
+
+                a[0]            = er + tr;
+                a[1]            = ei + ti;
+                b[0]            = er - tr;
+                b[1]            = ti - ei;
+
+                float nw_re     = w_re*c - w_im*s;
+                w_im            = w_re*s + w_im*c;
+                w_re            = nw_re;
+                a              += 2;
+                b              -= 2;
+            }
+            return;
+        }
+
+        // Twiddle factors W^1 .. W^4 pre-multiplied by 0.5, and the rotation step W^4
+        float w[16] __lsp_aligned16;
+        const float *dw     = &XFFT_W[(rank - 1) << 3];
+        const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+        const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+        const float *sw     = &XFFT_W[(rank - 3) << 3];
+
+        for (size_t i=0; i<4; ++i)
+        {
+            w[i]            = 0.5f * (iw_re[i]*dw[0] - iw_im[i]*dw[4]);
+            w[i+4]          = 0.5f * (iw_re[i]*dw[4] + iw_im[i]*dw[0]);
+            w[i+8]          = sw[i];
+            w[i+12]         = sw[i+4];
+        }
+
+        b                  -= 6;
+        half              >>= 2;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[w]), %%xmm6")            /* xmm6 = wr */
+            __ASM_EMIT("movaps      0x10(%[w]), %%xmm7")            /* xmm7 = wi */
+
+            __ASM_EMIT("1:")
+            /* Load and de-interleave data */
+            __ASM_EMIT("movups      0x00(%[a]), %%xmm0")            /* xmm0 = ar0 ai0 ar1 ai1 */
+            __ASM_EMIT("movups      0x10(%[a]), %%xmm1")            /* xmm1 = ar2 ai2 ar3 ai3 */
+            __ASM_EMIT("movups      0x00(%[b]), %%xmm2")            /* xmm2 = br3 bi3 br2 bi2 */
+            __ASM_EMIT("movups      0x10(%[b]), %%xmm3")            /* xmm3 = br1 bi1 br0 bi0 */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+            __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")         /* xmm0 = ar */
+            __ASM_EMIT("shufps      $0xdd, %%xmm1, %%xmm4")         /* xmm4 = ai */
+            __ASM_EMIT("shufps      $0x88, %%xmm3, %%xmm2")         /* xmm2 = br3 br2 br1 br0 */
+            __ASM_EMIT("shufps      $0xdd, %%xmm3, %%xmm5")         /* xmm5 = bi3 bi2 bi1 bi0 */
+            __ASM_EMIT("shufps      $0x1b, %%xmm2, %%xmm2")         /* xmm2 = br */
+            __ASM_EMIT("shufps      $0x1b, %%xmm5, %%xmm5")         /* xmm5 = bi */
+            /* Split spectrum */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")                /* xmm1 = ar */
+            __ASM_EMIT("movaps      %%xmm4, %%xmm3")                /* xmm3 = ai */
+            __ASM_EMIT("addps       %%xmm2, %%xmm1")                /* xmm1 = ar+br = 2*er */
+            __ASM_EMIT("subps       %%xmm0, %%xmm2")                /* xmm2 = br-ar = 2*oi */
+            __ASM_EMIT("subps       %%xmm5, %%xmm4")                /* xmm4 = ai-bi = 2*ei */
+            __ASM_EMIT("addps       %%xmm5, %%xmm3")                /* xmm3 = ai+bi = 2*or */
+            __ASM_EMIT("movaps      %%xmm3, %%xmm0")                /* xmm0 = 2*or */
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")                /* xmm5 = 2*oi */
+            __ASM_EMIT("mulps       %%xmm6, %%xmm3")                /* xmm3 = wr*or */
+            __ASM_EMIT("mulps       %%xmm7, %%xmm2")                /* xmm2 = wi*oi */
+            __ASM_EMIT("mulps       %%xmm6, %%xmm5")                /* xmm5 = wr*oi */
+            __ASM_EMIT("mulps       %%xmm7, %%xmm0")                /* xmm0 = wi*or */
+            __ASM_EMIT("addps       %%xmm2, %%xmm3")                /* xmm3 = tr = wr*or + wi*oi */
+            __ASM_EMIT("subps       %%xmm0, %%xmm5")                /* xmm5 = ti = wr*oi - wi*or */
+            __ASM_EMIT("mulps       %[X_HALF], %%xmm1")             /* xmm1 = er */
+            __ASM_EMIT("mulps       %[X_HALF], %%xmm4")             /* xmm4 = ei */
+            __ASM_EMIT("movaps      %%xmm1, %%xmm0")                /* xmm0 = er */
+            __ASM_EMIT("movaps      %%xmm5, %%xmm2")                /* xmm2 = ti */
+            __ASM_EMIT("addps       %%xmm3, %%xmm1")                /* xmm1 = er+tr */
+            __ASM_EMIT("subps       %%xmm3, %%xmm0")                /* xmm0 = er-tr */
+            __ASM_EMIT("addps       %%xmm4, %%xmm5")                /* xmm5 = ei+ti */
+            __ASM_EMIT("subps       %%xmm4, %%xmm2")                /* xmm2 = ti-ei */
+            /* Interleave and store data */
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")
+            __ASM_EMIT("unpcklps    %%xmm5, %%xmm1")                /* xmm1 = ar0 ai0 ar1 ai1 */
+            __ASM_EMIT("unpckhps    %%xmm5, %%xmm3")                /* xmm3 = ar2 ai2 ar3 ai3 */
+            __ASM_EMIT("shufps      $0x1b, %%xmm0, %%xmm0")         /* xmm0 = br3 br2 br1 br0 */
+            __ASM_EMIT("shufps      $0x1b, %%xmm2, %%xmm2")         /* xmm2 = bi3 bi2 bi1 bi0 */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("unpcklps    %%xmm2, %%xmm0")                /* xmm0 = br3 bi3 br2 bi2 */
+            __ASM_EMIT("unpckhps    %%xmm2, %%xmm4")                /* xmm4 = br1 bi1 br0 bi0 */
+            __ASM_EMIT("movups      %%xmm1, 0x00(%[a])")
+            __ASM_EMIT("movups      %%xmm3, 0x10(%[a])")
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[b])")
+            __ASM_EMIT("movups      %%xmm4, 0x10(%[b])")
+            /* Rotate twiddle factors */
+            __ASM_EMIT("movaps      %%xmm6, %%xmm0")                /* xmm0 = wr */
+            __ASM_EMIT("movaps      %%xmm7, %%xmm1")                /* xmm1 = wi */
+            __ASM_EMIT("mulps       0x20(%[w]), %%xmm6")            /* xmm6 = wr*c */
+            __ASM_EMIT("mulps       0x30(%[w]), %%xmm1")            /* xmm1 = wi*s */
+            __ASM_EMIT("mulps       0x30(%[w]), %%xmm0")            /* xmm0 = wr*s */
+            __ASM_EMIT("mulps       0x20(%[w]), %%xmm7")            /* xmm7 = wi*c */
+            __ASM_EMIT("subps       %%xmm1, %%xmm6")                /* xmm6 = wr*c - wi*s */
+            __ASM_EMIT("addps       %%xmm0, %%xmm7")                /* xmm7 = wr*s + wi*c */
+            /* Repeat loop */
+            __ASM_EMIT("add         $0x20, %[a]")
+            __ASM_EMIT("sub         $0x20, %[b]")
+            __ASM_EMIT("dec         %[n]")
+            __ASM_EMIT("jnz         1b")
+
+            : [a] "+r" (a), [b] "+r" (b), [n] "+r" (half)
+            : [w] "r" (w),
+              [X_HALF] "m" (X_HALF)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    static void real_fft_join(float *dst, const float *src, size_t rank)
+    {
+        // Restore Z[k] = E[k] + j*O[k] of complex signal z[n] = x[2n] + j*x[2n+1]:
+        //   E[k]   = (X[k] + conj(X[M-k]))/2
+        //   O[k]   = (X[k] - conj(X[M-k])) * conj(W^k)/2
+        //   Z[M-k] = conj(E[k]) + j*conj(O[k])
+        size_t half     = size_t(1) << (rank - 2);
+        const float *sa = &src[2];
+        const float *sb = &src[(half << 2) - 2];
+        float *a        = &dst[2];
+        float *b        = &dst[(half << 2) - 2];
+
+        // DC and Nyquist harmonics
+        float x_re      = src[0];
+        float x_im      = src[1];
+        dst[0]          = (x_re + x_im) * 0.5f;
+        dst[1]          = (x_re - x_im) * 0.5f;
+
+        if (rank < 4)
+        {
+            float c         = XFFT_W_RE[(rank - 1) << 2];
+            float s         = XFFT_W_IM[(rank - 1) << 2];
+            float w_re      = c, w_im = s;
+
+            for (size_t k=1; k <= half; ++k)
+            {
+                float er        = (sa[0] + sb[0]) * 0.5f;
+                float ei        = (sa[1] - sb[1]) * 0.5f;
+                float dr        = (sa[0] - sb[0]) * 0.5f;
+                float di        = (sa[1] + sb[1]) * 0.5f;
+                float or_       = dr*w_re - di*w_im;
+                float oi        = dr*w_im + di*w_re;
+
+                a[0]            = er - oi;
+                a[1]            = ei + or_;
+                b[0]            = er + oi;
+                b[1]            = or_ - ei;
+
+                float nw_re     = w_re*c - w_im*s;
+                w_im            = w_re*s + w_im*c;
+                w_re            = nw_re;
+                sa             += 2;
+                sb             -= 2;
+                a              += 2;
+                b              -= 2;
+            }
+            return;
+        }
+
+        // Twiddle factors W^1 .. W^4 pre-multiplied by 0.5, and the rotation step W^4
+        float w[16] __lsp_aligned16;
+        const float *dw     = &XFFT_W[(rank - 1) << 3];
+        const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+        const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+        const float *sw     = &XFFT_W[(rank - 3) << 3];
+
+        for (size_t i=0; i<4; ++i)
+        {
+            w[i]            = 0.5f * (iw_re[i]*dw[0] - iw_im[i]*dw[4]);
+            w[i+4]          = 0.5f * (iw_re[i]*dw[4] + iw_im[i]*dw[0]);
+            w[i+8]          = sw[i];
+            w[i+12]         = sw[i+4];
+        }
+
+        sb                 -= 6;
+        b                  -= 6;
+        half              >>= 2;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[w]), %%xmm6")            /* xmm6 = wr */
+            __ASM_EMIT("movaps      0x10(%[w]), %%xmm7")            /* xmm7 = wi */
+
+            __ASM_EMIT("1:")
+            /* Load and de-interleave data */
+            __ASM_EMIT("movups      0x00(%[sa]), %%xmm0")           /* xmm0 = xr0 xi0 xr1 xi1 */
+            __ASM_EMIT("movups      0x10(%[sa]), %%xmm1")           /* xmm1 = xr2 xi2 xr3 xi3 */
+            __ASM_EMIT("movups      0x00(%[sb]), %%xmm2")           /* xmm2 = yr3 yi3 yr2 yi2 */
+            __ASM_EMIT("movups      0x10(%[sb]), %%xmm3")           /* xmm3 = yr1 yi1 yr0 yi0 */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+            __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")         /* xmm0 = xr */
+            __ASM_EMIT("shufps      $0xdd, %%xmm1, %%xmm4")         /* xmm4 = xi */
+            __ASM_EMIT("shufps      $0x88, %%xmm3, %%xmm2")         /* xmm2 = yr3 yr2 yr1 yr0 */
+            __ASM_EMIT("shufps      $0xdd, %%xmm3, %%xmm5")         /* xmm5 = yi3 yi2 yi1 yi0 */
+            __ASM_EMIT("shufps      $0x1b, %%xmm2, %%xmm2")         /* xmm2 = yr */
+            __ASM_EMIT("shufps      $0x1b, %%xmm5, %%xmm5")         /* xmm5 = yi */
+            /* Join spectrum */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")                /* xmm1 = xr */
+            __ASM_EMIT("movaps      %%xmm4, %%xmm3")                /* xmm3 = xi */
+            __ASM_EMIT("addps       %%xmm2, %%xmm1")                /* xmm1 = xr+yr = 2*er */
+            __ASM_EMIT("subps       %%xmm2, %%xmm0")                /* xmm0 = xr-yr = 2*dr */
+            __ASM_EMIT("subps       %%xmm5, %%xmm4")                /* xmm4 = xi-yi = 2*ei */
+            __ASM_EMIT("addps       %%xmm3, %%xmm5")                /* xmm5 = xi+yi = 2*di */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2 = 2*dr */
+            __ASM_EMIT("movaps      %%xmm5, %%xmm3")                /* xmm3 = 2*di */
+            __ASM_EMIT("mulps       %%xmm6, %%xmm0")                /* xmm0 = wr*dr */
+            __ASM_EMIT("mulps       %%xmm7, %%xmm5")                /* xmm5 = wi*di */
+            __ASM_EMIT("mulps       %%xmm7, %%xmm2")                /* xmm2 = wi*dr */
+            __ASM_EMIT("mulps       %%xmm6, %%xmm3")                /* xmm3 = wr*di */
+            __ASM_EMIT("subps       %%xmm5, %%xmm0")                /* xmm0 = or = wr*dr - wi*di */
+            __ASM_EMIT("addps       %%xmm3, %%xmm2")                /* xmm2 = oi = wi*dr + wr*di */
+            __ASM_EMIT("mulps       %[X_HALF], %%xmm1")             /* xmm1 = er */
+            __ASM_EMIT("mulps       %[X_HALF], %%xmm4")             /* xmm4 = ei */
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                /* xmm3 = er */
+            __ASM_EMIT("movaps      %%xmm0, %%xmm5")                /* xmm5 = or */
+            __ASM_EMIT("subps       %%xmm2, %%xmm1")                /* xmm1 = er-oi */
+            __ASM_EMIT("addps       %%xmm2, %%xmm3")                /* xmm3 = er+oi */
+            __ASM_EMIT("addps       %%xmm4, %%xmm0")                /* xmm0 = ei+or */
+            __ASM_EMIT("subps       %%xmm4, %%xmm5")                /* xmm5 = or-ei */
+            /* Interleave and store data */
+            __ASM_EMIT("movaps      %%xmm1, %%xmm2")
+            __ASM_EMIT("unpcklps    %%xmm0, %%xmm1")                /* xmm1 = ar0 ai0 ar1 ai1 */
+            __ASM_EMIT("unpckhps    %%xmm0, %%xmm2")                /* xmm2 = ar2 ai2 ar3 ai3 */
+            __ASM_EMIT("shufps      $0x1b, %%xmm3, %%xmm3")         /* xmm3 = br3 br2 br1 br0 */
+            __ASM_EMIT("shufps      $0x1b, %%xmm5, %%xmm5")         /* xmm5 = bi3 bi2 bi1 bi0 */
+            __ASM_EMIT("movaps      %%xmm3, %%xmm4")
+            __ASM_EMIT("unpcklps    %%xmm5, %%xmm3")                /* xmm3 = br3 bi3 br2 bi2 */
+            __ASM_EMIT("unpckhps    %%xmm5, %%xmm4")                /* xmm4 = br1 bi1 br0 bi0 */
+            __ASM_EMIT("movups      %%xmm1, 0x00(%[a])")
+            __ASM_EMIT("movups      %%xmm2, 0x10(%[a])")
+            __ASM_EMIT("movups      %%xmm3, 0x00(%[b])")
+            __ASM_EMIT("movups      %%xmm4, 0x10(%[b])")
+            /* Rotate twiddle factors */
+            __ASM_EMIT("movaps      %%xmm6, %%xmm0")                /* xmm0 = wr */
+            __ASM_EMIT("movaps      %%xmm7, %%xmm1")                /* xmm1 = wi */
+            __ASM_EMIT("mulps       0x20(%[w]), %%xmm6")            /* xmm6 = wr*c */
+            __ASM_EMIT("mulps       0x30(%[w]), %%xmm1")            /* xmm1 = wi*s */
+            __ASM_EMIT("mulps       0x30(%[w]), %%xmm0")            /* xmm0 = wr*s */
+            __ASM_EMIT("mulps       0x20(%[w]), %%xmm7")            /* xmm7 = wi*c */
+            __ASM_EMIT("subps       %%xmm1, %%xmm6")                /* xmm6 = wr*c - wi*s */
+            __ASM_EMIT("addps       %%xmm0, %%xmm7")                /* xmm7 = wr*s + wi*c */
+            /* Repeat loop */
+            __ASM_EMIT("add         $0x20, %[sa]")
+            __ASM_EMIT("sub         $0x20, %[sb]")
+            __ASM_EMIT("add         $0x20, %[a]")
+            __ASM_EMIT("sub         $0x20, %[b]")
+            __ASM_EMIT("dec         %[n]")
+            __ASM_EMIT("jnz         1b")
+
+            : [sa] "+r" (sa), [sb] "+r" (sb),
+              [a] "+r" (a), [b] "+r" (b), [n] "+r" (half)
+            : [w] "r" (w),
+              [X_HALF] "m" (X_HALF)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+#endif /* DSP_ARCH_X86_SSE_FFT_REAL_H_ */
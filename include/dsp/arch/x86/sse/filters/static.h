@@ -645,6 +645,103 @@ namespace sse
               "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5", "%xmm6", "%xmm7"
         );
     }
+
+    /*
+     * Process four channels of one cascade stage, the filter f contains x4 bank
+     * with coefficients of channels, stride is the distance between samples in bytes
+     */
+    static inline void biquad_process_mc_x4(float *dst, const float *src, size_t count, size_t stride, biquad_t *f)
+    {
+        ARCH_X86_ASM
+        (
+            // Check count
+            __ASM_EMIT("test        %[count], %[count]")
+            __ASM_EMIT("jz          2f")
+
+            // Load filter memory
+            __ASM_EMIT("movaps      " BIQUAD_D0_SOFF "(%[f]), %%xmm0")      // xmm0 = d0
+            __ASM_EMIT("movaps      " BIQUAD_D1_SOFF "(%[f]), %%xmm1")      // xmm1 = d1
+
+            // Start loop
+            __ASM_EMIT(".align 16")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      (%[src]), %%xmm2")                      // xmm2 = s
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3")                        // xmm3 = s
+            __ASM_EMIT("mulps       " BIQUAD_X4_A0_SOFF "(%[f]), %%xmm3")   // xmm3 = a0*s
+            __ASM_EMIT("addps       %%xmm0, %%xmm3")                        // xmm3 = s2 = a0*s + d0
+            __ASM_EMIT("movaps      %%xmm2, %%xmm0")                        // xmm0 = s
+            __ASM_EMIT("mulps       " BIQUAD_X4_A1_SOFF "(%[f]), %%xmm0")   // xmm0 = a1*s
+            __ASM_EMIT("movaps      %%xmm3, %%xmm4")                        // xmm4 = s2
+            __ASM_EMIT("addps       %%xmm1, %%xmm0")                        // xmm0 = a1*s + d1
+            __ASM_EMIT("mulps       " BIQUAD_X4_B1_SOFF "(%[f]), %%xmm4")   // xmm4 = b1*s2
+            __ASM_EMIT("movaps      %%xmm3, %%xmm1")                        // xmm1 = s2
+            __ASM_EMIT("mulps       " BIQUAD_X4_A2_SOFF "(%[f]), %%xmm2")   // xmm2 = a2*s
+            __ASM_EMIT("mulps       " BIQUAD_X4_B2_SOFF "(%[f]), %%xmm1")   // xmm1 = b2*s2
+            __ASM_EMIT("addps       %%xmm4, %%xmm0")                        // xmm0 = d0' = a1*s + b1*s2 + d1
+            __ASM_EMIT("addps       %%xmm2, %%xmm1")                        // xmm1 = d1' = a2*s + b2*s2
+            __ASM_EMIT("movups      %%xmm3, (%[dst])")                      // store value
+            __ASM_EMIT("add         %[stride], %[src]")
+            __ASM_EMIT("add         %[stride], %[dst]")
+            __ASM_EMIT("dec         %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            // Store the updated buffer state
+            __ASM_EMIT("movaps      %%xmm0, " BIQUAD_D0_SOFF "(%[f])")
+            __ASM_EMIT("movaps      %%xmm1, " BIQUAD_D1_SOFF "(%[f])")
+
+            // Exit label
+            __ASM_EMIT("2:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [f] "r" (f), [stride] "r" (stride)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4"
+        );
+    }
+
+    void biquad_process_mc4(float *dst, const float *src, size_t count, biquad_t *f, size_t stages)
+    {
+        for (size_t i=0; i<stages; ++i, ++f)
+        {
+            biquad_process_mc_x4(dst, src, count, 4 * sizeof(float), f);
+            src         = dst; // actual data for the next stage is in output buffer now
+        }
+    }
+
+    void biquad_process_mc8(float *dst, const float *src, size_t count, biquad_t *f, size_t stages)
+    {
+        // Each half of x8 bank is processed as a separate x4 bank
+        biquad_t h;
+
+        for (size_t i=0; i<stages; ++i, ++f)
+        {
+            for (size_t j=0; j<8; j += 4)
+            {
+                // Convert the half of x8 bank to x4 bank
+                for (size_t k=0; k<4; ++k)
+                {
+                    h.d[k]          = f->d[j+k];
+                    h.d[k+4]        = f->d[j+k+8];
+                    h.x4.a0[k]      = f->x8.a0[j+k];
+                    h.x4.a1[k]      = f->x8.a1[j+k];
+                    h.x4.a2[k]      = f->x8.a2[j+k];
+                    h.x4.b1[k]      = f->x8.b1[j+k];
+                    h.x4.b2[k]      = f->x8.b2[j+k];
+                }
+
+                biquad_process_mc_x4(&dst[j], &src[j], count, 8 * sizeof(float), &h);
+
+                // Store filter memory back
+                for (size_t k=0; k<4; ++k)
+                {
+                    f->d[j+k]       = h.d[k];
+                    f->d[j+k+8]     = h.d[k+4];
+                }
+            }
+
+            src         = dst; // actual data for the next stage is in output buffer now
+        }
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_FILTERS_STATIC_H_ */
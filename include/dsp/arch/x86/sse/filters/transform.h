@@ -1219,6 +1219,59 @@ namespace sse
             : "cc", "memory"
         );
     }
+
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count)
+    {
+        float k                 = 1.0f / step;
+        size_t b_stride         = stride * sizeof(f_cascade_t);
+
+        while (count > 0)
+        {
+            size_t n                = (count > step) ? step : count;
+            count                  -= n;
+
+            ARCH_X86_ASM
+            (
+                // Calculate increments
+                __ASM_EMIT("movss       %[k], %%xmm6")                          // xmm6 = k
+                __ASM_EMIT("movups      0x00(%[keys]), %%xmm0")                 // xmm0 = at
+                __ASM_EMIT("movups      0x10(%[keys]), %%xmm1")                 // xmm1 = ab
+                __ASM_EMIT("movups      0x00(%[keys], %[stride]), %%xmm2")      // xmm2 = bt
+                __ASM_EMIT("movups      0x10(%[keys], %[stride]), %%xmm3")      // xmm3 = bb
+                __ASM_EMIT("shufps      $0x00, %%xmm6, %%xmm6")                 // xmm6 = k k k k
+                __ASM_EMIT("subps       %%xmm0, %%xmm2")                        // xmm2 = bt - at
+                __ASM_EMIT("subps       %%xmm1, %%xmm3")                        // xmm3 = bb - ab
+                __ASM_EMIT("xorps       %%xmm4, %%xmm4")                        // xmm4 = x = 0
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")                        // xmm2 = dt = (bt - at) * k
+                __ASM_EMIT("mulps       %%xmm6, %%xmm3")                        // xmm3 = db = (bb - ab) * k
+                __ASM_EMIT("movaps      %[ONE], %%xmm5")                        // xmm5 = 1
+
+                // Generate cascades
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movaps      %%xmm2, %%xmm6")                        // xmm6 = dt
+                __ASM_EMIT("movaps      %%xmm3, %%xmm7")                        // xmm7 = db
+                __ASM_EMIT("mulps       %%xmm4, %%xmm6")                        // xmm6 = dt*x
+                __ASM_EMIT("mulps       %%xmm4, %%xmm7")                        // xmm7 = db*x
+                __ASM_EMIT("addps       %%xmm0, %%xmm6")                        // xmm6 = at + dt*x
+                __ASM_EMIT("addps       %%xmm1, %%xmm7")                        // xmm7 = ab + db*x
+                __ASM_EMIT("addps       %%xmm5, %%xmm4")                        // xmm4 = x + 1
+                __ASM_EMIT("movups      %%xmm6, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm7, 0x10(%[dst])")
+                __ASM_EMIT("add         %[stride], %[dst]")
+                __ASM_EMIT("dec         %[n]")
+                __ASM_EMIT("jnz         1b")
+
+                : [dst] "+r" (dst), [n] "+r" (n)
+                : [keys] "r" (keys), [stride] "r" (b_stride),
+                  [k] "m" (k), [ONE] "m" (ONE)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            keys                   += stride;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_FILTERS_TRANSFORM_H_ */
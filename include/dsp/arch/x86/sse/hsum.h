@@ -285,6 +285,145 @@ namespace sse
         );
         return result;
     }
+    IF_ARCH_X86(
+        static const uint32_t SLIDING_SHIFT_MASK[] __lsp_aligned16 = { 0, 0xffffffff, 0xffffffff, 0xffffffff };
+    )
+
+    // Compute prefix sum of xmm1, add carry stored in xmm0, update carry, limit and normalize
+    #define SLIDING_PREFIX_SUM \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm2")                /* xmm2 = d0 d1 d2 d3 */ \
+        __ASM_EMIT("shufps      $0x90, %%xmm2, %%xmm2")         /* xmm2 = d0 d0 d1 d2 */ \
+        __ASM_EMIT("andps       %%xmm5, %%xmm2")                /* xmm2 = 0 d0 d1 d2 */ \
+        __ASM_EMIT("addps       %%xmm2, %%xmm1")                /* xmm1 = d0 d0+d1 d1+d2 d2+d3 */ \
+        __ASM_EMIT("xorps       %%xmm2, %%xmm2")                \
+        __ASM_EMIT("movlhps     %%xmm1, %%xmm2")                /* xmm2 = 0 0 d0 d0+d1 */ \
+        __ASM_EMIT("addps       %%xmm2, %%xmm1")                /* xmm1 = s0 s1 s2 s3 */ \
+        __ASM_EMIT("addps       %%xmm0, %%xmm1")                /* xmm1 = sum + s */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm0")                \
+        __ASM_EMIT("shufps      $0xff, %%xmm0, %%xmm0")         /* xmm0 = new sum */ \
+        __ASM_EMIT("maxps       %%xmm3, %%xmm1")                \
+        __ASM_EMIT("mulps       %%xmm4, %%xmm1")
+
+    float sliding_mean(float *dst, const float *head, const float *tail, float sum, float k, size_t count)
+    {
+        IF_ARCH_X86(size_t off);
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0")
+            __ASM_EMIT("movss       %[k], %%xmm4")
+            __ASM_EMIT("xorps       %%xmm3, %%xmm3")
+            __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")
+            __ASM_EMIT("movaps      %[MASK], %%xmm5")
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jb          2f")
+
+            /* x4 blocks */
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      0x00(%[head], %[off]), %%xmm1")
+            __ASM_EMIT("movups      0x00(%[tail], %[off]), %%xmm2")
+            __ASM_EMIT("subps       %%xmm2, %%xmm1")
+            SLIDING_PREFIX_SUM
+            __ASM_EMIT("movups      %%xmm1, 0x00(%[dst], %[off])")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jae         1b")
+
+            /* x1 blocks */
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add         $3, %[count]")
+            __ASM_EMIT("jl          4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movss       0x00(%[head], %[off]), %%xmm1")
+            __ASM_EMIT("subss       0x00(%[tail], %[off]), %%xmm1")
+            __ASM_EMIT("addss       %%xmm1, %%xmm0")
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+            __ASM_EMIT("maxss       %%xmm3, %%xmm1")
+            __ASM_EMIT("mulss       %%xmm4, %%xmm1")
+            __ASM_EMIT("movss       %%xmm1, 0x00(%[dst], %[off])")
+            __ASM_EMIT("add         $0x04, %[off]")
+            __ASM_EMIT("dec         %[count]")
+            __ASM_EMIT("jge         3b")
+            __ASM_EMIT("4:")
+
+            : [count] "+r" (count), [off] "=&r" (off),
+              [sum] "+Yz" (sum)
+            : [dst] "r" (dst), [head] "r" (head), [tail] "r" (tail),
+              [k] "m" (k),
+              [MASK] "m" (SLIDING_SHIFT_MASK)
+            : "cc", "memory",
+              "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+
+        return sum;
+    }
+
+    float sliding_rms(float *dst, const float *head, const float *tail, float sum, float k, size_t count)
+    {
+        IF_ARCH_X86(size_t off);
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("shufps      $0x00, %%xmm0, %%xmm0")
+            __ASM_EMIT("movss       %[k], %%xmm4")
+            __ASM_EMIT("xorps       %%xmm3, %%xmm3")
+            __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")
+            __ASM_EMIT("movaps      %[MASK], %%xmm5")
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jb          2f")
+
+            /* x4 blocks */
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      0x00(%[head], %[off]), %%xmm1")
+            __ASM_EMIT("movups      0x00(%[tail], %[off]), %%xmm2")
+            __ASM_EMIT("mulps       %%xmm1, %%xmm1")
+            __ASM_EMIT("mulps       %%xmm2, %%xmm2")
+            __ASM_EMIT("subps       %%xmm2, %%xmm1")
+            SLIDING_PREFIX_SUM
+            __ASM_EMIT("sqrtps      %%xmm1, %%xmm1")
+            __ASM_EMIT("movups      %%xmm1, 0x00(%[dst], %[off])")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jae         1b")
+
+            /* x1 blocks */
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add         $3, %[count]")
+            __ASM_EMIT("jl          4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movss       0x00(%[head], %[off]), %%xmm1")
+            __ASM_EMIT("movss       0x00(%[tail], %[off]), %%xmm2")
+            __ASM_EMIT("mulss       %%xmm1, %%xmm1")
+            __ASM_EMIT("mulss       %%xmm2, %%xmm2")
+            __ASM_EMIT("subss       %%xmm2, %%xmm1")
+            __ASM_EMIT("addss       %%xmm1, %%xmm0")
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+            __ASM_EMIT("maxss       %%xmm3, %%xmm1")
+            __ASM_EMIT("mulss       %%xmm4, %%xmm1")
+            __ASM_EMIT("sqrtss      %%xmm1, %%xmm1")
+            __ASM_EMIT("movss       %%xmm1, 0x00(%[dst], %[off])")
+            __ASM_EMIT("add         $0x04, %[off]")
+            __ASM_EMIT("dec         %[count]")
+            __ASM_EMIT("jge         3b")
+            __ASM_EMIT("4:")
+
+            : [count] "+r" (count), [off] "=&r" (off),
+              [sum] "+Yz" (sum)
+            : [dst] "r" (dst), [head] "r" (head), [tail] "r" (tail),
+              [k] "m" (k),
+              [MASK] "m" (SLIDING_SHIFT_MASK)
+            : "cc", "memory",
+              "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+
+        return sum;
+    }
+
+    #undef SLIDING_PREFIX_SUM
 }
 
 #endif /* DSP_ARCH_X86_SSE_HSUM_H_ */
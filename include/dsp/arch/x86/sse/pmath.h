@@ -597,6 +597,77 @@ namespace sse
               "%xmm4", "%xmm5", "%xmm6", "%xmm7"
         );
     }
+
+    IF_ARCH_X86(
+        static const float LRAMP_IDX[] __lsp_aligned16 =
+        {
+            0.0f, 1.0f, 2.0f, 3.0f,     // Initial index
+            4.0f, 4.0f, 4.0f, 4.0f      // Index step
+        };
+    )
+
+    void lramp_add2(float *dst, const float *src, float v1, float v2, size_t count)
+    {
+        if (count <= 0)
+            return;
+        float delta = (v2 - v1) / count;
+
+        IF_ARCH_X86(size_t off);
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movss       %[delta], %%xmm6")
+            __ASM_EMIT("movss       %[v1], %%xmm7")
+            __ASM_EMIT("shufps      $0x00, %%xmm6, %%xmm6")         /* xmm6 = delta */
+            __ASM_EMIT("shufps      $0x00, %%xmm7, %%xmm7")         /* xmm7 = v1 */
+            __ASM_EMIT("movaps      0x00 + %[IDX], %%xmm4")         /* xmm4 = i */
+            __ASM_EMIT("movaps      0x10 + %[IDX], %%xmm5")         /* xmm5 = 4 */
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jb          2f")
+
+            /* x4 blocks */
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movaps      %%xmm4, %%xmm0")
+            __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm1")
+            __ASM_EMIT("mulps       %%xmm6, %%xmm0")                /* xmm0 = delta * i */
+            __ASM_EMIT("movups      0x00(%[dst], %[off]), %%xmm2")
+            __ASM_EMIT("addps       %%xmm7, %%xmm0")                /* xmm0 = v1 + delta * i */
+            __ASM_EMIT("addps       %%xmm5, %%xmm4")                /* xmm4 = i + 4 */
+            __ASM_EMIT("mulps       %%xmm1, %%xmm0")
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst], %[off])")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jae         1b")
+
+            /* x1 blocks */
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add         $3, %[count]")
+            __ASM_EMIT("jl          4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movaps      %%xmm4, %%xmm0")
+            __ASM_EMIT("movss       0x00(%[src], %[off]), %%xmm1")
+            __ASM_EMIT("mulss       %%xmm6, %%xmm0")
+            __ASM_EMIT("movss       0x00(%[dst], %[off]), %%xmm2")
+            __ASM_EMIT("addss       %%xmm7, %%xmm0")
+            __ASM_EMIT("shufps      $0x39, %%xmm4, %%xmm4")         /* xmm4 = i+1 i+2 i+3 i */
+            __ASM_EMIT("mulss       %%xmm1, %%xmm0")
+            __ASM_EMIT("addss       %%xmm2, %%xmm0")
+            __ASM_EMIT("movss       %%xmm0, 0x00(%[dst], %[off])")
+            __ASM_EMIT("add         $0x04, %[off]")
+            __ASM_EMIT("dec         %[count]")
+            __ASM_EMIT("jge         3b")
+            __ASM_EMIT("4:")
+
+            : [count] "+r" (count), [off] "=&r" (off)
+            : [dst] "r" (dst), [src] "r" (src),
+              [v1] "m" (v1), [delta] "m" (delta),
+              [IDX] "o" (LRAMP_IDX)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
 }
 
 #undef SCALE_OP4_CORE
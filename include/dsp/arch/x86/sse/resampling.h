@@ -1745,6 +1745,165 @@ namespace sse
               "%xmm4", "%xmm5", "%xmm6", "%xmm7"
         );
     }
+
+    void halfband_upsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count)
+    {
+        const float *ce = &c[n];
+        IF_ARCH_X86(const float *p1, *p2, *k);
+
+        // 8x blocks
+        for ( ; count >= 8; count -= 8)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("mov         %[x], %[p1]")                   // p1 = &x[0]
+                __ASM_EMIT("mov         %[c], %[k]")                    // k  = c
+                __ASM_EMIT("lea         0x04(%[x]), %[p2]")             // p2 = &x[1]
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")                // xmm0 = s0 = 0
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")                // xmm1 = s1 = 0
+
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movss       (%[k]), %%xmm7")                // xmm7 = c
+                __ASM_EMIT("movups      0x00(%[p1]), %%xmm2")           // xmm2 = a0
+                __ASM_EMIT("movups      0x10(%[p1]), %%xmm3")           // xmm3 = a1
+                __ASM_EMIT("shufps      $0x00, %%xmm7, %%xmm7")         // xmm7 = c c c c
+                __ASM_EMIT("movups      0x00(%[p2]), %%xmm4")           // xmm4 = b0
+                __ASM_EMIT("movups      0x10(%[p2]), %%xmm5")           // xmm5 = b1
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")                // xmm2 = a0 + b0
+                __ASM_EMIT("addps       %%xmm5, %%xmm3")                // xmm3 = a1 + b1
+                __ASM_EMIT("mulps       %%xmm7, %%xmm2")                // xmm2 = c*(a0 + b0)
+                __ASM_EMIT("mulps       %%xmm7, %%xmm3")                // xmm3 = c*(a1 + b1)
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")                // xmm0 = s0 + c*(a0 + b0)
+                __ASM_EMIT("addps       %%xmm3, %%xmm1")                // xmm1 = s1 + c*(a1 + b1)
+                __ASM_EMIT("sub         $0x04, %[p1]")
+                __ASM_EMIT("add         $0x04, %[p2]")
+                __ASM_EMIT("add         $0x04, %[k]")
+                __ASM_EMIT("cmp         %[ce], %[k]")
+                __ASM_EMIT("jb          1b")
+
+                // Interleave with the delayed source samples
+                __ASM_EMIT("movups      0x00(%[x]), %%xmm2")            // xmm2 = x0 x1 x2 x3
+                __ASM_EMIT("movups      0x10(%[x]), %%xmm4")            // xmm4 = x4 x5 x6 x7
+                __ASM_EMIT("movaps      %%xmm2, %%xmm3")
+                __ASM_EMIT("movaps      %%xmm4, %%xmm5")
+                __ASM_EMIT("unpcklps    %%xmm0, %%xmm2")                // xmm2 = x0 s0 x1 s1
+                __ASM_EMIT("unpckhps    %%xmm0, %%xmm3")                // xmm3 = x2 s2 x3 s3
+                __ASM_EMIT("unpcklps    %%xmm1, %%xmm4")                // xmm4 = x4 s4 x5 s5
+                __ASM_EMIT("unpckhps    %%xmm1, %%xmm5")                // xmm5 = x6 s6 x7 s7
+                __ASM_EMIT("movups      %%xmm2, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm3, 0x10(%[dst])")
+                __ASM_EMIT("movups      %%xmm4, 0x20(%[dst])")
+                __ASM_EMIT("movups      %%xmm5, 0x30(%[dst])")
+
+                : [p1] "=&r" (p1), [p2] "=&r" (p2), [k] "=&r" (k)
+                : [dst] "r" (dst), [x] "r" (&src[n-1]),
+                  [c] "g" (c), [ce] "g" (ce)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm7"
+            );
+
+            dst        += 16;
+            src        += 8;
+        }
+
+        // Process the tail
+        for ( ; count > 0; --count)
+        {
+            const float *x  = &src[n-1];
+            float s         = 0.0f;
+            for (size_t j=0; j<n; ++j)
+                s              += c[j] * (x[-ssize_t(j)] + x[j+1]);
+
+            dst[0]          = x[0];
+            dst[1]          = s;
+            dst            += 2;
+            src            ++;
+        }
+    }
+
+    void halfband_downsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count)
+    {
+        const float *ce = &c[n];
+        IF_ARCH_X86(const float *p1, *p2, *k);
+
+        // 8x blocks
+        for ( ; count >= 8; count -= 8)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("mov         %[x], %[p1]")                   // p1 = &x[0]
+                __ASM_EMIT("mov         %[c], %[k]")                    // k  = c
+                __ASM_EMIT("lea         0x08(%[x]), %[p2]")             // p2 = &x[2]
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")                // xmm0 = s0 = 0
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")                // xmm1 = s1 = 0
+
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[p1]), %%xmm2")           // xmm2 = a0 ? a1 ?
+                __ASM_EMIT("movups      0x10(%[p1]), %%xmm4")           // xmm4 = a2 ? a3 ?
+                __ASM_EMIT("movups      0x20(%[p1]), %%xmm3")           // xmm3 = a4 ? a5 ?
+                __ASM_EMIT("movups      0x30(%[p1]), %%xmm5")           // xmm5 = a6 ? a7 ?
+                __ASM_EMIT("shufps      $0x88, %%xmm4, %%xmm2")         // xmm2 = a0 a1 a2 a3
+                __ASM_EMIT("shufps      $0x88, %%xmm5, %%xmm3")         // xmm3 = a4 a5 a6 a7
+                __ASM_EMIT("movups      0x00(%[p2]), %%xmm4")           // xmm4 = b0 ? b1 ?
+                __ASM_EMIT("movups      0x10(%[p2]), %%xmm5")           // xmm5 = b2 ? b3 ?
+                __ASM_EMIT("movss       (%[k]), %%xmm7")                // xmm7 = c
+                __ASM_EMIT("shufps      $0x88, %%xmm5, %%xmm4")         // xmm4 = b0 b1 b2 b3
+                __ASM_EMIT("shufps      $0x00, %%xmm7, %%xmm7")         // xmm7 = c c c c
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")                // xmm2 = a0 + b0 ...
+                __ASM_EMIT("movups      0x20(%[p2]), %%xmm4")           // xmm4 = b4 ? b5 ?
+                __ASM_EMIT("movups      0x30(%[p2]), %%xmm5")           // xmm5 = b6 ? b7 ?
+                __ASM_EMIT("shufps      $0x88, %%xmm5, %%xmm4")         // xmm4 = b4 b5 b6 b7
+                __ASM_EMIT("addps       %%xmm4, %%xmm3")                // xmm3 = a4 + b4 ...
+                __ASM_EMIT("mulps       %%xmm7, %%xmm2")                // xmm2 = c*(a0 + b0) ...
+                __ASM_EMIT("mulps       %%xmm7, %%xmm3")                // xmm3 = c*(a4 + b4) ...
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")                // xmm0 = s0 + c*(a0 + b0) ...
+                __ASM_EMIT("addps       %%xmm3, %%xmm1")                // xmm1 = s1 + c*(a4 + b4) ...
+                __ASM_EMIT("sub         $0x08, %[p1]")
+                __ASM_EMIT("add         $0x08, %[p2]")
+                __ASM_EMIT("add         $0x04, %[k]")
+                __ASM_EMIT("cmp         %[ce], %[k]")
+                __ASM_EMIT("jb          1b")
+
+                // Add the central tap
+                __ASM_EMIT("movups      0x00(%[x]), %%xmm2")            // xmm2 = ? x0 ? x1
+                __ASM_EMIT("movups      0x10(%[x]), %%xmm4")            // xmm4 = ? x2 ? x3
+                __ASM_EMIT("movups      0x20(%[x]), %%xmm3")            // xmm3 = ? x4 ? x5
+                __ASM_EMIT("movups      0x30(%[x]), %%xmm5")            // xmm5 = ? x6 ? x7
+                __ASM_EMIT("shufps      $0xdd, %%xmm4, %%xmm2")         // xmm2 = x0 x1 x2 x3
+                __ASM_EMIT("shufps      $0xdd, %%xmm5, %%xmm3")         // xmm3 = x4 x5 x6 x7
+                __ASM_EMIT("mulps       %[X_HALF], %%xmm2")             // xmm2 = 0.5 * x0 ...
+                __ASM_EMIT("mulps       %[X_HALF], %%xmm3")             // xmm3 = 0.5 * x4 ...
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")
+                __ASM_EMIT("addps       %%xmm3, %%xmm1")
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm1, 0x10(%[dst])")
+
+                : [p1] "=&r" (p1), [p2] "=&r" (p2), [k] "=&r" (k)
+                : [dst] "r" (dst), [x] "r" (&src[(n << 1) - 2]),
+                  [c] "g" (c), [ce] "g" (ce),
+                  [X_HALF] "m" (X_HALF)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm7"
+            );
+
+            dst        += 8;
+            src        += 16;
+        }
+
+        // Process the tail
+        for ( ; count > 0; --count)
+        {
+            const float *x  = &src[(n << 1) - 1];
+            float s         = 0.0f;
+            for (size_t j=0; j<n; ++j)
+                s              += c[j] * (x[-ssize_t((j << 1) + 1)] + x[(j << 1) + 1]);
+
+            *(dst++)        = 0.5f * x[0] + s;
+            src            += 2;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_RESAMPLING_H_ */
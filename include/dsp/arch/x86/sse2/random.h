@@ -0,0 +1,146 @@
+/*
+ * random.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE2_RANDOM_H_
+#define DSP_ARCH_X86_SSE2_RANDOM_H_
+
+#ifndef DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE2_IMPL */
+
+namespace sse2
+{
+    #define DSP_F32REP4(v)      v, v, v, v
+
+    IF_ARCH_X86(
+        static const float prng_const[] __lsp_aligned16 =
+        {
+            DSP_F32REP4(1.0f / 16777216.0f),            // Uniform scale
+            DSP_F32REP4(1.7320508f / 16777216.0f),      // Gaussian scale
+            DSP_F32REP4(-2.0f * 1.7320508f)             // Gaussian bias
+        };
+    )
+
+    #undef DSP_F32REP4
+
+/* Advance generators, xmm4 = x, xmm5 = y, xmm6 = z, xmm7 = w, result: xmm7 = w, xmm0 = w >> 8 */
+#define PRNG_STEP \
+    __ASM_EMIT("movdqa          %%xmm4, %%xmm0")                    /* xmm0 = x */ \
+    __ASM_EMIT("movdqa          %%xmm7, %%xmm1")                    /* xmm1 = w */ \
+    __ASM_EMIT("pslld           $11, %%xmm0")                       /* xmm0 = x << 11 */ \
+    __ASM_EMIT("psrld           $19, %%xmm1")                       /* xmm1 = w >> 19 */ \
+    __ASM_EMIT("pxor            %%xmm4, %%xmm0")                    /* xmm0 = t = x ^ (x << 11) */ \
+    __ASM_EMIT("pxor            %%xmm7, %%xmm1")                    /* xmm1 = w ^ (w >> 19) */ \
+    __ASM_EMIT("movdqa          %%xmm5, %%xmm4")                    /* x = y */ \
+    __ASM_EMIT("pxor            %%xmm0, %%xmm1")                    /* xmm1 = w ^ (w >> 19) ^ t */ \
+    __ASM_EMIT("psrld           $8, %%xmm0")                        /* xmm0 = t >> 8 */ \
+    __ASM_EMIT("movdqa          %%xmm6, %%xmm5")                    /* y = z */ \
+    __ASM_EMIT("pxor            %%xmm1, %%xmm0")                    /* xmm0 = w ^ (w >> 19) ^ t ^ (t >> 8) */ \
+    __ASM_EMIT("movdqa          %%xmm7, %%xmm6")                    /* z = w */ \
+    __ASM_EMIT("movdqa          %%xmm0, %%xmm7")                    /* w = w ^ (w >> 19) ^ t ^ (t >> 8) */ \
+    __ASM_EMIT("psrld           $8, %%xmm0")                        /* xmm0 = w >> 8 */
+
+/* Generate vector of random values into xmm2 using GEN code, store them to dst */
+#define PRNG_BODY(GEN) \
+    __ASM_EMIT("movdqu          0x00(%[rnd]), %%xmm4")              /* xmm4 = x */ \
+    __ASM_EMIT("movdqu          0x10(%[rnd]), %%xmm5")              /* xmm5 = y */ \
+    __ASM_EMIT("movdqu          0x20(%[rnd]), %%xmm6")              /* xmm6 = z */ \
+    __ASM_EMIT("movdqu          0x30(%[rnd]), %%xmm7")              /* xmm7 = w */ \
+    __ASM_EMIT("sub             $4, %[count]") \
+    __ASM_EMIT("jb              2f") \
+    /* x4 blocks */ \
+    __ASM_EMIT("1:") \
+    GEN \
+    __ASM_EMIT("movups          %%xmm2, 0x00(%[dst])") \
+    __ASM_EMIT("add             $0x10, %[dst]") \
+    __ASM_EMIT("sub             $4, %[count]") \
+    __ASM_EMIT("jae             1b") \
+    /* x1 blocks */ \
+    __ASM_EMIT("2:") \
+    __ASM_EMIT("add             $4, %[count]") \
+    __ASM_EMIT("jle             4f") \
+    GEN \
+    __ASM_EMIT("3:") \
+    __ASM_EMIT("movss           %%xmm2, 0x00(%[dst])") \
+    __ASM_EMIT("shufps          $0x39, %%xmm2, %%xmm2") \
+    __ASM_EMIT("add             $0x04, %[dst]") \
+    __ASM_EMIT("dec             %[count]") \
+    __ASM_EMIT("jnz             3b") \
+    /* Store state */ \
+    __ASM_EMIT("4:") \
+    __ASM_EMIT("movdqu          %%xmm4, 0x00(%[rnd])") \
+    __ASM_EMIT("movdqu          %%xmm5, 0x10(%[rnd])") \
+    __ASM_EMIT("movdqu          %%xmm6, 0x20(%[rnd])") \
+    __ASM_EMIT("movdqu          %%xmm7, 0x30(%[rnd])")
+
+    void rand_uniform(float *dst, dsp::prng_t *rnd, size_t count)
+    {
+        ARCH_X86_ASM(
+            PRNG_BODY(
+                PRNG_STEP
+                __ASM_EMIT("cvtdq2ps        %%xmm0, %%xmm2")
+                __ASM_EMIT("mulps           0x00 + %[PRNG], %%xmm2")    /* xmm2 = a * k */
+            )
+            : [dst] "+r" (dst), [count] "+r" (count)
+            : [rnd] "r" (rnd),
+              [PRNG] "o" (prng_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    void rand_triangle(float *dst, dsp::prng_t *rnd, size_t count)
+    {
+        ARCH_X86_ASM(
+            PRNG_BODY(
+                PRNG_STEP
+                __ASM_EMIT("movdqa          %%xmm0, %%xmm2")            /* xmm2 = a */
+                PRNG_STEP
+                __ASM_EMIT("psubd           %%xmm0, %%xmm2")            /* xmm2 = a - b */
+                __ASM_EMIT("cvtdq2ps        %%xmm2, %%xmm2")
+                __ASM_EMIT("mulps           0x00 + %[PRNG], %%xmm2")    /* xmm2 = (a - b) * k */
+            )
+            : [dst] "+r" (dst), [count] "+r" (count)
+            : [rnd] "r" (rnd),
+              [PRNG] "o" (prng_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    void rand_gaussian(float *dst, dsp::prng_t *rnd, size_t count)
+    {
+        ARCH_X86_ASM(
+            PRNG_BODY(
+                PRNG_STEP
+                __ASM_EMIT("movdqa          %%xmm0, %%xmm2")            /* xmm2 = a */
+                PRNG_STEP
+                __ASM_EMIT("paddd           %%xmm0, %%xmm2")            /* xmm2 = a + b */
+                PRNG_STEP
+                __ASM_EMIT("paddd           %%xmm0, %%xmm2")            /* xmm2 = a + b + c */
+                PRNG_STEP
+                __ASM_EMIT("paddd           %%xmm0, %%xmm2")            /* xmm2 = a + b + c + d */
+                __ASM_EMIT("cvtdq2ps        %%xmm2, %%xmm2")
+                __ASM_EMIT("mulps           0x10 + %[PRNG], %%xmm2")    /* xmm2 = (a + b + c + d) * k */
+                __ASM_EMIT("addps           0x20 + %[PRNG], %%xmm2")    /* xmm2 = (a + b + c + d) * k + b */
+            )
+            : [dst] "+r" (dst), [count] "+r" (count)
+            : [rnd] "r" (rnd),
+              [PRNG] "o" (prng_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+#undef PRNG_BODY
+#undef PRNG_STEP
+}
+
+#endif /* DSP_ARCH_X86_SSE2_RANDOM_H_ */
@@ -0,0 +1,115 @@
+/*
+ * wavetable.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE2_WAVETABLE_H_
+#define DSP_ARCH_X86_SSE2_WAVETABLE_H_
+
+#ifndef DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE2_IMPL */
+
+namespace sse2
+{
+#define WAVETABLE_LOOKUP \
+    /* Compute indexes and fractions */ \
+    __ASM_EMIT("movdqa          %%xmm0, %%xmm1")                    /* xmm1 = p */ \
+    __ASM_EMIT("movdqa          %%xmm0, %%xmm3")                    /* xmm3 = p */ \
+    __ASM_EMIT("psrld           0x20 + %[args], %%xmm1")            /* xmm1 = i = p >> (32 - rank) */ \
+    __ASM_EMIT("pslld           0x30 + %[args], %%xmm3")            /* xmm3 = p << rank */ \
+    __ASM_EMIT("psrld           $9, %%xmm3")                        /* xmm3 = mantissa of f */ \
+    __ASM_EMIT("por             0x40 + %[args], %%xmm3")            /* xmm3 = 1 + f */ \
+    __ASM_EMIT("subps           0x40 + %[args], %%xmm3")            /* xmm3 = f */ \
+    /* Fetch samples */ \
+    __ASM_EMIT("movd            %%xmm1, %k[idx]") \
+    __ASM_EMIT("movss           0x00(%[table], %[idx], 4), %%xmm2") /* xmm2 = a0 */ \
+    __ASM_EMIT("movss           0x04(%[table], %[idx], 4), %%xmm4") /* xmm4 = b0 */ \
+    __ASM_EMIT("pshufd          $0x39, %%xmm1, %%xmm1") \
+    __ASM_EMIT("movd            %%xmm1, %k[idx]") \
+    __ASM_EMIT("movss           0x00(%[table], %[idx], 4), %%xmm5") /* xmm5 = a1 */ \
+    __ASM_EMIT("movss           0x04(%[table], %[idx], 4), %%xmm6") /* xmm6 = b1 */ \
+    __ASM_EMIT("pshufd          $0x39, %%xmm1, %%xmm1") \
+    __ASM_EMIT("unpcklps        %%xmm5, %%xmm2")                    /* xmm2 = a0 a1 */ \
+    __ASM_EMIT("unpcklps        %%xmm6, %%xmm4")                    /* xmm4 = b0 b1 */ \
+    __ASM_EMIT("movd            %%xmm1, %k[idx]") \
+    __ASM_EMIT("movss           0x00(%[table], %[idx], 4), %%xmm5") /* xmm5 = a2 */ \
+    __ASM_EMIT("movss           0x04(%[table], %[idx], 4), %%xmm6") /* xmm6 = b2 */ \
+    __ASM_EMIT("pshufd          $0x39, %%xmm1, %%xmm1") \
+    __ASM_EMIT("movd            %%xmm1, %k[idx]") \
+    __ASM_EMIT("movss           0x00(%[table], %[idx], 4), %%xmm7") /* xmm7 = a3 */ \
+    __ASM_EMIT("movss           0x04(%[table], %[idx], 4), %%xmm1") /* xmm1 = b3 */ \
+    __ASM_EMIT("unpcklps        %%xmm7, %%xmm5")                    /* xmm5 = a2 a3 */ \
+    __ASM_EMIT("unpcklps        %%xmm1, %%xmm6")                    /* xmm6 = b2 b3 */ \
+    __ASM_EMIT("movlhps         %%xmm5, %%xmm2")                    /* xmm2 = a */ \
+    __ASM_EMIT("movlhps         %%xmm6, %%xmm4")                    /* xmm4 = b */ \
+    /* Interpolate */ \
+    __ASM_EMIT("subps           %%xmm2, %%xmm4")                    /* xmm4 = b - a */ \
+    __ASM_EMIT("mulps           %%xmm3, %%xmm4")                    /* xmm4 = (b-a)*f */ \
+    __ASM_EMIT("addps           %%xmm4, %%xmm2")                    /* xmm2 = a + (b-a)*f */ \
+    __ASM_EMIT("mulps           0x50 + %[args], %%xmm2")            /* xmm2 = k*(a + (b-a)*f) */ \
+    __ASM_EMIT("addps           0x60 + %[args], %%xmm2")            /* xmm2 = k*(a + (b-a)*f) + b */
+
+    void wavetable(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count)
+    {
+        uint32_t args[28] __lsp_aligned16;
+        float *fargs    = reinterpret_cast<float *>(args);
+        IF_ARCH_X86(size_t idx);
+
+        for (size_t i=0; i<4; ++i)
+        {
+            args[i]         = phase + step * i;     // Initial phases
+            args[i + 4]     = step * 4;             // Phase increment
+            args[i + 8]     = 0;                    // Right shift
+            args[i + 12]    = 0;                    // Left shift
+            args[i + 16]    = 0x3f800000;           // 1.0f
+            fargs[i + 20]   = k;
+            fargs[i + 24]   = b;
+        }
+        args[8]         = 32 - rank;
+        args[12]        = rank;
+
+        ARCH_X86_ASM(
+            __ASM_EMIT("movdqa          0x00 + %[args], %%xmm0")        /* xmm0 = p */
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jb              2f")
+
+            // x4 blocks
+            __ASM_EMIT("1:")
+            WAVETABLE_LOOKUP
+            __ASM_EMIT("paddd           0x10 + %[args], %%xmm0")        /* xmm0 = p + step*4 */
+            __ASM_EMIT("movups          %%xmm2, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jae             1b")
+
+            // x1 blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $4, %[count]")
+            __ASM_EMIT("jle             4f")
+            WAVETABLE_LOOKUP
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movss           %%xmm2, 0x00(%[dst])")
+            __ASM_EMIT("shufps          $0x39, %%xmm2, %%xmm2")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jnz             3b")
+
+            // End
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [count] "+r" (count),
+              [idx] "=&r" (idx)
+            : [table] "r" (table), [args] "o" (args)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+#undef WAVETABLE_LOOKUP
+}
+
+#endif /* DSP_ARCH_X86_SSE2_WAVETABLE_H_ */
@@ -0,0 +1,66 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_COMMON_DYNAMICS_H_
+#define DSP_COMMON_DYNAMICS_H_
+
+#define DYN_KNEE_X_MIN          1e-30f      /* Minimum level passed to the logarithm */
+#define DYN_KNEE_X_MAX          1e+10f      /* Maximum level passed to the logarithm */
+#define DYN_KNEE_LOG_MIN        -80.0f      /* Minimum logarithm of the gain */
+#define DYN_KNEE_LOG_MAX        80.0f       /* Maximum logarithm of the gain */
+
+namespace dsp
+{
+#pragma pack(push, 1)
+    /**
+     * Gain curve of the dynamics processor consisting of three regions, the logarithm
+     * of the gain in each region is a cubic polynomial of the logarithm of the level:
+     *   lx     = ln(|x|)
+     *   gain   = exp(((p[0]*lx + p[1])*lx + p[2])*lx + p[3])
+     *
+     * where p is the 'lo' polynomial for |x| < start, the 'hi' polynomial for |x| > end
+     * and the 'knee' polynomial otherwise
+     */
+    typedef struct dyn_knee_t
+    {
+        float       start;          // Start of the knee, linear
+        float       end;            // End of the knee, linear
+        float       lo[4];          // Polynomial below the knee
+        float       knee[4];        // Polynomial of the knee
+        float       hi[4];          // Polynomial above the knee
+    } dyn_knee_t;
+#pragma pack(pop)
+}
+
+//-----------------------------------------------------------------------
+// DSP dynamics processing functions
+namespace dsp
+{
+    /** Compute gain of the dynamics processor for each sample of the envelope.
+     * The level is limited to [DYN_KNEE_X_MIN, DYN_KNEE_X_MAX] before taking the logarithm,
+     * the logarithm of the gain is limited to [DYN_KNEE_LOG_MIN, DYN_KNEE_LOG_MAX], so the
+     * gain never becomes zero or infinite
+     *
+     * @param dst destination vector, may be the same as source
+     * @param src source vector of envelope
+     * @param knee gain curve
+     * @param count number of elements
+     */
+    extern void (* dyn_gain)(float *dst, const float *src, const dyn_knee_t *knee, size_t count);
+
+    /** Compute output level of the dynamics processor for each sample of the envelope:
+     *   dst[i] = gain(src[i]) * |src[i]|
+     *
+     * @param dst destination vector, may be the same as source
+     * @param src source vector of envelope
+     * @param knee gain curve
+     * @param count number of elements
+     */
+    extern void (* dyn_curve)(float *dst, const float *src, const dyn_knee_t *knee, size_t count);
+}
+
+#endif /* DSP_COMMON_DYNAMICS_H_ */
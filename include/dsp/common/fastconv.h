@@ -55,6 +55,16 @@ namespace dsp
      * @param rank the convolution rank
      */
     extern void (* fastconv_apply)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+
+    /** Convolve two convolutions and add the result to the accumulator,
+     * the accumulated data can be restored to real data by fastconv_restore
+     *
+     * @param dst fast convolution data of 2^(rank+1) floats to accumulate convolved data
+     * @param c1 fast convolution data of 2^(rank+1) floats
+     * @param c2 fast convolution data of 2^(rank+1) floats
+     * @param rank the convolution rank
+     */
+    extern void (* fastconv_accumulate)(float *dst, const float *c1, const float *c2, size_t rank);
 }
 
 #endif /* DSP_COMMON_FASTCONV_H_ */
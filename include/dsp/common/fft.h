@@ -48,6 +48,73 @@ namespace dsp
      */
     extern void (* packed_reverse_fft)(float *dst, const float *src, size_t rank);
 
+    /** Direct Fast Fourier Transform of real signal. Since the spectrum of real signal
+     * is conjugate-symmetric, only 2^(rank-1) harmonics with non-negative frequencies are stored
+     * in packed complex form, the real part of Nyquist harmonic is stored instead of the
+     * imaginary part of DC harmonic: [re0, reN/2, re1, im1, re2, im2, ... ]
+     *
+     * @param dst packed spectrum of 2^rank floats
+     * @param src real signal of 2^rank floats
+     * @param rank the rank of FFT
+     */
+    extern void (* real_direct_fft)(float *dst, const float *src, size_t rank);
+
+    /** Reverse Fast Fourier Transform to real signal, the inverse of real_direct_fft
+     *
+     * @param dst real signal of 2^rank floats
+     * @param src packed spectrum of 2^rank floats in format returned by real_direct_fft
+     * @param rank the rank of FFT
+     */
+    extern void (* real_reverse_fft)(float *dst, const float *src, size_t rank);
+
+    /**
+     * Pre-computed plan of FFT of the specific rank. The plan stores twiddle
+     * factors of all passes and the bit-reverse permutation table, so the planned
+     * transform performs radix-4 passes and needs about rank/2 + 1 memory passes
+     * instead of rank passes of the radix-2 algorithm
+     */
+    typedef struct fft_plan_t
+    {
+        size_t          rank;       // Rank of FFT
+        float          *tw;         // Twiddle factors of all passes
+        uint32_t       *rev;        // Bit-reverse permutation table
+        void           *data;       // Allocated data
+    } fft_plan_t;
+
+    /** Initialize FFT plan
+     *
+     * @param plan plan to initialize
+     * @param rank the rank of FFT
+     * @return true on success, false if there is not enough memory
+     */
+    extern bool (* init_fft_plan)(fft_plan_t *plan, size_t rank);
+
+    /** Destroy FFT plan and free allocated memory
+     *
+     * @param plan plan to destroy
+     */
+    extern void (* destroy_fft_plan)(fft_plan_t *plan);
+
+    /** Direct Fast Fourier Transform using pre-computed plan, gives the same
+     * result as direct_fft of the rank specified by the plan
+     * @param dst_re real part of spectrum
+     * @param dst_im imaginary part of spectrum
+     * @param src_re real part of signal
+     * @param src_im imaginary part of signal
+     * @param plan pre-computed FFT plan
+     */
+    extern void (* planned_direct_fft)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const fft_plan_t *plan);
+
+    /** Reverse Fast Fourier Transform using pre-computed plan, gives the same
+     * result as reverse_fft of the rank specified by the plan
+     * @param dst_re real part of signal
+     * @param dst_im imaginary part of signal
+     * @param src_re real part of spectrum
+     * @param src_im imaginary part of spectrum
+     * @param plan pre-computed FFT plan
+     */
+    extern void (* planned_reverse_fft)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const fft_plan_t *plan);
+
     /** Normalize FFT coefficients
      *
      * @param dst_re target array for real part of signal
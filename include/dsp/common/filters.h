@@ -390,6 +390,30 @@ namespace dsp
      */
     extern void (* biquad_process_x8)(float *dst, const float *src, size_t count, biquad_t *f);
 
+    /** Process the same cascade of bi-quadratic filters for four independent channels
+     * simultaneously, one channel per SIMD lane. Lane i of each x4 bank contains
+     * coefficients of the channel i, filter memory is stored as d0[4], d1[4]
+     *
+     * @param dst destination samples, 4 interleaved channels
+     * @param src source samples, 4 interleaved channels
+     * @param count number of samples per channel to process
+     * @param f array of bi-quadratic filter structures, one per cascade stage
+     * @param stages number of cascade stages, should be greater than zero
+     */
+    extern void (* biquad_process_mc4)(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+
+    /** Process the same cascade of bi-quadratic filters for eight independent channels
+     * simultaneously, one channel per SIMD lane. Lane i of each x8 bank contains
+     * coefficients of the channel i, filter memory is stored as d0[8], d1[8]
+     *
+     * @param dst destination samples, 8 interleaved channels
+     * @param src source samples, 8 interleaved channels
+     * @param count number of samples per channel to process
+     * @param f array of bi-quadratic filter structures, one per cascade stage
+     * @param stages number of cascade stages, should be greater than zero
+     */
+    extern void (* biquad_process_mc8)(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+
     //---------------------------------------------------------------------------------------
     // Dynamic filters
     //---------------------------------------------------------------------------------------
@@ -519,6 +543,22 @@ namespace dsp
      */
     extern void (* matched_transform_x8)(biquad_x8_t *bf, f_cascade_t *bc, float kf, float td, size_t count);
 
+    //---------------------------------------------------------------------------------------
+    // Interpolation of dynamic filters
+    //---------------------------------------------------------------------------------------
+    /** Linearly interpolate analog filter cascades between key cascades computed
+     * for each step'th sample:
+     *   dst[i*stride] = k[j] + (k[j+1] - k[j]) * (i - j*step) / step, where
+     *   j = i / step, k[j] = keys[j*stride]
+     *
+     * @param dst target cascades
+     * @param keys key cascades, should contain at least (count - 1)/step + 2 elements
+     * @param stride distance between two sequential cascades in dst and keys
+     * @param step number of samples between two key cascades
+     * @param count number of cascades to generate
+     */
+    extern void (* interpolate_cascades)(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count);
+
 } // dsp
 
 #endif /* DSP_COMMON_FILTERS_H_ */
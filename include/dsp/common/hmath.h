@@ -49,6 +49,42 @@ namespace dsp
      */
     extern float (* scalar_mul)(const float *a, const float *b, size_t count);
 
+    /** Calculate mean value of the sliding window:
+     *   sum[i] = sum[i-1] + head[i] - tail[i]
+     *   dst[i] = max(sum[i], 0) * k
+     *
+     * The window sum is updated by blocked prefix sums, so the caller should periodically
+     * re-compute the exact sum of the window to bound the accumulated error. Negative
+     * (and NaN) sums caused by this error are clamped to zero
+     *
+     * @param dst destination buffer, may be the same with head
+     * @param head samples that enter the window
+     * @param tail samples that leave the window
+     * @param sum initial sum of the window
+     * @param k normalizing factor, usually 1/window size
+     * @param count number of elements
+     * @return updated sum of the window
+     */
+    extern float (* sliding_mean)(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+
+    /** Calculate RMS value of the sliding window:
+     *   sum[i] = sum[i-1] + head[i]*head[i] - tail[i]*tail[i]
+     *   dst[i] = sqrt(max(sum[i], 0) * k)
+     *
+     * The window sum is updated by blocked prefix sums, so the caller should periodically
+     * re-compute the exact sum of the window to bound the accumulated error. Negative
+     * (and NaN) sums caused by this error are clamped to zero
+     *
+     * @param dst destination buffer, may be the same with head
+     * @param head samples that enter the window
+     * @param tail samples that leave the window
+     * @param sum initial sum of squares of the window
+     * @param k normalizing factor, usually 1/window size
+     * @param count number of elements
+     * @return updated sum of squares of the window
+     */
+    extern float (* sliding_rms)(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+
 }
 
 #endif /* DSP_COMMON_HMATH_H_ */
@@ -370,6 +370,16 @@ namespace dsp
      */
     extern void (* powvx2)(float *dst, const float *v, const float *x, size_t count);
 
+    /**
+     * Add source multiplied by linear ramp: dst[i] = dst[i] + src[i] * (v1 + (v2 - v1) * i / count)
+     * @param dst destination array
+     * @param src source array
+     * @param v1 gain at the start of the ramp
+     * @param v2 gain at the end of the ramp (not reached)
+     * @param count number of elements in array
+     */
+    extern void (* lramp_add2)(float *dst, const float *src, float v1, float v2, size_t count);
+
 }
 
 #endif /* DSP_COMMON_PMATH_H_ */
@@ -0,0 +1,65 @@
+/*
+ * random.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_COMMON_RANDOM_H_
+#define DSP_COMMON_RANDOM_H_
+
+namespace dsp
+{
+    /**
+     * State of the pseudo-random number generator: four xorshift128 generators
+     * which are advanced simultaneously, each step produces four numbers
+     */
+    typedef struct prng_t
+    {
+        uint32_t    x[4];
+        uint32_t    y[4];
+        uint32_t    z[4];
+        uint32_t    w[4];
+    } prng_t;
+}
+
+//-----------------------------------------------------------------------
+// DSP pseudo-random number generation functions
+namespace dsp
+{
+    /** Initialize the state of pseudo-random number generator
+     *
+     * @param rnd generator state
+     * @param seed seed
+     */
+    extern void (* init_prng)(prng_t *rnd, uint32_t seed);
+
+    /** Generate uniformly distributed random numbers in range of [0, 1)
+     *
+     * @param dst destination vector
+     * @param rnd generator state
+     * @param count number of elements
+     */
+    extern void (* rand_uniform)(float *dst, prng_t *rnd, size_t count);
+
+    /** Generate random numbers with triangular distribution in range of (-1, 1)
+     * as a difference of two uniformly distributed numbers
+     *
+     * @param dst destination vector
+     * @param rnd generator state
+     * @param count number of elements
+     */
+    extern void (* rand_triangle)(float *dst, prng_t *rnd, size_t count);
+
+    /** Generate random numbers with approximately gaussian distribution with zero mean
+     * and unit variance as a scaled sum of four uniformly distributed numbers, the
+     * output is limited to the range of [-2*sqrt(3), 2*sqrt(3)]
+     *
+     * @param dst destination vector
+     * @param rnd generator state
+     * @param count number of elements
+     */
+    extern void (* rand_gaussian)(float *dst, prng_t *rnd, size_t count);
+}
+
+#endif /* DSP_COMMON_RANDOM_H_ */
@@ -157,6 +157,63 @@ namespace dsp
      * @param count number of samples to process
      */
     extern void (* downsample_8x)(float *dst, const float *src, size_t count);
+
+    /** Perform polyphase half-band FIR upsampling by 2, the source buffer should contain
+     * (2*n - 1) samples of history before the actual samples. The filter is symmetric
+     * and has 4*n-1 taps where all even taps except the central one are zero, so only
+     * odd output samples are computed:
+     *   dst[2*i]   = src[i + n - 1]
+     *   dst[2*i+1] = sum { c[k] * (src[i + n - 1 - k] + src[i + n + k]) }, k = 0..n-1
+     *
+     * The introduced delay is n samples of the source sample rate
+     *
+     * @param dst destination buffer of count*2 samples
+     * @param src source buffer of count + 2*n - 1 samples
+     * @param c half of odd filter taps multiplied by 2 (n elements)
+     * @param n number of coefficients, should be greater than zero
+     * @param count number of samples in source buffer to process, excluding history
+     */
+    extern void (* halfband_upsample_2x)(float *dst, const float *src, const float *c, size_t n, size_t count);
+
+    /** Perform polyphase half-band FIR downsampling by 2, the source buffer should contain
+     * (4*n - 3) samples of history before the actual samples:
+     *   dst[i] = 0.5 * src[2*i + 2*n - 1] + sum { c[k] * (src[2*i + 2*n - 2 - 2*k] + src[2*i + 2*n + 2*k]) }, k = 0..n-1
+     *
+     * The introduced delay is (2*n - 2) samples of the source sample rate
+     *
+     * @param dst destination buffer of count samples
+     * @param src source buffer of count*2 + 4*n - 3 samples
+     * @param c half of odd filter taps (n elements)
+     * @param n number of coefficients, should be greater than zero
+     * @param count number of samples to produce
+     */
+    extern void (* halfband_downsample_2x)(float *dst, const float *src, const float *c, size_t n, size_t count);
+
+    /** Perform polyphase half-band IIR upsampling by 2. The filter consists of two chains of
+     * first-order allpass sections in z^2 (coefficients c[0], c[2], ... for the even output
+     * samples and c[1], c[3], ... for the odd output samples)
+     *
+     * @param dst destination buffer of count*2 samples
+     * @param src source buffer of count samples
+     * @param state filter state of n*2 elements, should be zeroed before first call
+     * @param c allpass coefficients
+     * @param n number of allpass coefficients
+     * @param count number of samples in source buffer to process
+     */
+    extern void (* halfband_iir_upsample_2x)(float *dst, const float *src, float *state, const float *c, size_t n, size_t count);
+
+    /** Perform polyphase half-band IIR downsampling by 2. The filter consists of two chains of
+     * first-order allpass sections in z^2 (coefficients c[0], c[2], ... for the odd input
+     * samples and c[1], c[3], ... for the even input samples)
+     *
+     * @param dst destination buffer of count samples
+     * @param src source buffer of count*2 samples
+     * @param state filter state of n*2 elements, should be zeroed before first call
+     * @param c allpass coefficients
+     * @param n number of allpass coefficients
+     * @param count number of samples to produce
+     */
+    extern void (* halfband_iir_downsample_2x)(float *dst, const float *src, float *state, const float *c, size_t n, size_t count);
 }
 
 #endif /* DSP_COMMON_RESAMPLING_H_ */
@@ -0,0 +1,29 @@
+/*
+ * wavetable.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_COMMON_WAVETABLE_H_
+#define DSP_COMMON_WAVETABLE_H_
+
+namespace dsp
+{
+    /** Synthesize the periodic signal from one period stored in the table using
+     * linear interpolation between table samples: dst[i] = k * table(phase + step*i) + b.
+     * The full range of 32-bit phase corresponds to one period of the signal
+     *
+     * @param dst destination buffer of count samples
+     * @param table one period of 2^rank samples followed by the copy of the first sample
+     * @param rank rank of the table, should be in range of 1 to 23
+     * @param phase initial phase
+     * @param step phase increment for each sample
+     * @param k scale of the table value
+     * @param b offset added to the scaled table value
+     * @param count number of samples to synthesize
+     */
+    extern void (* wavetable)(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count);
+}
+
+#endif /* DSP_COMMON_WAVETABLE_H_ */
@@ -72,6 +72,8 @@ namespace lsp
                     inline void set_file(size_t idx, size_t file)       { sReconfig.nFile[idx]      = file;     }
                     inline void set_track(size_t idx, size_t track)     { sReconfig.nTrack[idx]     = track;    }
                     inline void set_rank(size_t idx, size_t rank)       { sReconfig.nRank[idx]      = rank;     }
+
+                    inline bool render(size_t idx) const                { return sReconfig.bRender[idx];        }
             };
 
             typedef struct af_descriptor_t
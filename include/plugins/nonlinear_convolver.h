@@ -51,8 +51,8 @@ namespace lsp
             enum state_t
             {
                 IDLE,
-                LOADING,        // <- Not Realtime: ITask
-                PREPARE,        // <- Not Realtime: ITask
+                LOADING,        // <- Not Realtime: Loader with Preparator continuation
+                PREPARE,        // <- Not Realtime: Preparator
                 PROCESSING
             };
 
@@ -132,6 +132,7 @@ namespace lsp
                 void apply_fastIntPow(float *dst, float *src, size_t exponent, size_t count);
                 size_t calculate_rank(size_t taps);
                 void process_hammerstein_fir(float *dst, float *src, size_t count);
+                bool cancel_tasks();
 
             protected:
                 static size_t get_model_order(size_t order);
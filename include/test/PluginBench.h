@@ -0,0 +1,124 @@
+/*
+ * PluginBench.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef TEST_PLUGINBENCH_H_
+#define TEST_PLUGINBENCH_H_
+
+#include <core/types.h>
+#include <core/status.h>
+#include <core/plugin.h>
+#include <core/IWrapper.h>
+#include <core/ipc/NativeExecutor.h>
+#include <data/cvector.h>
+
+namespace test
+{
+    class BenchPort;
+
+    /**
+     * Headless plugin wrapper for performance tests. Instantiates the plugin listed
+     * in metadata/modules.h, emulates all ports of the host and feeds the plugin
+     * with the synthetic signal: decaying noise bursts on audio inputs and periodic
+     * note events on MIDI inputs. Meshes are consumed after each processing cycle
+     * as if the UI was connected, so the measured cost is the worst case.
+     */
+    class PluginBench: public lsp::IWrapper
+    {
+        private:
+            lsp::plugin_t              *pPlugin;
+            lsp::ipc::NativeExecutor   *pExecutor;
+            lsp::position_t             sPosition;
+            lsp::cvector<BenchPort>     vPorts;
+            lsp::cvector<lsp::port_t>   vGenMetadata;
+            float                      *vSignal;        // Synthetic input signal
+            size_t                      nSignalLength;  // Length of the input signal
+            size_t                      nOffset;        // Current read position of the input signal
+            size_t                      nBlockSize;     // Maximum block size
+            size_t                      nNoteInterval;  // Interval between MIDI notes in samples
+            size_t                      nNoteCounter;   // Number of notes emitted
+            uint8_t                     vNotes[128];    // List of notes to emit
+            size_t                      nNotes;         // Number of notes in the list
+            bool                        bUpdateSettings;
+            uint8_t                    *pData;
+
+        protected:
+            static bool     match(const char *pattern, const char *id);
+            static lsp::plugin_t   *create_plugin(const char *id);
+
+            lsp::status_t   create_port(const lsp::port_t *port, const char *postfix);
+            void            generate_signal(long sample_rate);
+            void            collect_notes();
+            void            emit_midi(size_t samples);
+
+        public:
+            explicit PluginBench();
+            virtual ~PluginBench();
+
+        public:
+            /**
+             * Write the file with exponentially decaying noise to use it as impulse response or sample
+             * @param path path to the file
+             * @param channels number of channels
+             * @param frames number of frames
+             * @param sample_rate sample rate
+             * @return status of operation
+             */
+            static lsp::status_t write_sample(const char *path, size_t channels, size_t frames, long sample_rate);
+
+            /**
+             * Create and activate plugin
+             * @param id plugin identifier as listed in metadata/modules.h
+             * @param sample_rate sample rate
+             * @param block_size maximum number of samples processed in one cycle
+             * @return status of operation
+             */
+            lsp::status_t   init(const char *id, long sample_rate, size_t block_size);
+
+            /**
+             * Deactivate and destroy plugin
+             */
+            void            destroy();
+
+            /**
+             * Set value of control ports
+             * @param pattern port identifier, '*' matches any sequence of characters
+             * @param value value to set
+             * @return number of affected ports
+             */
+            size_t          set_value(const char *pattern, float value);
+
+            /**
+             * Request loading of the file by path ports
+             * @param pattern port identifier, '*' matches any sequence of characters
+             * @param path path to the file
+             * @return number of affected ports
+             */
+            size_t          set_path(const char *pattern, const char *path);
+
+            /**
+             * Process data until all path ports become idle
+             * @param timeout maximum wait time in milliseconds
+             * @return status of operation
+             */
+            lsp::status_t   wait_loaded(size_t timeout);
+
+            /**
+             * Perform one processing cycle
+             * @param samples number of samples to process, should not be greater than block size
+             */
+            void            process(size_t samples);
+
+            inline lsp::plugin_t   *plugin()            { return pPlugin;       }
+            inline size_t           block_size() const  { return nBlockSize;    }
+
+        public:
+            virtual lsp::ipc::IExecutor        *get_executor();
+            virtual const lsp::position_t      *position();
+    };
+}
+
+#endif /* TEST_PLUGINBENCH_H_ */
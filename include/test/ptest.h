@@ -15,6 +15,7 @@
 #include <core/types.h>
 #include <core/stdlib/stdio.h>
 #include <data/cstorage.h>
+#include <dsp/dsp.h>
 #include <test/test.h>
 
 #define PTEST_BEGIN(group, name, time, iterations) \
@@ -40,7 +41,7 @@
 
 #define PTEST_SUPPORTED(ptr)        TEST_SUPPORTED(ptr)
 
-#define PTEST_LOOP(__key, ...) { \
+#define PTEST_RLOOP(__key, __samples, __sample_rate, ...) { \
         double __start = clock(); \
         double __time = 0.0f; \
         wsize_t __iterations = 0; \
@@ -54,15 +55,26 @@
             __time          = (clock() - __start) / CLOCKS_PER_SEC; \
         } while (__time < __test_time); \
         \
-        gather_stats(__key, __time, __iterations); \
+        gather_stats(__key, __time, __iterations, __samples, __sample_rate); \
         if (__verbose) { \
             printf("  time [s]:                 %.2f/%.2f\n", __time, __test_time); \
             printf("  iterations:               %ld/%ld\n", long(__iterations), long((__iterations * __test_time) / __time)); \
             printf("  performance [i/s]:        %.2f\n", __iterations / __time); \
-            printf("  iteration time [us/i]:    %.4f\n\n", (1000000.0 * __time) / __iterations); \
+            printf("  iteration time [us/i]:    %.4f\n", (1000000.0 * __time) / __iterations); \
+            if ((__samples) > 0) \
+                printf("  sample time [ns/smp]:     %.4f\n", (1000000000.0 * __time) / (double(__iterations) * (__samples))); \
+            if (((__samples) > 0) && ((__sample_rate) > 0)) \
+                printf("  real-time factor:         %.2f\n", (double(__iterations) * (__samples)) / (double(__sample_rate) * __time)); \
+            printf("\n"); \
         } \
     }
 
+#define PTEST_SLOOP(__key, __samples, ...) \
+        PTEST_RLOOP(__key, __samples, 0, __VA_ARGS__)
+
+#define PTEST_LOOP(__key, ...) \
+        PTEST_SLOOP(__key, 0, __VA_ARGS__)
+
 #define PTEST_KLOOP(__key, __mul, ...) { \
         double __start = clock(); \
         double __time = 0.0f; \
@@ -123,7 +135,7 @@ namespace test
             static PerformanceTest    *__root;
             PerformanceTest           *__next;
 
-        protected:
+        public:
             typedef struct stats_t
             {
                 char       *key;            /* The loop indicator */
@@ -134,7 +146,12 @@ namespace test
                 char       *performance;    /* The performance of test [iterations per second] */
                 char       *time_cost;      /* The amount of time spent per iteration [milliseconds per iteration] */
                 char       *rel;            /* The relative speed */
+                char       *rtf;            /* The real-time factor */
                 double      cost;           /* The overall cost */
+                double      seconds;        /* Actual time [seconds] */
+                wsize_t     count;          /* Number of iterations */
+                size_t      samples;        /* Number of samples processed per iteration, 0 if not applicable */
+                size_t      sample_rate;    /* Sample rate of processed samples, 0 if not applicable */
             } stats_t;
 
         protected:
@@ -143,10 +160,12 @@ namespace test
             mutable lsp::cstorage<stats_t>      __test_stats;
 
         protected:
-            void gather_stats(const char *key, double time, wsize_t iterations);
+            void gather_stats(const char *key, double time, wsize_t iterations, size_t samples = 0, size_t sample_rate = 0);
             static void destroy_stats(stats_t *stats);
             static void estimate(size_t *len, const char *text);
             static void out_text(FILE *out, size_t length, const char *text, int align, const char *padding, const char *tail);
+            static void out_json_string(FILE *out, const char *text);
+            static void out_csv_string(FILE *out, const char *text);
 
         public:
             explicit PerformanceTest(const char *group, const char *name, float time, size_t iterations);
@@ -156,7 +175,31 @@ namespace test
             inline PerformanceTest *next()          { return __next; }
             virtual Test *next_test() const         { return const_cast<PerformanceTest *>(__next); };
 
+            inline size_t stats_count() const       { return __test_stats.size(); }
+            inline const stats_t *stats_at(size_t index) const { return __test_stats.at(index); }
+
             void dump_stats(FILE *out) const;
+
+            /**
+             * Dump statistics as JSON Lines: one JSON object per test case
+             * @param out output file
+             * @param info information about the selected DSP architecture, may be NULL
+             */
+            void dump_json(FILE *out, const dsp::info_t *info) const;
+
+            /**
+             * Dump statistics as CSV rows without the header
+             * @param out output file
+             * @param info information about the selected DSP architecture, may be NULL
+             */
+            void dump_csv(FILE *out, const dsp::info_t *info) const;
+
+            /**
+             * Output header of CSV file
+             * @param out output file
+             */
+            static void dump_csv_header(FILE *out);
+
             void free_stats();
     };
 
@@ -226,7 +226,11 @@ status_t create_outfile(const config_t *cfg)
     FILE *fd = fopen(cfg->outfile, "w");
     if (fd != NULL)
     {
-        out_cpu_info(fd);
+        // Structured formats carry CPU information in each record
+        if (cfg->outformat == OUT_TEXT)
+            out_cpu_info(fd);
+        else if (cfg->outformat == OUT_CSV)
+            test::PerformanceTest::dump_csv_header(fd);
         fclose(fd);
     }
 
@@ -343,7 +347,11 @@ int main(int argc, const char **argv)
 
         // Output statistics
         if (!cfg.is_child)
-            output_stats(&cfg, &stats);
+        {
+            status_t sres   = output_stats(&cfg, &stats);
+            if ((res == STATUS_OK) && (cfg.baseline != NULL))
+                res             = sres;
+        }
     }
 
     dsp::finish(&ctx);
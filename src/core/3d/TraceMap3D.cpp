@@ -8,12 +8,22 @@
 #include <core/debug.h>
 #include <core/3d/TraceMap3D.h>
 #include <core/3d/Scene3D.h>
+#include <core/ipc/Thread.h>
+
+#define BVH_BINS            16      /* Number of bins for SAH estimation */
+#define BVH_LEAF_SIZE       4       /* Maximum number of triangles in leaf that is never split */
+#define BVH_MAX_DEPTH       48      /* Maximum depth of the tree */
+#define RT_BATCH_RAYS       0x2000  /* Number of primary rays processed between merges of captures */
 
 namespace lsp
 {
     TraceMap3D::TraceMap3D()
     {
         pRoot       = NULL;
+        vBvhRefs    = NULL;
+        vBvhNodes   = NULL;
+        nBvhNodes   = 0;
+        nThreads    = 0;
     }
 
     TraceMap3D::~TraceMap3D()
@@ -87,6 +97,9 @@ namespace lsp
         lsp_free(vv);
         pRoot               = seg;
 
+        // The hierarchy should be rebuilt
+        destroy_bvh();
+
         return true;
     }
 
@@ -106,6 +119,10 @@ namespace lsp
         if ((vCaptures.size() <= 0) && (s == NULL))
             return STATUS_OK;
 
+        // Build bounding volume hierarchy
+        if ((vBvhNodes == NULL) && (!build_bvh()))
+            return STATUS_NO_MEM;
+
         // Initialize captures
         for (size_t i=0; i< vCaptures.size(); ++i)
         {
@@ -129,98 +146,232 @@ namespace lsp
             rs->generate(&rt, rays);
         }
 
-        // Do raytracing for each ray in the stack
-        raytrace3d_t    rtx, rfx;   // Reflected and Refracted rays
-        capture3d_t     ix;         // Intersection capture point
-        vector3d_t      cv;         // Capture vector
-        size_t ray_id = 0;
-        size_t rays_left = rt.size();
+        // Estimate number of threads, debugging is always performed in one thread
+        size_t n_rays       = rt.size();
+        size_t n_threads    = (nThreads > 0) ? nThreads : ipc::Thread::system_cores();
+        if ((s != NULL) || (n_threads <= 0))
+            n_threads           = 1;
+        if (n_threads > n_rays)
+            n_threads           = (n_rays > 0) ? n_rays : 1;
 
-//        s = NULL;
+        lsp_trace("Tracing %d rays using %d threads", int(n_rays), int(n_threads));
 
-        // Process each ray independently
-        while (rt.pop(&rtx))
+        worker_t *workers   = new worker_t[n_threads];
+        if (workers == NULL)
         {
-            if (rt.size() < rays_left)
+            rt.destroy();
+            return STATUS_NO_MEM;
+        }
+
+        for (size_t i=0; i<n_threads; ++i)
+        {
+            worker_t *w         = &workers[i];
+            w->pMap             = this;
+            w->pRays            = &rt;
+            w->nFirst           = 0;
+            w->nCount           = 0;
+            w->pScene           = s;
+            w->nResult          = STATUS_OK;
+            w->bExit            = false;
+        }
+
+        // Launch additional threads, the first range of each batch is processed by the current thread
+        status_t res        = STATUS_OK;
+        ipc::Thread **threads = (n_threads > 1) ? new ipc::Thread *[n_threads - 1] : NULL;
+        size_t n_launched   = 0;
+        if ((n_threads > 1) && (threads == NULL))
+            res                 = STATUS_NO_MEM;
+
+        for (size_t i=1; (res == STATUS_OK) && (i<n_threads); ++i)
+        {
+            ipc::Thread *t      = new ipc::Thread(worker_proc, &workers[i]);
+            if (t == NULL)
             {
-                lsp_trace("Rays left: %d", int(rays_left));
-                rays_left   = rt.size();
+                res                 = STATUS_NO_MEM;
+                break;
             }
+            threads[n_launched++] = t;
+            res                 = t->start();
+        }
 
-            if ((ray_id % 10000) == 0)
-                lsp_trace("Tracing ray #%d", int(ray_id));
-//            lsp_trace(" ray=(%.3f, %.3f, %.3f - %.3f, %.3f, %.3f)",
-//                    rtx.r.z.x, rtx.r.z.y, rtx.r.z.z, rtx.r.v.dx, rtx.r.v.dy, rtx.r.v.dz);
-            ray_id++;
-
-            if (s != NULL) // DEBUG
-                s->add_point(&rtx.r.z);
+        // Process primary rays in batches to keep size of capture buffers bounded
+        for (size_t first=0; (res == STATUS_OK) && (first < n_rays); first += RT_BATCH_RAYS)
+        {
+            size_t batch        = n_rays - first;
+            if (batch > RT_BATCH_RAYS)
+                batch               = RT_BATCH_RAYS;
 
-            // Process ray until it's energy falls down
-            do
+            // Split primary rays of the batch into contiguous ranges
+            for (size_t i=0; i<n_threads; ++i)
             {
-                // Do raytracing: find intersection of ray with triangles
-                dsp::init_intersection3d(&ix);
+                worker_t *w         = &workers[i];
+                w->nFirst           = first + (batch * i) / n_threads;
+                w->nCount           = first + (batch * (i + 1)) / n_threads - w->nFirst;
+            }
 
-//                if (ray_id == 7066155)
-//                    printf("debug");
+            for (size_t i=0; i<n_launched; ++i)
+                workers[i+1].sStart.post();
 
-                raytrace_step(&ix, &rtx);
+            res                 = raytrace_rays(&workers[0]);
 
-                // Consider that there was no intersection found
-                if (ix.n <= 0)
+            for (size_t i=0; i<n_launched; ++i)
+            {
+                worker_t *w         = &workers[i+1];
+                w->sDone.wait();
+                if ((res == STATUS_OK) && (w->nResult != STATUS_OK))
+                    res                 = w->nResult;
+            }
+
+            // Merge captured data in the order of primary rays
+            for (size_t i=0; (res == STATUS_OK) && (i<n_threads); ++i)
+            {
+                cstorage<capture_event_t> *ev = &workers[i].vEvents;
+                for (size_t j=0, n=ev->size(); j<n; ++j)
                 {
-                    if (s != NULL) // DEBUG
-                        s->add_ray(&rtx.r);
-                    break;
+                    capture_event_t *e  = ev->at(j);
+                    e->pCapture->capture(&e->sDirection, e->fAmplitude, e->fDelay);
                 }
+            }
+
+            for (size_t i=0; i<n_threads; ++i)
+                workers[i].vEvents.clear();
+        }
+
+        // Stop threads
+        for (size_t i=0; i<n_launched; ++i)
+        {
+            workers[i+1].bExit  = true;
+            workers[i+1].sStart.post();
+
+            ipc::Thread *t      = threads[i];
+            t->join();
+            delete t;
+        }
+        if (threads != NULL)
+            delete [] threads;
+
+        // Destroy workers and raytrace stack
+        for (size_t i=0; i<n_threads; ++i)
+            workers[i].vEvents.flush();
+        delete [] workers;
+        rt.destroy();
+
+        return res;
+    }
+
+    status_t TraceMap3D::worker_proc(void *arg)
+    {
+        worker_t *w = reinterpret_cast<worker_t *>(arg);
+
+        // Enable DSP context for the worker thread
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+
+        while (true)
+        {
+            w->sStart.wait();
+            if (w->bExit)
+                break;
+            w->nResult  = w->pMap->raytrace_rays(w);
+            w->sDone.post();
+        }
+
+        dsp::finish(&ctx);
+
+        return STATUS_OK;
+    }
 
+    status_t TraceMap3D::raytrace_rays(worker_t *w)
+    {
+        RayTrace3D      rt;         // Private raytrace stack
+        raytrace3d_t    rtx, rfx;   // Reflected and Refracted rays
+        capture3d_t     ix;         // Intersection capture point
+        vector3d_t      cv;         // Capture vector
+        Scene3D        *s = w->pScene;
+
+        // Primary rays are processed in the same order as they were popped from the stack
+        size_t last     = w->pRays->size() - 1;
+
+        for (size_t ray_id = w->nFirst, end = w->nFirst + w->nCount; ray_id < end; ++ray_id)
+        {
+            if ((ray_id % 10000) == 0)
+                lsp_trace("Tracing ray #%d", int(ray_id));
+
+            if (!rt.push(w->pRays->get(last - ray_id)))
+            {
+                rt.destroy();
+                return STATUS_NO_MEM;
+            }
+
+            // Process the primary ray and all rays spawned by it
+            while (rt.pop(&rtx))
+            {
                 if (s != NULL) // DEBUG
+                    s->add_point(&rtx.r.z);
+
+                // Process ray until it's energy falls down
+                do
                 {
-                    segment3d_t seg;
-                    dsp::init_segment_p2(&seg, &rtx.r.z, &ix.p);
-                    s->add_segment(&seg);
-                    s->add_point(&ix.p);
-                }
+                    // Do raytracing: find intersection of ray with triangles
+                    dsp::init_intersection3d(&ix);
+                    raytrace_step(&ix, &rtx);
 
-                // Reflect and refract the ray with triangles
-                dsp::reflect_ray(&rtx, &rfx, &ix);
+                    // Consider that there was no intersection found
+                    if (ix.n <= 0)
+                    {
+                        if (s != NULL) // DEBUG
+                            s->add_ray(&rtx.r);
+                        break;
+                    }
 
-                // Trigger captures
-                bool has_capture = false;
-                for (size_t i=0; i<ix.n; ++i)
-                {
-                    segment_t *c = ix.pSeg[i];
-                    if ((c == NULL) || (c->pCapture == NULL))
-                        continue;
+                    if (s != NULL) // DEBUG
+                    {
+                        segment3d_t seg;
+                        dsp::init_segment_p2(&seg, &rtx.r.z, &ix.p);
+                        s->add_segment(&seg);
+                        s->add_point(&ix.p);
+                    }
 
-                    has_capture = true;
-                    dsp::init_vector_p2(&cv, &ix.p, &c->sCapture);
+                    // Reflect and refract the ray with triangles
+                    dsp::reflect_ray(&rtx, &rfx, &ix);
 
-                    // Calculate cosine between vectors
-                    float angle = dsp::calc_angle3d_v2(&rtx.r.v, &cv);
-                    c->pCapture->capture(&cv, rtx.amplitude * angle, rtx.delay / SOUND_SPEED_M_S);
-                }
+                    // Trigger captures
+                    bool has_capture = false;
+                    for (size_t i=0; i<ix.n; ++i)
+                    {
+                        segment_t *c = ix.pSeg[i];
+                        if ((c == NULL) || (c->pCapture == NULL))
+                            continue;
+
+                        has_capture = true;
+                        dsp::init_vector_p2(&cv, &ix.p, &c->sCapture);
+
+                        // Calculate cosine between vectors and store event to private buffer
+                        capture_event_t *e  = w->vEvents.append();
+                        if (e == NULL)
+                        {
+                            rt.destroy();
+                            return STATUS_NO_MEM;
+                        }
+                        e->pCapture     = c->pCapture;
+                        e->sDirection   = cv;
+                        e->fAmplitude   = rtx.amplitude * dsp::calc_angle3d_v2(&rtx.r.v, &cv);
+                        e->fDelay       = rtx.delay / SOUND_SPEED_M_S;
+                    }
 
-                if (!has_capture)
-                {
-                    if (!rt.push(&rfx)) // Queue refracted ray for future processing
+                    if (!has_capture)
                     {
-                        rt.destroy();
-                        return STATUS_NO_MEM;
+                        if (!rt.push(&rfx)) // Queue refracted ray for future processing
+                        {
+                            rt.destroy();
+                            return STATUS_NO_MEM;
+                        }
                     }
+                    else if (s != NULL)
+                        s->add_point(&ix.p);
                 }
-                else if (s != NULL)
-                    s->add_point(&ix.p);
-
-    //            lsp_trace(" refl=(%.3f, %.3f, %.3f - %.3f, %.3f, %.3f), ampl=%f, time=%.3f",
-    //                        rt.r.z.x, rt.r.z.y, rt.r.z.z, rt.r.v.dx, rt.r.v.dy, rt.r.v.dz,
-    //                        rt.amplitude, rt.delay);
-    //            lsp_trace(" refr=(%.3f, %.3f, %.3f - %.3f, %.3f, %.3f), ampl=%f, time=%.3f",
-    //                        rf.r.z.x, rf.r.z.y, rf.r.z.z, rf.r.v.dx, rf.r.v.dy, rf.r.v.dz,
-    //                        rf.amplitude, rf.delay);
+                while (fabs(rtx.amplitude) >= CMP_TOLERANCE);
             }
-            while (fabs(rtx.amplitude) >= CMP_TOLERANCE);
         }
 
         // Destroy raytrace stack
@@ -237,61 +388,383 @@ namespace lsp
         return false;
     }
 
-    void TraceMap3D::raytrace_step(capture3d_t *ix, const raytrace3d_t *rt)
+    static inline float bvh_area(const point3d_t *min, const point3d_t *max)
     {
-        point3d_t i;
-        const triangle3d_t *t;
+        float dx    = max->x - min->x;
+        float dy    = max->y - min->y;
+        float dz    = max->z - min->z;
+        return dx*dy + dy*dz + dz*dx;
+    }
+
+    static inline void bvh_extend(point3d_t *min, point3d_t *max, const point3d_t *pmin, const point3d_t *pmax)
+    {
+        if (min->x > pmin->x)
+            min->x      = pmin->x;
+        if (min->y > pmin->y)
+            min->y      = pmin->y;
+        if (min->z > pmin->z)
+            min->z      = pmin->z;
+        if (max->x < pmax->x)
+            max->x      = pmax->x;
+        if (max->y < pmax->y)
+            max->y      = pmax->y;
+        if (max->z < pmax->z)
+            max->z      = pmax->z;
+    }
+
+    static inline void bvh_reset(point3d_t *min, point3d_t *max)
+    {
+        dsp::init_point_xyz(min, DSP_3D_MAXVALUE, DSP_3D_MAXVALUE, DSP_3D_MAXVALUE);
+        dsp::init_point_xyz(max, -DSP_3D_MAXVALUE, -DSP_3D_MAXVALUE, -DSP_3D_MAXVALUE);
+    }
+
+    bool TraceMap3D::build_bvh()
+    {
+        destroy_bvh();
 
+        // Count number of triangles
+        size_t count = 0;
         for (segment_t *seg = pRoot; seg != NULL; seg = seg->pNext)
+            count          += seg->nItems;
+        if (count <= 0)
+            return true;
+
+        // Allocate references and nodes, the binary tree contains at most 2*N - 1 nodes
+        vBvhRefs            = lsp_tmalloc(bvh_ref_t, count);
+        if (vBvhRefs == NULL)
+            return false;
+        vBvhNodes           = lsp_tmalloc(bvh_node_t, count * 2);
+        if (vBvhNodes == NULL)
         {
-            // Check that has elements
-            if (seg->nItems <= 0)
-                continue;
+            destroy_bvh();
+            return false;
+        }
+
+        // Initialize references, extend bounds a bit to make box check conservative
+        bvh_ref_t *ref      = vBvhRefs;
+        for (segment_t *seg = pRoot; seg != NULL; seg = seg->pNext)
+        {
+            triangle3d_t *t     = seg->vTriangles;
+            for (size_t i=0; i<seg->nItems; ++i, ++t, ++ref)
+            {
+                ref->pTriangle      = t;
+                ref->pSeg           = seg;
+                bvh_reset(&ref->sMin, &ref->sMax);
+                for (size_t j=0; j<3; ++j)
+                    bvh_extend(&ref->sMin, &ref->sMax, &t->p[j], &t->p[j]);
+
+                float eps           = DSP_3D_TOLERANCE * (1.0f +
+                        fabs(ref->sMin.x) + fabs(ref->sMin.y) + fabs(ref->sMin.z) +
+                        fabs(ref->sMax.x) + fabs(ref->sMax.y) + fabs(ref->sMax.z));
+                ref->sMin.x        -= eps;
+                ref->sMin.y        -= eps;
+                ref->sMin.z        -= eps;
+                ref->sMax.x        += eps;
+                ref->sMax.y        += eps;
+                ref->sMax.z        += eps;
+
+                ref->sCenter.x      = (ref->sMin.x + ref->sMax.x) * 0.5f;
+                ref->sCenter.y      = (ref->sMin.y + ref->sMax.y) * 0.5f;
+                ref->sCenter.z      = (ref->sMin.z + ref->sMax.z) * 0.5f;
+                ref->sCenter.w      = 1.0f;
+            }
+        }
+
+        // Build the tree
+        nBvhNodes           = 0;
+        build_bvh_node(0, count, 0);
+        lsp_trace("Built BVH of %d nodes for %d triangles", int(nBvhNodes), int(count));
+
+        return true;
+    }
 
-            // Check octant
-            if (!dsp::check_octant3d_rv(&seg->sOctant, &rt->r))
+    size_t TraceMap3D::build_bvh_node(size_t first, size_t count, size_t depth)
+    {
+        size_t index        = nBvhNodes++;
+        bvh_node_t *node    = &vBvhNodes[index];
+        bvh_ref_t *refs     = &vBvhRefs[first];
+
+        // Compute bounds of the node and bounds of centroids
+        point3d_t cmin, cmax;
+        bvh_reset(&node->sMin, &node->sMax);
+        bvh_reset(&cmin, &cmax);
+        for (size_t i=0; i<count; ++i)
+        {
+            bvh_extend(&node->sMin, &node->sMax, &refs[i].sMin, &refs[i].sMax);
+            bvh_extend(&cmin, &cmax, &refs[i].sCenter, &refs[i].sCenter);
+        }
+
+        node->nFirst        = first;
+        node->nCount        = count;
+        if ((count <= BVH_LEAF_SIZE) || (depth >= BVH_MAX_DEPTH))
+            return index;
+
+        // Find the best split using binned surface area heuristic
+        const float *vcmin  = &cmin.x;
+        const float *vcmax  = &cmax.x;
+        size_t b_axis       = 0, b_split = 0;
+        float b_cost        = count; // The cost of leaf node
+        float area          = bvh_area(&node->sMin, &node->sMax);
+        if (area <= 0.0f)
+            area                = DSP_3D_TOLERANCE;
+
+        size_t nbins[BVH_BINS];
+        point3d_t bmin[BVH_BINS], bmax[BVH_BINS];
+        float rarea[BVH_BINS];
+        size_t rcount[BVH_BINS];
+
+        for (size_t axis=0; axis<3; ++axis)
+        {
+            float extent        = vcmax[axis] - vcmin[axis];
+            if (extent <= 0.0f)
                 continue;
+            float k             = BVH_BINS / extent;
 
-            t = seg->vTriangles;
+            for (size_t i=0; i<BVH_BINS; ++i)
+            {
+                nbins[i]            = 0;
+                bvh_reset(&bmin[i], &bmax[i]);
+            }
 
-            for (size_t count=seg->nItems; count > 0; count--, t++)
+            for (size_t i=0; i<count; ++i)
             {
-                if (has_triangle(&rt->x, t))
-                    continue;
+                size_t b            = ((&refs[i].sCenter.x)[axis] - vcmin[axis]) * k;
+                if (b >= BVH_BINS)
+                    b                   = BVH_BINS - 1;
+                nbins[b]           ++;
+                bvh_extend(&bmin[b], &bmax[b], &refs[i].sMin, &refs[i].sMax);
+            }
+
+            // Sweep from right to left
+            point3d_t smin, smax;
+            size_t n            = 0;
+            bvh_reset(&smin, &smax);
+            for (size_t i=BVH_BINS-1; i > 0; --i)
+            {
+                n                  += nbins[i];
+                bvh_extend(&smin, &smax, &bmin[i], &bmax[i]);
+                rcount[i]           = n;
+                rarea[i]            = (n > 0) ? bvh_area(&smin, &smax) : 0.0f;
+            }
 
-                float dist      = dsp::find_intersection3d_rt(&i, &rt->r, t);
-                if ((dist < 0.0f) || (dist > ix->p.w))
+            // Sweep from left to right and estimate the cost
+            n                   = 0;
+            bvh_reset(&smin, &smax);
+            for (size_t i=1; i < BVH_BINS; ++i)
+            {
+                n                  += nbins[i-1];
+                bvh_extend(&smin, &smax, &bmin[i-1], &bmax[i-1]);
+                if ((n <= 0) || (rcount[i] <= 0))
                     continue;
 
-//                printf("intersection at (%.3f, %.3f, %.3f) with triangle (%.3f, %.3f, %.3f; %.3f, %.3f, %.3f; %.3f, %.3f, %.3f), projection=%.3f\n",
-//                    i.x, i.y, i.z,
-//                    t->p[0].x, t->p[0].y, t->p[0].z,
-//                    t->p[1].x, t->p[1].y, t->p[1].z,
-//                    t->p[2].x, t->p[2].y, t->p[2].z,
-//                    proj
-//                );
+                float cost          = 1.0f + (bvh_area(&smin, &smax) * n + rarea[i] * rcount[i]) / area;
+                if (cost < b_cost)
+                {
+                    b_cost              = cost;
+                    b_axis              = axis;
+                    b_split             = i;
+                }
+            }
+        }
+
+        // Leaf node is cheaper?
+        if (b_split <= 0)
+            return index;
+
+        // Partition references
+        float k             = BVH_BINS / (vcmax[b_axis] - vcmin[b_axis]);
+        size_t left         = 0;
+        for (size_t i=0; i<count; ++i)
+        {
+            size_t b            = ((&refs[i].sCenter.x)[b_axis] - vcmin[b_axis]) * k;
+            if (b >= b_split)
+                continue;
+            if (i != left)
+            {
+                bvh_ref_t tmp       = refs[i];
+                refs[i]             = refs[left];
+                refs[left]          = tmp;
+            }
+            ++left;
+        }
+        if ((left <= 0) || (left >= count))
+            return index;
+
+        // Build child nodes, left child immediately follows the parent
+        build_bvh_node(first, left, depth + 1);
+        size_t right        = build_bvh_node(first + left, count - left, depth + 1);
+
+        node                = &vBvhNodes[index];
+        node->nFirst        = right;
+        node->nCount        = 0;
+
+        return index;
+    }
+
+    void TraceMap3D::destroy_bvh()
+    {
+        if (vBvhRefs != NULL)
+        {
+            lsp_free(vBvhRefs);
+            vBvhRefs        = NULL;
+        }
+        if (vBvhNodes != NULL)
+        {
+            lsp_free(vBvhNodes);
+            vBvhNodes       = NULL;
+        }
+        nBvhNodes       = 0;
+    }
+
+    float TraceMap3D::check_bvh_node(const bvh_node_t *node, const bvh_ray_t *r)
+    {
+        const float *min    = &node->sMin.x;
+        const float *max    = &node->sMax.x;
+        float tmin          = 0.0f;
+        float tmax          = DSP_3D_MAXVALUE;
+
+        // Slab test
+        for (size_t i=0; i<3; ++i)
+        {
+            if (r->vDir[i] == 0.0f)
+            {
+                if ((r->vOrigin[i] < min[i]) || (r->vOrigin[i] > max[i]))
+                    return -1.0f;
+                continue;
+            }
+
+            float t1            = (min[i] - r->vOrigin[i]) * r->vInvDir[i];
+            float t2            = (max[i] - r->vOrigin[i]) * r->vInvDir[i];
+            if (t1 > t2)
+            {
+                float t             = t1;
+                t1                  = t2;
+                t2                  = t;
+            }
+            if (tmin < t1)
+                tmin                = t1;
+            if (tmax > t2)
+                tmax                = t2;
+            if (tmin > tmax)
+                return -1.0f;
+        }
+
+        // Return the distance in units of projection on the ray
+        return tmin * r->fScale;
+    }
+
+    void TraceMap3D::raytrace_step(capture3d_t *ix, const raytrace3d_t *rt)
+    {
+        if (nBvhNodes <= 0)
+            return;
+
+        point3d_t i;
+        const triangle3d_t *t;
+        size_t stack[BVH_MAX_DEPTH + 2];
+        float dstack[BVH_MAX_DEPTH + 2];
+
+        // Prepare ray
+        bvh_ray_t r;
+        r.vOrigin[0]    = rt->r.z.x;
+        r.vOrigin[1]    = rt->r.z.y;
+        r.vOrigin[2]    = rt->r.z.z;
+        r.vDir[0]       = rt->r.v.dx;
+        r.vDir[1]       = rt->r.v.dy;
+        r.vDir[2]       = rt->r.v.dz;
+        for (size_t j=0; j<3; ++j)
+            r.vInvDir[j]    = (r.vDir[j] != 0.0f) ? 1.0f / r.vDir[j] : 0.0f;
+        r.fScale        = r.vDir[0]*r.vDir[0] + r.vDir[1]*r.vDir[1] + r.vDir[2]*r.vDir[2];
+
+        // Traverse the tree, nearest child first
+        float dist      = check_bvh_node(vBvhNodes, &r);
+        if (dist < 0.0f)
+            return;
+
+        size_t sp       = 0;
+        stack[sp]       = 0;
+        dstack[sp++]    = dist;
+
+        while (sp > 0)
+        {
+            --sp;
+            if (dstack[sp] > ix->p.w + DSP_3D_TOLERANCE)
+                continue;
+
+            const bvh_node_t *node  = &vBvhNodes[stack[sp]];
+            if (node->nCount > 0)
+            {
+                // Leaf node, check triangles
+                const bvh_ref_t *ref    = &vBvhRefs[node->nFirst];
+                for (size_t count=node->nCount; count > 0; count--, ref++)
+                {
+                    t               = ref->pTriangle;
+                    if (has_triangle(&rt->x, t))
+                        continue;
 
-                // This point is the right intersection, store it
-                if (fabs(dist - ix->p.w) > DSP_3D_TOLERANCE)
-                    ix->n = 0;
+                    dist            = dsp::find_intersection3d_rt(&i, &rt->r, t);
+                    if ((dist < 0.0f) || (dist > ix->p.w))
+                        continue;
+
+                    // This point is the right intersection, store it
+                    if (fabs(dist - ix->p.w) > DSP_3D_TOLERANCE)
+                        ix->n = 0;
+
+                    ix->p       = i;
+                    ix->p.w     = dist;
+
+                    // Store triangle with limit checking
+                    if (ix->n < DSP_3D_MAXISECT)
+                    {
+                        size_t idx      = ix->n++;
+                        ix->t[idx]      = t;
+                        ix->m[idx]      = ref->pSeg->pMaterial;
+                        ix->pSeg[idx]   = ref->pSeg;
+                    }
+                }
+                continue;
+            }
 
-                ix->p       = i;
-                ix->p.w     = dist;
+            // Inner node, check both children
+            size_t l        = stack[sp] + 1;
+            size_t r_idx    = node->nFirst;
+            float dl        = check_bvh_node(&vBvhNodes[l], &r);
+            float dr        = check_bvh_node(&vBvhNodes[r_idx], &r);
 
-                // Store triangle with limit checking
-                if (ix->n < DSP_3D_MAXISECT)
+            // Push the farthest child first to process the nearest one earlier
+            if ((dl >= 0.0f) && (dr >= 0.0f))
+            {
+                if (dl < dr)
+                {
+                    stack[sp]       = r_idx;
+                    dstack[sp++]    = dr;
+                    stack[sp]       = l;
+                    dstack[sp++]    = dl;
+                }
+                else
                 {
-                    size_t idx      = ix->n++;
-                    ix->t[idx]      = t;
-                    ix->m[idx]      = seg->pMaterial;
-                    ix->pSeg[idx]   = seg;
+                    stack[sp]       = l;
+                    dstack[sp++]    = dl;
+                    stack[sp]       = r_idx;
+                    dstack[sp++]    = dr;
                 }
             }
+            else if (dl >= 0.0f)
+            {
+                stack[sp]       = l;
+                dstack[sp++]    = dl;
+            }
+            else if (dr >= 0.0f)
+            {
+                stack[sp]       = r_idx;
+                dstack[sp++]    = dr;
+            }
         }
     }
 
     void TraceMap3D::destroy()
     {
+        destroy_bvh();
+
         for (segment_t *seg = pRoot; seg != NULL; )
         {
             segment_t *next = seg->pNext;
@@ -33,6 +33,14 @@ namespace lsp
         fKS             = 0.0f;
         fKE             = 0.0f;
         fLogTH          = 0.0f;
+        sKnee.start     = 0.0f;
+        sKnee.end       = 0.0f;
+        for (size_t i=0; i<4; ++i)
+        {
+            sKnee.lo[i]     = 0.0f;
+            sKnee.knee[i]   = 0.0f;
+            sKnee.hi[i]     = 0.0f;
+        }
 
         // Additional parameters
         nSampleRate     = 0;
@@ -66,6 +74,25 @@ namespace lsp
         else
             interpolation::hermite_quadratic(vHermite, log_ks, log_ks, 1.0f, log_ke, fXRatio);
 
+        // Build gain curve for block processing
+        float *tilt     = (bUpward) ? sKnee.lo : sKnee.hi;
+        float *flat     = (bUpward) ? sKnee.hi : sKnee.lo;
+
+        sKnee.start     = fKS;
+        sKnee.end       = fKE;
+        tilt[0]         = 0.0f;
+        tilt[1]         = 0.0f;
+        tilt[2]         = fXRatio - 1.0f;
+        tilt[3]         = (1.0f - fXRatio) * fLogTH;
+        sKnee.knee[0]   = 0.0f;
+        sKnee.knee[1]   = vHermite[0];
+        sKnee.knee[2]   = vHermite[1] - 1.0f;
+        sKnee.knee[3]   = vHermite[2];
+        flat[0]         = 0.0f;
+        flat[1]         = 0.0f;
+        flat[2]         = 0.0f;
+        flat[3]         = 0.0f;
+
         // Reset update flag
         bUpdate         = false;
     }
@@ -108,48 +135,7 @@ namespace lsp
 
     void Compressor::curve(float *out, const float *in, size_t dots)
     {
-        if (bUpward)
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-                if (x < FLOAT_SAT_N_INF)
-                    x       = FLOAT_SAT_N_INF;
-
-                if (x <= fKE)
-                {
-                    float lx    = logf(x);
-                    *out = (x < fKS) ?
-                            expf(fXRatio*(lx - fLogTH) + fLogTH) :
-                            expf((vHermite[0]*lx + vHermite[1])*lx + vHermite[2]);
-                }
-                else
-                    *out        = x;
-                out++;
-            }
-        }
-        else
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-                if (x >= fKS)
-                {
-                    float lx    = logf(x);
-                    x   = (x > fKE) ?
-                        expf(fXRatio*(lx - fLogTH) + fLogTH) :
-                        expf((vHermite[0]*lx + vHermite[1])*lx + vHermite[2]);
-                    *out        = x;
-                }
-                else
-                    *out        = x;
-                out++;
-            }
-        }
+        dsp::dyn_curve(out, in, &sKnee, dots);
     }
 
     float Compressor::curve(float in)
@@ -185,48 +171,7 @@ namespace lsp
 
     void Compressor::reduction(float *out, const float *in, size_t dots)
     {
-        if (bUpward)
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-                if (x < FLOAT_SAT_N_INF)
-                    x       = FLOAT_SAT_N_INF;
-
-                if (x <= fKE)
-                {
-                    float lx    = logf(x);
-                    x   = (x < fKS) ?
-                            expf((fXRatio-1.0f)*(lx-fLogTH)) :
-                            expf((vHermite[0]*lx + vHermite[1] - 1.0f)*lx + vHermite[2]);
-                    *out        = x;
-                }
-                else
-                    *out        = 1.0f;
-                out++;
-            }
-        }
-        else
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-                if (x >= fKS)
-                {
-                    float lx    = logf(x);
-                    *out = (x > fKE) ?
-                        expf((fXRatio-1.0f)*(lx-fLogTH)) :
-                        expf((vHermite[0]*lx + vHermite[1] - 1.0f)*lx + vHermite[2]);
-                }
-                else
-                    *out        = 1.0f;
-                out++;
-            }
-        }
+        dsp::dyn_gain(out, in, &sKnee, dots);
     }
 
     float Compressor::reduction(float in)
@@ -312,27 +312,60 @@ namespace lsp
         return reduction(fEnvelope);
     }
 
-    void DynamicProcessor::curve(float *out, const float *in, size_t dots)
+    void DynamicProcessor::amp_gain(float *lx, size_t count)
+    {
+        size_t splines  = fCount[CT_SPLINES];
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float x     = lx[i];
+            float gain  = 0.0f;
+
+            for (size_t j=0; j<splines; ++j)
+                gain       += spline_amp(&vSplines[j], x);
+
+            lx[i]       = gain;
+        }
+
+        dsp::limit1(lx, DYN_KNEE_LOG_MIN, DYN_KNEE_LOG_MAX, count);
+    }
+
+    void DynamicProcessor::model_gain(float *lx, size_t count)
     {
         size_t splines  = fCount[CT_SPLINES];
 
-        for (size_t i=0; i<dots; ++i)
+        for (size_t i=0; i<count; ++i)
         {
-            float x     = *(in++);
-            if (x < 0.0f)
-                x       = -x;
-            if (x < FLOAT_SAT_N_INF)
-                x       = FLOAT_SAT_N_INF;
-            else if (x > FLOAT_SAT_P_INF)
-                x       = FLOAT_SAT_P_INF;
-
-            float lx    = logf(x);
+            float x     = lx[i];
             float gain  = 0.0f;
 
             for (size_t j=0; j<splines; ++j)
-                gain       += spline_amp(&vSplines[j], lx);
+                gain       += spline_model(&vSplines[j], x);
+
+            lx[i]       = gain;
+        }
+
+        dsp::limit1(lx, DYN_KNEE_LOG_MIN, DYN_KNEE_LOG_MAX, count);
+    }
 
-            *(out++)    = expf(gain) * x;
+    void DynamicProcessor::curve(float *out, const float *in, size_t dots)
+    {
+        float x[DYNAMIC_PROCESSOR_BUF_SIZE] __lsp_aligned16;
+
+        while (dots > 0)
+        {
+            size_t to_do    = (dots > DYNAMIC_PROCESSOR_BUF_SIZE) ? DYNAMIC_PROCESSOR_BUF_SIZE : dots;
+
+            dsp::abs2(x, in, to_do);
+            dsp::limit1(x, DYN_KNEE_X_MIN, FLOAT_SAT_P_INF, to_do);
+            dsp::loge2(out, x, to_do);
+            amp_gain(out, to_do);
+            dsp::exp1(out, to_do);
+            dsp::mul2(out, x, to_do);
+
+            in             += to_do;
+            out            += to_do;
+            dots           -= to_do;
         }
     }
 
@@ -358,25 +391,22 @@ namespace lsp
 
     void DynamicProcessor::model(float *out, const float *in, size_t dots)
     {
-        size_t splines  = fCount[CT_SPLINES];
+        float x[DYNAMIC_PROCESSOR_BUF_SIZE] __lsp_aligned16;
 
-        for (size_t i=0; i<dots; ++i)
+        while (dots > 0)
         {
-            float x     = *(in++);
-            if (x < 0.0f)
-                x       = -x;
-            if (x < FLOAT_SAT_N_INF)
-                x       = FLOAT_SAT_N_INF;
-            else if (x > FLOAT_SAT_P_INF)
-                x       = FLOAT_SAT_P_INF;
-
-            float lx    = logf(x);
-            float gain  = 0.0f;
-
-            for (size_t j=0; j<splines; ++j)
-                gain       += spline_model(&vSplines[j], lx);
-
-            *(out++)    = expf(gain) * x;
+            size_t to_do    = (dots > DYNAMIC_PROCESSOR_BUF_SIZE) ? DYNAMIC_PROCESSOR_BUF_SIZE : dots;
+
+            dsp::abs2(x, in, to_do);
+            dsp::limit1(x, DYN_KNEE_X_MIN, FLOAT_SAT_P_INF, to_do);
+            dsp::loge2(out, x, to_do);
+            model_gain(out, to_do);
+            dsp::exp1(out, to_do);
+            dsp::mul2(out, x, to_do);
+
+            in             += to_do;
+            out            += to_do;
+            dots           -= to_do;
         }
     }
 
@@ -402,26 +432,11 @@ namespace lsp
 
     void DynamicProcessor::reduction(float *out, const float *in, size_t dots)
     {
-        size_t splines  = fCount[CT_SPLINES];
-
-        for (size_t i=0; i<dots; ++i)
-        {
-            float x     = *(in++);
-            if (x < 0.0f)
-                x       = -x;
-            if (x < GAIN_AMP_MIN)
-                x       = GAIN_AMP_MIN;
-            else if (x > FLOAT_SAT_P_INF)
-                x       = FLOAT_SAT_P_INF;
-
-            float lx    = logf(x);
-            float gain  = 0.0f;
-
-            for (size_t j=0; j<splines; ++j)
-                gain       += spline_amp(&vSplines[j], lx);
-
-            *(out++)    = expf(gain);
-        }
+        dsp::abs2(out, in, dots);
+        dsp::limit1(out, GAIN_AMP_MIN, FLOAT_SAT_P_INF, dots);
+        dsp::loge1(out, dots);
+        amp_gain(out, dots);
+        dsp::exp1(out, dots);
     }
 
     float DynamicProcessor::reduction(float in)
@@ -33,6 +33,14 @@ namespace lsp
         fLogKS          = 0.0f;
         fLogKE          = 0.0f;
         fLogTH          = 0.0f;
+        sKnee.start     = 0.0f;
+        sKnee.end       = 0.0f;
+        for (size_t i=0; i<4; ++i)
+        {
+            sKnee.lo[i]     = 0.0f;
+            sKnee.knee[i]   = 0.0f;
+            sKnee.hi[i]     = 0.0f;
+        }
 
         // Additional parameters
         nSampleRate     = 0;
@@ -60,6 +68,25 @@ namespace lsp
         else
             interpolation::hermite_quadratic(vHermite, fLogKE, fLogKE, 1.0f, fLogKS, fRatio);
 
+        // Build gain curve for block processing
+        float *tilt     = (bUpward) ? sKnee.hi : sKnee.lo;
+        float *flat     = (bUpward) ? sKnee.lo : sKnee.hi;
+
+        sKnee.start     = fAttackThresh * fKnee;
+        sKnee.end       = fAttackThresh / fKnee;
+        tilt[0]         = 0.0f;
+        tilt[1]         = 0.0f;
+        tilt[2]         = fRatio - 1.0f;
+        tilt[3]         = (1.0f - fRatio) * fLogTH;
+        sKnee.knee[0]   = 0.0f;
+        sKnee.knee[1]   = vHermite[0];
+        sKnee.knee[2]   = vHermite[1] - 1.0f;
+        sKnee.knee[3]   = vHermite[2];
+        flat[0]         = 0.0f;
+        flat[1]         = 0.0f;
+        flat[2]         = 0.0f;
+        flat[3]         = 0.0f;
+
         // Reset update flag
         bUpdate         = false;
     }
@@ -98,50 +125,7 @@ namespace lsp
 
     void Expander::curve(float *out, const float *in, size_t dots)
     {
-        if (bUpward)
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-                if (x > FLOAT_SAT_P_INF)
-                    x       = FLOAT_SAT_P_INF;
-
-                float lx    = logf(x);
-                if (lx >= fLogKS)
-                {
-                    x   = (lx > fLogKE) ?
-                        expf(fRatio*(lx - fLogTH) + fLogTH) :
-                        expf((vHermite[0]*lx + vHermite[1])*lx + vHermite[2]);
-                    *out        = x;
-                }
-                else
-                    *out        = x;
-                out++;
-            }
-        }
-        else
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-
-                float lx    = logf(x);
-                if (lx <= fLogKE)
-                {
-                    x   = (lx < fLogKS) ?
-                        expf(fRatio*(lx - fLogTH) + fLogTH) :
-                        expf((vHermite[0]*lx + vHermite[1])*lx + vHermite[2]);
-                    *out        = x;
-                }
-                else
-                    *out        = x;
-                out++;
-            }
-        }
+        dsp::dyn_curve(out, in, &sKnee, dots);
     }
 
     float Expander::curve(float in)
@@ -174,48 +158,7 @@ namespace lsp
 
     void Expander::amplification(float *out, const float *in, size_t dots)
     {
-        if (bUpward)
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-                if (x > FLOAT_SAT_P_INF)
-                    x       = FLOAT_SAT_P_INF;
-
-                float lx    = logf(x);
-                if (lx >= fLogKS)
-                {
-                    *out    = (lx > fLogKE) ?
-                        expf((fRatio - 1.0f)*(lx - fLogTH)) :
-                        expf((vHermite[0]*lx + vHermite[1] - 1.0f)*lx + vHermite[2]);
-                }
-                else
-                    *out        = 1.0f;
-                out++;
-            }
-        }
-        else
-        {
-            for (size_t i=0; i<dots; ++i)
-            {
-                float x     = *(in++);
-                if (x < 0.0f)
-                    x       = -x;
-
-                float lx    = logf(x);
-                if (lx <= fLogKE)
-                {
-                    *out    = (lx < fLogKS) ?
-                        expf((fRatio - 1.0f)*(lx - fLogTH)) :
-                        expf((vHermite[0]*lx + vHermite[1] - 1.0f)*lx + vHermite[2]);
-                }
-                else
-                    *out        = 1.0f;
-                out++;
-            }
-        }
+        dsp::dyn_gain(out, in, &sKnee, dots);
     }
 
     float Expander::amplification(float in)
@@ -30,6 +30,16 @@ namespace lsp
             c->vHermite[1]  = 0.0f;
             c->vHermite[2]  = 0.0f;
             c->vHermite[3]  = 0.0f;
+
+            dsp::dyn_knee_t *k  = &c->sKnee;
+            k->start        = 0.0f;
+            k->end          = 0.0f;
+            for (size_t j=0; j<4; ++j)
+            {
+                k->lo[j]        = 0.0f;
+                k->knee[j]      = 0.0f;
+                k->hi[j]        = 0.0f;
+            }
         }
 
         fAttack         = 0.0f;
@@ -80,6 +90,23 @@ namespace lsp
                         c->fLogZE, c->fLogZE, 1.0f
                     );
 //            }
+
+            // Build gain curve for block processing
+            dsp::dyn_knee_t *k  = &c->sKnee;
+            k->start        = c->fZS;
+            k->end          = c->fZE;
+            k->lo[0]        = 0.0f;
+            k->lo[1]        = 0.0f;
+            k->lo[2]        = 0.0f;
+            k->lo[3]        = logf(fReduction);
+            k->knee[0]      = c->vHermite[0];
+            k->knee[1]      = c->vHermite[1];
+            k->knee[2]      = c->vHermite[2] - 1.0f;
+            k->knee[3]      = c->vHermite[3];
+            k->hi[0]        = 0.0f;
+            k->hi[1]        = 0.0f;
+            k->hi[2]        = 0.0f;
+            k->hi[3]        = 0.0f;
         }
 
         // Reset update flag
@@ -89,26 +116,7 @@ namespace lsp
     void Gate::curve(float *out, const float *in, size_t dots, bool hyst)
     {
         curve_t *c      = &sCurves[(hyst) ? 1 : 0];
-
-        for (size_t i=0; i<dots; ++i)
-        {
-            float x     = *(in++);
-            if (x < 0.0f)
-                x       = -x;
-
-            if (x > c->fZS)
-            {
-                if (x < c->fZE)
-                {
-                    float lx    = logf(x);
-                    x           = expf(((c->vHermite[0]*lx + c->vHermite[1])*lx + c->vHermite[2])*lx + c->vHermite[3]);
-                }
-                *out    = x;
-            }
-            else
-                *out    = fReduction * x;
-            out++;
-        }
+        dsp::dyn_curve(out, in, &c->sKnee, dots);
     }
 
     float Gate::curve(float in, bool hyst)
@@ -132,6 +140,8 @@ namespace lsp
 
     void Gate::process(float *out, float *env, const float *in, size_t samples)
     {
+        size_t first    = 0;
+
         // Calculate envelope of gate
         for (size_t i=0; i<samples; ++i)
         {
@@ -142,29 +152,23 @@ namespace lsp
             // Update result
             if (env != NULL)
                 env[i]          = fEnvelope;
-            out[i]          = amplification(fEnvelope);
+            out[i]          = fEnvelope;
 
             // Change state
             curve_t *c      = &sCurves[nCurve];
-            if (fEnvelope > c->fZS)
-            {
-                if (fEnvelope < c->fZE)
-                {
-                    float lx    = logf(fEnvelope);
-                    out[i]      = expf(((c->vHermite[0]*lx + c->vHermite[1])*lx + c->vHermite[2] - 1.0f)*lx + c->vHermite[3]);
-                }
-                else
-                {
-                    nCurve      = 1;
-                    out[i]      = 1.0f;
-                }
-            }
-            else
-            {
-                nCurve      = 0;
-                out[i]      = fReduction;
-            }
+            size_t curve    = (fEnvelope > c->fZS) ? ((fEnvelope < c->fZE) ? nCurve : 1) : 0;
+            if (curve == nCurve)
+                continue;
+
+            // Apply the curve to the samples processed before the state change, including current
+            dsp::dyn_gain(&out[first], &out[first], &c->sKnee, i + 1 - first);
+            first           = i + 1;
+            nCurve          = curve;
         }
+
+        // Apply the curve to the rest of samples
+        if (first < samples)
+            dsp::dyn_gain(&out[first], &out[first], &sCurves[nCurve].sKnee, samples - first);
     }
 
     float Gate::process(float *env, float s)
@@ -188,27 +192,7 @@ namespace lsp
     void Gate::amplification(float *out, const float *in, size_t dots, bool hyst)
     {
         curve_t *c      = &sCurves[(hyst) ? 1 : 0];
-
-        for (size_t i=0; i<dots; ++i)
-        {
-            float x     = *(in++);
-            if (x < 0.0f)
-                x       = -x;
-
-            if (x > c->fZS)
-            {
-                if (x < c->fZE)
-                {
-                    float lx    = logf(x);
-                    *out        = expf(((c->vHermite[0]*lx + c->vHermite[1])*lx + c->vHermite[2] - 1.0f)*lx + c->vHermite[3]);
-                }
-                else
-                    *out    = 1.0f;
-            }
-            else
-                *out    = fReduction;
-            out++;
-        }
+        dsp::dyn_gain(out, in, &c->sKnee, dots);
     }
 
     float Gate::amplification(float in)
@@ -12,6 +12,8 @@
 
 #define BUF_GRANULARITY         8192
 #define GAIN_LOWERING           0.891250938134 /* 0.944060876286 */
+#define PEAK_LEAVES             (BUF_GRANULARITY / LIMITER_PEAK_BLOCK)
+#define PEAK_TREE_DEPTH         8
 
 namespace lsp
 {
@@ -32,6 +34,8 @@ namespace lsp
         nThresh         = 0;
         vGainBuf        = NULL;
         vTmpBuf         = NULL;
+        vPeakBuf        = NULL;
+        vPeakTree       = NULL;
         vData           = NULL;
     }
 
@@ -42,7 +46,7 @@ namespace lsp
     bool Limiter::init(size_t max_sr, float max_lookahead)
     {
         nMaxLookahead       = millis_to_samples(max_sr, max_lookahead);
-        size_t alloc        = nMaxLookahead*4 + BUF_GRANULARITY*2;
+        size_t alloc        = nMaxLookahead*4 + BUF_GRANULARITY*3 + PEAK_LEAVES*2;
         vData               = new uint8_t[alloc*sizeof(float) + DEFAULT_ALIGN];
         if (vData == NULL)
             return false;
@@ -52,6 +56,10 @@ namespace lsp
         ptr                += nMaxLookahead*4 + BUF_GRANULARITY;
         vTmpBuf             = ptr;
         ptr                += BUF_GRANULARITY;
+        vPeakBuf            = ptr;
+        ptr                += BUF_GRANULARITY;
+        vPeakTree           = ptr;
+        ptr                += PEAK_LEAVES*2;
 
         lsp_assert(reinterpret_cast<uint8_t *>(ptr) <= &vData[alloc*sizeof(float) + DEFAULT_ALIGN]);
 
@@ -75,6 +83,8 @@ namespace lsp
 
         vGainBuf    = NULL;
         vTmpBuf     = NULL;
+        vPeakBuf    = NULL;
+        vPeakTree   = NULL;
     }
 
     void Limiter::reset_sat(sat_t *sat)
@@ -604,100 +614,239 @@ namespace lsp
         }
     }
 
-    void Limiter::process_patch(float *dst, float *gain, const float *src, const float *sc, size_t samples)
+    void Limiter::build_peak_tree(const float *gbuf, size_t samples)
     {
-        float *gbuf     = &vGainBuf[nMaxLookahead];
+        // Compute peak values and maximums of blocks
+        dsp::mul3(vPeakBuf, vTmpBuf, gbuf, samples);
+        float *leaves   = &vPeakTree[PEAK_LEAVES];
+        size_t blocks   = (samples + LIMITER_PEAK_BLOCK - 1) / LIMITER_PEAK_BLOCK;
 
-        while (samples > 0)
+        for (size_t i=0, off=0; i<blocks; ++i, off += LIMITER_PEAK_BLOCK)
         {
-            size_t to_do    = (samples > BUF_GRANULARITY) ? BUF_GRANULARITY : samples;
+            size_t n        = samples - off;
+            leaves[i]       = dsp::max(&vPeakBuf[off], (n > LIMITER_PEAK_BLOCK) ? LIMITER_PEAK_BLOCK : n);
+        }
+        dsp::fill_zero(&leaves[blocks], PEAK_LEAVES - blocks);
 
-            // Fill gain buffer
-            dsp::fill_one(&gbuf[nMaxLookahead*3], to_do);
-            dsp::abs2(vTmpBuf, sc, to_do);
+        // Build the rest of tree
+        for (size_t i=PEAK_LEAVES-1; i > 0; --i)
+        {
+            float l         = vPeakTree[i << 1];
+            float r         = vPeakTree[(i << 1) + 1];
+            vPeakTree[i]    = (l > r) ? l : r;
+        }
+    }
+
+    void Limiter::update_peak_tree(const float *gbuf, ssize_t first, ssize_t last, size_t samples)
+    {
+        if (first < 0)
+            first       = 0;
+        if (last > ssize_t(samples))
+            last        = samples;
+        if (first >= last)
+            return;
 
-            float thresh    = 1.0f;
+        // Update peak values and maximums of affected blocks
+        dsp::mul3(&vPeakBuf[first], &vTmpBuf[first], &gbuf[first], last - first);
 
-            // Repeat until there are no peaks
-            while (true)
+        size_t lo       = first / LIMITER_PEAK_BLOCK;
+        size_t hi       = (last - 1) / LIMITER_PEAK_BLOCK;
+        for (size_t i=lo; i <= hi; ++i)
+        {
+            size_t off      = i * LIMITER_PEAK_BLOCK;
+            size_t n        = samples - off;
+            vPeakTree[PEAK_LEAVES + i] = dsp::max(&vPeakBuf[off], (n > LIMITER_PEAK_BLOCK) ? LIMITER_PEAK_BLOCK : n);
+        }
+
+        // Propagate changes to the root
+        for (lo = (lo + PEAK_LEAVES) >> 1, hi = (hi + PEAK_LEAVES) >> 1; lo > 0; lo >>= 1, hi >>= 1)
+        {
+            for (size_t i=lo; i <= hi; ++i)
+            {
+                float l         = vPeakTree[i << 1];
+                float r         = vPeakTree[(i << 1) + 1];
+                vPeakTree[i]    = (l > r) ? l : r;
+            }
+        }
+    }
+
+    size_t Limiter::find_peaks(peak_t *peaks, size_t samples)
+    {
+        size_t n_peaks  = 0;
+        size_t stack[PEAK_TREE_DEPTH * 2];
+        size_t n_stack  = 0;
+        stack[n_stack++]= 1;
+
+        // Visit only blocks that contain samples above the threshold
+        while (n_stack > 0)
+        {
+            size_t node     = stack[--n_stack];
+            if (vPeakTree[node] <= fThreshold)
+                continue;
+            if (node < PEAK_LEAVES)
             {
-                // Find LIMITER_PEAKS_MAX peaks
-                peak_t vPeaks[LIMITER_PEAKS_MAX];
-                size_t nPeaks   = 0;
-                float left      = 0.0f;
-                float s         = vTmpBuf[0] * gbuf[0];
+                stack[n_stack++]    = (node << 1) + 1;
+                stack[n_stack++]    = node << 1;
+                continue;
+            }
+
+            size_t first    = (node - PEAK_LEAVES) * LIMITER_PEAK_BLOCK;
+            size_t last     = first + LIMITER_PEAK_BLOCK;
+            if (last > samples)
+                last            = samples;
 
-                for (size_t i=1; i<=to_do; ++i)
+            for (size_t i=first; i<last; ++i)
+            {
+                float s         = vPeakBuf[i];
+                if (s <= fThreshold)
+                    continue;
+
+                // Check that it is a peak
+                float left      = (i > 0) ? vPeakBuf[i-1] : 0.0f;
+                float right     = ((i + 1) < samples) ? vPeakBuf[i+1] : 0.0f;
+                if ((s <= left) || (s < right))
+                    continue;
+
+                // Keep LIMITER_PEAKS_MAX highest peaks in the min-heap
+                size_t j;
+                if (n_peaks < LIMITER_PEAKS_MAX)
                 {
-                    float right     = (i < to_do) ? vTmpBuf[i] * gbuf[i] : 0.0f;
-                    if (s > fThreshold)
+                    // Sift up
+                    for (j = n_peaks++; j > 0; )
                     {
-                        // Check that it is a peak
-                        if ((s > left) && (s >= right))
-                        {
-                            peak_t *p = &vPeaks[0];
-
-                            if (nPeaks >= LIMITER_PEAKS_MAX)
-                            {
-                                for (size_t j=0; j<LIMITER_PEAKS_MAX; ++j)
-                                {
-                                    if (vPeaks[j].fValue < s)
-                                        p = & vPeaks[j];
-                                }
-                            }
-                            else
-                                p = & vPeaks[nPeaks++];
-
-                            p->nTime        = i-1;
-                            p->fValue       = s;
-                        }
+                        size_t p        = (j - 1) >> 1;
+                        if (peaks[p].fValue <= s)
+                            break;
+                        peaks[j]        = peaks[p];
+                        j               = p;
                     }
-                    left        = s;
-                    s           = right;
                 }
-
-                // Check that there are no peaks left
-                if (nPeaks <= 0)
-                    break;
-
-                // Apply modifications to the buffer
-                for (size_t i=0; i<nPeaks; ++i)
+                else if (s > peaks[0].fValue)
                 {
-                    peak_t *p       = &vPeaks[i];
-
-                    s               = vTmpBuf[p->nTime] * gbuf[p->nTime];
-                    if (s > fThreshold)
+                    // Sift down
+                    for (j = 0; ; )
                     {
-                        left            = (s - (fKnee * fThreshold * thresh - 0.000001))/ s;
-                        switch (nMode)
-                        {
-                            case LM_HERM_THIN:
-                            case LM_HERM_WIDE:
-                            case LM_HERM_TAIL:
-                            case LM_HERM_DUCK:
-                                apply_sat_patch(&sSat, &gbuf[p->nTime - sSat.nMiddle], left);
-                                break;
-
-                            case LM_EXP_THIN:
-                            case LM_EXP_WIDE:
-                            case LM_EXP_TAIL:
-                            case LM_EXP_DUCK:
-                                apply_exp_patch(&sExp, &gbuf[p->nTime - sExp.nMiddle], left);
-                                break;
-
-                            case LM_LINE_THIN:
-                            case LM_LINE_WIDE:
-                            case LM_LINE_TAIL:
-                            case LM_LINE_DUCK:
-                                apply_line_patch(&sLine, &gbuf[p->nTime - sLine.nMiddle], left);
-                                break;
-                        }
+                        size_t c        = (j << 1) + 1;
+                        if (c >= n_peaks)
+                            break;
+                        if (((c + 1) < n_peaks) && (peaks[c+1].fValue < peaks[c].fValue))
+                            ++c;
+                        if (s <= peaks[c].fValue)
+                            break;
+                        peaks[j]        = peaks[c];
+                        j               = c;
                     }
                 }
+                else
+                    continue;
 
-                // Lower gain each time at -0.5 dB
-                thresh     *=       GAIN_LOWERING;
+                peaks[j].nTime  = i;
+                peaks[j].fValue = s;
             }
+        }
+
+        return n_peaks;
+    }
+
+    void Limiter::apply_patch(float *gbuf, ssize_t time, float amp, size_t samples)
+    {
+        ssize_t first, last;
+
+        switch (nMode)
+        {
+            case LM_HERM_THIN:
+            case LM_HERM_WIDE:
+            case LM_HERM_TAIL:
+            case LM_HERM_DUCK:
+                first       = time - sSat.nMiddle;
+                last        = first + sSat.nRelease;
+                apply_sat_patch(&sSat, &gbuf[first], amp);
+                break;
+
+            case LM_EXP_THIN:
+            case LM_EXP_WIDE:
+            case LM_EXP_TAIL:
+            case LM_EXP_DUCK:
+                first       = time - sExp.nMiddle;
+                last        = first + sExp.nRelease;
+                apply_exp_patch(&sExp, &gbuf[first], amp);
+                break;
+
+            case LM_LINE_THIN:
+            case LM_LINE_WIDE:
+            case LM_LINE_TAIL:
+            case LM_LINE_DUCK:
+                first       = time - sLine.nMiddle;
+                last        = first + sLine.nRelease;
+                apply_line_patch(&sLine, &gbuf[first], amp);
+                break;
+
+            case LM_MIXED_HERM:
+                first       = time - sMixed.sSat.nMiddle;
+                last        = first + sMixed.sSat.nRelease;
+                apply_sat_patch(&sMixed.sSat, &gbuf[first], amp);
+                break;
+
+            case LM_MIXED_EXP:
+                first       = time - sMixed.sExp.nMiddle;
+                last        = first + sMixed.sExp.nRelease;
+                apply_exp_patch(&sMixed.sExp, &gbuf[first], amp);
+                break;
+
+            case LM_MIXED_LINE:
+                first       = time - sMixed.sLine.nMiddle;
+                last        = first + sMixed.sLine.nRelease;
+                apply_line_patch(&sMixed.sLine, &gbuf[first], amp);
+                break;
+
+            default:
+                return;
+        }
+
+        // Update only affected part of the peak tree
+        update_peak_tree(gbuf, first, last, samples);
+    }
+
+    void Limiter::limit_peaks(float *gbuf, size_t samples, float knee)
+    {
+        peak_t vPeaks[LIMITER_PEAKS_MAX];
+        float thresh    = 1.0f;
+
+        build_peak_tree(gbuf, samples);
+
+        // Repeat until there are no samples above the threshold
+        while (vPeakTree[1] > fThreshold)
+        {
+            size_t nPeaks   = find_peaks(vPeaks, samples);
+
+            // Apply modifications to the buffer
+            for (size_t i=0; i<nPeaks; ++i)
+            {
+                peak_t *p       = &vPeaks[i];
+                float s         = vPeakBuf[p->nTime];
+                if (s > fThreshold)
+                    apply_patch(gbuf, p->nTime, (s - (knee * fThreshold * thresh - 0.000001))/ s, samples);
+            }
+
+            // Lower gain each time at -0.5 dB
+            thresh     *=       GAIN_LOWERING;
+        }
+    }
+
+    void Limiter::process_patch(float *dst, float *gain, const float *src, const float *sc, size_t samples)
+    {
+        float *gbuf     = &vGainBuf[nMaxLookahead];
+
+        while (samples > 0)
+        {
+            size_t to_do    = (samples > BUF_GRANULARITY) ? BUF_GRANULARITY : samples;
+
+            // Fill gain buffer
+            dsp::fill_one(&gbuf[nMaxLookahead*3], to_do);
+            dsp::abs2(vTmpBuf, sc, to_do);
+
+            // Patch the gain curve until there are no peaks
+            limit_peaks(gbuf, to_do, fKnee);
 
             // Copy gain value and shift gain buffer
             dsp::copy(gain, &vGainBuf[nMaxLookahead - nLookahead], to_do);
@@ -759,79 +908,8 @@ namespace lsp
                 gbuf[i]            *= reduction(comp);
             }
 
-            float thresh = 1.0f;
-
-            // Repeat until there are no peaks
-            while (true)
-            {
-                // Find LIMITER_PEAKS_MAX peaks
-                peak_t vPeaks[LIMITER_PEAKS_MAX];
-                size_t nPeaks   = 0;
-                float left      = 0.0f;
-                float s         = vTmpBuf[0] * gbuf[0];
-
-                for (size_t i=1; i<=to_do; ++i)
-                {
-                    float right     = (i < to_do) ? vTmpBuf[i] * gbuf[i] : 0.0f;
-                    if (s > fThreshold)
-                    {
-                        // Check that it is a peak
-                        if ((s > left) && (s >= right))
-                        {
-                            peak_t *p = &vPeaks[0];
-
-                            if (nPeaks >= LIMITER_PEAKS_MAX)
-                            {
-                                for (size_t j=0; j<LIMITER_PEAKS_MAX; ++j)
-                                {
-                                    if (vPeaks[j].fValue < s)
-                                        p = & vPeaks[j];
-                                }
-                            }
-                            else
-                                p = & vPeaks[nPeaks++];
-
-                            p->nTime        = i-1;
-                            p->fValue       = s;
-                        }
-                    }
-                    left        = s;
-                    s           = right;
-                }
-
-                // Check that there are no peaks left
-                if (nPeaks <= 0)
-                    break;
-
-                // Apply modifications to the buffer
-                for (size_t i=0; i<nPeaks; ++i)
-                {
-                    peak_t *p       = &vPeaks[i];
-
-                    s               = vTmpBuf[p->nTime] * gbuf[p->nTime];
-                    if (s > fThreshold)
-                    {
-                        left            = (s - (fThreshold * thresh - 0.000001)) / s;
-                        switch (nMode)
-                        {
-                            case LM_MIXED_HERM:
-                                apply_sat_patch(&sMixed.sSat, &gbuf[p->nTime - sMixed.sSat.nMiddle], left);
-                                break;
-
-                            case LM_MIXED_EXP:
-                                apply_exp_patch(&sMixed.sExp, &gbuf[p->nTime - sMixed.sExp.nMiddle], left);
-                                break;
-
-                            case LM_MIXED_LINE:
-                                apply_line_patch(&sMixed.sLine, &gbuf[p->nTime - sMixed.sLine.nMiddle], left);
-                                break;
-                        }
-                    }
-                }
-
-                // Lower gain each time at -0.5 dB
-                thresh     *=       GAIN_LOWERING;
-            }
+            // Patch the gain curve until there are no peaks
+            limit_peaks(gbuf, to_do, 1.0f);
 
             // Copy gain value and shift gain buffer
             dsp::copy(gain, &vGainBuf[nMaxLookahead - nLookahead], to_do);
@@ -5,6 +5,7 @@
  *      Author: sadko
  */
 
+#include <dsp/dsp.h>
 #include <core/envelope.h>
 #include <math.h>
 
@@ -58,13 +59,13 @@ namespace lsp
             dst[0]      = 1.0f;
             float kd    = (SPEC_FREQ_MAX / SPEC_FREQ_MIN) / n;
             for (size_t i=1; i < n; ++i)
-                dst[i]      = expf(k * logf(i * kd));
+                dst[i]      = i * kd;
+            dsp::powvc1(&dst[1], k, n - 1);
         }
 
         void white_noise(float *dst, size_t n)
         {
-            while (n--)
-                *(dst++)        = 1.0f;
+            dsp::fill_one(dst, n);
         }
 
         void pink_noise(float *dst, size_t n)
@@ -12,12 +12,14 @@
 #include <core/files/LSPCFile.h>
 #include <core/files/AudioFile.h>
 #include <core/files/lspc/LSPCAudioReader.h>
+#include <core/ipc/Thread.h>
 #include <core/alloc.h>
 
 #include <sndfile.h>
 
 #define TMP_BUFFER_SIZE         1024
 #define RESAMPLING_PERIODS      8
+#define RESAMPLING_CHUNK_SIZE   0x10000
 
 namespace lsp
 {
@@ -658,357 +660,284 @@ namespace lsp
         return (pData != NULL) ? pData->nSampleRate : 0;
     }
 
+    static inline double lanczos_kernel(double t)
+    {
+        if ((t <= -RESAMPLING_PERIODS) || (t >= RESAMPLING_PERIODS))
+            return 0.0;
+        else if (t == 0.0)
+            return 1.0;
+
+        double t2           = M_PI * t;
+        return RESAMPLING_PERIODS * sin(t2) * sin(t2 / RESAMPLING_PERIODS) / (t2 * t2);
+    }
+
     status_t AudioFile::resample(size_t new_sample_rate)
     {
+        if (pData == NULL)
+            return STATUS_NO_DATA;
+        if (new_sample_rate <= 0)
+            return STATUS_BAD_ARGUMENTS;
+
         // Check that resampling is actually needed
-        if (new_sample_rate > pData->nSampleRate)
-        {
-            // Need to up-sample data
-            if ((new_sample_rate % pData->nSampleRate) == 0)
-                return fast_upsample(new_sample_rate);
-            else
-                return complex_upsample(new_sample_rate);
+        if (new_sample_rate == pData->nSampleRate)
+            return STATUS_OK;
+
+        // Calculate parameters of transformation: source sample i
+        // corresponds to the output position i * nPhases / nStep
+        resampler_t r;
+        size_t gcd          = gcd_euclid(new_sample_rate, pData->nSampleRate);
+        r.nPhases           = new_sample_rate / gcd;
+        r.nStep             = pData->nSampleRate / gcd;
+        r.bScatter          = r.nPhases > r.nStep;
+
+        // Build polyphase Lanczos kernel table. Up-sampling scatters each source sample
+        // to the output with the kernel selected by the phase of the source sample,
+        // down-sampling gathers each output sample from the source with the kernel
+        // stretched to cut off the frequencies above the new Nyquist frequency.
+        size_t rows;
+        if (r.bScatter)
+        {
+            rows                = r.nStep;
+            r.nHalf             = (RESAMPLING_PERIODS * r.nPhases + r.nStep - 1) / r.nStep;
         }
-        else if (new_sample_rate < pData->nSampleRate)
+        else
         {
-            // Need to down-sample data
-            if ((pData->nSampleRate % new_sample_rate) == 0)
-                return fast_downsample(new_sample_rate);
-            else
-                return complex_downsample(new_sample_rate);
+            rows                = r.nPhases;
+            r.nHalf             = (RESAMPLING_PERIODS * r.nStep + r.nPhases - 1) / r.nPhases;
         }
+        r.nTaps             = ALIGN_SIZE(r.nHalf << 1, 4);
 
-        // Return OK status
-        return STATUS_OK;
-    }
+        float *k            = lsp_tmalloc(float, rows * r.nTaps);
+        if (k == NULL)
+            return STATUS_NO_MEM;
 
-    status_t AudioFile::fast_downsample(size_t new_sample_rate)
-    {
-        size_t rkf          = pData->nSampleRate / new_sample_rate;
-        size_t new_samples  = pData->nSamples / rkf;
+        double cutoff       = double(r.nPhases) / double(r.nStep);
+        for (size_t i=0; i<rows; ++i)
+        {
+            float *kp           = &k[i * r.nTaps];
+            for (size_t j=0; j<r.nTaps; ++j)
+            {
+                ssize_t d           = ssize_t(j) - ssize_t(r.nHalf) + 1;
+                kp[j]               = (r.bScatter) ?
+                        lanczos_kernel(double(d * ssize_t(r.nStep) - ssize_t(i)) / double(r.nPhases)) :
+                        cutoff * lanczos_kernel((double(i) / double(r.nPhases) - d) * cutoff);
+            }
+        }
 
         // Prepare new data structure to store resampled data
+        size_t new_samples  = (pData->nSamples * r.nPhases) / r.nStep;
         file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
         if (fc == NULL)
-            return STATUS_NO_MEM;
-        fc->nSampleRate     = new_sample_rate;
-
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
         {
-            const float *src    = pData->vChannels[c];
-            float *dst          = fc->vChannels[c];
-
-            for (size_t i=0, p=0; i < pData->nSamples; i += rkf, p++)
-                dst[p]              = src[i];
+            lsp_free(k);
+            return STATUS_NO_MEM;
         }
+        fc->nSampleRate     = new_sample_rate;
+        new_samples         = fc->nSamples;
 
-        // Destroy old data content
-        destroy_file_content(pData);
+        r.vKernel           = k;
+        r.pSrc              = pData;
+        r.pDst              = fc;
 
-        // Store new file content
-        pData       = fc;
+        // Estimate number of threads, short files are processed in the current thread
+        size_t n_threads    = ipc::Thread::system_cores();
+        if (n_threads > (new_samples / RESAMPLING_CHUNK_SIZE))
+            n_threads           = new_samples / RESAMPLING_CHUNK_SIZE;
+        if (n_threads <= 0)
+            n_threads           = 1;
 
-        return STATUS_OK;
-    }
+        lsp_trace("Resampling %d -> %d: phases=%d, step=%d, taps=%d, scatter=%s, threads=%d",
+                int(pData->nSampleRate), int(new_sample_rate), int(r.nPhases), int(r.nStep),
+                int(r.nTaps), (r.bScatter) ? "true" : "false", int(n_threads));
 
-    status_t AudioFile::fast_upsample(size_t new_sample_rate)
-    {
-        // Calculate parameters of transformation
-        ssize_t kf          = new_sample_rate / pData->nSampleRate;
-        float rkf           = 1.0f / kf;
-
-        // Prepare kernel for resampling
-        ssize_t k_periods   = RESAMPLING_PERIODS; // * (kf >> 1);
-        ssize_t k_base      = k_periods * kf;
-        ssize_t k_center    = k_base + 1;
-        ssize_t k_len       = (k_center << 1) + 1;
-        ssize_t k_size      = ALIGN_SIZE(k_len + 1, 4); // Additional sample for time offset
-        float *k            = lsp_tmalloc(float, k_size);
-        if (k == NULL)
-            return STATUS_NO_MEM;
-
-        // Prepare temporary buffer for resampling
-        size_t new_samples  = kf * pData->nSamples;
-        size_t b_len        = new_samples + k_size;
-        size_t b_size       = ALIGN_SIZE(b_len, 4);
-        float *b            = lsp_tmalloc(float, b_size);
-        if (b == NULL)
+        resampler_t *workers    = new resampler_t[n_threads];
+        if (workers == NULL)
         {
+            destroy_file_content(fc);
             lsp_free(k);
             return STATUS_NO_MEM;
         }
 
-        // Prepare new data structure to store resampled data
-        file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
-        if (fc == NULL)
+        // Split output into contiguous ranges, each thread writes only its own range
+        for (size_t i=0; i<n_threads; ++i)
         {
-            lsp_free(b);
-            lsp_free(k);
-            return STATUS_NO_MEM;
+            resampler_t *w      = &workers[i];
+            *w                  = r;
+            w->nFirst           = (new_samples * i) / n_threads;
+            w->nCount           = (new_samples * (i + 1)) / n_threads - w->nFirst;
         }
-        fc->nSampleRate     = new_sample_rate;
 
-        // Generate Lanczos kernel
-        for (ssize_t j=0; j<k_size; ++j)
-        {
-            float t         = (j - k_center) * rkf;
+        // Launch additional threads, the first range is processed by the current thread
+        status_t res        = STATUS_OK;
+        ipc::Thread **threads = (n_threads > 1) ? new ipc::Thread *[n_threads - 1] : NULL;
+        size_t n_launched   = 0;
+        if ((n_threads > 1) && (threads == NULL))
+            res                 = STATUS_NO_MEM;
 
-            if ((t > -k_periods) && (t < k_periods))
+        for (size_t i=1; (res == STATUS_OK) && (i<n_threads); ++i)
+        {
+            ipc::Thread *t      = new ipc::Thread(resample_worker, &workers[i]);
+            if (t == NULL)
             {
-                if (t != 0)
-                {
-                    float t2    = M_PI * t;
-                    k[j]        = k_periods * sinf(t2) * sinf(t2 / k_periods) / (t2 * t2);
-                }
-                else
-                    k[j]        = 1.0f;
+                res                 = STATUS_NO_MEM;
+                break;
             }
-            else
-                k[j]        = 0.0f;
+            threads[n_launched++] = t;
+            res                 = t->start();
         }
 
-        // Output dump
-//        printf("----------------------\n");
-//        printf("j;t;k(j);\n");
-//        for (ssize_t j=0; j<k_len; ++j)
-//        {
-//            float t         = (j - k_center) * rkf;
-//            printf("%d;%f;%f;\n", int(j), t, k[j]);
-//        }
-//        printf("----------------------\n");
-
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
-        {
-            const float *src    = pData->vChannels[c];
-            dsp::fill_zero(b, b_size);  // Clear the temporary buffer
-
-            // Perform convolutions
-            for (size_t i=0, p=0; i<pData->nSamples; i++, p += kf)
-                dsp::scale_add3(&b[p], k, src[i], k_size);
+        if (res == STATUS_OK)
+            resample_range(&workers[0]);
 
-            // Copy the data to the file content
-            dsp::copy(fc->vChannels[c], &b[k_center], fc->nSamples);
+        // Wait for threads
+        for (size_t i=0; i<n_launched; ++i)
+        {
+            ipc::Thread *t      = threads[i];
+            t->join();
+            if ((res == STATUS_OK) && (t->get_result() != STATUS_OK))
+                res                 = t->get_result();
+            delete t;
         }
+        if (threads != NULL)
+            delete [] threads;
 
-        // Delete  temporary buffers
-        destroy_file_content(pData);
-        lsp_free(b);
+        // Delete temporary buffers
+        delete [] workers;
         lsp_free(k);
 
+        if (res != STATUS_OK)
+        {
+            destroy_file_content(fc);
+            return res;
+        }
+
         // Store new file content
+        destroy_file_content(pData);
         pData       = fc;
 
         return STATUS_OK;
     }
 
-    status_t AudioFile::complex_upsample(size_t new_sample_rate)
+    status_t AudioFile::resample_worker(void *arg)
     {
-        // Calculate parameters of transformation
-        ssize_t gcd         = gcd_euclid(new_sample_rate, pData->nSampleRate);
-        ssize_t src_step    = pData->nSampleRate / gcd;
-        ssize_t dst_step    = new_sample_rate / gcd;
-        float kf            = float(dst_step) / float(src_step);
-        float rkf           = float(src_step) / float(dst_step);
-
-        // Prepare kernel for resampling
-        ssize_t k_periods   = RESAMPLING_PERIODS; // Number of periods
-        ssize_t k_base      = k_periods * kf;
-        ssize_t k_center    = k_base + 1;
-        ssize_t k_len       = (k_center << 1) + 1; // Centered impulse response
-        ssize_t k_size      = ALIGN_SIZE(k_len + 1, 4); // Additional sample for time offset
-        float *k            = lsp_tmalloc(float, k_size);
-        if (k == NULL)
-            return STATUS_NO_MEM;
+        resampler_t *r      = reinterpret_cast<resampler_t *>(arg);
 
-        // Prepare temporary buffer for resampling
-        size_t new_samples  = kf * pData->nSamples;
-        size_t b_len        = new_samples + k_size;
-        size_t b_size       = ALIGN_SIZE(b_len, 4);
-        float *b            = lsp_tmalloc(float, b_size);
-        if (b == NULL)
-        {
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
+        // Enable DSP context for the worker thread
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+        resample_range(r);
+        dsp::finish(&ctx);
 
-        // Prepare new data structure to store resampled data
-        file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
-        if (fc == NULL)
-        {
-            lsp_free(b);
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
-        fc->nSampleRate     = new_sample_rate;
+        return STATUS_OK;
+    }
 
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
+    void AudioFile::resample_range(const resampler_t *r)
+    {
+        if (r->bScatter)
+            scatter_range(r);
+        else
+            gather_range(r);
+    }
+
+    void AudioFile::scatter_range(const resampler_t *r)
+    {
+        size_t src_len      = r->pSrc->nSamples;
+        ssize_t first       = r->nFirst;
+        ssize_t last        = r->nFirst + r->nCount;
+        size_t s_step       = r->nPhases / r->nStep;
+        size_t p_step       = r->nPhases % r->nStep;
+
+        // Find the first source sample which contributes to the output range
+        size_t start        = (r->nFirst > r->nTaps) ? ((r->nFirst - r->nTaps) * r->nStep) / r->nPhases : 0;
+
+        for (size_t c=0; c<r->pSrc->nChannels; ++c)
         {
-            const float *src    = pData->vChannels[c];
-            dsp::fill_zero(b, b_size);  // Clear the temporary buffer
+            const float *src    = r->pSrc->vChannels[c];
+            float *dst          = r->pDst->vChannels[c];
 
-            for (ssize_t i=0; i<src_step; ++i)
-            {
-                // calculate the offset between nearest samples
-                ssize_t p       = kf * i;
-                float dt        = i*kf - p;
+            // Output position of the source sample: i * nPhases = s * nStep + p
+            size_t pos          = start * r->nPhases;
+            size_t s            = pos / r->nStep;
+            size_t p            = pos % r->nStep;
 
-                // Generate Lanczos kernel
-                for (ssize_t j=0; j<k_size; ++j)
+            for (size_t i=start; i<src_len; ++i)
+            {
+                // The kernel covers output samples [s - nHalf + 1, s - nHalf + nTaps]
+                ssize_t head        = ssize_t(s) - ssize_t(r->nHalf) + 1;
+                ssize_t tail        = head + r->nTaps;
+                if (head >= last)
+                    break;
+
+                if ((head >= first) && (tail <= last))
+                    dsp::scale_add3(&dst[head], &r->vKernel[p * r->nTaps], src[i], r->nTaps);
+                else
                 {
-                    float t         = (j - k_center - dt) * rkf;
-
-                    if ((t > -k_periods) && (t < k_periods))
-                    {
-                        if (t != 0.0f)
-                        {
-                            float t2    = M_PI * t;
-                            k[j]        = k_periods * sinf(t2) * sinf(t2 / k_periods) / (t2 * t2);
-                        }
-                        else
-                            k[j]        = 1.0f;
-                    }
-                    else
-                        k[j]        = 0.0f;
+                    // Clip the kernel by the boundaries of the output range
+                    ssize_t lo          = (head > first) ? head : first;
+                    ssize_t hi          = (tail < last) ? tail : last;
+                    if (lo < hi)
+                        dsp::scale_add3(&dst[lo], &r->vKernel[p * r->nTaps + lo - head], src[i], hi - lo);
                 }
 
-                // Output dump
-//                printf("----------------------\n");
-//                printf("j;t;k(j);\n");
-//                for (ssize_t j=0; j<k_len; ++j)
-//                {
-//                    float t         = (j - k_center - dt) * kt;
-//                    printf("%d;%f;%f;\n", int(j), t, k[j]);
-//                }
-//                printf("----------------------\n");
-
-                // Perform convolutions
-                for (size_t j=i; j<pData->nSamples; j += src_step)
+                // Move to the next source sample
+                s                  += s_step;
+                p                  += p_step;
+                if (p >= r->nStep)
                 {
-                    dsp::scale_add3(&b[p], k, src[j], k_size);
-                    p   += dst_step;
+                    p                  -= r->nStep;
+                    ++s;
                 }
             }
-
-            // Copy the data to the file content
-            dsp::copy(fc->vChannels[c], &b[k_center], fc->nSamples);
         }
-
-        // Delete  temporary buffers
-        destroy_file_content(pData);
-        lsp_free(b);
-        lsp_free(k);
-
-        // Store new file content
-        pData       = fc;
-
-        return STATUS_OK;
     }
 
-    status_t AudioFile::complex_downsample(size_t new_sample_rate)
+    void AudioFile::gather_range(const resampler_t *r)
     {
-        // Calculate parameters of transformation
-        ssize_t gcd         = gcd_euclid(new_sample_rate, pData->nSampleRate);
-        ssize_t src_step    = pData->nSampleRate / gcd;
-        ssize_t dst_step    = new_sample_rate / gcd;
-        float kf            = float(dst_step) / float(src_step);
-        float rkf           = float(src_step) / float(dst_step);
-
-        // Prepare kernel for resampling
-        ssize_t k_base      = RESAMPLING_PERIODS;
-        ssize_t k_periods   = k_base * rkf; // Number of periods
-        ssize_t k_center    = k_base + 1;
-        ssize_t k_len       = (k_center << 1) + rkf + 1; // Centered impulse response
-        ssize_t k_size      = ALIGN_SIZE(k_len + 1, 4); // Additional sample for time offset
-        float *k            = lsp_tmalloc(float, k_size);
-        if (k == NULL)
-            return STATUS_NO_MEM;
+        size_t src_len      = r->pSrc->nSamples;
+        size_t q_step       = r->nStep / r->nPhases;
+        size_t p_step       = r->nStep % r->nPhases;
 
-        // Prepare temporary buffer for resampling
-        size_t new_samples  = kf * pData->nSamples;
-        size_t b_len        = new_samples + k_size;
-        size_t b_size       = ALIGN_SIZE(b_len, 4);
-        float *b            = lsp_tmalloc(float, b_size);
-        if (b == NULL)
+        for (size_t c=0; c<r->pSrc->nChannels; ++c)
         {
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
-
-        // Prepare new data structure to store resampled data
-        file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
-        if (fc == NULL)
-        {
-            lsp_free(b);
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
-        fc->nSampleRate     = new_sample_rate;
+            const float *src    = r->pSrc->vChannels[c];
+            float *dst          = r->pDst->vChannels[c];
 
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
-        {
-            const float *src    = pData->vChannels[c];
-            dsp::fill_zero(b, b_size);  // Clear the temporary buffer
+            // Source position of the output sample: n * nStep = q * nPhases + p
+            size_t pos          = r->nFirst * r->nStep;
+            size_t q            = pos / r->nPhases;
+            size_t p            = pos % r->nPhases;
 
-            for (ssize_t i=0; i<src_step; ++i)
+            for (size_t i=r->nFirst, end=r->nFirst + r->nCount; i<end; ++i)
             {
-                // calculate the offset between nearest samples
-                ssize_t p       = kf * i;
-                float dt        = i*kf - p; // Always positive, in range of [0..1]
+                // The kernel covers source samples [q - nHalf + 1, q - nHalf + nTaps]
+                const float *kp     = &r->vKernel[p * r->nTaps];
+                ssize_t head        = ssize_t(q) - ssize_t(r->nHalf) + 1;
 
-                // Generate Lanczos kernel
-                for (ssize_t j=0; j<k_size; ++j)
+                if ((head >= 0) && ((head + r->nTaps) <= src_len))
+                    dst[i]              = dsp::scalar_mul(&src[head], kp, r->nTaps);
+                else
                 {
-                    float t         = (j - k_center - dt) * rkf;
-
-                    if ((t > -k_periods) && (t < k_periods))
+                    // Clip the kernel by the boundaries of the source data
+                    float s             = 0.0f;
+                    for (size_t j=0; j<r->nTaps; ++j)
                     {
-                        if (t != 0.0f)
-                        {
-                            float t2    = M_PI * t;
-                            k[j]        = k_periods * sinf(t2) * sinf(t2 / k_periods) / (t2 * t2);
-                        }
-                        else
-                            k[j]        = 1.0f;
+                        ssize_t idx         = head + j;
+                        if ((idx >= 0) && (size_t(idx) < src_len))
+                            s                  += src[idx] * kp[j];
                     }
-                    else
-                        k[j]        = 0.0f;
+                    dst[i]              = s;
                 }
 
-                // Output dump
-//                printf("----------------------\n");
-//                printf("j;t;k(j);\n");
-//                for (ssize_t j=0; j<k_size; ++j)
-//                {
-//                    float t         = (j - k_center - dt) * kt;
-//                    printf("%d;%f;%f;\n", int(j), t, k[j]);
-//                }
-//                printf("----------------------\n");
-
-                // Perform convolutions
-                for (size_t j=i; j<pData->nSamples; j += src_step)
+                // Move to the next output sample
+                q                  += q_step;
+                p                  += p_step;
+                if (p >= r->nPhases)
                 {
-                    dsp::scale_add3(&b[p], k, src[j], k_size);
-                    p   += dst_step;
+                    p                  -= r->nPhases;
+                    ++q;
                 }
             }
-
-            // Copy the data to the file content
-            dsp::copy(fc->vChannels[c], &b[k_center], fc->nSamples);
         }
-
-        // Delete  temporary buffers
-        destroy_file_content(pData);
-        lsp_free(b);
-        lsp_free(k);
-
-        // Store new file content
-        pData       = fc;
-
-        return STATUS_OK;
     }
 
     float *AudioFile::channel(size_t track)
@@ -0,0 +1,401 @@
+/*
+ * AudioStream.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <dsp/endian.h>
+#include <core/debug.h>
+#include <core/alloc.h>
+#include <core/files/AudioStream.h>
+
+#include <stdio.h>
+#include <sndfile.h>
+
+#define STREAM_FRAMES           1024
+
+namespace lsp
+{
+    static status_t decode_sf_error(SNDFILE *fd)
+    {
+        switch (sf_error(fd))
+        {
+            case SF_ERR_NO_ERROR:
+                return STATUS_OK;
+            case SF_ERR_UNRECOGNISED_FORMAT:
+                return STATUS_BAD_FORMAT;
+            case SF_ERR_MALFORMED_FILE:
+                return STATUS_CORRUPTED_FILE;
+            case SF_ERR_UNSUPPORTED_ENCODING:
+                return STATUS_BAD_FORMAT;
+            default:
+                return STATUS_UNKNOWN_ERR;
+        }
+    }
+
+    static void close_lspc(LSPCFile *fd, LSPCAudioReader *ar)
+    {
+        if (ar != NULL)
+        {
+            ar->close();
+            delete ar;
+        }
+        if (fd != NULL)
+        {
+            fd->close();
+            delete fd;
+        }
+    }
+
+    AudioStream::AudioStream()
+    {
+        nChannels       = 0;
+        nSamples        = 0;
+        nSampleRate     = 0;
+        nHead           = 0;
+
+        vHead           = NULL;
+        vFrames         = NULL;
+        pData           = NULL;
+
+        hSndFile        = NULL;
+        pFile           = NULL;
+        pReader         = NULL;
+        nChunkId        = 0;
+        nSkip           = 0;
+        nPosition       = 0;
+
+        nReferences     = 0;
+    }
+
+    AudioStream::~AudioStream()
+    {
+        close();
+    }
+
+    status_t AudioStream::open_lspc(const char *path)
+    {
+        LSPCFile *fd        = new LSPCFile();
+        if (fd == NULL)
+            return STATUS_NO_MEM;
+
+        status_t res        = fd->open(path);
+        if (res != STATUS_OK)
+        {
+            close_lspc(fd, NULL);
+            return res;
+        }
+
+        // Read profile (if present)
+        uint32_t chunk_id   = 0;
+        size_t skip         = 0;
+        LSPCChunkReader *prof = fd->find_chunk(LSPC_CHUNK_PROFILE);
+        if (prof != NULL)
+        {
+            lspc_chunk_audio_profile_t p;
+            ssize_t n = prof->read_header(&p, sizeof(lspc_chunk_audio_profile_t));
+            if (n < 0)
+                res     = status_t(-n);
+            else if ((p.common.version < 1) || (p.common.size < sizeof(lspc_chunk_audio_profile_t)))
+                res     = STATUS_CORRUPTED_FILE;
+            else if (p.common.version < 2)
+                res     = STATUS_UNSUPPORTED_FORMAT; // Legacy offset semantics are supported by AudioFile only
+            else
+            {
+                chunk_id    = BE_TO_CPU(p.chunk_id);
+                skip        = BE_TO_CPU(p.skip);
+                if (chunk_id == 0)
+                    res         = STATUS_CORRUPTED_FILE;
+            }
+
+            status_t res2 = prof->close();
+            if (res == STATUS_OK)
+                res = res2;
+            delete prof;
+
+            if (res != STATUS_OK)
+            {
+                close_lspc(fd, NULL);
+                return res;
+            }
+        }
+
+        // Open audio chunk
+        LSPCAudioReader *ar = new LSPCAudioReader();
+        if (ar == NULL)
+        {
+            close_lspc(fd, NULL);
+            return STATUS_NO_MEM;
+        }
+
+        res = (chunk_id > 0) ? ar->open(fd, chunk_id) : ar->open(fd);
+        if (res != STATUS_OK)
+        {
+            close_lspc(fd, ar);
+            return STATUS_BAD_FORMAT;
+        }
+
+        lspc_audio_parameters_t aparams;
+        res = ar->get_parameters(&aparams);
+        if (res != STATUS_OK)
+        {
+            close_lspc(fd, ar);
+            return res;
+        }
+
+        // Skip frames at the beginning of the chunk
+        skip                = (skip > aparams.frames) ? aparams.frames : skip;
+        if (skip > 0)
+        {
+            ssize_t skipped = ar->skip_frames(skip);
+            if (skipped != ssize_t(skip))
+            {
+                close_lspc(fd, ar);
+                return (skipped >= 0) ? STATUS_CORRUPTED_FILE : -skipped;
+            }
+        }
+
+        lsp_trace("streaming LSPC file: frames=%d, channels=%d, sample_rate=%d, skip=%d",
+                int(aparams.frames), int(aparams.channels), int(aparams.sample_rate), int(skip));
+
+        pFile               = fd;
+        pReader             = ar;
+        nChunkId            = ar->unique_id();
+        nSkip               = skip;
+        nChannels           = aparams.channels;
+        nSamples            = aparams.frames - skip;
+        nSampleRate         = aparams.sample_rate;
+        nPosition           = 0;
+
+        return STATUS_OK;
+    }
+
+    status_t AudioStream::open_sndfile(const char *path)
+    {
+        SNDFILE *sf_obj;
+        SF_INFO sf_info;
+
+        if ((sf_obj = sf_open(path, SFM_READ, &sf_info)) == NULL)
+            return decode_sf_error(sf_obj);
+
+        // Random access is required for streaming
+        if (!sf_info.seekable)
+        {
+            sf_close(sf_obj);
+            return STATUS_NOT_SUPPORTED;
+        }
+
+        lsp_trace("streaming file: frames=%d, channels=%d, sample_rate=%d",
+                int(sf_info.frames), int(sf_info.channels), int(sf_info.samplerate));
+
+        hSndFile            = sf_obj;
+        nChannels           = sf_info.channels;
+        nSamples            = sf_info.frames;
+        nSampleRate         = sf_info.samplerate;
+        nPosition           = 0;
+
+        return STATUS_OK;
+    }
+
+    status_t AudioStream::init_buffers(size_t head)
+    {
+        if (nChannels <= 0)
+            return STATUS_BAD_FORMAT;
+
+        nHead               = (head > nSamples) ? nSamples : head;
+
+        size_t head_size    = ALIGN_SIZE(nHead * nChannels, DEFAULT_ALIGN / sizeof(float));
+        size_t frame_size   = STREAM_FRAMES * nChannels;
+        float *ptr          = alloc_aligned<float>(pData, head_size + frame_size);
+        if (ptr == NULL)
+            return STATUS_NO_MEM;
+
+        vHead               = ptr;
+        ptr                += head_size;
+        vFrames             = ptr;
+
+        return STATUS_OK;
+    }
+
+    status_t AudioStream::seek(size_t offset)
+    {
+        if (offset == nPosition)
+            return STATUS_OK;
+
+        if (hSndFile != NULL)
+        {
+            if (sf_seek(reinterpret_cast<SNDFILE *>(hSndFile), offset, SEEK_SET) < 0)
+                return STATUS_IO_ERROR;
+            nPosition           = offset;
+            return STATUS_OK;
+        }
+
+        if (pReader == NULL)
+            return STATUS_CLOSED;
+
+        // LSPC audio reader can not move backward: re-open the chunk
+        size_t skip         = offset - nPosition;
+        if (offset < nPosition)
+        {
+            pReader->close();
+            status_t res        = pReader->open(pFile, nChunkId);
+            if (res != STATUS_OK)
+                return res;
+            nPosition           = 0;
+            skip                = nSkip + offset;
+        }
+
+        ssize_t skipped     = pReader->skip_frames(skip);
+        if (skipped != ssize_t(skip))
+            return (skipped >= 0) ? STATUS_CORRUPTED_FILE : -skipped;
+
+        nPosition           = offset;
+        return STATUS_OK;
+    }
+
+    ssize_t AudioStream::read_frames(size_t count)
+    {
+        if (count > STREAM_FRAMES)
+            count               = STREAM_FRAMES;
+
+        ssize_t n;
+        if (hSndFile != NULL)
+        {
+            SNDFILE *sf_obj     = reinterpret_cast<SNDFILE *>(hSndFile);
+            n                   = sf_readf_float(sf_obj, vFrames, count);
+            if (n <= 0)
+                return -decode_sf_error(sf_obj);
+        }
+        else if (pReader != NULL)
+        {
+            n                   = pReader->read_frames(vFrames, count);
+            if (n == -STATUS_EOF)
+                n                   = 0;
+        }
+        else
+            return -STATUS_CLOSED;
+
+        if (n > 0)
+            nPosition          += n;
+        return n;
+    }
+
+    status_t AudioStream::open(const char *path, size_t head)
+    {
+        if (path == NULL)
+            return STATUS_BAD_ARGUMENTS;
+        if (pData != NULL)
+            return STATUS_OPENED;
+
+        status_t res = open_lspc(path);
+        if (res != STATUS_OK)
+            res = open_sndfile(path);
+        if (res != STATUS_OK)
+            return res;
+
+        res = init_buffers(head);
+        if (res != STATUS_OK)
+        {
+            close();
+            return res;
+        }
+
+        // Load the resident head
+        for (size_t off = 0; off < nHead; )
+        {
+            ssize_t n = read_frames(nHead - off);
+            if (n <= 0)
+            {
+                close();
+                return (n < 0) ? status_t(-n) : STATUS_CORRUPTED_FILE;
+            }
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const float *src    = &vFrames[i];
+                float *dst          = &vHead[i * nHead + off];
+                for (ssize_t j=0; j<n; ++j, src += nChannels)
+                    dst[j]              = *src;
+            }
+
+            off    += n;
+        }
+
+        return STATUS_OK;
+    }
+
+    status_t AudioStream::close()
+    {
+        if (nReferences > 0)
+            return STATUS_BAD_STATE;
+
+        status_t res = STATUS_OK;
+        if (hSndFile != NULL)
+        {
+            if (sf_close(reinterpret_cast<SNDFILE *>(hSndFile)) != 0)
+                res         = STATUS_IO_ERROR;
+            hSndFile    = NULL;
+        }
+
+        close_lspc(pFile, pReader);
+        pFile           = NULL;
+        pReader         = NULL;
+
+        free_aligned(pData);
+        vHead           = NULL;
+        vFrames         = NULL;
+
+        nChannels       = 0;
+        nSamples        = 0;
+        nSampleRate     = 0;
+        nHead           = 0;
+        nChunkId        = 0;
+        nSkip           = 0;
+        nPosition       = 0;
+
+        return res;
+    }
+
+    ssize_t AudioStream::read(size_t channel, float *dst, size_t offset, size_t count)
+    {
+        if (channel >= nChannels)
+            return -STATUS_BAD_ARGUMENTS;
+        if (offset >= nSamples)
+            return 0;
+        if (count > (nSamples - offset))
+            count       = nSamples - offset;
+
+        // Serve the request from the resident head if possible
+        if ((offset + count) <= nHead)
+        {
+            dsp::copy(dst, &vHead[channel * nHead + offset], count);
+            return count;
+        }
+
+        status_t res = seek(offset);
+        if (res != STATUS_OK)
+            return -res;
+
+        size_t done = 0;
+        while (done < count)
+        {
+            ssize_t n = read_frames(count - done);
+            if (n < 0)
+                return n;
+            else if (n == 0)
+                break;
+
+            const float *src    = &vFrames[channel];
+            for (ssize_t j=0; j<n; ++j, src += nChannels)
+                dst[j]              = *src;
+
+            dst    += n;
+            done   += n;
+        }
+
+        return done;
+    }
+
+} /* namespace lsp */
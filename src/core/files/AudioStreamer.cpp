@@ -0,0 +1,331 @@
+/*
+ * AudioStreamer.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <core/debug.h>
+#include <core/files/AudioStreamer.h>
+
+namespace lsp
+{
+    AudioStreamer::AudioStreamer()
+    {
+        vCursors        = NULL;
+        nCursors        = 0;
+        nBlocks         = 0;
+        nBlockSize      = 0;
+        pWorker         = NULL;
+        nUnderruns      = 0;
+        pData           = NULL;
+    }
+
+    AudioStreamer::~AudioStreamer()
+    {
+        destroy();
+    }
+
+    status_t AudioStreamer::init(size_t cursors, size_t blocks, size_t block_size)
+    {
+        if ((cursors <= 0) || (blocks <= 0) || (block_size <= 0))
+            return STATUS_BAD_ARGUMENTS;
+
+        destroy();
+
+        // Estimate amount of memory
+        size_t n_blocks     = cursors * blocks;
+        block_size          = ALIGN_SIZE(block_size, DEFAULT_ALIGN / sizeof(float));
+        size_t c_size       = ALIGN_SIZE(sizeof(cursor_t) * cursors, DEFAULT_ALIGN);
+        size_t b_size       = ALIGN_SIZE(sizeof(block_t) * n_blocks, DEFAULT_ALIGN);
+        size_t d_size       = sizeof(float) * block_size * n_blocks;
+
+        uint8_t *ptr        = alloc_aligned<uint8_t>(pData, c_size + b_size + d_size);
+        if (ptr == NULL)
+            return STATUS_NO_MEM;
+
+        vCursors            = reinterpret_cast<cursor_t *>(ptr);
+        ptr                += c_size;
+        block_t *vb         = reinterpret_cast<block_t *>(ptr);
+        ptr                += b_size;
+        float *fptr         = reinterpret_cast<float *>(ptr);
+
+        nCursors            = cursors;
+        nBlocks             = blocks;
+        nBlockSize          = block_size;
+        nUnderruns          = 0;
+
+        // Initialize cursors
+        for (size_t i=0; i<cursors; ++i)
+        {
+            cursor_t *c         = &vCursors[i];
+            c->nState           = CS_FREE;
+            c->pStream          = NULL;
+            c->nChannel         = 0;
+            c->nFirst           = 0;
+            c->vBlocks          = vb;
+
+            for (size_t j=0; j<blocks; ++j, ++vb)
+            {
+                vb->nState          = BS_IDLE;
+                vb->nIndex          = 0;
+                vb->nLoaded         = 0;
+                vb->nLength         = 0;
+                vb->vData           = fptr;
+                fptr               += block_size;
+            }
+        }
+
+        // Start the I/O thread
+        pWorker             = new ipc::Thread(worker, this);
+        if (pWorker == NULL)
+        {
+            destroy();
+            return STATUS_NO_MEM;
+        }
+
+        status_t res        = pWorker->start();
+        if (res != STATUS_OK)
+        {
+            destroy();
+            return res;
+        }
+
+        return STATUS_OK;
+    }
+
+    void AudioStreamer::destroy()
+    {
+        // Stop the I/O thread first: it may still access the data
+        if (pWorker != NULL)
+        {
+            pWorker->cancel();
+            pWorker->join();
+            delete pWorker;
+            pWorker         = NULL;
+        }
+
+        // Drop all stream references held by cursors
+        for (size_t i=0; i<nCursors; ++i)
+        {
+            cursor_t *c     = &vCursors[i];
+            if ((c->nState != CS_FREE) && (c->pStream != NULL))
+                c->pStream->release();
+            c->pStream      = NULL;
+            c->nState       = CS_FREE;
+        }
+
+        free_aligned(pData);
+        vCursors        = NULL;
+        nCursors        = 0;
+        nBlocks         = 0;
+        nBlockSize      = 0;
+    }
+
+    status_t AudioStreamer::worker(void *arg)
+    {
+        AudioStreamer *_this    = reinterpret_cast<AudioStreamer *>(arg);
+
+        // Enable DSP context for the worker thread
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+
+        while (!ipc::Thread::is_cancelled())
+        {
+            // Serve at most one block per cursor on each pass to keep all voices fed
+            bool served = false;
+            for (size_t i=0; i<_this->nCursors; ++i)
+            {
+                if (_this->serve(&_this->vCursors[i]))
+                    served      = true;
+            }
+
+            if ((!served) && (ipc::Thread::sleep(1) == STATUS_CANCELLED))
+                break;
+        }
+
+        dsp::finish(&ctx);
+        return STATUS_OK;
+    }
+
+    bool AudioStreamer::serve(cursor_t *c)
+    {
+        atomic_t state      = c->nState;
+
+        // Release the stream which is not used by the real-time thread anymore
+        if (state == CS_RELEASED)
+        {
+            c->pStream->release();
+            c->pStream          = NULL;
+            atomic_swap(&c->nState, CS_FREE);
+            return true;
+        }
+        else if (state != CS_ACTIVE)
+            return false;
+
+        // Load the requested block nearest to the playback position
+        for (size_t i=0; i<nBlocks; ++i)
+        {
+            block_t *b          = &c->vBlocks[(c->nFirst + i) % nBlocks];
+            if (!atomic_cas(&b->nState, BS_REQUEST, BS_LOADING))
+                continue;
+
+            // The request may be changed by the real-time thread at any time:
+            // in this case the final state transition will fail and the block
+            // will be requested again
+            size_t index        = b->nIndex;
+            AudioStream *s      = c->pStream;
+            ssize_t n           = s->read(c->nChannel, b->vData, s->head_length() + index * nBlockSize, nBlockSize);
+            if (n < 0)
+            {
+                lsp_trace("Error reading block %d of stream %p: code=%d", int(index), s, int(-n));
+                n                   = 0;
+            }
+            if (size_t(n) < nBlockSize)
+                dsp::fill_zero(&b->vData[n], nBlockSize - n);
+
+            b->nLength          = n;
+            b->nLoaded          = index;
+            atomic_cas(&b->nState, BS_LOADING, BS_READY);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void AudioStreamer::move_window(cursor_t *c, size_t first)
+    {
+        if (first <= c->nFirst)
+            return;
+        c->nFirst           = first;
+
+        AudioStream *s      = c->pStream;
+        size_t total        = (s->samples() - s->head_length() + nBlockSize - 1) / nBlockSize;
+        size_t shift        = nBlocks - (first % nBlocks);
+
+        for (size_t i=0; i<nBlocks; ++i)
+        {
+            block_t *b          = &c->vBlocks[i];
+            size_t index        = first + (i + shift) % nBlocks;
+            if (b->nIndex == index)
+                continue;
+
+            b->nIndex           = index;
+            atomic_swap(&b->nState, (index < total) ? BS_REQUEST : BS_IDLE);
+        }
+    }
+
+    AudioStreamer::cursor_t *AudioStreamer::acquire(AudioStream *stream, size_t channel)
+    {
+        if ((stream == NULL) || (!stream->valid()) || (channel >= stream->channels()))
+            return NULL;
+
+        size_t total        = (stream->samples() - stream->head_length() + nBlockSize - 1) / nBlockSize;
+
+        for (size_t i=0; i<nCursors; ++i)
+        {
+            cursor_t *c         = &vCursors[i];
+            if (!atomic_cas(&c->nState, CS_FREE, CS_SETUP))
+                continue;
+
+            stream->acquire();
+            c->pStream          = stream;
+            c->nChannel         = channel;
+            c->nFirst           = 0;
+
+            // Request the first blocks that follow the resident head
+            for (size_t j=0; j<nBlocks; ++j)
+            {
+                block_t *b          = &c->vBlocks[j];
+                b->nIndex           = j;
+                b->nLoaded          = size_t(-1);
+                b->nLength          = 0;
+                b->nState           = (j < total) ? BS_REQUEST : BS_IDLE;
+            }
+
+            atomic_swap(&c->nState, CS_ACTIVE);
+            return c;
+        }
+
+        return NULL;
+    }
+
+    void AudioStreamer::release(cursor_t *c)
+    {
+        if (c != NULL)
+            atomic_swap(&c->nState, CS_RELEASED);
+    }
+
+    size_t AudioStreamer::read(cursor_t *c, float *dst, size_t offset, size_t count)
+    {
+        AudioStream *s      = c->pStream;
+        size_t head         = s->head_length();
+        size_t length       = s->samples();
+        size_t done         = 0;
+
+        // Read data from the resident head
+        if (offset < head)
+        {
+            done                = head - offset;
+            if (done > count)
+                done                = count;
+            dsp::copy(dst, &s->head(c->nChannel)[offset], done);
+        }
+
+        // Read data from the prefetched blocks
+        while (done < count)
+        {
+            size_t pos          = offset + done;
+            if (pos >= length)
+            {
+                dsp::fill_zero(&dst[done], count - done);
+                return done;
+            }
+
+            size_t index        = (pos - head) / nBlockSize;
+            size_t off          = (pos - head) % nBlockSize;
+            size_t to_do        = nBlockSize - off;
+            if (to_do > (count - done))
+                to_do               = count - done;
+
+            move_window(c, index);
+
+            block_t *b          = &c->vBlocks[index % nBlocks];
+            if ((b->nState == BS_READY) && (b->nLoaded == index))
+                dsp::copy(&dst[done], &b->vData[off], to_do);
+            else
+            {
+                dsp::fill_zero(&dst[done], to_do);
+                atomic_add(&nUnderruns, atomic_t(to_do));
+            }
+
+            done               += to_do;
+        }
+
+        return done;
+    }
+
+    size_t AudioStreamer::pending() const
+    {
+        size_t count        = 0;
+
+        for (size_t i=0; i<nCursors; ++i)
+        {
+            const cursor_t *c   = &vCursors[i];
+            if (c->nState != CS_ACTIVE)
+                continue;
+
+            for (size_t j=0; j<nBlocks; ++j)
+            {
+                atomic_t state      = c->vBlocks[j].nState;
+                if ((state == BS_REQUEST) || (state == BS_LOADING))
+                    ++count;
+            }
+        }
+
+        return count;
+    }
+
+} /* namespace lsp */
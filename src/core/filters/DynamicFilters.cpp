@@ -10,6 +10,8 @@
 
 #define BLD_BUF_SIZE    8
 #define BUF_SIZE        0x400       /* 1024 samples at one time */
+#define KEYS_MAX        ((BUF_SIZE >> 1) + 2) /* Maximum number of key cascades for the minimum step */
+#define STEP_MAX        BUF_SIZE    /* Maximum interpolation step */
 
 namespace lsp
 {
@@ -25,9 +27,12 @@ namespace lsp
         vFilters        = NULL;
         vMemory         = NULL;
         vCascades       = NULL;
+        vKeys           = NULL;
+        vKeyGain        = NULL;
         vBiquads.ptr    = NULL;
         nFilters        = 0;
         nSampleRate     = 0;
+        nStep           = 1;
         pData           = NULL;
         bClearMem       = false;
     }
@@ -43,9 +48,11 @@ namespace lsp
         size_t b_per_filter_t       = ALIGN_SIZE(sizeof(filter_t) * filters, ALIGN64);
         size_t b_per_memory         = FILTER_CHAINS_MAX * 2 * filters * sizeof(float);
         size_t b_per_cascades       = ALIGN_SIZE(8 * (BUF_SIZE + 8) * sizeof(f_cascade_t), ALIGN64);
+        size_t b_per_keys           = ALIGN_SIZE(8 * (KEYS_MAX + 8) * sizeof(f_cascade_t), ALIGN64);
+        size_t b_per_key_gain       = ALIGN_SIZE(KEYS_MAX * sizeof(float), ALIGN64);
         size_t b_per_biquad         = sizeof(biquad_x8_t) * (BUF_SIZE + 8);
 
-        size_t to_alloc             = b_per_filter_t + b_per_memory + b_per_cascades + b_per_biquad;
+        size_t to_alloc             = b_per_filter_t + b_per_memory + b_per_cascades + b_per_keys + b_per_key_gain + b_per_biquad;
 
         // Allocate memory
         uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, ALIGN64);
@@ -59,6 +66,10 @@ namespace lsp
         ptr            += b_per_memory;
         vCascades       = reinterpret_cast<f_cascade_t *>(ptr);
         ptr            += b_per_cascades;
+        vKeys           = reinterpret_cast<f_cascade_t *>(ptr);
+        ptr            += b_per_keys;
+        vKeyGain        = reinterpret_cast<float *>(ptr);
+        ptr            += b_per_key_gain;
         vBiquads.ptr    = ptr;
         nFilters        = filters;
 
@@ -88,6 +99,12 @@ namespace lsp
         nSampleRate         = sr;
     }
 
+    void DynamicFilters::set_interpolation(size_t step)
+    {
+        nStep               = (step <= 1) ? 1 :
+                              (step > STEP_MAX) ? STEP_MAX : step;
+    }
+
     void DynamicFilters::destroy()
     {
         if (pData != NULL)
@@ -95,6 +112,8 @@ namespace lsp
 
         vFilters        = NULL;
         vCascades       = NULL;
+        vKeys           = NULL;
+        vKeyGain        = NULL;
         vMemory         = NULL;
         vBiquads.ptr    = NULL;
         nFilters        = 0;
@@ -211,11 +230,41 @@ namespace lsp
             const float *src        = in;
             size_t cj               = 0;
 
+            // Prepare gain values for key cascades: each nStep'th sample and the last sample
+            size_t keys = 0, segs = 0, tail = 0;
+            if (nStep > 1)
+            {
+                segs                    = (to_process - 1) / nStep; // Number of full segments
+                tail                    = to_process - 1 - segs * nStep; // Length of the last segment
+                for (size_t k=0; keys <= segs; ++keys, k += nStep)
+                    vKeyGain[keys]          = gain[k];
+                if (tail > 0)
+                    vKeyGain[keys++]        = gain[to_process - 1];
+            }
+
             // Process all cascades
             while (true)
             {
                 // Generate cascades
-                size_t nj               = build_filter_bank(vCascades, &f->sParams, cj, gain, to_process);
+                size_t nj;
+                if (keys > 0)
+                {
+                    // Generate key cascades and interpolate them
+                    nj                      = build_filter_bank(vKeys, &f->sParams, cj, vKeyGain, keys);
+                    for (size_t j=0; j<nj; ++j)
+                    {
+                        f_cascade_t *dc         = &vCascades[(nj+1)*j];
+                        const f_cascade_t *kc   = &vKeys[(nj+1)*j];
+                        if (segs > 0)
+                            dsp::interpolate_cascades(dc, kc, nj, nStep, segs * nStep);
+                        if (tail > 0)
+                            dsp::interpolate_cascades(&dc[segs * nStep * nj], &kc[segs * nj], nj, tail, tail);
+                        dc[(to_process - 1) * nj] = kc[(keys - 1) * nj]; // The last sample is always exact
+                    }
+                }
+                else
+                    nj                      = build_filter_bank(vCascades, &f->sParams, cj, gain, to_process);
+
                 if (nj <= 0)
                     break;
 
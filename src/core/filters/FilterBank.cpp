@@ -22,6 +22,11 @@ namespace lsp
         nLastItems  = -1;
         vData       = NULL;
         vBackup     = NULL;
+        vBuffer     = NULL;
+        nChannels   = 1;
+        nLanes      = 1;
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            vChItems[i]     = 0;
     }
 
     FilterBank::~FilterBank()
@@ -40,23 +45,30 @@ namespace lsp
         vFilters    = NULL;
         vChains     = NULL;
         vBackup     = NULL;
+        vBuffer     = NULL;
         nItems      = 0;
         nMaxItems   = 0;
         nLastItems  = -1;
+        nChannels   = 1;
+        nLanes      = 1;
     }
 
-    bool FilterBank::init(size_t filters)
+    bool FilterBank::init(size_t filters, size_t channels)
     {
         destroy();
+        if ((channels <= 0) || (channels > MAX_CHANNELS))
+            return false;
 
         // Calculate data size
-        size_t n_banks      = (filters/8) + 3;
+        size_t lanes        = (channels <= 1) ? 1 : (channels <= 4) ? 4 : 8;
+        size_t n_banks      = (lanes > 1) ? filters : (filters/8) + 3; // One bank per stage in multi-channel mode
         size_t bank_alloc   = ALIGN_SIZE(sizeof(biquad_t), BIQUAD_ALIGN) * n_banks;
-        size_t chain_alloc  = sizeof(biquad_x1_t) * filters;
+        size_t chain_alloc  = sizeof(biquad_x1_t) * filters * channels;
         size_t backup_alloc = sizeof(float) * BIQUAD_D_ITEMS * n_banks;
+        size_t buf_alloc    = (lanes > 1) ? ALIGN_SIZE(sizeof(float) * BUF_SIZE * lanes, BIQUAD_ALIGN) : 0;
 
         // Allocate data
-        size_t allocate     = bank_alloc + chain_alloc + backup_alloc + BIQUAD_ALIGN;
+        size_t allocate     = bank_alloc + buf_alloc + chain_alloc + backup_alloc + BIQUAD_ALIGN;
         vData               = lsp_tmalloc(uint8_t, allocate);
         if (vData == NULL)
             return false;
@@ -65,6 +77,8 @@ namespace lsp
         uint8_t *ptr        = ALIGN_PTR(vData, BIQUAD_ALIGN);
         vFilters            = reinterpret_cast<biquad_t *>(ptr);
         ptr                += bank_alloc;
+        vBuffer             = (buf_alloc > 0) ? reinterpret_cast<float *>(ptr) : NULL;
+        ptr                += buf_alloc;
         vChains             = reinterpret_cast<biquad_x1_t *>(ptr);
         ptr                += chain_alloc;
         vBackup             = reinterpret_cast<float *>(ptr);
@@ -74,6 +88,14 @@ namespace lsp
         nItems              = 0;
         nMaxItems           = filters;
         nLastItems          = -1;
+        nChannels           = channels;
+        nLanes              = lanes;
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            vChItems[i]         = 0;
+
+        // Unused lanes of the interleave buffer should always contain zeros
+        if (vBuffer != NULL)
+            dsp::fill_zero(vBuffer, BUF_SIZE * lanes);
 
         return true;
     }
@@ -85,8 +107,76 @@ namespace lsp
         return &vChains[nItems++];
     }
 
+    biquad_x1_t *FilterBank::add_chain(size_t channel)
+    {
+        if (channel >= nChannels)
+            return NULL;
+
+        biquad_x1_t *c  = &vChains[channel * nMaxItems];
+        size_t n        = vChItems[channel];
+        if (n >= nMaxItems)
+            return (n <= 0) ? NULL : &c[n-1];
+
+        vChItems[channel] = ++n;
+        if (nItems < n)
+            nItems          = n;
+        return &c[n-1];
+    }
+
+    void FilterBank::end_multichannel()
+    {
+        // Each bank contains one stage of all channels, missing stages
+        // and unused lanes are filled with identity filters
+        biquad_t *b     = vFilters;
+
+        for (size_t j=0; j<nItems; ++j, ++b)
+        {
+            float *a0, *a1, *a2, *b1, *b2;
+            if (nLanes == 8)
+            {
+                biquad_x8_t *f  = &b->x8;
+                a0 = f->a0; a1 = f->a1; a2 = f->a2; b1 = f->b1; b2 = f->b2;
+            }
+            else
+            {
+                biquad_x4_t *f  = &b->x4;
+                a0 = f->a0; a1 = f->a1; a2 = f->a2; b1 = f->b1; b2 = f->b2;
+            }
+
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                if ((i < nChannels) && (j < vChItems[i]))
+                {
+                    biquad_x1_t *c  = &vChains[i * nMaxItems + j];
+                    a0[i]           = c->a[0];
+                    a1[i]           = c->a[2];
+                    a2[i]           = c->a[3];
+                    b1[i]           = c->b[0];
+                    b2[i]           = c->b[1];
+                }
+                else
+                {
+                    a0[i]           = 1.0f;
+                    a1[i]           = 0.0f;
+                    a2[i]           = 0.0f;
+                    b1[i]           = 0.0f;
+                    b2[i]           = 0.0f;
+                }
+            }
+        }
+    }
+
     void FilterBank::end(bool clear)
     {
+        if (nLanes > 1)
+        {
+            end_multichannel();
+            if ((clear) || (nItems != nLastItems))
+                reset();
+            nLastItems      = nItems;
+            return;
+        }
+
         size_t items    = nItems;
         biquad_x1_t *c  = vChains;
         biquad_t *b     = vFilters;
@@ -235,8 +325,11 @@ namespace lsp
         nLastItems      = nItems;
     }
 
-    void FilterBank::reset()
+    size_t FilterBank::banks() const
     {
+        if (nLanes > 1)
+            return nItems;
+
         size_t items    = nItems >> 3;
         if (nItems & 4)
             items ++;
@@ -245,6 +338,12 @@ namespace lsp
         if (nItems & 1)
             items ++;
 
+        return items;
+    }
+
+    void FilterBank::reset()
+    {
+        size_t items    = banks();
         biquad_t *b     = vFilters;
         while (items--)
         {
@@ -290,19 +389,66 @@ namespace lsp
             dsp::biquad_process_x1(out, in, samples, f);
     }
 
+    void FilterBank::process(float **out, const float **in, size_t samples)
+    {
+        if (nLanes <= 1)
+        {
+            process(out[0], in[0], samples);
+            return;
+        }
+        else if (nItems == 0)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+                dsp::copy(out[i], in[i], samples);
+            return;
+        }
+
+        for (size_t off=0; off < samples; )
+        {
+            size_t to_do    = samples - off;
+            if (to_do > BUF_SIZE)
+                to_do           = BUF_SIZE;
+
+            // Interleave channels
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const float *src    = &in[i][off];
+                float *dst          = &vBuffer[i];
+                for (size_t k=0; k<to_do; ++k, dst += nLanes)
+                    *dst                = src[k];
+            }
+
+            // Process all channels at once
+            if (nLanes == 8)
+                dsp::biquad_process_mc8(vBuffer, vBuffer, to_do, vFilters, nItems);
+            else
+                dsp::biquad_process_mc4(vBuffer, vBuffer, to_do, vFilters, nItems);
+
+            // De-interleave channels
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const float *src    = &vBuffer[i];
+                float *dst          = &out[i][off];
+                for (size_t k=0; k<to_do; ++k, src += nLanes)
+                    dst[k]              = *src;
+            }
+
+            off            += to_do;
+        }
+    }
+
     void FilterBank::impulse_response(float *out, size_t samples)
     {
+        if (nLanes > 1)
+        {
+            impulse_response(out, samples, 0);
+            return;
+        }
+
         // Backup and clean all delays
         biquad_t *f         = vFilters;
         float *dst          = vBackup;
-
-        size_t items        = nItems >> 3;
-        if (nItems & 4)
-            items ++;
-        if (nItems & 2)
-            items ++;
-        if (nItems & 1)
-            items ++;
+        size_t items        = banks();
 
         for (size_t i=0; i < items; ++i)
         {
@@ -329,4 +475,63 @@ namespace lsp
         }
     }
 
+    void FilterBank::impulse_response(float *out, size_t samples, size_t channel)
+    {
+        if ((nLanes <= 1) || (channel >= nChannels))
+        {
+            impulse_response(out, samples);
+            return;
+        }
+
+        // Backup and clean all delays
+        biquad_t *f         = vFilters;
+        float *dst          = vBackup;
+        size_t items        = banks();
+
+        for (size_t i=0; i < items; ++i)
+        {
+            dsp::copy(dst, f->d, BIQUAD_D_ITEMS);
+            dsp::fill_zero(f->d, BIQUAD_D_ITEMS);
+            dst                += BIQUAD_D_ITEMS;
+            f                  ++;
+        }
+
+        // Generate impulse response in the lane of the channel
+        for (size_t off=0; off < samples; )
+        {
+            size_t to_do    = samples - off;
+            if (to_do > BUF_SIZE)
+                to_do           = BUF_SIZE;
+
+            dsp::fill_zero(vBuffer, to_do * nLanes);
+            if (off == 0)
+                vBuffer[channel]    = 1.0f;
+
+            if (nLanes == 8)
+                dsp::biquad_process_mc8(vBuffer, vBuffer, to_do, vFilters, items);
+            else
+                dsp::biquad_process_mc4(vBuffer, vBuffer, to_do, vFilters, items);
+
+            const float *src    = &vBuffer[channel];
+            for (size_t k=0; k<to_do; ++k, src += nLanes)
+                out[off + k]        = *src;
+
+            off            += to_do;
+        }
+
+        // Restore all delays
+        dst                 = vBackup;
+        f                   = vFilters;
+
+        for (size_t i=0; i < items; ++i)
+        {
+            dsp::copy(f->d, dst, BIQUAD_D_ITEMS);
+            dst                += BIQUAD_D_ITEMS;
+            f                  ++;
+        }
+
+        // Unused lanes of the interleave buffer should always contain zeros
+        dsp::fill_zero(vBuffer, BUF_SIZE * nLanes);
+    }
+
 } /* namespace lsp */
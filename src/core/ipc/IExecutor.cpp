@@ -28,5 +28,52 @@ namespace lsp
         void IExecutor::shutdown()
         {
         }
+
+        void IExecutor::run_task(ITask *task)
+        {
+            // Enable DSP context for executor service
+            dsp::context_t ctx;
+            dsp::start(&ctx);
+
+            int code        = STATUS_OK;
+            bool skip       = false;
+
+            while (task != NULL)
+            {
+                // The task should not be touched after it becomes completed
+                ITask *next     = task->pContinuation;
+
+                if (skip)
+                    task->nCode     = code;
+                else if (task->bCancelled)
+                    task->nCode     = code = STATUS_CANCELLED;
+                else
+                {
+                    task->nState    = ITask::TS_RUNNING;
+                    task->nCode     = 0;
+                    task->nCode     = code = task->run();
+                }
+
+                if (task->pCallback != NULL)
+                    task->pCallback(task, task->pCallbackArg);
+
+                // Pass control to the continuation, skip it if the task has failed.
+                // The continuation should become submitted before the task becomes
+                // completed: the owner may reset, re-submit or destroy the chain
+                // as soon as it sees the task completed and the continuation idle
+                if ((next != NULL) && (!next->idle()))
+                    next            = NULL;
+                if (next != NULL)
+                {
+                    next->nState    = ITask::TS_SUBMITTED;
+                    skip            = code != STATUS_OK;
+                }
+
+                task->nState    = ITask::TS_COMPLETED;
+                task            = next;
+            }
+
+            dsp::finish(&ctx);
+        }
     } /* namespace lsp */
 } /* namespace lsp */
@@ -14,9 +14,13 @@ namespace lsp
     {
         ITask::ITask()
         {
-            nState  = TS_IDLE;
-            nCode   = 0;
-            pNext   = NULL;
+            nState          = TS_IDLE;
+            nCode           = 0;
+            pNext           = NULL;
+            bCancelled      = false;
+            pContinuation   = NULL;
+            pCallback       = NULL;
+            pCallbackArg    = NULL;
         }
 
         ITask::~ITask()
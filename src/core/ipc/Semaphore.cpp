@@ -0,0 +1,135 @@
+/*
+ * Semaphore.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <core/ipc/Semaphore.h>
+#include <core/ipc/Thread.h>
+
+namespace lsp
+{
+    namespace ipc
+    {
+#if defined(PLATFORM_WINDOWS)
+        Semaphore::Semaphore()
+        {
+            hSem        = CreateSemaphoreW(NULL, 0, LONG_MAX, NULL);
+        }
+
+        Semaphore::~Semaphore()
+        {
+            CloseHandle(hSem);
+        }
+
+        bool Semaphore::post()
+        {
+            return ReleaseSemaphore(hSem, 1, NULL);
+        }
+
+        bool Semaphore::wait()
+        {
+            return WaitForSingleObject(hSem, INFINITE) == WAIT_OBJECT_0;
+        }
+
+        bool Semaphore::try_wait()
+        {
+            return WaitForSingleObject(hSem, 0) == WAIT_OBJECT_0;
+        }
+
+#elif defined(PLATFORM_LINUX)
+        Semaphore::Semaphore()
+        {
+            nCount      = 0;
+            nWaiters    = 0;
+        }
+
+        Semaphore::~Semaphore()
+        {
+        }
+
+        bool Semaphore::post()
+        {
+            atomic_add(&nCount, 1);
+            if (nWaiters > 0)
+                syscall(SYS_futex, &nCount, FUTEX_WAKE, 1, NULL, 0, 0);
+            return true;
+        }
+
+        bool Semaphore::wait()
+        {
+            while (true)
+            {
+                if (try_wait())
+                    return true;
+
+                // Wait until the counter changes it's zero value
+                atomic_add(&nWaiters, 1);
+                if ((syscall(SYS_futex, &nCount, FUTEX_WAIT, 0, NULL, 0, 0) != 0) && (errno == ENOSYS))
+                    Thread::sleep(1);
+                atomic_add(&nWaiters, -1);
+            }
+        }
+
+        bool Semaphore::try_wait()
+        {
+            while (true)
+            {
+                atomic_t count  = nCount;
+                if (count <= 0)
+                    return false;
+                if (atomic_cas(&nCount, count, count - 1))
+                    return true;
+            }
+        }
+
+#else
+        Semaphore::Semaphore()
+        {
+            pthread_mutex_init(&sMutex, NULL);
+            pthread_cond_init(&sCond, NULL);
+            nCount      = 0;
+        }
+
+        Semaphore::~Semaphore()
+        {
+            pthread_cond_destroy(&sCond);
+            pthread_mutex_destroy(&sMutex);
+        }
+
+        bool Semaphore::post()
+        {
+            if (pthread_mutex_lock(&sMutex) != 0)
+                return false;
+            ++nCount;
+            pthread_cond_signal(&sCond);
+            pthread_mutex_unlock(&sMutex);
+            return true;
+        }
+
+        bool Semaphore::wait()
+        {
+            if (pthread_mutex_lock(&sMutex) != 0)
+                return false;
+            while (nCount <= 0)
+                pthread_cond_wait(&sCond, &sMutex);
+            --nCount;
+            pthread_mutex_unlock(&sMutex);
+            return true;
+        }
+
+        bool Semaphore::try_wait()
+        {
+            if (pthread_mutex_lock(&sMutex) != 0)
+                return false;
+            bool res    = nCount > 0;
+            if (res)
+                --nCount;
+            pthread_mutex_unlock(&sMutex);
+            return res;
+        }
+#endif /* PLATFORM_LINUX */
+
+    } /* namespace ipc */
+} /* namespace lsp */
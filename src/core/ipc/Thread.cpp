@@ -190,6 +190,16 @@ namespace lsp
             return STATUS_OK;
         }
 
+        void Thread::yield()
+        {
+            SwitchToThread();
+        }
+
+        status_t Thread::set_realtime()
+        {
+            return (SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST)) ? STATUS_OK : STATUS_PERMISSION_DENIED;
+        }
+
         size_t Thread::system_cores()
         {
             SYSTEM_INFO     os_sysinfo;
@@ -303,6 +313,21 @@ namespace lsp
             return STATUS_OK;
         }
 
+        void Thread::yield()
+        {
+            sched_yield();
+        }
+
+        status_t Thread::set_realtime()
+        {
+            struct sched_param param;
+            param.sched_priority    = sched_get_priority_min(SCHED_FIFO);
+            if (param.sched_priority < 0)
+                return STATUS_NOT_SUPPORTED;
+
+            return (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0) ? STATUS_OK : STATUS_PERMISSION_DENIED;
+        }
+
         size_t Thread::system_cores()
         {
             return sysconf(_SC_NPROCESSORS_ONLN);
@@ -0,0 +1,315 @@
+/*
+ * WorkStealingExecutor.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <core/debug.h>
+#include <core/ipc/WorkStealingExecutor.h>
+
+namespace lsp
+{
+    namespace ipc
+    {
+        WorkStealingExecutor::WorkStealingExecutor(size_t threads)
+        {
+            vWorkers    = NULL;
+            nWorkers    = 0;
+            nThreads    = threads;
+            nPending    = 0;
+            nNext       = 0;
+        }
+
+        WorkStealingExecutor::~WorkStealingExecutor()
+        {
+            if (vWorkers != NULL)
+                shutdown();
+        }
+
+        status_t WorkStealingExecutor::start()
+        {
+            if (vWorkers != NULL)
+                return STATUS_BAD_STATE;
+
+            size_t n        = (nThreads > 0) ? nThreads : Thread::system_cores();
+            if (n <= 0)
+                n               = 1;
+
+            // Initialize workers
+            worker_t *vw    = new worker_t[n];
+            if (vw == NULL)
+                return STATUS_NO_MEM;
+
+            for (size_t i=0; i<n; ++i)
+            {
+                worker_t *w     = &vw[i];
+                w->pExecutor    = this;
+                w->pThread      = NULL;
+                w->nIndex       = i;
+                atomic_init(w->nLock);
+                w->nTop         = 0;
+                w->nCount       = 0;
+            }
+
+            vWorkers        = vw;
+            nWorkers        = n;
+
+            // Launch threads
+            for (size_t i=0; i<n; ++i)
+            {
+                worker_t *w     = &vw[i];
+                w->pThread      = new Thread(execute, w);
+                if (w->pThread == NULL)
+                {
+                    destroy();
+                    return STATUS_NO_MEM;
+                }
+
+                status_t res    = w->pThread->start();
+                if (res != STATUS_OK)
+                {
+                    delete w->pThread;
+                    w->pThread      = NULL;
+                    destroy();
+                    return res;
+                }
+            }
+
+            lsp_trace("started %d worker threads", int(n));
+            return STATUS_OK;
+        }
+
+        bool WorkStealingExecutor::submit(ITask *task)
+        {
+            lsp_trace("submit task=%p", task);
+            if ((vWorkers == NULL) || (!task->idle()))
+                return false;
+
+            // Update task state to SUBMITTED
+            change_task_state(task, ITask::TS_SUBMITTED);
+            atomic_add(&nPending, 1);
+
+            // Try to put the task to the top of deque of any worker, do not wait for locks
+            size_t first    = size_t(atomic_add(&nNext, 1)) % nWorkers;
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                worker_t *w     = &vWorkers[(first + i) % nWorkers];
+                if (!atomic_trylock(w->nLock))
+                    continue;
+
+                if (w->nCount < QUEUE_SIZE)
+                {
+                    w->nTop         = (w->nTop + QUEUE_SIZE - 1) % QUEUE_SIZE;
+                    w->vTasks[w->nTop] = task;
+                    ++w->nCount;
+                    atomic_unlock(w->nLock);
+                    return true;
+                }
+
+                atomic_unlock(w->nLock);
+            }
+
+            // All deques are busy, rollback the state
+            atomic_add(&nPending, -1);
+            change_task_state(task, ITask::TS_IDLE);
+            return false;
+        }
+
+        bool WorkStealingExecutor::fork(ITask *task)
+        {
+            worker_t *w     = current_worker();
+            if (w == NULL)
+                return submit(task);
+            if (!task->idle())
+                return false;
+
+            change_task_state(task, ITask::TS_SUBMITTED);
+            atomic_add(&nPending, 1);
+
+            // Put the task to the bottom of the current worker's deque
+            while (!atomic_trylock(w->nLock))
+                /* nothing */ ;
+
+            if (w->nCount < QUEUE_SIZE)
+            {
+                w->vTasks[(w->nTop + w->nCount) % QUEUE_SIZE] = task;
+                ++w->nCount;
+                atomic_unlock(w->nLock);
+                return true;
+            }
+
+            atomic_unlock(w->nLock);
+
+            // The deque is full, execute the task immediately
+            process_task(task);
+            return true;
+        }
+
+        bool WorkStealingExecutor::wait(ITask *task)
+        {
+            if (task->idle())
+                return false;
+
+            worker_t *w     = current_worker();
+            while (!task->completed())
+            {
+                // Help other tasks to complete while waiting
+                ITask *t        = (w != NULL) ? pop_task(w) : NULL;
+                if ((t == NULL) && (w != NULL))
+                    t               = steal_task(w);
+
+                if (t != NULL)
+                    process_task(t);
+                else
+                    Thread::sleep(1);
+            }
+
+            return true;
+        }
+
+        void WorkStealingExecutor::shutdown()
+        {
+            if (vWorkers == NULL)
+                return;
+
+            lsp_trace("start shutdown");
+
+            // Wait until all tasks are completed
+            while (nPending > 0)
+                ipc::Thread::sleep(10);
+
+            destroy();
+
+            lsp_trace("shutdown complete");
+        }
+
+        void WorkStealingExecutor::destroy()
+        {
+            // Cancel all threads first
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                Thread *t       = vWorkers[i].pThread;
+                if (t != NULL)
+                    t->cancel();
+            }
+
+            // Wait for termination
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                Thread *t       = vWorkers[i].pThread;
+                if (t == NULL)
+                    continue;
+                t->join();
+                delete t;
+                vWorkers[i].pThread = NULL;
+            }
+
+            delete [] vWorkers;
+            vWorkers        = NULL;
+            nWorkers        = 0;
+        }
+
+        WorkStealingExecutor::worker_t *WorkStealingExecutor::current_worker()
+        {
+            Thread *t       = Thread::current();
+            if (t == NULL)
+                return NULL;
+
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                if (vWorkers[i].pThread == t)
+                    return &vWorkers[i];
+            }
+
+            return NULL;
+        }
+
+        ITask *WorkStealingExecutor::pop_task(worker_t *w)
+        {
+            if (w->nCount <= 0)
+                return NULL;
+
+            while (!atomic_trylock(w->nLock))
+                /* nothing */ ;
+
+            ITask *task     = NULL;
+            if (w->nCount > 0)
+            {
+                --w->nCount;
+                task            = w->vTasks[(w->nTop + w->nCount) % QUEUE_SIZE];
+            }
+
+            atomic_unlock(w->nLock);
+            return task;
+        }
+
+        ITask *WorkStealingExecutor::steal_task(worker_t *w)
+        {
+            for (size_t i=1; i<nWorkers; ++i)
+            {
+                worker_t *v     = &vWorkers[(w->nIndex + i) % nWorkers];
+                if (v->nCount <= 0)
+                    continue;
+                if (!atomic_trylock(v->nLock))
+                    continue;
+
+                ITask *task     = NULL;
+                if (v->nCount > 0)
+                {
+                    task            = v->vTasks[v->nTop];
+                    v->nTop         = (v->nTop + 1) % QUEUE_SIZE;
+                    --v->nCount;
+                }
+
+                atomic_unlock(v->nLock);
+                if (task != NULL)
+                    return task;
+            }
+
+            return NULL;
+        }
+
+        void WorkStealingExecutor::process_task(ITask *task)
+        {
+            lsp_trace("executing task %p", task);
+            run_task(task);
+            // The task may be already destroyed by the waiting side, do not touch it
+            lsp_trace("executed task %p", task);
+            atomic_add(&nPending, -1);
+        }
+
+        void WorkStealingExecutor::run(worker_t *w)
+        {
+            size_t delay    = 0;
+
+            while (!ipc::Thread::is_cancelled())
+            {
+                ITask *task     = pop_task(w);
+                if (task == NULL)
+                    task            = steal_task(w);
+
+                if (task != NULL)
+                {
+                    process_task(task);
+                    delay           = 0;
+                    continue;
+                }
+
+                // No tasks, wait for a while and increase the delay
+                delay           = (delay > 0) ? delay << 1 : 1;
+                if (delay > IDLE_MAX_DELAY)
+                    delay           = IDLE_MAX_DELAY;
+                if (ipc::Thread::sleep(delay) == STATUS_CANCELLED)
+                    return;
+            }
+        }
+
+        status_t WorkStealingExecutor::execute(void *params)
+        {
+            worker_t *w     = reinterpret_cast<worker_t *>(params);
+            w->pExecutor->run(w);
+            return STATUS_OK;
+        }
+    }
+}
@@ -16,6 +16,7 @@ namespace lsp
         nLength     = 0;
         nMaxLength  = 0;
         nChannels   = 0;
+        pStream     = NULL;
     }
 
     Sample::~Sample()
@@ -93,6 +94,21 @@ namespace lsp
         nLength         = length;
         nMaxLength      = max_length;
         nChannels       = channels;
+        pStream         = NULL;
+        return true;
+    }
+
+    bool Sample::init_stream(AudioStream *stream)
+    {
+        if ((stream == NULL) || (!stream->valid()))
+            return false;
+
+        // Destroy previous data
+        destroy();
+
+        pStream         = stream;
+        nLength         = stream->samples();
+        nChannels       = stream->channels();
         return true;
     }
 
@@ -108,6 +124,7 @@ namespace lsp
         nMaxLength      = 0;
         nLength         = 0;
         nChannels       = 0;
+        pStream         = NULL;
     }
 
 } /* namespace lsp */
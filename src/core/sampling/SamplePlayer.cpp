@@ -7,21 +7,32 @@
 
 #include <dsp/dsp.h>
 #include <core/debug.h>
+#include <core/sugar.h>
 #include <core/sampling/SamplePlayer.h>
 
+#define STREAM_BUFFER_SIZE      0x400
+
 namespace lsp
 {
     SamplePlayer::SamplePlayer()
     {
-        vSamples        = NULL;
-        nSamples        = 0;
-        vPlayback       = NULL;
-        nPlayback       = 0;
-        sActive.pHead   = NULL;
-        sActive.pTail   = NULL;
-        sInactive.pHead = NULL;
-        sInactive.pTail = NULL;
-        fGain           = 1.0f;
+        vSamples                = NULL;
+        nSamples                = 0;
+        sPlayback.vSample       = NULL;
+        sPlayback.vID           = NULL;
+        sPlayback.vChannel      = NULL;
+        sPlayback.vOffset       = NULL;
+        sPlayback.vFadeout      = NULL;
+        sPlayback.vFadeOffset   = NULL;
+        sPlayback.vVolume       = NULL;
+        sPlayback.vCursor       = NULL;
+        nPlayback               = 0;
+        nActive                 = 0;
+        nPolyphony              = 0;
+        fGain                   = 1.0f;
+        pStreamer               = NULL;
+        vBuffer                 = NULL;
+        pData                   = NULL;
     }
     
     SamplePlayer::~SamplePlayer()
@@ -29,86 +40,83 @@ namespace lsp
         destroy(true);
     }
 
-    inline void SamplePlayer::list_remove(list_t *list, playback_t *pb)
-    {
-        if (pb->pPrev != NULL)
-            pb->pPrev->pNext    = pb->pNext;
-        else
-            list->pHead         = pb->pNext;
-        if (pb->pNext != NULL)
-            pb->pNext->pPrev    = pb->pPrev;
-        else
-            list->pTail         = pb->pPrev;
-    }
-
-    inline SamplePlayer::playback_t *SamplePlayer::list_remove_first(list_t *list)
-    {
-        playback_t *pb          = list->pHead;
-        if (pb == NULL)
-            return NULL;
-        list->pHead             = pb->pNext;
-        if (pb->pNext != NULL)
-            pb->pNext->pPrev    = pb->pPrev;
-        else
-            list->pTail         = pb->pPrev;
-        return pb;
-    }
-
-    inline void SamplePlayer::list_add_first(list_t *list, playback_t *pb)
-    {
-        if (list->pHead == NULL)
+    template <class T>
+        static inline void swap_items(T *v, size_t a, size_t b)
         {
-            list->pHead         = pb;
-            list->pTail         = pb;
-            pb->pPrev           = NULL;
-            pb->pNext           = NULL;
+            T tmp       = v[a];
+            v[a]        = v[b];
+            v[b]        = tmp;
         }
-        else
+
+    template <class T>
+        static inline T *alloc_items(uint8_t * &ptr, size_t count)
         {
-            pb->pNext           = list->pHead;
-            pb->pPrev           = NULL;
-            list->pHead->pPrev  = pb;
-            list->pHead         = pb;
+            T *res      = reinterpret_cast<T *>(ptr);
+            ptr        += ALIGN_SIZE(count * sizeof(T), DEFAULT_ALIGN);
+            return res;
         }
-    }
 
-    inline void SamplePlayer::list_insert_from_tail(list_t *list, playback_t *pb)
+    void SamplePlayer::cleanup(size_t idx)
     {
-        // Find the position to insert data
-        playback_t *prev    = list->pTail;
-        while (prev != NULL)
+        playback_t *pb          = &sPlayback;
+        if (pb->vCursor[idx] != NULL)
         {
-            if (pb->nOffset <= prev->nOffset)
-                break;
-            prev    = prev->pPrev;
+            pStreamer->release(pb->vCursor[idx]);
+            pb->vCursor[idx]        = NULL;
         }
 
-        // Position is before the first element?
-        if (prev == NULL)
-        {
-            list_add_first(list, pb);
+        pb->vSample[idx]        = NULL;
+        pb->vID[idx]            = -1;
+        pb->vChannel[idx]       = 0;
+        pb->vFadeout[idx]       = -1;
+        pb->vFadeOffset[idx]    = 0;
+        pb->vVolume[idx]        = 0.0f;
+        pb->vOffset[idx]        = 0;
+    }
+
+    void SamplePlayer::release(size_t idx)
+    {
+        cleanup(idx);
+
+        // Move the last active playback to the freed position
+        size_t last             = --nActive;
+        if (idx == last)
             return;
-        }
 
-        // Insert after the found element
-        if (prev->pNext == NULL)
-            list->pTail         = pb;
-        else
-            prev->pNext->pPrev  = pb;
-        pb->pPrev           = prev;
-        pb->pNext           = prev->pNext;
-        prev->pNext         = pb;
+        playback_t *pb          = &sPlayback;
+        swap_items(pb->vSample, idx, last);
+        swap_items(pb->vID, idx, last);
+        swap_items(pb->vChannel, idx, last);
+        swap_items(pb->vOffset, idx, last);
+        swap_items(pb->vFadeout, idx, last);
+        swap_items(pb->vFadeOffset, idx, last);
+        swap_items(pb->vVolume, idx, last);
+        swap_items(pb->vCursor, idx, last);
     }
 
-    inline void SamplePlayer::cleanup(playback_t *pb)
+    size_t SamplePlayer::steal()
     {
-        pb->pSample         = NULL;
-        pb->nID             = -1;
-        pb->nChannel        = 0;
-        pb->nFadeout        = -1;
-        pb->nFadeOffset     = 0;
-        pb->nVolume         = 0.0f;
-        pb->nOffset         = 0;
+        // Steal the oldest playback, prefer cancelled playbacks
+        const playback_t *pb    = &sPlayback;
+        size_t idx              = 0;
+        bool cancelled          = pb->vFadeout[0] >= 0;
+
+        for (size_t i=1; i<nActive; ++i)
+        {
+            bool c                  = pb->vFadeout[i] >= 0;
+            if (c != cancelled)
+            {
+                if (!c)
+                    continue;
+            }
+            else if (pb->vOffset[i] <= pb->vOffset[idx])
+                continue;
+
+            idx                     = i;
+            cancelled               = c;
+        }
+
+        return idx;
     }
 
     bool SamplePlayer::init(size_t max_samples, size_t max_playbacks)
@@ -122,52 +130,58 @@ namespace lsp
         if (vSamples == NULL)
             return false;
 
-        // Allocate playback array
-        vPlayback           = new playback_t[max_playbacks];
-        if (vPlayback == NULL)
+        // Allocate playback arrays
+        size_t allocate     =
+            ALIGN_SIZE(max_playbacks * sizeof(Sample *), DEFAULT_ALIGN) +
+            ALIGN_SIZE(max_playbacks * sizeof(ssize_t), DEFAULT_ALIGN) * 4 +
+            ALIGN_SIZE(max_playbacks * sizeof(size_t), DEFAULT_ALIGN) +
+            ALIGN_SIZE(max_playbacks * sizeof(float), DEFAULT_ALIGN) +
+            ALIGN_SIZE(max_playbacks * sizeof(AudioStreamer::cursor_t *), DEFAULT_ALIGN) +
+            STREAM_BUFFER_SIZE * sizeof(float);
+
+        uint8_t *ptr        = alloc_aligned<uint8_t>(pData, allocate);
+        if (ptr == NULL)
         {
             delete [] vSamples;
             vSamples            = NULL;
             return false;
         }
 
+        playback_t *pb      = &sPlayback;
+        pb->vSample         = alloc_items<Sample *>(ptr, max_playbacks);
+        pb->vID             = alloc_items<ssize_t>(ptr, max_playbacks);
+        pb->vChannel        = alloc_items<size_t>(ptr, max_playbacks);
+        pb->vOffset         = alloc_items<ssize_t>(ptr, max_playbacks);
+        pb->vFadeout        = alloc_items<ssize_t>(ptr, max_playbacks);
+        pb->vFadeOffset     = alloc_items<ssize_t>(ptr, max_playbacks);
+        pb->vVolume         = alloc_items<float>(ptr, max_playbacks);
+        pb->vCursor         = alloc_items<AudioStreamer::cursor_t *>(ptr, max_playbacks);
+        vBuffer             = alloc_items<float>(ptr, STREAM_BUFFER_SIZE);
+
         // Update state
         nSamples            = max_samples;
         nPlayback           = max_playbacks;
+        nPolyphony          = max_playbacks;
+        nActive             = 0;
         for (size_t i=0; i<max_samples; ++i)
             vSamples[i]         = NULL;
 
-        // Init active list (empty)
-        sActive.pHead       = NULL;
-        sActive.pTail       = NULL;
-
-        // Init inactive list (full)
-        playback_t *last    = NULL;
-        sInactive.pHead     = NULL;
+        // All playbacks are inactive
         for (size_t i=0; i<max_playbacks; ++i)
         {
-            playback_t *curr = &vPlayback[i];
-
-            // Initialize fields
-            cleanup(curr);
-
-            // Link
-            curr->pPrev     = last;
-            if (last == NULL)
-                sInactive.pHead = curr;
-            else
-                last->pNext     = curr;
-
-            last            = curr;
+            pb->vCursor[i]      = NULL;
+            cleanup(i);
         }
-        last->pNext         = NULL;
-        sInactive.pTail     = last;
 
         return true;
     }
 
     void SamplePlayer::destroy(bool cascade)
     {
+        // Release all streaming cursors
+        if (pData != NULL)
+            stop();
+
         if (vSamples != NULL)
         {
             // Delete all bound samples
@@ -190,16 +204,35 @@ namespace lsp
         }
         nSamples        = 0;
 
-        if (vPlayback != NULL)
+        if (pData != NULL)
         {
-            delete [] vPlayback;
-            vPlayback       = NULL;
+            free_aligned(pData);
+            pData           = NULL;
         }
+
+        sPlayback.vSample       = NULL;
+        sPlayback.vID           = NULL;
+        sPlayback.vChannel      = NULL;
+        sPlayback.vOffset       = NULL;
+        sPlayback.vFadeout      = NULL;
+        sPlayback.vFadeOffset   = NULL;
+        sPlayback.vVolume       = NULL;
+        sPlayback.vCursor       = NULL;
+        vBuffer         = NULL;
         nPlayback       = 0;
-        sActive.pHead   = NULL;
-        sActive.pTail   = NULL;
-        sInactive.pHead = NULL;
-        sInactive.pTail = NULL;
+        nActive         = 0;
+        nPolyphony      = 0;
+    }
+
+    void SamplePlayer::set_polyphony(size_t polyphony)
+    {
+        if ((polyphony <= 0) || (polyphony > nPlayback))
+            polyphony       = nPlayback;
+        nPolyphony      = polyphony;
+
+        // Drop playbacks that exceed the limit
+        while (nActive > nPolyphony)
+            release(steal());
     }
 
     bool SamplePlayer::bind(size_t id, Sample **sample)
@@ -222,17 +255,12 @@ namespace lsp
         }
 
         // Cleanup all active playbacks associated with this sample
-        playback_t *pb = sActive.pHead;
-        while (pb != NULL)
+        for (size_t i=0; i<nActive; )
         {
-            playback_t *next    = pb->pNext;
-            if (pb->pSample == old)
-            {
-                pb->pSample     = NULL;
-                list_remove(&sActive, pb);
-                list_add_first(&sInactive, pb);
-            }
-            pb          = next;
+            if (sPlayback.vSample[i] == old)
+                release(i);
+            else
+                ++i;
         }
 
         return true;
@@ -278,82 +306,144 @@ namespace lsp
         do_process(dst, samples);
     }
 
+    void SamplePlayer::mix(size_t idx, float *dst, const float *src, size_t count)
+    {
+        playback_t *pb      = &sPlayback;
+        float gain          = pb->vVolume[idx] * fGain;
+        ssize_t fadeout     = pb->vFadeout[idx];
+        if (fadeout < 0)
+        {
+            dsp::scale_add3(dst, src, gain, count);
+            return;
+        }
+
+        // Play the part before the fadeout
+        ssize_t fade_head   = pb->vFadeOffset[idx];
+        if (fade_head < 0)
+        {
+            size_t n            = (ssize_t(count) > -fade_head) ? -fade_head : count;
+            dsp::scale_add3(dst, src, gain, n);
+            dst                += n;
+            src                += n;
+            count              -= n;
+            fade_head          += n;
+        }
+
+        // Apply the fadeout ramp
+        if ((count > 0) && (fade_head < fadeout))
+        {
+            size_t n            = ((fadeout - fade_head) > ssize_t(count)) ? count : fadeout - fade_head;
+            float fgain         = gain / (fadeout + 1);
+            dsp::lramp_add2(dst, src, fgain * (fadeout - fade_head), fgain * (fadeout - fade_head - n), n);
+            fade_head          += n;
+        }
+
+        pb->vFadeOffset[idx]= fade_head;
+    }
+
+    void SamplePlayer::flush(group_t *g, float *dst, size_t count)
+    {
+        switch (g->nItems)
+        {
+            case 1:
+                dsp::scale_add3(dst, g->vSrc[0], g->vGain[0], count);
+                break;
+            case 2:
+                dsp::mix_add2(dst, g->vSrc[0], g->vSrc[1], g->vGain[0], g->vGain[1], count);
+                break;
+            case 3:
+                dsp::mix_add3(dst, g->vSrc[0], g->vSrc[1], g->vSrc[2],
+                        g->vGain[0], g->vGain[1], g->vGain[2], count);
+                break;
+            case 4:
+                dsp::mix_add4(dst, g->vSrc[0], g->vSrc[1], g->vSrc[2], g->vSrc[3],
+                        g->vGain[0], g->vGain[1], g->vGain[2], g->vGain[3], count);
+                break;
+            default:
+                break;
+        }
+        g->nItems       = 0;
+    }
+
     void SamplePlayer::do_process(float *dst, size_t samples)
     {
-        playback_t *pb      = sActive.pHead;
+        playback_t *pb      = &sPlayback;
+        group_t g;
+        g.nItems            = 0;
 
         // Iterate playbacks
-        while (pb != NULL)
+        for (size_t i=0; i<nActive; )
         {
-            // Get next playback
-            playback_t *next    = pb->pNext;
-
             // Check bounds
-            ssize_t src_head    = pb->nOffset;
-            pb->nOffset        += samples;
-            Sample *s           = pb->pSample;
-            ssize_t s_len       = s->length();
+            ssize_t src_head    = pb->vOffset[i];
+            ssize_t offset      = src_head + samples;
+            pb->vOffset[i]      = offset;
+            Sample *s           = pb->vSample[i];
+            AudioStream *as     = s->stream();
+            ssize_t s_len       = (as == NULL) ? s->length() :
+                                  (pb->vCursor[i] != NULL) ? as->samples() : as->head_length();
 
             // Handle sample if active
-            if (pb->nOffset > 0)
+            if (offset > 0)
             {
-//                lsp_trace("pb->nOffset=%d, samples=%d, s_len=%d", int(pb->nOffset), int(samples), int(s_len));
-
                 ssize_t dst_off     = 0;
                 ssize_t count       = samples;
-                if (pb->nOffset < count)
+                if (offset < count)
                 {
                     src_head    = 0;
-                    dst_off     = samples - pb->nOffset;
-                    count       = pb->nOffset;
+                    dst_off     = samples - offset;
+                    count       = offset;
                 }
-                if (pb->nOffset > s_len)
-                    count      += s_len - pb->nOffset;
+                if (offset > s_len)
+                    count      += s_len - offset;
 
                 // Add sample data to the output buffer
                 if (count > 0)
                 {
-//                    lsp_trace("add_multiplied dst_off=%d, src_head=%d, volume=%f, count=%d", int(dst_off), int(src_head), pb->nVolume, int(count));
-                    if (pb->nFadeout < 0)
-                        dsp::scale_add3(&dst[dst_off], s->getBuffer(pb->nChannel, src_head), pb->nVolume * fGain, count);
+                    if (pb->vCursor[i] != NULL)
+                    {
+                        // Read streamed data by portions
+                        for (ssize_t off=0; off < count; )
+                        {
+                            ssize_t to_do   = count - off;
+                            if (to_do > STREAM_BUFFER_SIZE)
+                                to_do           = STREAM_BUFFER_SIZE;
+
+                            pStreamer->read(pb->vCursor[i], vBuffer, src_head + off, to_do);
+                            mix(i, &dst[dst_off + off], vBuffer, to_do);
+                            off            += to_do;
+                        }
+                    }
                     else
                     {
-                        ssize_t fade_head   = pb->nFadeOffset;
-                        float gain          = pb->nVolume * fGain;
-                        float *sp           = s->getBuffer(pb->nChannel, src_head);
-                        float *dp           = &dst[dst_off];
+                        const float *src    = (as == NULL) ?
+                                s->getBuffer(pb->vChannel[i], src_head) :
+                                &as->head(pb->vChannel[i])[src_head];
 
-                        float fgain         = gain / (pb->nFadeout + 1);
-                        for (ssize_t i=0; (i<count) && (fade_head < pb->nFadeout); ++i, ++fade_head)
+                        // Playbacks that cover the whole block are mixed by groups
+                        if ((count == ssize_t(samples)) && (pb->vFadeout[i] < 0))
                         {
-                            if (fade_head < 0)
-                                *(dp++)        += *(sp++) * gain;
-                            else
-                                *(dp++)        += *(sp++) * fgain * (pb->nFadeout - fade_head);
+                            g.vSrc[g.nItems]    = src;
+                            g.vGain[g.nItems]   = pb->vVolume[i] * fGain;
+                            if ((++g.nItems) >= 4)
+                                flush(&g, dst, samples);
                         }
-
-                        pb->nFadeOffset     = fade_head;
+                        else
+                            mix(i, &dst[dst_off], src, count);
                     }
                 }
             }
 
             // Check that there are no samples to process in the future
-            if ((pb->nOffset >= s_len) ||
-                ((pb->nFadeout >= 0) && (pb->nFadeOffset >= pb->nFadeout)))
-            {
-                // Cleanup playback
-                cleanup(pb);
-
-                // Move to inactive
-                list_remove(&sActive, pb);
-                list_add_first(&sInactive, pb);
-
-//                lsp_trace("freed playback %p", pb);
-            }
-
-            // Iterate next playback
-            pb                  = next;
+            if ((offset >= s_len) ||
+                ((pb->vFadeout[i] >= 0) && (pb->vFadeOffset[i] >= pb->vFadeout[i])))
+                release(i);
+            else
+                ++i;
         }
+
+        // Mix the rest of the group
+        flush(&g, dst, samples);
     }
 
     bool SamplePlayer::play(size_t id, size_t channel, float volume, ssize_t delay)
@@ -371,26 +461,24 @@ namespace lsp
         if (channel >= s->channels())
             return false;
 
-        // Try to acquire playback
-        playback_t *pb  = list_remove_first(&sInactive);
-        if (pb == NULL)
-            pb              = list_remove_first(&sActive);
-        if (pb == NULL)
+        // Try to acquire playback, steal one if the polyphony limit is reached
+        if ((nActive >= nPolyphony) && (nActive > 0))
+            release(steal());
+        if (nActive >= nPolyphony)
             return false;
 
-//        lsp_trace("acquired playback %p", pb);
-
         // Now we are ready to activate sample
-        pb->pSample     = s;
-        pb->nID         = id;
-        pb->nChannel    = channel;
-        pb->nVolume     = volume;
-        pb->nOffset     = -delay;
-        pb->nFadeout    = -1;  // No fadeout
-        pb->nFadeOffset = -1; // No cancellation
-
-        // Add the playback to the active list
-        list_insert_from_tail(&sActive, pb);
+        playback_t *pb          = &sPlayback;
+        size_t idx              = nActive++;
+        pb->vSample[idx]        = s;
+        pb->vID[idx]            = id;
+        pb->vChannel[idx]       = channel;
+        pb->vVolume[idx]        = volume;
+        pb->vOffset[idx]        = -delay;
+        pb->vFadeout[idx]       = -1;  // No fadeout
+        pb->vFadeOffset[idx]    = -1; // No cancellation
+        pb->vCursor[idx]        = ((s->stream() != NULL) && (pStreamer != NULL)) ?
+                                    pStreamer->acquire(s->stream(), channel) : NULL;
 
         return true;
     }
@@ -401,66 +489,31 @@ namespace lsp
         if (id >= nSamples)
             return -1;
 
-        ssize_t result = 0;
-
-        // Get first playback
-        playback_t *pb      = sActive.pHead;
-        if (pb == NULL)
-            return result;
+        ssize_t result      = 0;
+        playback_t *pb      = &sPlayback;
 
-        // Stop all playbacks
-        do
+        // Cancel all playbacks
+        for (size_t i=0; i<nActive; ++i)
         {
-            // Remember next playback
-            playback_t *next        = pb->pNext;
-
             // Cancel playback if not already cancelled
-            if ((pb->nID == ssize_t(id)) &&
-                (pb->pSample != NULL) &&
-                (pb->nFadeout < 0))
+            if ((pb->vID[i] == ssize_t(id)) &&
+                (pb->vSample[i] != NULL) &&
+                (pb->vFadeout[i] < 0))
             {
-                pb->nFadeout    = fadeout;
-                pb->nFadeOffset = -delay;
+                pb->vFadeout[i]     = fadeout;
+                pb->vFadeOffset[i]  = -delay;
                 result          ++;
-
-//                lsp_trace("marked playback %p for cancelling", pb);
             }
-
-            // Iterate to next playback
-            pb                      = next;
-        } while (pb != NULL);
+        }
 
         return result;
     }
 
     void SamplePlayer::stop()
     {
-        // Get first playback
-        playback_t *pb      = sActive.pHead;
-        if (pb == NULL)
-            return;
-
-        // Stop all playbacks
-        do
-        {
-            // Cancel playback
-            cleanup(pb);
-
-            // Iterate next playback
-            pb                      = pb->pNext;
-        } while (pb != NULL);
-
-        // Move all data from active list to inactive
-        if (sInactive.pHead == NULL)
-            sInactive.pTail         = sActive.pTail;
-        else
-        {
-            sActive.pTail->pNext    = sInactive.pHead;
-            sInactive.pHead->pPrev  = sActive.pTail;
-        }
-
-        sInactive.pHead     = sActive.pHead;
-        sActive.pHead       = NULL;
-        sActive.pTail       = NULL;
+        // Cancel all playbacks and make them inactive
+        for (size_t i=0; i<nActive; ++i)
+            cleanup(i);
+        nActive             = 0;
     }
 } /* namespace lsp */
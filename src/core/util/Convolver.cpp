@@ -8,6 +8,8 @@
 #include <dsp/dsp.h>
 #include <core/debug.h>
 #include <core/util/Convolver.h>
+#include <core/util/ConvolverCache.h>
+#include <core/util/ConvolverPool.h>
 #include <stdarg.h>
 
 #define CONVOLVER_RANK_FRM_SMALL    (CONVOLVER_RANK_FFT_SMALL - 1)
@@ -16,6 +18,11 @@
 #define CONVOLVER_SMALL_FFT_MASK    (CONVOLVER_SMALL_FFT_SIZE - 1)
 #define CONVOLVER_SMALL_FRM_MASK    (CONVOLVER_SMALL_FRM_SIZE - 1)
 
+#define CONVOLVER_BG_IDX_BITS       16                                  /* Bits of block index in the ticket            */
+#define CONVOLVER_BG_IDX_MASK       ((1 << CONVOLVER_BG_IDX_BITS) - 1)
+#define CONVOLVER_BG_GEN_MASK       0x7fff                              /* Generation bits, the ticket is non-negative  */
+#define CONVOLVER_BG_CLOSED         CONVOLVER_BG_IDX_MASK               /* Block index of the closed job                */
+
 namespace lsp
 {
     Convolver::Convolver()
@@ -32,14 +39,27 @@ namespace lsp
         vBufferEnd      = NULL;
         vConvFirst      = NULL;
         vTask           = NULL;
+        vFdl            = NULL;
 
         nRank           = 0;
         nSteps          = 0;
         nBlocks         = 0;
         nBlocksDone     = 0;
         nDirectSize     = CONVOLVER_SMALL_FRM_SIZE;
+        nFdlHead        = 0;
         pConv           = NULL;
-        pTargetPtr      = NULL;
+        nRtBlocks       = 0;
+
+        vBgTask         = NULL;
+        nBgBlocks       = 0;
+        nBgGen          = 0;
+        nBgNext         = 0;
+        nBgDone         = -1;
+        nBgOwner        = 0;
+        pBgNext         = NULL;
+        bBackground     = false;
+
+        pData           = NULL;
         vData           = NULL;
     }
 
@@ -84,89 +104,91 @@ namespace lsp
 //        fprintf(stderr, "\n");
 //    }
 
-    bool Convolver::init(const float *data, size_t count, size_t rank, float phase)
+    static inline atomic_t bg_ticket(size_t gen, size_t idx)
     {
-        // Check arguments
-        if (count <= 0)
+        return atomic_t(((gen & CONVOLVER_BG_GEN_MASK) << CONVOLVER_BG_IDX_BITS) | idx);
+    }
+
+    ConvolverData::ConvolverData()
+    {
+        pNext           = NULL;
+        nReferences     = 1;
+        nHash           = 0;
+        vSamples        = NULL;
+        nLength         = 0;
+        nRank           = 0;
+        nSteps          = 0;
+        nBlocks         = 0;
+        nDirectSize     = 0;
+        nFrameMax       = 0;
+        vConvFirst      = NULL;
+        vConv           = NULL;
+        vData           = NULL;
+    }
+
+    ConvolverData::~ConvolverData()
+    {
+        free_aligned(vData);
+        vConvFirst      = NULL;
+        vConv           = NULL;
+
+        if (vSamples != NULL)
         {
-            destroy();
-            return true;
+            delete [] vSamples;
+            vSamples        = NULL;
         }
+    }
 
-//        lsp_trace("Initializing convolver this=%p", this);
-
-        // Determine number of buffers
+    size_t ConvolverData::clamp_rank(size_t rank)
+    {
         if (rank < CONVOLVER_RANK_MIN)
-            rank    = CONVOLVER_RANK_MIN;
+            return CONVOLVER_RANK_MIN;
         else if (rank >= CONVOLVER_RANK_MAX)
-            rank    = CONVOLVER_RANK_MAX;
+            return CONVOLVER_RANK_MAX;
+        return rank;
+    }
+
+    ConvolverData *ConvolverData::create(const float *data, size_t count, size_t rank)
+    {
+        if (count <= 0)
+            return NULL;
 
         // Determine size of buffer
+        rank                    = clamp_rank(rank);
         size_t fft_buf_size     = 1 << rank;
         size_t data_buf_size    = fft_buf_size >> 1;
         size_t bins             = (count + data_buf_size - 1) >> (rank - 1);
 
-//        lsp_trace("count = 0x%x, rank=%d, phase=%.3f, bins=%d",
-//                int(count), int(rank), phase, int(bins));
+//        lsp_trace("count = 0x%x, rank=%d, bins=%d",
+//                int(count), int(rank), int(bins));
 
         size_t allocate         = CONVOLVER_SMALL_FRM_SIZE; // Non-FFT first frame
         allocate               += bins * fft_buf_size * 2; // FFT of the convolution
-        allocate               += fft_buf_size * 2; // Temporary buffer (real and imaginary)
-        allocate               += fft_buf_size * 2; // Frame buffer (real only, two frames)
-        allocate               += fft_buf_size * 2; // Task buffer (real and imaginary)
-        allocate               += bins * data_buf_size * 9 + data_buf_size * 6; // Buffer for convolution tail
+        allocate               += data_buf_size; // Temporary buffer (real only)
 
-        uint8_t *pdata          = NULL;
-        float *fptr             = alloc_aligned<float>(pdata, allocate);
+        ConvolverData *cd       = new ConvolverData();
+        if (cd == NULL)
+            return NULL;
+
+        float *fptr             = alloc_aligned<float>(cd->vData, allocate);
         lsp_guard_assert(float *save = fptr);
         if (fptr == NULL)
-            return false;
-//        lsp_trace("Allocated %x floats (%x bytes) at: %p, pdata: %p",
-//                int(allocate), int(allocate * sizeof(float)), fptr, pdata);
-
-        // Replace previously used data by new allocated data
-        destroy();
-        vData               = pdata;
-//        lsp_trace("vData    = %p x 0x%x", vData, int(allocate));
-
-        dsp::fill_zero(fptr, allocate); // Drop all previously used data
-
-        vBufferHead         = fptr;
-        fptr               += bins * data_buf_size * 8;
-//        lsp_trace("vBufferHead = %p x 0x%x", vBufferHead, int(bins * data_buf_size * 8));
-
-        vBufferTail         = fptr;
-        fptr               += bins * data_buf_size + data_buf_size * 6;
-//        lsp_trace("vBufferTail = %p x 0x%x", vBufferTail, int(bins * data_buf_size * 6));
-
-        vBufferEnd          = fptr;
-//        lsp_trace("vBufferEnd = %p", vBufferEnd);
-
-        vBufferPtr          = vBufferHead;
-//        lsp_trace("vBufferPtr = %p", vBufferPtr);
+        {
+            delete cd;
+            return NULL;
+        }
+        dsp::fill_zero(fptr, allocate);
 
-        vConvFirst          = fptr;
+        cd->vConvFirst      = fptr;
         fptr               += CONVOLVER_SMALL_FRM_SIZE;
-//        lsp_trace("vConvFirst = %p x 0x%x", vConvFirst, CONVOLVER_SMALL_FRM_SIZE);
-
-        vTask               = fptr;
-        fptr               += fft_buf_size * 2;
+//        lsp_trace("vConvFirst = %p x 0x%x", cd->vConvFirst, CONVOLVER_SMALL_FRM_SIZE);
 
-//        lsp_trace("vTask = %p x 0x%x", vTask, int(fft_buf_size * 2));
-
-//        lsp_trace("vFrame(prev) = %p x 0x%x", fptr, int(fft_buf_size));
-        fptr               += fft_buf_size; // previous frame (re)
-        vFrame              = fptr;
-        fptr               += fft_buf_size;
-//        lsp_trace("vFrame(curr) = %p x 0x%x", vFrame, int(fft_buf_size));
-
-        vTempBuf            = fptr;
-        fptr               += fft_buf_size * 2;
-//        lsp_trace("vTempBuf = %p x 0x%x", vTempBuf, int(fft_buf_size * 2));
-
-        vConv               = fptr;
+        cd->vConv           = fptr;
         fptr               += bins * fft_buf_size * 2;
-//        lsp_trace("vConv = %p x 0x%x", vConv, int(bins * fft_buf_size * 2));
+//        lsp_trace("vConv = %p x 0x%x", cd->vConv, int(bins * fft_buf_size * 2));
+
+        float *tmp          = fptr;
+        fptr               += data_buf_size;
 
         lsp_assert(fptr <= &save[allocate]);
 
@@ -177,58 +199,52 @@ namespace lsp
             |FFT|FFT|FFT x2|   FFT x4   |       FFT x5           |  . . .
             +---+---+------+------------+------------------------+
          */
-        float *conv_re      = vConv;
+        float *conv_re      = cd->vConv;
         size_t bin_rank     = CONVOLVER_RANK_FFT_SMALL;
         size_t bin_size     = 1 << bin_rank;
         size_t frame_size   = bin_size >> 1;
-        nRank               = rank;
-        nSteps              = 0;
-        nBlocks             = 0;
-        nFrameMax           = frame_size;
-        nDirectSize         = (count > frame_size) ? frame_size : count;
+        cd->nLength         = count;
+        cd->nRank           = rank;
+        cd->nFrameMax       = frame_size;
+        cd->nDirectSize     = (count > frame_size) ? frame_size : count;
 
 //        dump(data, count, "DATA");
 
         // Prepare first frame
-        dsp::copy(vConvFirst, data, nDirectSize);
-//        lsp_trace("dsp::copy dst=%p, src=%p, count=0x%x", vConvFirst, data, int(nDirectSize));
-//        dump(vConvFirst, CONVOLVER_SMALL_FRM_SIZE, "vConvFirst");
+        dsp::copy(cd->vConvFirst, data, cd->nDirectSize);
+//        lsp_trace("dsp::copy dst=%p, src=%p, count=0x%x", cd->vConvFirst, data, int(cd->nDirectSize));
+//        dump(cd->vConvFirst, CONVOLVER_SMALL_FRM_SIZE, "vConvFirst");
 
         // Calculate FFT of first bin
-        dsp::fill_zero(vTempBuf, bin_size*2);
-//        lsp_trace("dsp::fill_zero dst=%p, count=0x%x", vTempBuf, int(bin_size*2));
+        dsp::copy(tmp, data, cd->nDirectSize);
+//        lsp_trace("dsp::copy dst=%p, src=%p, count=0x%x", tmp, data, int(cd->nDirectSize));
 
-        dsp::copy(vTempBuf, data, nDirectSize);
-//        lsp_trace("dsp::copy dst=%p, src=%p, count=0x%x", vTempBuf, data, int(nDirectSize));
-
-//        dump(vTempBuf, 1 << bin_rank, "conv_tmp[0] (%p)", vTempBuf); // dbg
-        dsp::fastconv_parse(conv_re, vTempBuf, bin_rank);
-//        lsp_trace("dsp::fastconv_parse dst=%p, src=%p, rank=0x%x", conv_re, vTempBuf, int(bin_rank));
-//        dump(conv_re, 1 << bin_rank, "conv_fft[0] (%p)", conv_re); // dbg
+//        dump(tmp, 1 << bin_rank, "conv_tmp[0] (%p)", tmp); // dbg
+        dsp::fastconv_parse(conv_re, tmp, bin_rank);
+//        lsp_trace("dsp::fastconv_parse dst=%p, src=%p, rank=0x%x", conv_re, tmp, int(bin_rank));
 //        dump_fastconv(conv_re, bin_rank, "conv_img[0] (%p)", conv_re); // dbg
-//        dump_fastconv(conv_re, bin_rank, "conv[0x%x] (%p)", (conv_re - vConv) / CONVOLVER_SMALL_FFT_SIZE, conv_re); // dbg
 
         // Move pointers
         data               += frame_size;
-        count              -= nDirectSize;
+        count              -= cd->nDirectSize;
         conv_re            += bin_size * 2;
 
-        size_t i_dbg        = 1;
         while (count > 0)
         {
             size_t to_do        = (count > frame_size) ? frame_size : count;
-            nFrameMax           = frame_size;
-
-            // Calculate FFT
-            dsp::fill_zero(vTempBuf, bin_size*2);
-//            lsp_trace("dsp::fill_zero dst=%p, count=0x%x", vTempBuf, int(bin_size*2));
-            dsp::copy(vTempBuf, data, to_do);
-//            lsp_trace("dsp::copy dst=%p, src=%p, count=0x%x", vTempBuf, data, int(to_do));
-//            dump(vTempBuf, 1 << bin_rank, "conv_tmp[%d] (%p)", int(i_dbg), vTempBuf); // dbg
-            dsp::fastconv_parse(conv_re, vTempBuf, bin_rank);
-//            lsp_trace("dsp::fastconv_parse dst=%p, src=%p, rank=0x%x", conv_re, vTempBuf, int(bin_rank));
-//            dump(conv_re, 1 << bin_rank, "conv_fft[%d] (%p)", int(i_dbg), conv_re);
-//            dump_fastconv(conv_re, bin_rank, "conv[0x%x] (%p)", (conv_re - vConv) / CONVOLVER_SMALL_FFT_SIZE, conv_re); // dbg
+            cd->nFrameMax       = frame_size;
+
+            // Calculate FFT, only the last frame needs to be padded with zeros
+            if (to_do < frame_size)
+            {
+                dsp::copy(tmp, data, to_do);
+                dsp::fill_zero(&tmp[to_do], frame_size - to_do);
+                dsp::fastconv_parse(conv_re, tmp, bin_rank);
+            }
+            else
+                dsp::fastconv_parse(conv_re, data, bin_rank);
+//            lsp_trace("dsp::fastconv_parse dst=%p, src=%p, rank=0x%x", conv_re, data, int(bin_rank));
+//            dump_fastconv(conv_re, bin_rank, "conv[0x%x] (%p)", (conv_re - cd->vConv) / CONVOLVER_SMALL_FFT_SIZE, conv_re); // dbg
 
             // Move pointers
             data               += frame_size;
@@ -238,25 +254,167 @@ namespace lsp
             // Update size of bin
             if (bin_rank < rank)
             {
-                nSteps         ++;
+                cd->nSteps     ++;
                 bin_rank       ++;
                 bin_size      <<= 1;
                 frame_size    <<= 1;
             }
             else
-                nBlocks        ++;
-            i_dbg++;
+                cd->nBlocks    ++;
+        }
+
+        return cd;
+    }
+
+    bool Convolver::init(const float *data, size_t count, size_t rank, float phase, bool background)
+    {
+        // Check arguments
+        if (count <= 0)
+        {
+            destroy();
+            return true;
+        }
+
+        // Prepare private convolution data
+        ConvolverData *cd   = ConvolverData::create(data, count, rank);
+        if (cd == NULL)
+            return false;
+
+        bool res            = init(cd, phase, background);
+        ConvolverCache::release(cd);
+        return res;
+    }
+
+    bool Convolver::init(ConvolverData *data, float phase, bool background)
+    {
+        // Check arguments
+        if (data == NULL)
+        {
+            destroy();
+            return true;
+        }
+
+//        lsp_trace("Initializing convolver this=%p", this);
+
+        // Determine size of buffer
+        size_t fft_buf_size     = 1 << data->nRank;
+        size_t data_buf_size    = fft_buf_size >> 1;
+
+        size_t allocate         = fft_buf_size * 2; // Temporary buffer (real and imaginary)
+        allocate               += fft_buf_size * 2; // Frame buffer (real only, two frames)
+        allocate               += fft_buf_size * 2; // Task buffer (real and imaginary)
+        allocate               += data->nBlocks * fft_buf_size * 2; // Frequency-domain delay line (real and imaginary)
+        allocate               += data_buf_size * 12; // Buffer for convolution tail
+        if (background)
+            allocate               += fft_buf_size * 4; // Two background task buffers (real and imaginary)
+
+        uint8_t *pdata          = NULL;
+        float *fptr             = alloc_aligned<float>(pdata, allocate);
+        lsp_guard_assert(float *save = fptr);
+        if (fptr == NULL)
+            return false;
+//        lsp_trace("Allocated %x floats (%x bytes) at: %p, pdata: %p",
+//                int(allocate), int(allocate * sizeof(float)), fptr, pdata);
+
+        // Replace previously used data by new allocated data
+        ConvolverCache::acquire(data);
+        destroy();
+        vData               = pdata;
+        pData               = data;
+//        lsp_trace("vData    = %p x 0x%x", vData, int(allocate));
+
+        dsp::fill_zero(fptr, allocate); // Drop all previously used data
+
+        vBufferHead         = fptr;
+        fptr               += data_buf_size * 8;
+//        lsp_trace("vBufferHead = %p x 0x%x", vBufferHead, int(data_buf_size * 8));
+
+        vBufferTail         = fptr;
+        fptr               += data_buf_size * 4;
+//        lsp_trace("vBufferTail = %p x 0x%x", vBufferTail, int(data_buf_size * 4));
+
+        vBufferEnd          = fptr;
+//        lsp_trace("vBufferEnd = %p", vBufferEnd);
+
+        vBufferPtr          = vBufferHead;
+//        lsp_trace("vBufferPtr = %p", vBufferPtr);
+
+        vTask               = fptr;
+        fptr               += fft_buf_size * 2;
+
+//        lsp_trace("vTask = %p x 0x%x", vTask, int(fft_buf_size * 2));
+
+//        lsp_trace("vFrame(prev) = %p x 0x%x", fptr, int(fft_buf_size));
+        fptr               += fft_buf_size; // previous frame (re)
+        vFrame              = fptr;
+        fptr               += fft_buf_size;
+//        lsp_trace("vFrame(curr) = %p x 0x%x", vFrame, int(fft_buf_size));
+
+        vTempBuf            = fptr;
+        fptr               += fft_buf_size * 2;
+//        lsp_trace("vTempBuf = %p x 0x%x", vTempBuf, int(fft_buf_size * 2));
+
+        vFdl                = fptr;
+        fptr               += data->nBlocks * fft_buf_size * 2;
+//        lsp_trace("vFdl = %p x 0x%x", vFdl, int(data->nBlocks * fft_buf_size * 2));
+
+        if (background)
+        {
+            vBgTask             = fptr;
+            fptr               += fft_buf_size * 4;
         }
 
-//        lsp_assert_msg((conv_re <= &cptr[allocate]),
-//                "conv_re (%p) is after end of allocated data (%p)",
-//                conv_re, &cptr[allocate]);
+        lsp_assert(fptr <= &save[allocate]);
+
+        // Attach to convolution data
+        vConvFirst          = data->vConvFirst;
+        vConv               = data->vConv;
+        nRank               = data->nRank;
+        nSteps              = data->nSteps;
+        nBlocks             = data->nBlocks;
+        nDirectSize         = data->nDirectSize;
+        nFrameMax           = data->nFrameMax;
+        nFdlHead            = 0;
+
+        // Tail convolution follows the raising steps
+        pConv               = vConv + CONVOLVER_SMALL_FFT_SIZE * 2;
+        for (size_t i=0; i<nSteps; ++i)
+            pConv              += 1 << (CONVOLVER_RANK_FFT_SMALL + i + 1);
 
         // Initialize frame size
         nFrameSize          = size_t(phase * nFrameMax) & (~CONVOLVER_SMALL_FRM_MASK);
         if (nFrameSize >= nFrameMax)
             nFrameSize          = 0;
-        nBlocksDone         = nBlocks;
+
+        // Distribute tail blocks between RT thread and background workers
+        nRtBlocks           = nBlocks;
+        nBgBlocks           = 0;
+        if ((background) && (nBlocks > CONVOLVER_RT_BLOCKS))
+        {
+            // Block index should fit into the ticket
+            nBgBlocks           = nBlocks - CONVOLVER_RT_BLOCKS;
+            if (nBgBlocks >= CONVOLVER_BG_CLOSED)
+                nBgBlocks           = CONVOLVER_BG_CLOSED - 1;
+            nRtBlocks           = nBlocks - nBgBlocks;
+        }
+        nBlocksDone         = nRtBlocks;
+        nBgGen              = 0;
+        nBgNext             = bg_ticket(nBgGen, CONVOLVER_BG_CLOSED);
+        nBgDone             = -1;
+
+        if (nBgBlocks > 0)
+        {
+            bBackground         = ConvolverPool::attach(this);
+            if (bBackground)
+                start_background();
+            else
+            {
+                lsp_trace("Failed to attach to the pool of background workers, processing all tail blocks in RT thread");
+                nRtBlocks           = nBlocks;
+                nBgBlocks           = 0;
+                nBlocksDone         = nRtBlocks;
+            }
+        }
 
 //        lsp_trace("nSteps   = 0x%x", int(nSteps));
 //        lsp_trace("nBlocks  = 0x%x", int(nBlocks));
@@ -271,7 +429,20 @@ namespace lsp
 //        lsp_trace("Convolver::destroy this=%p", this);
 //        lsp_trace("free_aligned vData=%p", vData);
 
+        // Detach from the pool first: the worker may still access the data
+        if (bBackground)
+        {
+            atomic_swap(&nBgNext, bg_ticket(nBgGen, CONVOLVER_BG_CLOSED));
+            ConvolverPool::detach(this);
+            bBackground     = false;
+        }
+
         free_aligned(vData);
+        if (pData != NULL)
+        {
+            ConvolverCache::release(pData);
+            pData           = NULL;
+        }
 
         nFrameSize      = 0;
         nFrameMax       = 0;
@@ -285,14 +456,92 @@ namespace lsp
         vBufferEnd      = NULL;
         vConvFirst      = NULL;
         vTask           = NULL;
+        vFdl            = NULL;
         pConv           = NULL;
-        pTargetPtr      = NULL;
+        vBgTask         = NULL;
 
         nRank           = 0;
         nSteps          = 0;
         nBlocks         = 0;
         nBlocksDone     = 0;
         nDirectSize     = 0;
+        nFdlHead        = 0;
+        nRtBlocks       = 0;
+        nBgBlocks       = 0;
+        nBgGen          = 0;
+        nBgNext         = 0;
+        nBgDone         = -1;
+    }
+
+    bool Convolver::bg_pending() const
+    {
+        return size_t(nBgNext & CONVOLVER_BG_IDX_MASK) < nBgBlocks;
+    }
+
+    atomic_t Convolver::claim_block()
+    {
+        while (true)
+        {
+            atomic_t ticket = nBgNext;
+            if (size_t(ticket & CONVOLVER_BG_IDX_MASK) >= nBgBlocks)
+                return -1;
+            if (atomic_cas(&nBgNext, ticket, ticket + 1))
+                return ticket;
+        }
+    }
+
+    void Convolver::process_block(atomic_t ticket)
+    {
+        // Blocks are accumulated into two buffers by turns: the buffer that holds the sum of
+        // all previous blocks stays untouched while the next block is processed, so the RT thread
+        // can take the completed prefix of blocks at any moment without waiting for the worker
+        size_t idx      = ticket & CONVOLVER_BG_IDX_MASK;
+        size_t len      = nFrameMax << 2;
+        float *dst      = &vBgTask[(idx & 1) * len];
+        if (idx > 0)
+            dsp::copy(dst, &vBgTask[((idx - 1) & 1) * len], len);
+        else
+            dsp::fill_zero(dst, len);
+
+        accumulate_block(dst, nRtBlocks + idx);
+        atomic_swap(&nBgDone, ticket + 1);
+    }
+
+    void Convolver::accumulate_block(float *dst, size_t idx)
+    {
+        // Block of index idx is applied to the input spectrum delayed by (idx - 1) frames
+        size_t off      = (nFdlHead + nBlocks + 1 - idx) % nBlocks;
+        dsp::fastconv_accumulate(dst, &vFdl[off * (nFrameMax << 2)], &pConv[idx * (nFrameMax << 2)], nRank);
+    }
+
+    void Convolver::start_background()
+    {
+        nBgGen          = (nBgGen + 1) & CONVOLVER_BG_GEN_MASK;
+        atomic_swap(&nBgNext, bg_ticket(nBgGen, 0));
+        ConvolverPool::wakeup();
+    }
+
+    void Convolver::complete_background()
+    {
+        // Close the job: the worker can not claim blocks any more
+        atomic_swap(&nBgNext, bg_ticket(nBgGen, CONVOLVER_BG_CLOSED));
+
+        // Take the sum of blocks completed by the worker in this frame. The RT thread never
+        // waits: it processes the block that is still processed by the worker (if any)
+        // and all blocks that were never claimed
+        atomic_t done   = nBgDone;
+        size_t first    = 0;
+        if ((done >= 0) && (size_t(done >> CONVOLVER_BG_IDX_BITS) == nBgGen))
+            first           = done & CONVOLVER_BG_IDX_MASK;
+
+        if (first > 0)
+        {
+            size_t len      = nFrameMax << 2;
+            dsp::add2(vTask, &vBgTask[((first - 1) & 1) * len], len);
+        }
+
+        for (size_t i=first; i<nBgBlocks; ++i)
+            accumulate_block(vTask, nRtBlocks + i);
     }
 
     void Convolver::process(float *dst, const float *src, size_t count)
@@ -330,7 +579,7 @@ namespace lsp
                 // Apply higher-order convolutions
                 size_t frame_id     = nFrameSize >> CONVOLVER_RANK_FRM_SMALL;
                 size_t frm_mask     = ((frame_id-1) ^ frame_id);
-                float *conv_re      = &vConv[CONVOLVER_SMALL_FFT_SIZE*2];
+                const float *conv_re     = &vConv[CONVOLVER_SMALL_FFT_SIZE*2];
                 size_t rank         = CONVOLVER_RANK_FFT_SMALL;
 
                 for (size_t i=0; i<nSteps; ++i)
@@ -357,49 +606,40 @@ namespace lsp
                 // Start of frame and need to perform tail convolution?
                 if ((nFrameSize == 0) && (nBlocks > 0))
                 {
-                    // Apply convolution
+                    // All delayed spectra should be accumulated until now
+                    while (nBlocksDone < nRtBlocks)
+                        accumulate_block(vTask, nBlocksDone++);
+                    if (nBgBlocks > 0)
+                        complete_background();
+
+                    // Push the spectrum of the last frame to the delay line and apply the first block
+                    nFdlHead        = (nFdlHead + 1) % nBlocks;
+                    float *fdl      = &vFdl[nFdlHead * (nFrameMax << 2)];
 //                    lsp_trace("dsp::fastconv_parse dst=%p, src=%p, rank=0x%x",
-//                            vTask, vFrame - nFrameMax, int(nRank));
-                    dsp::fastconv_parse(vTask, vFrame - nFrameMax, nRank);
-
-                    // Set number of blocks done
-                    nBlocksDone     = 0;
-                    pConv           = conv_re;
-                    pTargetPtr      = vBufferPtr;
+//                            fdl, vFrame - nFrameMax, int(nRank));
+                    dsp::fastconv_parse(fdl, vFrame - nFrameMax, nRank);
+                    dsp::fastconv_accumulate(vTask, fdl, pConv, nRank);
+
+                    // Do the only reverse FFT for all tail blocks and apply it to the history buffer
+                    dsp::fastconv_restore(vTempBuf, vTask, nRank);
+                    dsp::add2(vBufferPtr, vTempBuf, nFrameMax << 1);
+                    dsp::fill_zero(vTask, nFrameMax << 2);
+
+                    // Start accumulation of delayed spectra for the next frame
+                    nBlocksDone     = 1;
+                    if (nBgBlocks > 0)
+                        start_background();
                 }
 
-                // Do tail convolution
-                if (nBlocksDone < nBlocks)
+                // Accumulate delayed spectra, blocks are spread over the frame
+                if (nBlocksDone < nRtBlocks)
                 {
-                    size_t tgt_block    = ((nFrameSize + CONVOLVER_SMALL_FRM_SIZE) * nBlocks) / nFrameMax;
-                    if (tgt_block > nBlocks)
-                        tgt_block           = nBlocks;
+                    size_t tgt_block    = 1 + ((nFrameSize + CONVOLVER_SMALL_FRM_SIZE) * (nRtBlocks - 1)) / nFrameMax;
+                    if (tgt_block > nRtBlocks)
+                        tgt_block           = nRtBlocks;
 
                     while (nBlocksDone < tgt_block)
-                    {
-                        // Do multiplication in frequency domain, reverse FFT and apply it to the history buffer
-//                        lsp_trace("fastconv_apply_block dst=0x%x, conv=0x%x, fptr=-0x%x, n=%d %d/%d",
-//                                    (pTargetPtr-vBufferHead)/CONVOLVER_SMALL_FRM_SIZE,
-//                                    (pConv-vConv)/CONVOLVER_SMALL_FFT_SIZE,
-//                                    0, 1 << (nRank - CONVOLVER_RANK_FFT_SMALL),
-//                                    nBlocksDone, nBlocks
-//                                    );
-//                        lsp_trace("dsp::fastconv_apply dst=%p, tmp=%p, conv1=%p, conv2=%p, rank=0x%x",
-//                                pTargetPtr, vTempBuf, vTask, pConv, int(nRank));
-//                        if (vBufferEnd < &pTargetPtr[1 << nRank])
-//                        {
-//                            lsp_error("Failed assertion: vBufferEnd >= &pTargetPtr[1 << nRank]");
-//                        }
-                        dsp::fastconv_apply(pTargetPtr, vTempBuf, vTask, pConv, nRank);
-
-                        // Update pointers
-                        pConv              += nFrameMax << 2;
-                        pTargetPtr         += nFrameMax;
-                        nBlocksDone        ++;
-
-//                        if (pTargetPtr >= vBufferEnd)
-//                            lsp_trace("pTargetPtr(%p) >= vBufferEnd(%p)", pTargetPtr, vBufferEnd);
-                    }
+                        accumulate_block(vTask, nBlocksDone++);
                 }
             }
 
@@ -452,24 +692,12 @@ namespace lsp
             // Check that buffer head is required to be moved
             if (vBufferPtr >= vBufferTail)
             {
-                float *sptr = ((pTargetPtr == NULL) || (pTargetPtr >= vBufferPtr)) ?
-                        vBufferPtr : pTargetPtr;
-
-                size_t hist_size    = vBufferEnd - sptr;
-                size_t free_size    = sptr - vBufferHead;
-
+                size_t hist_size    = vBufferEnd - vBufferPtr;
 //                lsp_trace("dsp::move dst=%p src=%p, count=0x%x", vBufferHead, vBufferPtr, int(hist_size));
-                dsp::move(vBufferHead, sptr, hist_size);
+                dsp::move(vBufferHead, vBufferPtr, hist_size);
 //                lsp_trace("dsp::fill_zero dst=%p, count=0x%x", &vBufferHead[hist_size], int(vBufferPtr - vBufferHead));
-                dsp::fill_zero(&vBufferHead[hist_size], free_size);
-                if (pTargetPtr != NULL)
-                    pTargetPtr         -= free_size;
-                vBufferPtr         -= free_size;
-
-//                if ((vBufferPtr < vBufferHead) || (pTargetPtr < vBufferHead))
-//                {
-//                    lsp_error("Failed assertion: (vBufferPtr >= vBufferHead) && (pTargetPtr >= vBufferHead)");
-//                }
+                dsp::fill_zero(&vBufferHead[hist_size], vBufferPtr - vBufferHead);
+                vBufferPtr          = vBufferHead;
             }
         }
 
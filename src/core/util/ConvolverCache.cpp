@@ -0,0 +1,142 @@
+/*
+ * ConvolverCache.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <string.h>
+#include <core/debug.h>
+#include <core/ipc/Mutex.h>
+#include <core/util/ConvolverCache.h>
+
+#define FNV_OFFSET_BASIS        uint64_t(0xcbf29ce484222325ULL)
+#define FNV_PRIME               uint64_t(0x100000001b3ULL)
+
+namespace lsp
+{
+    static ipc::Mutex       cache_lock;
+    static ConvolverData   *cache_root = NULL;
+
+    static uint64_t ir_hash(const float *data, size_t count, size_t rank)
+    {
+        // FNV-1a hash of the sample data
+        const uint32_t *p   = reinterpret_cast<const uint32_t *>(data);
+        uint64_t h          = FNV_OFFSET_BASIS;
+        for (size_t i=0; i<count; ++i)
+            h                   = (h ^ p[i]) * FNV_PRIME;
+        return (h ^ rank) * FNV_PRIME;
+    }
+
+    ConvolverData *ConvolverCache::find(uint64_t hash, const float *data, size_t count, size_t rank)
+    {
+        for (ConvolverData *cd = cache_root; cd != NULL; cd = cd->pNext)
+        {
+            if ((cd->nHash != hash) || (cd->nLength != count) || (cd->nRank != rank))
+                continue;
+            // Hash collisions are possible, compare the whole impulse response
+            if (memcmp(cd->vSamples, data, count * sizeof(float)) != 0)
+                continue;
+            return cd;
+        }
+        return NULL;
+    }
+
+    ConvolverData *ConvolverCache::get(const float *data, size_t count, size_t rank)
+    {
+        if (count <= 0)
+            return NULL;
+
+        rank                = ConvolverData::clamp_rank(rank);
+        uint64_t hash       = ir_hash(data, count, rank);
+
+        // Lookup for existing data
+        cache_lock.lock();
+        ConvolverData *cd   = find(hash, data, count, rank);
+        if (cd != NULL)
+            ++cd->nReferences;
+        cache_lock.unlock();
+        if (cd != NULL)
+            return cd;
+
+        // Compute the data without holding the lock
+        ConvolverData *res  = ConvolverData::create(data, count, rank);
+        if (res == NULL)
+            return NULL;
+        res->vSamples       = new float[count];
+        if (res->vSamples == NULL)
+        {
+            delete res;
+            return NULL;
+        }
+        memcpy(res->vSamples, data, count * sizeof(float));
+        res->nHash          = hash;
+
+        // Store the data in cache, the same data could be stored by concurrent thread
+        cache_lock.lock();
+        cd                  = find(hash, data, count, rank);
+        if (cd != NULL)
+            ++cd->nReferences;
+        else
+        {
+            res->pNext          = cache_root;
+            cache_root          = res;
+        }
+        cache_lock.unlock();
+
+        if (cd == NULL)
+            return res;
+
+        delete res;
+        return cd;
+    }
+
+    ConvolverData *ConvolverCache::acquire(ConvolverData *data)
+    {
+        if (data == NULL)
+            return NULL;
+
+        cache_lock.lock();
+        ++data->nReferences;
+        cache_lock.unlock();
+
+        return data;
+    }
+
+    void ConvolverCache::release(ConvolverData *data)
+    {
+        if (data == NULL)
+            return;
+
+        // Remove data from cache under lock, uncached data is not present in the list
+        cache_lock.lock();
+        bool remove         = (--data->nReferences) <= 0;
+        if ((remove) && (data->vSamples != NULL))
+        {
+            for (ConvolverData **pcd = &cache_root; *pcd != NULL; pcd = &(*pcd)->pNext)
+            {
+                if (*pcd != data)
+                    continue;
+                *pcd                = data->pNext;
+                break;
+            }
+        }
+        cache_lock.unlock();
+
+        if (remove)
+            delete data;
+    }
+
+    size_t ConvolverCache::size()
+    {
+        size_t n    = 0;
+
+        cache_lock.lock();
+        for (ConvolverData *cd = cache_root; cd != NULL; cd = cd->pNext)
+            ++n;
+        cache_lock.unlock();
+
+        return n;
+    }
+
+} /* namespace lsp */
@@ -0,0 +1,199 @@
+/*
+ * ConvolverPool.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <core/debug.h>
+#include <core/ipc/Mutex.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/Semaphore.h>
+#include <core/util/ConvolverPool.h>
+
+namespace lsp
+{
+    static ipc::Mutex       pool_control;                           // Serializes attach() and detach()
+    static ipc::Mutex       pool_lock;                              // Guards the list of convolvers
+    static ipc::Semaphore   pool_wakeup;                            // Wakes up worker threads
+    static Convolver       *pool_root = NULL;                       // List of attached convolvers
+    static ipc::Thread     *pool_threads[CONVOLVER_POOL_THREADS_MAX];
+    static size_t           pool_nthreads = 0;
+    static volatile atomic_t pool_suspended = 0;
+
+    status_t ConvolverPool::worker(void *arg)
+    {
+        // Real-time scheduling may be not permitted, keep the inherited priority then
+        if (ipc::Thread::set_realtime() != STATUS_OK)
+            lsp_trace("Could not switch convolver worker to real-time scheduling");
+
+        // Enable DSP context for the worker thread
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+
+        while (!ipc::Thread::is_cancelled())
+        {
+            // Wait until some RT thread starts the next frame
+            if (!pool_wakeup.wait())
+                break;
+
+            // Process jobs until there are no more pending jobs
+            Convolver *cv;
+            while ((!ipc::Thread::is_cancelled()) && ((cv = acquire_job()) != NULL))
+                process_job(cv);
+        }
+
+        dsp::finish(&ctx);
+        return STATUS_OK;
+    }
+
+    Convolver *ConvolverPool::acquire_job()
+    {
+        Convolver *res  = NULL;
+
+        pool_lock.lock();
+        for (Convolver *cv = pool_root; cv != NULL; cv = cv->pBgNext)
+        {
+            if ((cv->bg_pending()) && (atomic_cas(&cv->nBgOwner, 0, 1)))
+            {
+                res             = cv;
+                break;
+            }
+        }
+        pool_lock.unlock();
+
+        return res;
+    }
+
+    void ConvolverPool::process_job(Convolver *cv)
+    {
+        // The convolver can not be detached until the owner is released
+        atomic_t ticket;
+        while ((ticket = cv->claim_block()) >= 0)
+        {
+            while ((pool_suspended) && (!ipc::Thread::is_cancelled()))
+                ipc::Thread::sleep(1);
+            cv->process_block(ticket);
+        }
+
+        atomic_swap(&cv->nBgOwner, 0);
+    }
+
+    bool ConvolverPool::attach(Convolver *cv)
+    {
+        pool_control.lock();
+
+        // Start worker threads if they are not started yet
+        if (pool_nthreads <= 0)
+        {
+            size_t n        = ipc::Thread::system_cores();
+            if (n > CONVOLVER_POOL_THREADS_MAX)
+                n               = CONVOLVER_POOL_THREADS_MAX;
+            else if (n <= 0)
+                n               = 1;
+
+            for (size_t i=0; i<n; ++i)
+            {
+                ipc::Thread *t  = new ipc::Thread(worker, NULL);
+                if (t == NULL)
+                    break;
+                if (t->start() != STATUS_OK)
+                {
+                    delete t;
+                    break;
+                }
+                pool_threads[pool_nthreads++]   = t;
+            }
+
+            if (pool_nthreads <= 0)
+            {
+                pool_control.unlock();
+                return false;
+            }
+
+            lsp_trace("started %d convolver worker threads", int(pool_nthreads));
+        }
+
+        // Add convolver to the list
+        pool_lock.lock();
+        cv->nBgOwner    = 0;
+        cv->pBgNext     = pool_root;
+        pool_root       = cv;
+        pool_lock.unlock();
+
+        pool_control.unlock();
+        return true;
+    }
+
+    void ConvolverPool::detach(Convolver *cv)
+    {
+        pool_control.lock();
+
+        // Remove convolver from the list, workers can not acquire it any more
+        pool_lock.lock();
+        for (Convolver **pcv = &pool_root; *pcv != NULL; pcv = &(*pcv)->pBgNext)
+        {
+            if (*pcv != cv)
+                continue;
+            *pcv            = cv->pBgNext;
+            break;
+        }
+        cv->pBgNext     = NULL;
+        pool_lock.unlock();
+
+        // Wait until the worker that processes the convolver releases it
+        while (cv->nBgOwner != 0)
+            ipc::Thread::sleep(1);
+
+        if (pool_root == NULL)
+            stop();
+
+        pool_control.unlock();
+    }
+
+    void ConvolverPool::stop()
+    {
+        for (size_t i=0; i<pool_nthreads; ++i)
+            pool_threads[i]->cancel();
+        for (size_t i=0; i<pool_nthreads; ++i)
+            pool_wakeup.post();
+
+        for (size_t i=0; i<pool_nthreads; ++i)
+        {
+            pool_threads[i]->join();
+            delete pool_threads[i];
+            pool_threads[i]     = NULL;
+        }
+        pool_nthreads   = 0;
+
+        while (pool_wakeup.try_wait())
+            /* nothing */ ;
+
+        lsp_trace("stopped convolver worker threads");
+    }
+
+    void ConvolverPool::wakeup()
+    {
+        pool_wakeup.post();
+    }
+
+    void ConvolverPool::suspend()
+    {
+        atomic_swap(&pool_suspended, 1);
+    }
+
+    void ConvolverPool::resume()
+    {
+        atomic_swap(&pool_suspended, 0);
+    }
+
+    size_t ConvolverPool::threads()
+    {
+        pool_control.lock();
+        size_t n        = pool_nthreads;
+        pool_control.unlock();
+        return n;
+    }
+
+} /* namespace lsp */
@@ -7,8 +7,10 @@
 
 #include <dsp/dsp.h>
 #include <core/util/Dither.h>
+#include <core/util/Randomizer.h>
 
 #define DITHER_8BIT         0.00390625  /* 1 / 256 */
+#define DITHER_BUF_SIZE     0x200
 
 namespace lsp
 {
@@ -17,12 +19,33 @@ namespace lsp
         nBits   = 0;
         fGain   = 1.0f;
         fDelta  = 0.0f;
+
+        // The generator produces zeros until it is initialized
+        for (size_t i=0; i<4; ++i)
+        {
+            sRandom.x[i]    = 0;
+            sRandom.y[i]    = 0;
+            sRandom.z[i]    = 0;
+            sRandom.w[i]    = 0;
+        }
     }
 
     Dither::~Dither()
     {
     }
 
+    void Dither::init()
+    {
+        Randomizer rnd;
+        rnd.init();
+        init(rnd.random(RND_LINEAR) * 0x7fffffff);
+    }
+
+    void Dither::init(uint32_t seed)
+    {
+        dsp::init_prng(&sRandom, seed);
+    }
+
     void Dither::set_bits(size_t bits)
     {
         nBits   = bits;
@@ -48,8 +71,21 @@ namespace lsp
             return;
         }
 
-        while (count--)
-            *(out++) = *(in++) * fGain + (sRandom.random(RND_TRIANGLE) - 0.5f) * fDelta;
+        // Triangular random values in range of (-1, 1) are scaled to (-0.5*fDelta, 0.5*fDelta)
+        float noise[DITHER_BUF_SIZE] __lsp_aligned16;
+
+        while (count > 0)
+        {
+            size_t to_do    = (count > DITHER_BUF_SIZE) ? DITHER_BUF_SIZE : count;
+
+            dsp::rand_triangle(noise, &sRandom, to_do);
+            dsp::scale3(out, in, fGain, to_do);
+            dsp::scale_add3(out, noise, 0.5f * fDelta, to_do);
+
+            out            += to_do;
+            in             += to_do;
+            count          -= to_do;
+        }
     }
 
 } /* namespace lsp */
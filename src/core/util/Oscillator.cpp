@@ -10,6 +10,10 @@
 #include <core/util/Oscillator.h>
 
 #define PROCESS_BUF_LIMIT_SIZE  (12 * 1024) // Multiple of 3, 4 and 8
+#define WAVETABLE_RANK          12
+#define WAVETABLE_SIZE          (1 << WAVETABLE_RANK)
+#define WAVETABLE_STRIDE        (WAVETABLE_SIZE + 4) // Period, copy of the first sample and alignment
+#define WAVETABLE_LEVELS        (WAVETABLE_RANK - 1) // Level i contains (WAVETABLE_SIZE / 4) >> i harmonics
 
 namespace lsp
 {
@@ -79,6 +83,16 @@ namespace lsp
         sParabolic.fWaveDC          = 0.0f;
         sParabolic.fBLPeakAtten     = 0.0f;
 
+        sWaveTable.bEnabled         = false;
+        sWaveTable.bRebuild         = true;
+        sWaveTable.nLevels          = 0;
+        sWaveTable.vTable           = NULL;
+        sWaveTable.pLevel           = NULL;
+        sWaveTable.nShift           = 0;
+        sWaveTable.nOffset          = 0;
+        sWaveTable.fScale           = 0.0f;
+        sWaveTable.fDC              = 0.0f;
+
         nOversampling               = 0;
         enOverMode                  = OM_NONE;
         vProcessBuffer              = NULL;
@@ -96,7 +110,7 @@ namespace lsp
 
     bool Oscillator::init()
     {
-        size_t samples      = PROCESS_BUF_LIMIT_SIZE + PROCESS_BUF_LIMIT_SIZE;
+        size_t samples      = PROCESS_BUF_LIMIT_SIZE + PROCESS_BUF_LIMIT_SIZE + WAVETABLE_LEVELS * WAVETABLE_STRIDE;
         pData               = new uint8_t[samples * sizeof(float) + DEFAULT_ALIGN];
 
         uint8_t *ptr        = ALIGN_PTR(pData, DEFAULT_ALIGN);
@@ -104,6 +118,12 @@ namespace lsp
         ptr                += PROCESS_BUF_LIMIT_SIZE * sizeof(float);
         vSynthBuffer        = reinterpret_cast<float *>(ptr);
         ptr                += PROCESS_BUF_LIMIT_SIZE * sizeof(float);
+        sWaveTable.vTable   = reinterpret_cast<float *>(ptr);
+        ptr                += WAVETABLE_LEVELS * WAVETABLE_STRIDE * sizeof(float);
+
+        sWaveTable.nLevels  = 0;
+        sWaveTable.pLevel   = NULL;
+        sWaveTable.bRebuild = true;
 
         lsp_assert(ptr <= &pData[samples * sizeof(float) + DEFAULT_ALIGN]);
 
@@ -123,8 +143,11 @@ namespace lsp
             delete [] pData;
             pData = NULL;
         }
-        vProcessBuffer = NULL;
-        vSynthBuffer   = NULL;
+        vProcessBuffer      = NULL;
+        vSynthBuffer        = NULL;
+        sWaveTable.vTable   = NULL;
+        sWaveTable.pLevel   = NULL;
+        sWaveTable.nLevels  = 0;
     }
 
     void Oscillator::update_settings()
@@ -357,9 +380,233 @@ namespace lsp
         nOversampling       = sOver.get_oversampling();
         nFreqCtrlWord_Over  = nFreqCtrlWord / nOversampling;
 
+        update_wavetable();
+
         bSync               = false;
     }
 
+    bool Oscillator::wavetable_supported() const
+    {
+        switch (enFunction)
+        {
+            case FG_SINE:
+            case FG_COSINE:
+            case FG_SQUARED_SINE:
+            case FG_SQUARED_COSINE:
+            case FG_BL_RECTANGULAR:
+            case FG_BL_SAWTOOTH:
+            case FG_BL_TRAPEZOID:
+            case FG_BL_PULSETRAIN:
+            case FG_BL_PARABOLIC:
+                return true;
+            default:
+                break;
+        }
+        return false;
+    }
+
+    void Oscillator::build_period(float *dst, size_t count)
+    {
+        // All waves are computed with unit amplitude and zero DC, the phase t is in range [0, 1)
+        float k = 1.0f / count;
+
+        switch (enFunction)
+        {
+            case FG_SINE:
+            case FG_COSINE:
+            case FG_SQUARED_SINE:
+            case FG_SQUARED_COSINE:
+                for (size_t i=0; i<count; ++i)
+                    dst[i]      = sin(2.0 * M_PI * i / count);
+                break;
+
+            case FG_BL_RECTANGULAR:
+                for (size_t i=0; i<count; ++i)
+                    dst[i]      = (i * k < sRectangular.fDutyRatio) ? 1.0f : -1.0f;
+                break;
+
+            case FG_BL_SAWTOOTH:
+            {
+                float w         = sSawtooth.fWidth;
+                for (size_t i=0; i<count; ++i)
+                {
+                    float t     = i * k;
+                    dst[i]      = (t < w) ? 2.0f * t / w - 1.0f : 1.0f - 2.0f * (t - w) / (1.0f - w);
+                }
+                break;
+            }
+
+            case FG_BL_TRAPEZOID:
+            {
+                float r         = sTrapezoid.fRaiseRatio;
+                float f         = sTrapezoid.fFallRatio;
+                float p0        = 0.5f * r;
+                float p1        = 0.5f * (1.0f - f);
+                float p2        = 0.5f * (1.0f + f);
+                float p3        = 1.0f - 0.5f * r;
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    float t     = i * k;
+                    if (t < p0)
+                        dst[i]      = t / p0;
+                    else if (t <= p1)
+                        dst[i]      = 1.0f;
+                    else if (t < p2)
+                        dst[i]      = (0.5f - t) / (p2 - p1) * 2.0f;
+                    else if (t <= p3)
+                        dst[i]      = -1.0f;
+                    else
+                        dst[i]      = (t - 1.0f) / p0;
+                }
+                break;
+            }
+
+            case FG_BL_PULSETRAIN:
+            {
+                float p0        = 0.5f * sPulse.fPosWidthRatio;
+                float p2        = 0.5f * (1.0f + sPulse.fNegWidthRatio);
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    float t     = i * k;
+                    dst[i]      = (t <= p0) ? 1.0f :
+                                  ((t >= 0.5f) && (t <= p2)) ? -1.0f : 0.0f;
+                }
+                break;
+            }
+
+            case FG_BL_PARABOLIC:
+            {
+                float w         = sParabolic.fWidth;
+                for (size_t i=0; i<count; ++i)
+                {
+                    float t     = i * k;
+                    float x     = 2.0f * t / w - 1.0f;
+                    dst[i]      = (t < w) ? 1.0f - x*x : 0.0f;
+                }
+                break;
+            }
+
+            default:
+                dsp::fill_zero(dst, count);
+                break;
+        }
+    }
+
+    void Oscillator::build_wavetable()
+    {
+        float *t                = sWaveTable.vTable;
+        sWaveTable.bRebuild     = false;
+        sWaveTable.nLevels      = 0;
+        sWaveTable.pLevel       = t;
+
+        if ((t == NULL) || (!wavetable_supported()))
+            return;
+
+        switch (enFunction)
+        {
+            // Sinusoidal waves consist of one harmonic and do not need mip levels
+            case FG_SINE:
+            case FG_COSINE:
+            case FG_SQUARED_SINE:
+            case FG_SQUARED_COSINE:
+                build_period(t, WAVETABLE_SIZE);
+                t[WAVETABLE_SIZE]       = t[0];
+                sWaveTable.nLevels      = 1;
+                return;
+
+            default:
+                break;
+        }
+
+        // Band limited waves: drop harmonics from the spectrum of non band limited wave
+        // and restore the wave for each level
+        float *sp               = vProcessBuffer;
+        build_period(vSynthBuffer, WAVETABLE_SIZE);
+        dsp::real_direct_fft(sp, vSynthBuffer, WAVETABLE_RANK);
+        sp[1]                   = 0.0f; // Nyquist harmonic
+
+        for (size_t i=0; i<WAVETABLE_LEVELS; ++i, t += WAVETABLE_STRIDE)
+        {
+            size_t harmonics        = (WAVETABLE_SIZE >> 2) >> i;
+            dsp::fill_zero(&sp[(harmonics + 1) * 2], WAVETABLE_SIZE - (harmonics + 1) * 2);
+            dsp::real_reverse_fft(t, sp, WAVETABLE_RANK);
+            t[WAVETABLE_SIZE]       = t[0];
+        }
+
+        sWaveTable.nLevels      = WAVETABLE_LEVELS;
+    }
+
+    void Oscillator::update_wavetable()
+    {
+        if (!sWaveTable.bEnabled)
+            return;
+        if (sWaveTable.bRebuild)
+            build_wavetable();
+
+        sWaveTable.nShift       = sizeof(phacc_t) * 8 - nPhaseAccBits;
+        sWaveTable.nOffset      = 0;
+
+        switch (enFunction)
+        {
+            case FG_SINE:
+                sWaveTable.fScale       = fAmplitude;
+                sWaveTable.fDC          = fReferencedDC;
+                break;
+            case FG_COSINE:
+                sWaveTable.nOffset      = 0x40000000; // Quarter of period
+                sWaveTable.fScale       = fAmplitude;
+                sWaveTable.fDC          = fReferencedDC;
+                break;
+            case FG_SQUARED_SINE: // sin^2(x/2) = (1 - cos(x)) / 2
+                sWaveTable.nOffset      = 0x40000000;
+                sWaveTable.fScale       = -0.5f * sSquaredSinusoid.fAmplitude;
+                sWaveTable.fDC          = 0.5f * sSquaredSinusoid.fAmplitude + fReferencedDC;
+                break;
+            case FG_SQUARED_COSINE: // cos^2(x/2) = (1 + cos(x)) / 2
+                sWaveTable.nOffset      = 0x40000000;
+                sWaveTable.fScale       = 0.5f * sSquaredSinusoid.fAmplitude;
+                sWaveTable.fDC          = 0.5f * sSquaredSinusoid.fAmplitude + fReferencedDC;
+                break;
+            case FG_BL_RECTANGULAR:
+                sWaveTable.fScale       = sRectangular.fBLPeakAtten * fAmplitude;
+                sWaveTable.fDC          = sRectangular.fBLPeakAtten * fReferencedDC;
+                break;
+            case FG_BL_SAWTOOTH:
+                sWaveTable.fScale       = sSawtooth.fBLPeakAtten * fAmplitude;
+                sWaveTable.fDC          = sSawtooth.fBLPeakAtten * fReferencedDC;
+                break;
+            case FG_BL_TRAPEZOID:
+                sWaveTable.fScale       = sTrapezoid.fBLPeakAtten * fAmplitude;
+                sWaveTable.fDC          = sTrapezoid.fBLPeakAtten * fReferencedDC;
+                break;
+            case FG_BL_PULSETRAIN:
+                sWaveTable.fScale       = sPulse.fBLPeakAtten * fAmplitude;
+                sWaveTable.fDC          = sPulse.fBLPeakAtten * fReferencedDC;
+                break;
+            case FG_BL_PARABOLIC:
+                sWaveTable.fScale       = sParabolic.fBLPeakAtten * sParabolic.fAmplitude;
+                sWaveTable.fDC          = sParabolic.fBLPeakAtten * fReferencedDC;
+                break;
+            default:
+                break;
+        }
+
+        // Select the mip level which does not contain harmonics above Nyquist frequency
+        sWaveTable.pLevel       = sWaveTable.vTable;
+        if ((sWaveTable.nLevels <= 1) || (nFreqCtrlWord == 0))
+            return;
+
+        float max_harmonic      = 0.5f * (nPhaseAccMask + 1.0f) / nFreqCtrlWord;
+        size_t harmonics        = WAVETABLE_SIZE >> 2;
+        for (size_t i=1; (i < sWaveTable.nLevels) && (harmonics > max_harmonic); ++i)
+        {
+            sWaveTable.pLevel      += WAVETABLE_STRIDE;
+            harmonics             >>= 1;
+        }
+    }
+
     void Oscillator::do_process(Oversampler *os, float *dst, size_t count)
     {
         // Prevent overwrite of vProcessBuffer when the size of processed data is smaller
@@ -368,6 +615,16 @@ namespace lsp
         if (dst == vProcessBuffer)
             return;
 
+        if ((sWaveTable.bEnabled) && (sWaveTable.nLevels > 0))
+        {
+            uint8_t shift       = sWaveTable.nShift;
+            dsp::wavetable(dst, sWaveTable.pLevel, WAVETABLE_RANK,
+                    (nPhaseAcc << shift) + sWaveTable.nOffset, nFreqCtrlWord << shift,
+                    sWaveTable.fScale, sWaveTable.fDC, count);
+            nPhaseAcc           = (nPhaseAcc + nFreqCtrlWord * count) & nPhaseAccMask;
+            return;
+        }
+
         switch (enFunction)
         {
             case FG_SINE:
@@ -13,9 +13,143 @@
 #define OS_UP_BUFFER_SIZE       (12 * 1024)   /* Multiple of 3 and 4 */
 #define OS_DOWN_BUFFER_SIZE     (12 * 1024)   /* Multiple of 3 and 4 */
 #define OS_CUTOFF               21000.0f
+#define OS_HB_BUFFER_SIZE       0x800           /* Size of oversampled block for half-band modes */
+#define OS_HB_HISTORY_MAX       0xa0            /* Maximum size of half-band filter history */
+#define OS_HB_COEFFS_MAX        0x30            /* Maximum number of half-band filter coefficients */
 
 namespace lsp
 {
+    /* Odd taps of Kaiser-windowed half-band FIR filters, each next stage works
+     * on the twice higher sample rate and has wider transition band:
+     *   stage 0: 40 coefficients, beta=10, < -100 dB at 0.2733 of sample rate
+     *   stage 1: 6 coefficients, beta=10, < -97 dB at 0.3866 of sample rate
+     *   stage 2: 4 coefficients, beta=9, < -88 dB at 0.4433 of sample rate
+     */
+    static const float hb_fir_s0[] __lsp_aligned16 =
+    {
+        +3.1807406746e-01f, -1.0539772449e-01f, +6.2492279790e-02f, -4.3848293035e-02f,
+        +3.3301145997e-02f, -2.6444652246e-02f, +2.1585904627e-02f, -1.7936210593e-02f,
+        +1.5078989757e-02f, -1.2773719712e-02f, +1.0871903317e-02f, -9.2768755766e-03f,
+        +7.9229046000e-03f, -6.7635864909e-03f, +5.7650510629e-03f, -4.9018087880e-03f,
+        +4.1541208918e-03f, -3.5062851748e-03f, +2.9454923326e-03f, -2.4610487035e-03f,
+        +2.0438405511e-03f, -1.6859610350e-03f, +1.3804486755e-03f, -1.1211032117e-03f,
+        +9.0235561912e-04f, -7.1917612454e-04f, +5.6700878874e-04f, -4.4172445937e-04f,
+        +3.3958616425e-04f, -2.5722263977e-04f, +1.9160687960e-04f, -1.4003747776e-04f,
+        +1.0012121514e-04f, -6.9755855997e-05f, +4.7112520390e-05f, -3.0617305795e-05f,
+        +1.8932064545e-05f, -1.0934417091e-05f, +5.6972040958e-06f, -2.4676611908e-06f
+    };
+
+    static const float hb_fir_s1[] __lsp_aligned16 =
+    {
+        +3.0797965617e-01f, -7.8528866836e-02f, +2.6930606066e-02f, -7.7424323390e-03f,
+        +1.4833170077e-03f, -1.1580256312e-04f
+    };
+
+    static const float hb_fir_s2[] __lsp_aligned16 =
+    {
+        +2.9782261628e-01f, -5.7212618699e-02f, +1.0050064934e-02f, -6.4116631830e-04f
+    };
+
+    /* Coefficients of allpass sections of elliptic half-band IIR filters with
+     * the same transition bands as FIR filters:
+     *   stage 0: 10 coefficients, < -106 dB
+     *   stage 1: 5 coefficients, < -100 dB
+     *   stage 2: 4 coefficients, < -98 dB
+     */
+    static const float hb_iir_s0[] __lsp_aligned16 =
+    {
+        3.5530681584e-02f, 1.3264544576e-01f, 2.6796020622e-01f, 4.1514473317e-01f,
+        5.5401522493e-01f, 6.7381455971e-01f, 7.7188746865e-01f, 8.5072776674e-01f,
+        9.1544237741e-01f, 9.7232002369e-01f
+    };
+
+    static const float hb_iir_s1[] __lsp_aligned16 =
+    {
+        4.3756453861e-02f, 1.6598259462e-01f, 3.4643159750e-01f, 5.6906042986e-01f,
+        8.3773300433e-01f
+    };
+
+    static const float hb_iir_s2[] __lsp_aligned16 =
+    {
+        5.0756423925e-02f, 1.9737637457e-01f, 4.3215608230e-01f, 7.7042386477e-01f
+    };
+
+    typedef struct hb_filter_t
+    {
+        const float    *vCoeffs;
+        size_t          nCoeffs;
+    } hb_filter_t;
+
+    static const hb_filter_t hb_fir_filters[] =
+    {
+        { hb_fir_s0, sizeof(hb_fir_s0) / sizeof(float) },
+        { hb_fir_s1, sizeof(hb_fir_s1) / sizeof(float) },
+        { hb_fir_s2, sizeof(hb_fir_s2) / sizeof(float) }
+    };
+
+    static const hb_filter_t hb_iir_filters[] =
+    {
+        { hb_iir_s0, sizeof(hb_iir_s0) / sizeof(float) },
+        { hb_iir_s1, sizeof(hb_iir_s1) / sizeof(float) },
+        { hb_iir_s2, sizeof(hb_iir_s2) / sizeof(float) }
+    };
+
+    static size_t halfband_stages(size_t mode)
+    {
+        switch (mode)
+        {
+            case OM_HALFBAND_2X:
+            case OM_HALFBAND_IIR_2X:
+                return 1;
+            case OM_HALFBAND_4X:
+            case OM_HALFBAND_IIR_4X:
+                return 2;
+            case OM_HALFBAND_8X:
+            case OM_HALFBAND_IIR_8X:
+                return 3;
+            default:
+                break;
+        }
+        return 0;
+    }
+
+    /**
+     * Compute padding of downsampling history for each FIR stage so that
+     * the overall latency is an integer number of samples
+     * @param pad array to store padding for each stage, may be NULL
+     * @param stages number of stages
+     * @return latency in normal samples
+     */
+    static size_t halfband_fir_latency(size_t *pad, size_t stages)
+    {
+        // Each stage delays signal by (4*n - 2 + pad) samples of the higher sample rate
+        size_t latency  = 0;
+        for (ssize_t i=stages-1; i >= 0; --i)
+        {
+            size_t p        = latency & 1;
+            latency         = (latency + (hb_fir_filters[i].nCoeffs << 2) - 2 + p) >> 1;
+            if (pad != NULL)
+                pad[i]          = p;
+        }
+        return latency;
+    }
+
+    static size_t halfband_iir_latency(size_t stages)
+    {
+        // Estimate group delay of each stage at low frequencies
+        float latency   = 0.0f;
+        for (ssize_t i=stages-1; i >= 0; --i)
+        {
+            const hb_filter_t *f = &hb_iir_filters[i];
+            float delay     = 0.0f;
+            for (size_t j=0; j<f->nCoeffs; j += 2)
+                delay          += (1.0f - f->vCoeffs[j]) / (1.0f + f->vCoeffs[j]);
+
+            latency         = (latency + delay * 4.0f - 1.0f) * 0.5f;
+        }
+        return latency + 0.5f;
+    }
+
     IOversamplerCallback::~IOversamplerCallback()
     {
     }
@@ -36,6 +170,20 @@ namespace lsp
         nUpdate     = UP_ALL;
         bData       = NULL;
         bFilter     = true;
+        nStages     = 0;
+
+        for (size_t i=0; i<HB_STAGES_MAX; ++i)
+        {
+            hb_stage_t *st      = &vStages[i];
+            st->vUp             = NULL;
+            st->vDown           = NULL;
+            st->vState          = NULL;
+            st->vUpCoeffs       = NULL;
+            st->vDownCoeffs     = NULL;
+            st->nCoeffs         = 0;
+            st->nUpHistory      = 0;
+            st->nDownHistory    = 0;
+        }
     }
     
     Oversampler::~Oversampler()
@@ -49,7 +197,11 @@ namespace lsp
 
         if (bData == NULL)
         {
-            size_t samples  = OS_UP_BUFFER_SIZE + OS_DOWN_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES;
+            size_t hb_up    = OS_HB_HISTORY_MAX + (OS_HB_BUFFER_SIZE >> 1);
+            size_t hb_down  = OS_HB_HISTORY_MAX + OS_HB_BUFFER_SIZE;
+            size_t hb_stage = hb_up + hb_down + OS_HB_COEFFS_MAX * 5;
+            size_t samples  = OS_UP_BUFFER_SIZE + OS_DOWN_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES +
+                              hb_stage * HB_STAGES_MAX;
             bData           = new uint8_t[samples * sizeof(float) + DEFAULT_ALIGN];
             if (bData == NULL)
                 return false;
@@ -59,6 +211,19 @@ namespace lsp
             fUpBuffer       = reinterpret_cast<float *>(ptr);
             ptr            += OS_UP_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES;
 
+            for (size_t i=0; i<HB_STAGES_MAX; ++i)
+            {
+                hb_stage_t *st      = &vStages[i];
+                st->vUp             = ptr;
+                ptr                += hb_up;
+                st->vDown           = ptr;
+                ptr                += hb_down;
+                st->vState          = ptr;
+                ptr                += OS_HB_COEFFS_MAX * 4;
+                st->vUpCoeffs       = ptr;
+                ptr                += OS_HB_COEFFS_MAX;
+            }
+
             lsp_assert(reinterpret_cast<uint8_t *>(ptr) <= &bData[samples * sizeof(float) + DEFAULT_ALIGN]);
         }
 
@@ -66,6 +231,7 @@ namespace lsp
         dsp::fill_zero(fUpBuffer, OS_UP_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES);
         dsp::fill_zero(fDownBuffer, OS_DOWN_BUFFER_SIZE);
         nUpHead       = 0;
+        configure_halfband();
 
         return true;
     }
@@ -76,8 +242,19 @@ namespace lsp
         if (bData != NULL)
         {
             delete [] bData;
+            bData       = NULL;
             fUpBuffer   = NULL;
             fDownBuffer = NULL;
+
+            for (size_t i=0; i<HB_STAGES_MAX; ++i)
+            {
+                hb_stage_t *st      = &vStages[i];
+                st->vUp             = NULL;
+                st->vDown           = NULL;
+                st->vState          = NULL;
+                st->vUpCoeffs       = NULL;
+            }
+            nStages     = 0;
         }
         pCallback = NULL;
     }
@@ -109,6 +286,7 @@ namespace lsp
             dsp::fill_zero(fUpBuffer, OS_UP_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES);
             nUpHead       = 0;
             sFilter.clear();
+            configure_halfband();
         }
 
         size_t os       = get_oversampling();
@@ -144,6 +322,14 @@ namespace lsp
             case OM_LANCZOS_8X3:
                 return 8;
 
+            case OM_HALFBAND_2X:
+            case OM_HALFBAND_4X:
+            case OM_HALFBAND_8X:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+                return 1 << halfband_stages(nMode);
+
             default:
                 break;
         }
@@ -151,6 +337,92 @@ namespace lsp
         return 1;
     }
 
+    void Oversampler::configure_halfband()
+    {
+        nStages         = (bData != NULL) ? halfband_stages(nMode) : 0;
+        if (nStages <= 0)
+            return;
+
+        bool iir        = (nMode == OM_HALFBAND_IIR_2X) || (nMode == OM_HALFBAND_IIR_4X) || (nMode == OM_HALFBAND_IIR_8X);
+        size_t pad[HB_STAGES_MAX];
+        halfband_fir_latency(pad, nStages);
+
+        for (size_t i=0; i<nStages; ++i)
+        {
+            hb_stage_t *st      = &vStages[i];
+            const hb_filter_t *f= (iir) ? &hb_iir_filters[i] : &hb_fir_filters[i];
+
+            st->nCoeffs         = f->nCoeffs;
+            st->vDownCoeffs     = f->vCoeffs;
+            if (iir)
+            {
+                st->nUpHistory      = 0;
+                st->nDownHistory    = 0;
+                dsp::copy(st->vUpCoeffs, f->vCoeffs, f->nCoeffs);
+            }
+            else
+            {
+                st->nUpHistory      = (f->nCoeffs << 1) - 1;
+                st->nDownHistory    = (f->nCoeffs << 2) - 3 + pad[i];
+                dsp::scale3(st->vUpCoeffs, f->vCoeffs, 2.0f, f->nCoeffs);
+            }
+
+            // Clear the filter memory
+            dsp::fill_zero(st->vUp, st->nUpHistory);
+            dsp::fill_zero(st->vDown, st->nDownHistory);
+            dsp::fill_zero(st->vState, f->nCoeffs << 2);
+        }
+    }
+
+    void Oversampler::halfband_upsample(float *dst, const float *src, size_t samples)
+    {
+        for (size_t i=0; i<nStages; ++i)
+        {
+            hb_stage_t *st      = &vStages[i];
+            float *out          = dst;
+            if ((i + 1) < nStages)
+                out                 = &st[1].vUp[st[1].nUpHistory];
+            const float *in     = (i > 0) ? st->vUp : src;
+
+            if (st->nUpHistory > 0)
+            {
+                // FIR filter: append data to the history, process and shift the history
+                if (i <= 0)
+                    dsp::copy(&st->vUp[st->nUpHistory], src, samples);
+                dsp::halfband_upsample_2x(out, st->vUp, st->vUpCoeffs, st->nCoeffs, samples);
+                dsp::move(st->vUp, &st->vUp[samples], st->nUpHistory);
+            }
+            else
+                dsp::halfband_iir_upsample_2x(out, in, st->vState, st->vUpCoeffs, st->nCoeffs, samples);
+
+            samples           <<= 1;
+        }
+    }
+
+    void Oversampler::halfband_downsample(float *dst, const float *src, size_t samples)
+    {
+        for (ssize_t i=nStages-1; i >= 0; --i)
+        {
+            hb_stage_t *st      = &vStages[i];
+            size_t count        = samples << i;
+            float *out          = dst;
+            if (i > 0)
+                out                 = &vStages[i-1].vDown[vStages[i-1].nDownHistory];
+            const float *in     = (size_t(i + 1) < nStages) ? st->vDown : src;
+
+            if (st->nDownHistory > 0)
+            {
+                // FIR filter: append data to the history, process and shift the history
+                if (size_t(i + 1) >= nStages)
+                    dsp::copy(&st->vDown[st->nDownHistory], src, count << 1);
+                dsp::halfband_downsample_2x(out, st->vDown, st->vDownCoeffs, st->nCoeffs, count);
+                dsp::move(st->vDown, &st->vDown[count << 1], st->nDownHistory);
+            }
+            else
+                dsp::halfband_iir_downsample_2x(out, in, &st->vState[st->nCoeffs << 1], st->vDownCoeffs, st->nCoeffs, count);
+        }
+    }
+
     void Oversampler::upsample(float *dst, const float *src, size_t samples)
     {
         switch (nMode)
@@ -321,6 +593,28 @@ namespace lsp
             }
 
 
+            case OM_HALFBAND_2X:
+            case OM_HALFBAND_4X:
+            case OM_HALFBAND_8X:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+            {
+                while (samples > 0)
+                {
+                    size_t can_do   = OS_HB_BUFFER_SIZE >> nStages;
+                    size_t to_do    = (samples > can_do) ? can_do : samples;
+
+                    halfband_upsample(dst, src, to_do);
+
+                    // Update pointers
+                    dst            += to_do << nStages;
+                    src            += to_do;
+                    samples        -= to_do;
+                }
+                break;
+            }
+
             case OM_NONE:
             default:
                 dsp::copy(dst, src, samples);
@@ -459,6 +753,28 @@ namespace lsp
                 break;
             }
 
+            case OM_HALFBAND_2X:
+            case OM_HALFBAND_4X:
+            case OM_HALFBAND_8X:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+            {
+                while (samples > 0)
+                {
+                    size_t can_do   = OS_HB_BUFFER_SIZE >> nStages;
+                    size_t to_do    = (samples > can_do) ? can_do : samples;
+
+                    halfband_downsample(dst, src, to_do);
+
+                    // Update pointers
+                    src            += to_do << nStages;
+                    dst            += to_do;
+                    samples        -= to_do;
+                }
+                break;
+            }
+
             case OM_NONE:
             default:
                 dsp::copy(dst, src, samples);
@@ -504,7 +820,7 @@ namespace lsp
 
                     // Update pointers
                     nUpHead        += to_do << 1;
-                    dst            += to_do << 1;
+                    dst            += to_do;
                     src            += to_do;
                     samples        -= to_do;
                 }
@@ -675,6 +991,37 @@ namespace lsp
                 break;
             }
 
+            case OM_HALFBAND_2X:
+            case OM_HALFBAND_4X:
+            case OM_HALFBAND_8X:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+            {
+                while (samples > 0)
+                {
+                    size_t can_do   = OS_HB_BUFFER_SIZE >> nStages;
+                    size_t to_do    = (samples > can_do) ? can_do : samples;
+                    size_t count    = to_do << nStages;
+
+                    // Do oversampling
+                    halfband_upsample(fUpBuffer, src, to_do);
+
+                    // Call handler
+                    if (callback != NULL)
+                        callback->process(fUpBuffer, fUpBuffer, count);
+
+                    // Do downsampling
+                    halfband_downsample(dst, fUpBuffer, to_do);
+
+                    // Update pointers
+                    dst            += to_do;
+                    src            += to_do;
+                    samples        -= to_do;
+                }
+                break;
+            }
+
             case OM_NONE:
             default:
                 if (callback != NULL)
@@ -703,6 +1050,16 @@ namespace lsp
             case OM_LANCZOS_8X3:
                 return 3;
 
+            case OM_HALFBAND_2X:
+            case OM_HALFBAND_4X:
+            case OM_HALFBAND_8X:
+                return halfband_fir_latency(NULL, halfband_stages(nMode));
+
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+                return halfband_iir_latency(halfband_stages(nMode));
+
             default:
                 break;
         }
@@ -8,13 +8,17 @@
 #include <dsp/dsp.h>
 #include <core/util/Sidechain.h>
 
-#define REFRESH_RATE        0x1000
 #define MIN_GAP_ITEMS       0x200
 
 namespace lsp
 {
     Sidechain::Sidechain()
     {
+        vPeaks              = NULL;
+        nPeakHead           = 0;
+        nPeakCount          = 0;
+        nPeakMask           = 0;
+        nTime               = 0;
         nReactivity         = 0;
         fReactivity         = 0.0f;
         fTau                = 0.0f;
@@ -38,6 +42,14 @@ namespace lsp
     void Sidechain::destroy()
     {
         sBuffer.destroy();
+        if (vPeaks != NULL)
+        {
+            delete [] vPeaks;
+            vPeaks      = NULL;
+        }
+        nPeakHead           = 0;
+        nPeakCount          = 0;
+        nPeakMask           = 0;
     }
 
     bool Sidechain::init(size_t channels, float max_reactivity)
@@ -68,13 +80,30 @@ namespace lsp
         size_t gap          = millis_to_samples(sr, fMaxReactivity);
         size_t buf_size     = (gap < MIN_GAP_ITEMS) ? MIN_GAP_ITEMS : gap;
         sBuffer.init(buf_size * 4, gap);
+
+        // The peak deque never holds more items than the window contains
+        size_t capacity     = 1;
+        while (capacity <= gap)
+            capacity          <<= 1;
+        if ((vPeaks == NULL) || (capacity != (nPeakMask + 1)))
+        {
+            if (vPeaks != NULL)
+                delete [] vPeaks;
+            vPeaks              = new peak_t[capacity];
+            nPeakMask           = (vPeaks != NULL) ? capacity - 1 : 0;
+        }
+        nPeakHead           = 0;
+        nPeakCount          = 0;
+        nTime               = 0;
     }
 
     void Sidechain::update_settings()
     {
         nReactivity         = millis_to_samples(nSampleRate, fReactivity);
         fTau                = 1.0f - expf(logf(1.0f - M_SQRT1_2) / (nReactivity)); // Tau is based on seconds
-        nRefresh            = REFRESH_RATE; // Force the function to be refreshed
+        nRefresh            = SIDECHAIN_REFRESH_RATE; // Force the function to be refreshed
+        nPeakHead           = 0;
+        nPeakCount          = 0;
     }
 
     void Sidechain::refresh_processing()
@@ -82,8 +111,16 @@ namespace lsp
         switch (nMode)
         {
             case SCM_PEAK:
+            {
+                // The sliding maximum is exact, rebuild the peak deque from the history only after reset
                 fRmsValue       = 0.0f;
+                if ((nPeakCount > 0) || (nReactivity <= 0))
+                    break;
+
+                nTime          -= nReactivity;
+                update_peaks(NULL, sBuffer.tail(nReactivity), nReactivity);
                 break;
+            }
 
             case SCM_UNIFORM:
                 fRmsValue       = dsp::h_abs_sum(sBuffer.tail(nReactivity), nReactivity);
@@ -98,6 +135,43 @@ namespace lsp
         }
     }
 
+    void Sidechain::update_peaks(float *dst, const float *src, size_t count)
+    {
+        if (vPeaks == NULL)
+            return;
+
+        size_t head     = nPeakHead;
+        size_t tail     = nPeakHead + nPeakCount;   // Not wrapped by mask
+        size_t mask     = nPeakMask;
+        size_t time     = nTime;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float value     = src[i];
+            ++time;
+
+            // Remove peaks that can not become maximum anymore
+            while ((tail != head) && (vPeaks[(tail - 1) & mask].fValue <= value))
+                --tail;
+
+            // Append new peak
+            peak_t *p       = &vPeaks[(tail++) & mask];
+            p->fValue       = value;
+            p->nTime        = time;
+
+            // Remove peak that has left the window
+            if ((time - vPeaks[head & mask].nTime) >= nReactivity)
+                ++head;
+
+            if (dst != NULL)
+                dst[i]          = vPeaks[head & mask].fValue;
+        }
+
+        nPeakHead       = head & mask;
+        nPeakCount      = tail - head;
+        nTime           = time;
+    }
+
     void Sidechain::process(float *out, const float **in, size_t samples)
     {
         // Check if need update settings
@@ -167,100 +241,69 @@ namespace lsp
         if (fGain != 1.0f)
             dsp::scale2(out, fGain, samples);
 
-        // Update refresh counter
-        nRefresh       += samples;
-        if (nRefresh >= REFRESH_RATE)
-        {
-            refresh_processing();
-            nRefresh   %= REFRESH_RATE;
-        }
-
         // Calculate sidechain function
-        switch (nMode)
+        while (samples > 0)
         {
-            // Peak processing
-            case SCM_PEAK:
+            // Periodically re-compute the exact state of the window to bound the accumulated error
+            if (nRefresh >= SIDECHAIN_REFRESH_RATE)
             {
-                while (samples > 0)
-                {
-                    size_t n    = sBuffer.append(out, samples);
-                    sBuffer.shift(n);
-                    out        += n;
-                    samples    -= n;
-                }
-                break;
+                refresh_processing();
+                nRefresh        = 0;
             }
 
-            // Lo-pass filter processing
-            case SCM_LPF:
-            {
-                while (samples > 0)
-                {
-                    size_t n    = sBuffer.append(out, samples);
-                    sBuffer.shift(n);
-                    samples    -= n;
-
-                    while (n--)
-                    {
-                        fRmsValue      += fTau * ((*out) - fRmsValue);
-                        *(out++)        = (fRmsValue < 0.0f) ? 0.0f : fRmsValue;
-                    }
-                }
-                break;
-            }
+            size_t to_do    = SIDECHAIN_REFRESH_RATE - nRefresh;
+            if (to_do > samples)
+                to_do           = samples;
+            size_t n        = sBuffer.append(out, to_do);
 
-            // Uniform processing
-            case SCM_UNIFORM:
+            switch (nMode)
             {
-                if (nReactivity <= 0)
+                // Peak processing
+                case SCM_PEAK:
+                {
+                    if (nReactivity <= 0)
+                        break;
+                    update_peaks(out, out, n);
                     break;
-                float interval  = nReactivity;
+                }
 
-                while (samples > 0)
+                // Lo-pass filter processing
+                case SCM_LPF:
                 {
-                    size_t n    = sBuffer.append(out, samples);
-                    float *p    = sBuffer.tail(nReactivity + n);
-                    samples    -= n;
-
                     for (size_t i=0; i<n; ++i)
                     {
-                        fRmsValue      += *(out) - *(p++);
-                        *(out++)        = (fRmsValue < 0.0f) ? 0.0f : fRmsValue / interval;
+                        fRmsValue      += fTau * (out[i] - fRmsValue);
+                        out[i]          = (fRmsValue < 0.0f) ? 0.0f : fRmsValue;
                     }
-
-                    // Remove old sample
-                    sBuffer.shift(n);
+                    break;
                 }
-                break;
-            }
 
-            // RMS processing
-            case SCM_RMS:
-            {
-                if (nReactivity <= 0)
+                // Uniform processing
+                case SCM_UNIFORM:
+                {
+                    if (nReactivity <= 0)
+                        break;
+                    fRmsValue       = dsp::sliding_mean(out, out, sBuffer.tail(nReactivity + n), fRmsValue, 1.0f / nReactivity, n);
                     break;
-                float interval  = nReactivity;
+                }
 
-                while (samples > 0)
+                // RMS processing
+                case SCM_RMS:
                 {
-                    size_t n        = sBuffer.append(out, samples);
-                    float *p        = sBuffer.tail(nReactivity + n);
-                    samples        -= n;
-
-                    for (size_t i=0; i<n; ++i)
-                    {
-                        float sample    = *out;
-                        float last      = *(p++);
-                        fRmsValue      += sample*sample - last*last;
-                        *(out++)        = (fRmsValue < 0.0f) ? 0.0f : sqrtf(fRmsValue / interval);
-                    }
-                    sBuffer.shift(n);
+                    if (nReactivity <= 0)
+                        break;
+                    fRmsValue       = dsp::sliding_rms(out, out, sBuffer.tail(nReactivity + n), fRmsValue, 1.0f / nReactivity, n);
+                    break;
                 }
-                break;
+
+                default:
+                    break;
             }
 
-            default:
-                break;
+            sBuffer.shift(n);
+            nRefresh       += n;
+            out            += n;
+            samples        -= n;
         }
     }
 
@@ -336,10 +379,10 @@ namespace lsp
 
         // Update refresh counter
         nRefresh       ++;
-        if (nRefresh >= REFRESH_RATE)
+        if (nRefresh >= SIDECHAIN_REFRESH_RATE)
         {
             refresh_processing();
-            nRefresh   %= REFRESH_RATE;
+            nRefresh   %= SIDECHAIN_REFRESH_RATE;
         }
 
         // Calculate sidechain function
@@ -350,6 +393,9 @@ namespace lsp
             {
                 sBuffer.append(out);
                 sBuffer.shift();
+                if (nReactivity <= 0)
+                    break;
+                update_peaks(&out, &out, 1);
                 break;
             }
 
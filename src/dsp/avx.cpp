@@ -25,6 +25,7 @@
 
 #include <dsp/arch/x86/avx/copy.h>
 #include <dsp/arch/x86/avx/complex.h>
+#include <dsp/arch/x86/avx/fastconv.h>
 #include <dsp/arch/x86/avx/filters/static.h>
 #include <dsp/arch/x86/avx/filters/dynamic.h>
 #include <dsp/arch/x86/avx/filters/transform.h>
@@ -63,6 +64,12 @@ namespace avx
             EXPORT2_X64(pcomplex_mul3, x64_pcomplex_mul3);
             EXPORT2_X64(pcomplex_mod, x64_pcomplex_mod);
             EXPORT2_X64(bilinear_transform_x8, x64_bilinear_transform_x8);
+
+            EXPORT2_X64(fastconv_parse, x64_fastconv_parse);
+            EXPORT2_X64(fastconv_parse_apply, x64_fastconv_parse_apply);
+            EXPORT2_X64(fastconv_restore, x64_fastconv_restore);
+            EXPORT2_X64(fastconv_apply, x64_fastconv_apply);
+            EXPORT2_X64(fastconv_accumulate, x64_fastconv_accumulate);
         }
         else
         {
@@ -70,6 +77,12 @@ namespace avx
             SUPPORT_X64(x64_complex_mul3);
             SUPPORT_X64(x64_pcomplex_mul3);
             SUPPORT_X64(x64_bilinear_transform_x8);
+
+            SUPPORT_X64(x64_fastconv_parse);
+            SUPPORT_X64(x64_fastconv_parse_apply);
+            SUPPORT_X64(x64_fastconv_restore);
+            SUPPORT_X64(x64_fastconv_apply);
+            SUPPORT_X64(x64_fastconv_accumulate);
         }
 
         if (f->features & CPU_OPTION_FMA3)
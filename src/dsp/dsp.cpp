@@ -103,6 +103,9 @@ namespace dsp
 
     void    (* abs_normalized)(float *dst, const float *src, size_t count) = NULL;
     void    (* normalize)(float *dst, const float *src, size_t count) = NULL;
+
+    void    (* dyn_gain)(float *dst, const float *src, const dyn_knee_t *knee, size_t count) = NULL;
+    void    (* dyn_curve)(float *dst, const float *src, const dyn_knee_t *knee, size_t count) = NULL;
     float   (* min)(const float *src, size_t count) = NULL;
     float   (* max)(const float *src, size_t count) = NULL;
     float   (* abs_max)(const float *src, size_t count) = NULL;
@@ -142,11 +145,14 @@ namespace dsp
     void    (* powvc2)(float *dst, const float *c, float v, size_t count) = NULL;
     void    (* powvx1)(float *v, const float *x, size_t count) = NULL;
     void    (* powvx2)(float *dst, const float *v, const float *x, size_t count) = NULL;
+    void    (* lramp_add2)(float *dst, const float *src, float v1, float v2, size_t count) = NULL;
 
     float   (* h_sum)(const float *src, size_t count) = NULL;
     float   (* h_sqr_sum)(const float *src, size_t count) = NULL;
     float   (* h_abs_sum)(const float *src, size_t count) = NULL;
     float   (* scalar_mul)(const float *a, const float *b, size_t count) = NULL;
+    float   (* sliding_mean)(float *dst, const float *head, const float *tail, float sum, float k, size_t count) = NULL;
+    float   (* sliding_rms)(float *dst, const float *head, const float *tail, float sum, float k, size_t count) = NULL;
 
     void    (* scale_add3)(float *dst, const float *src, float k, size_t count) = NULL;
     void    (* scale_sub3)(float *dst, const float *src, float k, size_t count) = NULL;
@@ -175,6 +181,12 @@ namespace dsp
     void    (* packed_direct_fft)(float *dst, const float *src, size_t rank) = NULL;
     void    (* reverse_fft)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank) = NULL;
     void    (* packed_reverse_fft)(float *dst, const float *src, size_t rank) = NULL;
+    void    (* real_direct_fft)(float *dst, const float *src, size_t rank) = NULL;
+    void    (* real_reverse_fft)(float *dst, const float *src, size_t rank) = NULL;
+    bool    (* init_fft_plan)(fft_plan_t *plan, size_t rank) = NULL;
+    void    (* destroy_fft_plan)(fft_plan_t *plan) = NULL;
+    void    (* planned_direct_fft)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const fft_plan_t *plan) = NULL;
+    void    (* planned_reverse_fft)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const fft_plan_t *plan) = NULL;
 //        void    (* join_fft)(float *dst_re, float *dst_im, float *src_re, float *src_im, size_t rank) = NULL;
     void    (* normalize_fft3)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank) = NULL;
     void    (* normalize_fft2)(float *re, float *im, size_t rank) = NULL;
@@ -217,6 +229,7 @@ namespace dsp
     void    (* fastconv_parse_apply)(float *dst, float *tmp, const float *c, const float *src, size_t rank) = NULL;
     void    (* fastconv_restore)(float *dst, float *tmp, size_t rank) = NULL;
     void    (* fastconv_apply)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank) = NULL;
+    void    (* fastconv_accumulate)(float *dst, const float *c1, const float *c2, size_t rank) = NULL;
 
     void    (* lr_to_ms)(float *m, float *s, const float *l, const float *r, size_t count) = NULL;
     void    (* lr_to_mid)(float *m, const float *l, const float *r, size_t count) = NULL;
@@ -230,6 +243,8 @@ namespace dsp
     void    (* biquad_process_x2)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
     void    (* biquad_process_x4)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
     void    (* biquad_process_x8)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
+    void    (* biquad_process_mc4)(float *dst, const float *src, size_t count, biquad_t *f, size_t stages) = NULL;
+    void    (* biquad_process_mc8)(float *dst, const float *src, size_t count, biquad_t *f, size_t stages) = NULL;
 
     void    (* dyn_biquad_process_x1)(float *dst, const float *src, float *d, size_t count, const biquad_x1_t *f) = NULL;
     void    (* dyn_biquad_process_x2)(float *dst, const float *src, float *d, size_t count, const biquad_x2_t *f) = NULL;
@@ -246,6 +261,8 @@ namespace dsp
     void    (* matched_transform_x4)(biquad_x4_t *bf, f_cascade_t *bc, float kf, float td, size_t count) = NULL;
     void    (* matched_transform_x8)(biquad_x8_t *bf, f_cascade_t *bc, float kf, float td, size_t count) = NULL;
 
+    void    (* interpolate_cascades)(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count) = NULL;
+
     void    (* axis_apply_log1)(float *x, const float *v, float zero, float norm_x, size_t count) = NULL;
     void    (* axis_apply_log2)(float *x, float *y, const float *v, float zero, float norm_x, float norm_y, size_t count) = NULL;
     void    (* rgba32_to_bgra32)(void *dst, const void *src, size_t count) = NULL;
@@ -278,6 +295,18 @@ namespace dsp
     void    (* downsample_6x)(float *dst, const float *src, size_t count) = NULL;
     void    (* downsample_8x)(float *dst, const float *src, size_t count) = NULL;
 
+    void    (* halfband_upsample_2x)(float *dst, const float *src, const float *c, size_t n, size_t count) = NULL;
+    void    (* halfband_downsample_2x)(float *dst, const float *src, const float *c, size_t n, size_t count) = NULL;
+    void    (* halfband_iir_upsample_2x)(float *dst, const float *src, float *state, const float *c, size_t n, size_t count) = NULL;
+    void    (* halfband_iir_downsample_2x)(float *dst, const float *src, float *state, const float *c, size_t n, size_t count) = NULL;
+
+    void    (* init_prng)(prng_t *rnd, uint32_t seed) = NULL;
+    void    (* rand_uniform)(float *dst, prng_t *rnd, size_t count) = NULL;
+    void    (* rand_triangle)(float *dst, prng_t *rnd, size_t count) = NULL;
+    void    (* rand_gaussian)(float *dst, prng_t *rnd, size_t count) = NULL;
+
+    void    (* wavetable)(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count) = NULL;
+
     // 3D mathematics
     void    (* init_point_xyz)(point3d_t *p, float x, float y, float z) = NULL;
     void    (* init_point)(point3d_t *p, const point3d_t *s) = NULL;
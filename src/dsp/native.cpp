@@ -25,6 +25,9 @@
 #include <dsp/arch/native/graphics/interpolation.h>
 
 #include <dsp/arch/native/pmath.h>
+#include <dsp/arch/native/dynamics.h>
+#include <dsp/arch/native/random.h>
+#include <dsp/arch/native/wavetable.h>
 #include <dsp/arch/native/search.h>
 
 #include <dsp/arch/native/filters/static.h>
@@ -32,6 +35,7 @@
 #include <dsp/arch/native/filters/transform.h>
 
 #include <dsp/arch/native/fft.h>
+#include <dsp/arch/native/fft/plan.h>
 #include <dsp/arch/native/fastconv.h>
 #include <dsp/arch/native/float.h>
 #include <dsp/arch/native/resampling.h>
@@ -97,10 +101,14 @@ namespace native
         EXPORT1(powvc2);
         EXPORT1(powvx1);
         EXPORT1(powvx2);
+        EXPORT1(lramp_add2);
 
         EXPORT1(abs_normalized);
         EXPORT1(normalize);
 
+        EXPORT1(dyn_gain);
+        EXPORT1(dyn_curve);
+
         EXPORT1(min);
         EXPORT1(max);
         EXPORT1(abs_max);
@@ -130,6 +138,8 @@ namespace native
         EXPORT1(h_sqr_sum);
         EXPORT1(h_abs_sum);
         EXPORT1(scalar_mul);
+        EXPORT1(sliding_mean);
+        EXPORT1(sliding_rms);
 
         EXPORT1(scale_add3);
         EXPORT1(scale_sub3);
@@ -158,6 +168,12 @@ namespace native
         EXPORT1(packed_direct_fft);
         EXPORT1(reverse_fft);
         EXPORT1(packed_reverse_fft);
+        EXPORT1(real_direct_fft);
+        EXPORT1(real_reverse_fft);
+        EXPORT1(init_fft_plan);
+        EXPORT1(destroy_fft_plan);
+        EXPORT1(planned_direct_fft);
+        EXPORT1(planned_reverse_fft);
         EXPORT1(normalize_fft3);
         EXPORT1(normalize_fft2);
         EXPORT1(center_fft);
@@ -168,6 +184,7 @@ namespace native
         EXPORT1(fastconv_parse_apply);
         EXPORT1(fastconv_restore);
         EXPORT1(fastconv_apply);
+        EXPORT1(fastconv_accumulate);
 
         EXPORT1(complex_mul2);
         EXPORT1(complex_mul3);
@@ -212,6 +229,8 @@ namespace native
         EXPORT1(biquad_process_x2);
         EXPORT1(biquad_process_x4);
         EXPORT1(biquad_process_x8);
+        EXPORT1(biquad_process_mc4);
+        EXPORT1(biquad_process_mc8);
 
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
@@ -228,6 +247,8 @@ namespace native
         EXPORT1(matched_transform_x4);
         EXPORT1(matched_transform_x8);
 
+        EXPORT1(interpolate_cascades);
+
         EXPORT1(axis_apply_log1);
         EXPORT1(axis_apply_log2);
         EXPORT1(rgba32_to_bgra32);
@@ -262,6 +283,18 @@ namespace native
         EXPORT1(downsample_6x);
         EXPORT1(downsample_8x);
 
+        EXPORT1(halfband_upsample_2x);
+        EXPORT1(halfband_downsample_2x);
+        EXPORT1(halfband_iir_upsample_2x);
+        EXPORT1(halfband_iir_downsample_2x);
+
+        EXPORT1(init_prng);
+        EXPORT1(rand_uniform);
+        EXPORT1(rand_triangle);
+        EXPORT1(rand_gaussian);
+
+        EXPORT1(wavetable);
+
         // 3D math
         EXPORT1(init_point_xyz);
         EXPORT1(init_point);
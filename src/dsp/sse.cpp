@@ -62,6 +62,7 @@ namespace sse // TODO: make constants common for all architectures
 #include <dsp/arch/x86/sse/msmatrix.h>
 #include <dsp/arch/x86/sse/search.h>
 #include <dsp/arch/x86/sse/resampling.h>
+#include <dsp/arch/x86/sse/dynamics.h>
 
 #include <dsp/arch/x86/sse/complex.h>
 #include <dsp/arch/x86/sse/pcomplex.h>
@@ -170,11 +171,14 @@ namespace sse
         EXPORT1(mul3);
         EXPORT1(div3);
         EXPORT1(scale3);
+        EXPORT1(lramp_add2);
 
         EXPORT1(h_sum);
         EXPORT1(h_sqr_sum);
         EXPORT1(h_abs_sum);
 //            EXPORT1(scalar_mul);
+        EXPORT1(sliding_mean);
+        EXPORT1(sliding_rms);
 
         EXPORT1(scale_add3);
         EXPORT1(scale_sub3);
@@ -203,6 +207,10 @@ namespace sse
         EXPORT1(packed_direct_fft);
         EXPORT1(reverse_fft);
         EXPORT1(packed_reverse_fft);
+        EXPORT1(real_direct_fft);
+        EXPORT1(real_reverse_fft);
+        IF_ARCH_X86_64(EXPORT2(planned_direct_fft, x64_planned_direct_fft));
+        IF_ARCH_X86_64(EXPORT2(planned_reverse_fft, x64_planned_reverse_fft));
 //            EXPORT1(center_fft);
 //            EXPORT1(combine_fft);
 
@@ -210,6 +218,7 @@ namespace sse
         EXPORT1(fastconv_parse_apply);
         EXPORT1(fastconv_restore);
         EXPORT1(fastconv_apply);
+        EXPORT1(fastconv_accumulate);
 
         EXPORT1(complex_mul2);
         EXPORT1(complex_mul3);
@@ -245,6 +254,8 @@ namespace sse
         EXPORT1(biquad_process_x2);
         EXPORT1(biquad_process_x4);
         EXPORT1(biquad_process_x8);
+        EXPORT1(biquad_process_mc4);
+        EXPORT1(biquad_process_mc8);
 
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
@@ -256,6 +267,8 @@ namespace sse
         EXPORT1(bilinear_transform_x4);
         EXPORT1(bilinear_transform_x8);
 
+        EXPORT1(interpolate_cascades);
+
         EXPORT1(axis_apply_log1);
         EXPORT1(axis_apply_log2);
         EXPORT1(rgba32_to_bgra32);
@@ -279,6 +292,12 @@ namespace sse
         EXPORT1(downsample_6x);
         EXPORT1(downsample_8x);
 
+        EXPORT1(halfband_upsample_2x);
+        EXPORT1(halfband_downsample_2x);
+
+        EXPORT1(dyn_gain);
+        EXPORT1(dyn_curve);
+
         // 3D Math
         EXPORT1(init_point_xyz);
         EXPORT1(init_point);
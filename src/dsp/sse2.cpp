@@ -48,6 +48,8 @@ namespace sse2 // TODO: make constants common for all architectures
 
 #include <dsp/arch/x86/sse2/float.h>
 #include <dsp/arch/x86/sse2/search.h>
+#include <dsp/arch/x86/sse2/wavetable.h>
+#include <dsp/arch/x86/sse2/random.h>
 #include <dsp/arch/x86/sse2/graphics.h>
 #include <dsp/arch/x86/sse2/graphics/effects.h>
 
@@ -101,6 +103,12 @@ namespace sse2
         EXPORT1(abs_max_index);
         EXPORT1(abs_minmax_index);
 
+        EXPORT1(rand_uniform);
+        EXPORT1(rand_triangle);
+        EXPORT1(rand_gaussian);
+
+        EXPORT1(wavetable);
+
         EXPORT1(hsla_to_rgba);
         EXPORT1(rgba_to_hsla);
         EXPORT1(rgba_to_bgra32);
@@ -11,6 +11,7 @@
 #include <core/debug.h>
 #include <core/status.h>
 #include <core/fade.h>
+#include <core/util/ConvolverCache.h>
 
 #include <string.h>
 
@@ -919,10 +920,21 @@ namespace lsp
             if ((s == NULL) || (!s->valid()) || (s->channels() <= track))
                 continue;
 
+            // Get prepared convolution data, it may be shared with other convolvers
+            ConvolverData *cd   = ConvolverCache::get(s->getBuffer(track), s->length(), cfg[i].nRank);
+            if (cd == NULL)
+                return STATUS_NO_MEM;
+
             // Now we can create convolver
             Convolver *cv   = new Convolver();
-            if (!cv->init(s->getBuffer(track), s->length(), cfg[i].nRank, float((phase + i*step)& 0x7fffffff)/float(0x80000000)))
+            bool res        = cv->init(cd, float((phase + i*step)& 0x7fffffff)/float(0x80000000), true);
+            ConvolverCache::release(cd);
+            if (!res)
+            {
+                cv->destroy();
+                delete cv;
                 return STATUS_NO_MEM;
+            }
             c->pSwap        = cv;
         }
 
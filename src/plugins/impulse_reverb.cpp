@@ -11,6 +11,7 @@
 #include <core/debug.h>
 #include <core/status.h>
 #include <core/fade.h>
+#include <core/util/ConvolverCache.h>
 
 #include <stdlib.h>
 #include <string.h>
@@ -714,6 +715,21 @@ namespace lsp
                     vFiles[i].bRender   = false;
             }
         }
+        else if ((sConfigurator.completed()) && (sConfigurator.code() == STATUS_CANCELLED))
+        {
+            // Reconfiguration has been superseded by the new request, drop the result
+            // and restore render flags, convolvers and samples will be destroyed by
+            // the next reconfiguration
+            for (size_t i=0; i<impulse_reverb_base_metadata::FILES; ++i)
+            {
+                af_descriptor_t *f = &vFiles[i];
+                if (sConfigurator.render(i))
+                    f->bRender          = true;
+                f->bSwap            = false;
+            }
+
+            sConfigurator.reset();
+        }
         else if (sConfigurator.completed())
         {
             // Update samples
@@ -750,6 +766,12 @@ namespace lsp
             // Reset configurator
             sConfigurator.reset();
         }
+        else if ((nReconfigReq != nReconfigResp) && (!sConfigurator.cancelled()))
+        {
+            // The result of active reconfiguration will be outdated, abort it
+            lsp_trace("cancelling outdated configuration task");
+            sConfigurator.cancel();
+        }
     }
 
     void impulse_reverb_base::process(size_t samples)
@@ -979,6 +1001,8 @@ namespace lsp
             // Do we need to re-render file?
             if (!cfg[i].bRender)
                 continue;
+            if (sConfigurator.cancelled())
+                return STATUS_CANCELLED;
 
             // Get audio file
             af_descriptor_t *f  = &vFiles[i];
@@ -1055,6 +1079,8 @@ namespace lsp
         for (size_t i=0; i<impulse_reverb_base_metadata::CONVOLVERS; ++i)
         {
             convolver_t *c      = &vConvolvers[i];
+            if (sConfigurator.cancelled())
+                return STATUS_CANCELLED;
 
             // Check that routing has changed
             size_t file     = cfg->nFile[i];
@@ -1073,9 +1099,16 @@ namespace lsp
             if ((s == NULL) || (!s->valid()) || (s->channels() <= track))
                 continue;
 
+            // Get prepared convolution data, it may be shared with other convolvers
+            ConvolverData *cd   = ConvolverCache::get(s->getBuffer(track), s->length(), cfg->nRank[i]);
+            if (cd == NULL)
+                return STATUS_NO_MEM;
+
             // Now we can create convolver
             Convolver *cv   = new Convolver();
-            if (!cv->init(s->getBuffer(track), s->length(), cfg->nRank[i], float((phase + i*step)& 0x7fffffff)/float(0x80000000)))
+            bool res        = cv->init(cd, float((phase + i*step)& 0x7fffffff)/float(0x80000000), true);
+            ConvolverCache::release(cd);
+            if (!res)
             {
                 cv->destroy();
                 delete cv;
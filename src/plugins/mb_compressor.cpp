@@ -11,6 +11,7 @@
 #include <plugins/mb_compressor.h>
 
 #define MBC_BUFFER_SIZE         0x1000
+#define MBC_FILTER_STEP         1           /* Interpolation step of dynamic filters, 1 means exact coefficients */
 #define TRACE_PORT(p)           lsp_trace("  port id=%s", (p)->metadata()->id);
 
 namespace lsp
@@ -148,6 +149,7 @@ namespace lsp
         // Initialize filters according to number of bands
         if (sFilters.init(mb_compressor_base_metadata::BANDS_MAX * channels) != STATUS_OK)
             return;
+        sFilters.set_interpolation(MBC_FILTER_STEP);
         size_t filter_cid = 0;
 
         // Initialize channels
@@ -41,6 +41,10 @@ namespace lsp
             path->commit();
         }
 
+        // Newer request has been received
+        if (cancelled())
+            return STATUS_CANCELLED;
+
         status_t status = pCore->sSyncChirpProcessor.load_from_lspc(path->get_path());
 
 //        if (status != STATUS_OK)
@@ -74,6 +78,8 @@ namespace lsp
 
         if (!pCore->bDataLoaded)
             return STATUS_NO_DATA;
+        if (cancelled())
+            return STATUS_CANCELLED;
 
         status_t status = STATUS_OK;
 
@@ -382,6 +388,9 @@ namespace lsp
         pLoader                 = new Loader(this);
         pPreparator             = new Preparator(this);
 
+        // Loaded data is always prepared in the same executor thread
+        pLoader->set_continuation(pPreparator);
+
         sSyncChirpProcessor.init();
         sOverPrepare.init();
         sOverProcess.init();
@@ -502,6 +511,20 @@ namespace lsp
         }
     }
 
+    bool nonlinear_convolver_mono::cancel_tasks()
+    {
+        // Idle preparator is cancelled only when it is going to be executed
+        // as continuation of loader, otherwise the flag would not be reset
+        bool chain      = !pLoader->idle();
+        if (chain)
+            pLoader->cancel();
+        if ((chain) || (!pPreparator->idle()))
+            pPreparator->cancel();
+
+        // Tasks are still busy until the last task of chain completes
+        return (chain) ? !pPreparator->completed() : !(pPreparator->idle() || pPreparator->completed());
+    }
+
     void nonlinear_convolver_mono::process(size_t samples)
     {
         float *in = pIn->getBuffer<float>();
@@ -512,24 +535,18 @@ namespace lsp
         if (out == NULL)
             return;
 
-        if (bSwitch2Loading)
-        {
-            pLoader->reset();
-            pPreparator->reset();
-
-            nState = LOADING;
-
-            bSwitch2Loading = false;
-        }
-
-        if (bSwitch2Prepare)
+        if ((bSwitch2Loading) || (bSwitch2Prepare))
         {
-            pLoader->reset();
-            pPreparator->reset();
-
-            nState = PREPARE;
+            // Outdated tasks should be cancelled and complete first
+            if (!cancel_tasks())
+            {
+                pLoader->reset();
+                pPreparator->reset();
 
-            bSwitch2Prepare = false;
+                nState          = (bSwitch2Loading) ? LOADING : PREPARE;
+                bSwitch2Loading = false;
+                bSwitch2Prepare = false;
+            }
         }
 
         while (samples > 0)
@@ -540,17 +557,20 @@ namespace lsp
             {
                 case LOADING:
                 {
-                    if (pLoader->idle())
+                    // Preparator is executed as continuation of loader
+                    if ((pLoader->idle()) && (pPreparator->idle()))
                         pExecutor->submit(pLoader);
 
-                    if (pLoader->completed())
+                    // Preparator is completed with loader's code if loading fails
+                    if (pPreparator->completed())
                     {
-                        if (pLoader->successful())
-                            nState = PREPARE;
+                        if (pPreparator->successful())
+                            nState = PROCESSING;
                         else
                             nState = IDLE;
 
                         pLoader->reset();
+                        pPreparator->reset();
                     }
 
                     dsp::fill_zero(vBuffer, to_do);
@@ -559,7 +579,7 @@ namespace lsp
 
                 case PREPARE:
                 {
-                    if (pPreparator->idle())
+                    if ((pLoader->idle()) && (pPreparator->idle()))
                         pExecutor->submit(pPreparator);
 
                     if (pPreparator->completed())
@@ -677,9 +697,8 @@ namespace lsp
         // Was the trigger pressed (are we passing from false to true?). Also,
         // was a new file loaded? In the case, we cannot jump to prepare, but
         // we will go to loading first.
+        // The request stays pending until process() applies it.
         if (!previousTrigger && bDSP_Prepare_Trigger && !bSwitch2Loading)
             bSwitch2Prepare     = true;
-        else
-            bSwitch2Prepare     = false;
     }
 }
@@ -0,0 +1,813 @@
+/*
+ * PluginBench.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <core/alloc.h>
+#include <core/sugar.h>
+#include <core/stdlib/stdio.h>
+#include <core/midi.h>
+#include <core/ipc/Thread.h>
+#include <plugins/plugins.h>
+#include <core/files/lspc/LSPCAudioWriter.h>
+#include <test/PluginBench.h>
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define BENCH_SIGNAL_LENGTH         0x10000     /* Length of the synthetic signal in samples */
+#define BENCH_BURST_RATE            8           /* Number of noise bursts and notes per second */
+#define BENCH_BURST_DECAY           0.02f       /* Decay time of the noise burst in seconds */
+
+using namespace lsp;
+
+namespace test
+{
+    class BenchPort: public IPort
+    {
+        public:
+            explicit BenchPort(const port_t *meta): IPort(meta) {}
+            virtual ~BenchPort() {}
+
+        public:
+            virtual status_t init()     { return STATUS_OK; }
+            virtual void destroy()      { }
+            virtual bool idle()         { return true; }
+    };
+
+    class BenchAudioPort: public BenchPort
+    {
+        private:
+            float      *pBuffer;
+            uint8_t    *pData;
+
+        public:
+            explicit BenchAudioPort(const port_t *meta): BenchPort(meta)
+            {
+                pBuffer     = NULL;
+                pData       = NULL;
+            }
+
+            virtual ~BenchAudioPort()
+            {
+                destroy();
+            }
+
+        public:
+            status_t alloc(size_t samples)
+            {
+                pBuffer     = alloc_aligned<float>(pData, samples);
+                if (pBuffer == NULL)
+                    return STATUS_NO_MEM;
+                dsp::fill_zero(pBuffer, samples);
+                return STATUS_OK;
+            }
+
+            inline void bind(float *buf)    { pBuffer = buf; }
+
+            virtual void *getBuffer()       { return pBuffer; }
+
+            virtual void destroy()
+            {
+                free_aligned(pData);
+                pBuffer     = NULL;
+            }
+    };
+
+    class BenchMidiPort: public BenchPort
+    {
+        private:
+            midi_t      sMidi;
+
+        public:
+            explicit BenchMidiPort(const port_t *meta): BenchPort(meta)
+            {
+                sMidi.clear();
+            }
+
+        public:
+            inline midi_t *midi()           { return &sMidi; }
+
+            virtual void *getBuffer()       { return &sMidi; }
+
+            virtual void post_process(size_t samples)
+            {
+                sMidi.clear();
+            }
+    };
+
+    class BenchControlPort: public BenchPort
+    {
+        private:
+            float       fNewValue;
+            float       fCurrValue;
+
+        public:
+            explicit BenchControlPort(const port_t *meta): BenchPort(meta)
+            {
+                fNewValue   = meta->start;
+                fCurrValue  = meta->start;
+            }
+
+        public:
+            virtual bool pre_process(size_t samples)
+            {
+                if (fNewValue == fCurrValue)
+                    return false;
+
+                fCurrValue  = fNewValue;
+                return true;
+            }
+
+            virtual float getValue()        { return fCurrValue; }
+
+            void submit(float value)
+            {
+                fNewValue   = limit_value(pMetadata, value);
+            }
+    };
+
+    class BenchMeterPort: public BenchPort
+    {
+        private:
+            float       fValue;
+
+        public:
+            explicit BenchMeterPort(const port_t *meta): BenchPort(meta)
+            {
+                fValue      = meta->start;
+            }
+
+        public:
+            virtual float getValue()        { return fValue; }
+            virtual void setValue(float value) { fValue = value; }
+    };
+
+    class BenchPortGroup: public BenchPort
+    {
+        private:
+            float       fNewRow;
+            float       fCurrRow;
+            size_t      nRows;
+
+        public:
+            explicit BenchPortGroup(const port_t *meta): BenchPort(meta)
+            {
+                fNewRow     = meta->start;
+                fCurrRow    = meta->start;
+                nRows       = list_size(meta->items);
+            }
+
+        public:
+            virtual bool pre_process(size_t samples)
+            {
+                if (fNewRow == fCurrRow)
+                    return false;
+
+                fCurrRow    = fNewRow;
+                return true;
+            }
+
+            virtual float getValue()        { return fCurrRow; }
+
+            void submit(float value)
+            {
+                ssize_t v   = value;
+                if ((v >= 0) && (v < ssize_t(nRows)))
+                    fNewRow     = v;
+            }
+
+            inline size_t rows() const      { return nRows; }
+    };
+
+    class BenchMeshPort: public BenchPort
+    {
+        private:
+            mesh_t     *pMesh;
+            uint8_t    *pData;
+
+        public:
+            explicit BenchMeshPort(const port_t *meta): BenchPort(meta)
+            {
+                pMesh       = NULL;
+                pData       = NULL;
+            }
+
+            virtual ~BenchMeshPort()
+            {
+                destroy();
+            }
+
+        public:
+            virtual status_t init()
+            {
+                size_t buffers      = pMetadata->step;
+                size_t buf_size     = ALIGN_SIZE(size_t(pMetadata->start) * sizeof(float), DEFAULT_ALIGN);
+                size_t mesh_size    = ALIGN_SIZE(sizeof(mesh_t) + sizeof(float *) * buffers, DEFAULT_ALIGN);
+
+                uint8_t *ptr        = alloc_aligned<uint8_t>(pData, mesh_size + buf_size * buffers);
+                if (ptr == NULL)
+                    return STATUS_NO_MEM;
+
+                pMesh               = reinterpret_cast<mesh_t *>(ptr);
+                ptr                += mesh_size;
+                for (size_t i=0; i<buffers; ++i, ptr += buf_size)
+                    pMesh->pvData[i]    = reinterpret_cast<float *>(ptr);
+                pMesh->cleanup();
+
+                return STATUS_OK;
+            }
+
+            virtual void *getBuffer()       { return pMesh; }
+
+            virtual void post_process(size_t samples)
+            {
+                // Emulate the UI which immediately consumes the data
+                if ((pMesh != NULL) && (pMesh->containsData()))
+                    pMesh->markEmpty();
+            }
+
+            virtual void destroy()
+            {
+                free_aligned(pData);
+                pMesh       = NULL;
+            }
+    };
+
+    class BenchFrameBufferPort: public BenchPort
+    {
+        private:
+            frame_buffer_t  sFB;
+
+        public:
+            explicit BenchFrameBufferPort(const port_t *meta): BenchPort(meta) {}
+
+            virtual ~BenchFrameBufferPort()
+            {
+                destroy();
+            }
+
+        public:
+            virtual status_t init()         { return sFB.init(pMetadata->start, pMetadata->step); }
+            virtual void *getBuffer()       { return &sFB; }
+            virtual void destroy()          { sFB.destroy(); }
+    };
+
+    typedef struct bench_path_t: public path_t
+    {
+        char        sPath[PATH_MAX];
+        bool        bPending;
+        bool        bAccepted;
+
+        virtual void init()
+        {
+            sPath[0]        = '\0';
+            bPending        = false;
+            bAccepted       = false;
+        }
+
+        virtual const char *get_path()  { return sPath; }
+        virtual bool pending()          { return (bPending) && (!bAccepted); }
+        virtual bool accepted()         { return bAccepted; }
+
+        virtual void accept()
+        {
+            if (bPending)
+                bAccepted       = true;
+        }
+
+        virtual void commit()
+        {
+            bPending        = false;
+            bAccepted       = false;
+        }
+
+        void submit(const char *path)
+        {
+            strncpy(sPath, path, PATH_MAX);
+            sPath[PATH_MAX-1]   = '\0';
+            bAccepted       = false;
+            bPending        = true;
+        }
+    } bench_path_t;
+
+    class BenchPathPort: public BenchPort
+    {
+        private:
+            bench_path_t    sPath;
+
+        public:
+            explicit BenchPathPort(const port_t *meta): BenchPort(meta)
+            {
+                sPath.init();
+            }
+
+        public:
+            virtual void *getBuffer()       { return static_cast<path_t *>(&sPath); }
+            virtual bool pre_process(size_t samples) { return sPath.pending(); }
+            virtual bool idle()             { return !sPath.bPending; }
+
+            inline void submit(const char *path) { sPath.submit(path); }
+    };
+
+    PluginBench::PluginBench()
+    {
+        pPlugin         = NULL;
+        pExecutor       = NULL;
+        vSignal         = NULL;
+        nSignalLength   = 0;
+        nOffset         = 0;
+        nBlockSize      = 0;
+        nNoteInterval   = 0;
+        nNoteCounter    = 0;
+        nNotes          = 0;
+        bUpdateSettings = true;
+        pData           = NULL;
+
+        position_t::init(&sPosition);
+    }
+
+    PluginBench::~PluginBench()
+    {
+        destroy();
+    }
+
+    bool PluginBench::match(const char *pattern, const char *id)
+    {
+        while (*pattern != '\0')
+        {
+            if (*pattern == '*')
+            {
+                for (++pattern; ; ++id)
+                {
+                    if (match(pattern, id))
+                        return true;
+                    if (*id == '\0')
+                        return false;
+                }
+            }
+            else if (*(pattern++) != *(id++))
+                return false;
+        }
+
+        return *id == '\0';
+    }
+
+    plugin_t *PluginBench::create_plugin(const char *id)
+    {
+        #define MOD_PLUGIN(plugin) \
+            if (!strcmp(id, #plugin)) \
+                return new plugin();
+        #include <metadata/modules.h>
+
+        return NULL;
+    }
+
+    status_t PluginBench::create_port(const port_t *port, const char *postfix)
+    {
+        BenchPort *bp   = NULL;
+
+        switch (port->role)
+        {
+            case R_AUDIO:
+            {
+                BenchAudioPort *ap  = new BenchAudioPort(port);
+                if ((ap != NULL) && (IS_OUT_PORT(port)) && (ap->alloc(nBlockSize) != STATUS_OK))
+                {
+                    delete ap;
+                    return STATUS_NO_MEM;
+                }
+                bp      = ap;
+                break;
+            }
+            case R_MIDI:
+                bp      = new BenchMidiPort(port);
+                break;
+            case R_CONTROL:
+                bp      = new BenchControlPort(port);
+                break;
+            case R_METER:
+                bp      = new BenchMeterPort(port);
+                break;
+            case R_MESH:
+                bp      = new BenchMeshPort(port);
+                break;
+            case R_FBUFFER:
+                bp      = new BenchFrameBufferPort(port);
+                break;
+            case R_PATH:
+                bp      = new BenchPathPort(port);
+                break;
+
+            case R_PORT_SET:
+            {
+                char postfix_buf[LSP_MAX_PARAM_ID_BYTES];
+                BenchPortGroup *pg  = new BenchPortGroup(port);
+                if (pg == NULL)
+                    return STATUS_NO_MEM;
+                if ((!vPorts.add(pg)) || (!pPlugin->add_port(pg)))
+                {
+                    delete pg;
+                    return STATUS_NO_MEM;
+                }
+
+                for (size_t row=0; row<pg->rows(); ++row)
+                {
+                    snprintf(postfix_buf, sizeof(postfix_buf)-1, "%s_%d", (postfix != NULL) ? postfix : "", int(row));
+
+                    port_t *cm          = clone_port_metadata(port->members, postfix_buf);
+                    if ((cm == NULL) || (!vGenMetadata.add(cm)))
+                    {
+                        if (cm != NULL)
+                            drop_port_metadata(cm);
+                        return STATUS_NO_MEM;
+                    }
+
+                    for (; cm->id != NULL; ++cm)
+                    {
+                        if (IS_GROWING_PORT(cm))
+                            cm->start    = cm->min + ((cm->max - cm->min) * row) / float(pg->rows());
+                        else if (IS_LOWERING_PORT(cm))
+                            cm->start    = cm->max - ((cm->max - cm->min) * row) / float(pg->rows());
+
+                        status_t res = create_port(cm, postfix_buf);
+                        if (res != STATUS_OK)
+                            return res;
+                    }
+                }
+
+                return STATUS_OK;
+            }
+
+            default:
+                bp      = new BenchPort(port);
+                break;
+        }
+
+        if (bp == NULL)
+            return STATUS_NO_MEM;
+
+        status_t res    = bp->init();
+        if ((res == STATUS_OK) && ((!vPorts.add(bp)) || (!pPlugin->add_port(bp))))
+            res             = STATUS_NO_MEM;
+        if (res != STATUS_OK)
+        {
+            vPorts.remove(bp);
+            bp->destroy();
+            delete bp;
+        }
+
+        return res;
+    }
+
+    void PluginBench::generate_signal(long sample_rate)
+    {
+        size_t period   = sample_rate / BENCH_BURST_RATE;
+        float k         = 1.0f / (BENCH_BURST_DECAY * sample_rate);
+        uint32_t seed   = 0x1234567;
+
+        // Decaying noise bursts over the noise floor
+        for (size_t i=0; i<nSignalLength; ++i)
+        {
+            seed            = seed * 1103515245 + 12345;
+            float noise     = float(int32_t(seed >> 8) - 0x800000) / float(0x800000);
+            float env       = 0.5f * expf(-float(i % period) * k) + 1e-3f;
+            vSignal[i]      = noise * env;
+        }
+    }
+
+    void PluginBench::collect_notes()
+    {
+        // Prefer notes assigned to instruments of the plugin
+        nNotes          = 0;
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *p        = vPorts.at(i);
+            const port_t *meta  = p->metadata();
+            if ((meta->role != R_METER) || (strncmp(meta->id, "mn", 2) != 0))
+                continue;
+
+            ssize_t note        = p->getValue();
+            if ((note < 0) || (note >= 128))
+                continue;
+
+            bool found          = false;
+            for (size_t j=0; j<nNotes; ++j)
+                if (vNotes[j] == note)
+                {
+                    found               = true;
+                    break;
+                }
+            if (!found)
+                vNotes[nNotes++]    = note;
+        }
+
+        // Use middle C if plugin does not assign notes
+        if (nNotes <= 0)
+            vNotes[nNotes++]    = 60;
+    }
+
+    void PluginBench::emit_midi(size_t samples)
+    {
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *p        = vPorts.at(i);
+            const port_t *meta  = p->metadata();
+            if ((meta->role != R_MIDI) || (!IS_IN_PORT(meta)))
+                continue;
+
+            midi_t *midi        = static_cast<BenchMidiPort *>(p)->midi();
+            midi->clear();
+
+            // Emit note-on at the beginning of the interval and note-off in the middle
+            size_t half         = nNoteInterval >> 1;
+            size_t first        = sPosition.frame;
+            size_t last         = first + samples;
+            size_t t            = (first / half) * half;
+            if (t < first)
+                t                  += half;
+
+            for (size_t counter = nNoteCounter; t < last; t += half)
+            {
+                midi_event_t ev;
+                bool on             = (t % nNoteInterval) == 0;
+                ev.timestamp        = t - first;
+                ev.type             = (on) ? MIDI_MSG_NOTE_ON : MIDI_MSG_NOTE_OFF;
+                ev.channel          = 0;
+                ev.note.pitch       = vNotes[(on) ? counter % nNotes : (counter - 1) % nNotes];
+                ev.note.velocity    = (on) ? 100 : 0;
+                if (on)
+                    ++counter;
+                midi->push(ev);
+            }
+        }
+
+        for (size_t t = sPosition.frame; t < sPosition.frame + samples; ++t)
+            if ((t % nNoteInterval) == 0)
+                ++nNoteCounter;
+    }
+
+    status_t PluginBench::write_sample(const char *path, size_t channels, size_t frames, long sample_rate)
+    {
+        LSPCFile fd;
+        LSPCAudioWriter aw;
+        lspc_audio_parameters_t p;
+
+        status_t res        = fd.create(path);
+        if (res != STATUS_OK)
+            return res;
+
+        p.channels          = channels;
+        p.sample_format     = LSPC_SAMPLE_FMT_F32LE;
+        p.sample_rate       = sample_rate;
+        p.codec             = LSPC_CODEC_PCM;
+        p.frames            = frames;
+        res                 = aw.open(&fd, &p);
+
+        float frame[8];
+        float k             = -5.0f / frames;
+        uint32_t seed       = 0x7654321;
+        if (channels > (sizeof(frame) / sizeof(float)))
+            res                 = STATUS_BAD_ARGUMENTS;
+
+        for (size_t i=0; (res == STATUS_OK) && (i<frames); ++i)
+        {
+            for (size_t j=0; j<channels; ++j)
+            {
+                seed                = seed * 1103515245 + 12345;
+                frame[j]            = float(int32_t(seed >> 8) - 0x800000) / float(0x800000) * expf(k * i);
+            }
+            res                 = aw.write_frames(frame, 1);
+        }
+
+        status_t res2       = aw.close();
+        if (res == STATUS_OK)
+            res                 = res2;
+        res2                = fd.close();
+
+        return (res == STATUS_OK) ? res2 : res;
+    }
+
+    status_t PluginBench::init(const char *id, long sample_rate, size_t block_size)
+    {
+        destroy();
+
+        if ((id == NULL) || (sample_rate <= 0) || (block_size <= 0))
+            return STATUS_BAD_ARGUMENTS;
+
+        // Allocate synthetic signal
+        nBlockSize      = block_size;
+        nSignalLength   = ALIGN_SIZE(BENCH_SIGNAL_LENGTH + block_size, DEFAULT_ALIGN);
+        vSignal         = alloc_aligned<float>(pData, nSignalLength);
+        if (vSignal == NULL)
+            return STATUS_NO_MEM;
+        generate_signal(sample_rate);
+
+        nOffset         = 0;
+        nNoteInterval   = sample_rate / BENCH_BURST_RATE;
+        nNoteCounter    = 0;
+        nNotes          = 0;
+
+        // Create plugin and ports
+        pPlugin         = create_plugin(id);
+        if (pPlugin == NULL)
+        {
+            destroy();
+            return STATUS_NOT_FOUND;
+        }
+
+        for (const port_t *meta = pPlugin->get_metadata()->ports ; meta->id != NULL; ++meta)
+        {
+            status_t res = create_port(meta, NULL);
+            if (res != STATUS_OK)
+            {
+                destroy();
+                return res;
+            }
+        }
+
+        // Initialize and activate plugin
+        pPlugin->init(this);
+        pPlugin->set_sample_rate(sample_rate);
+        sPosition.sampleRate    = sample_rate;
+        sPosition.speed         = 1.0f;
+        sPosition.frame         = 0;
+        pPlugin->set_position(&sPosition);
+        bUpdateSettings         = true;
+        pPlugin->activate();
+
+        // Perform the first cycle to apply settings and discover notes of instruments
+        collect_notes();
+        process(nBlockSize);
+        collect_notes();
+
+        return STATUS_OK;
+    }
+
+    void PluginBench::destroy()
+    {
+        if (pPlugin != NULL)
+        {
+            pPlugin->deactivate();
+            pPlugin->destroy();
+            delete pPlugin;
+            pPlugin     = NULL;
+        }
+
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *p    = vPorts.at(i);
+            p->destroy();
+            delete p;
+        }
+        vPorts.flush();
+
+        for (size_t i=0, n=vGenMetadata.size(); i<n; ++i)
+            drop_port_metadata(vGenMetadata.at(i));
+        vGenMetadata.flush();
+
+        if (pExecutor != NULL)
+        {
+            pExecutor->shutdown();
+            delete pExecutor;
+            pExecutor   = NULL;
+        }
+
+        free_aligned(pData);
+        vSignal         = NULL;
+        nSignalLength   = 0;
+        nBlockSize      = 0;
+    }
+
+    size_t PluginBench::set_value(const char *pattern, float value)
+    {
+        size_t count = 0;
+
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *p        = vPorts.at(i);
+            const port_t *meta  = p->metadata();
+            if (!match(pattern, meta->id))
+                continue;
+
+            if (meta->role == R_CONTROL)
+                static_cast<BenchControlPort *>(p)->submit(value);
+            else if (meta->role == R_PORT_SET)
+                static_cast<BenchPortGroup *>(p)->submit(value);
+            else
+                continue;
+            ++count;
+        }
+
+        return count;
+    }
+
+    size_t PluginBench::set_path(const char *pattern, const char *path)
+    {
+        size_t count = 0;
+
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *p        = vPorts.at(i);
+            const port_t *meta  = p->metadata();
+            if ((meta->role != R_PATH) || (!match(pattern, meta->id)))
+                continue;
+
+            static_cast<BenchPathPort *>(p)->submit(path);
+            ++count;
+        }
+
+        return count;
+    }
+
+    status_t PluginBench::wait_loaded(size_t timeout)
+    {
+        for (size_t time = 0; time <= timeout; ++time)
+        {
+            process(nBlockSize);
+
+            bool idle = true;
+            for (size_t i=0, n=vPorts.size(); i<n; ++i)
+            {
+                if (!vPorts.at(i)->idle())
+                {
+                    idle    = false;
+                    break;
+                }
+            }
+
+            if (idle)
+            {
+                collect_notes();
+                return STATUS_OK;
+            }
+
+            ipc::Thread::sleep(1);
+        }
+
+        return STATUS_TIMED_OUT;
+    }
+
+    void PluginBench::process(size_t samples)
+    {
+        if (samples > nBlockSize)
+            samples     = nBlockSize;
+
+        // Bind input buffers to the synthetic signal
+        if ((nOffset + samples) > nSignalLength)
+            nOffset     = 0;
+        float *src      = &vSignal[nOffset];
+
+        size_t n_ports  = vPorts.size();
+        for (size_t i=0; i<n_ports; ++i)
+        {
+            BenchPort *p        = vPorts.at(i);
+            const port_t *meta  = p->metadata();
+            if ((meta->role == R_AUDIO) && (IS_IN_PORT(meta)))
+                static_cast<BenchAudioPort *>(p)->bind(src);
+            if (p->pre_process(samples))
+                bUpdateSettings     = true;
+        }
+        emit_midi(samples);
+
+        if (bUpdateSettings)
+        {
+            pPlugin->update_settings();
+            bUpdateSettings     = false;
+        }
+
+        pPlugin->process(samples);
+
+        for (size_t i=0; i<n_ports; ++i)
+            vPorts.at(i)->post_process(samples);
+
+        nOffset            += samples;
+        sPosition.frame    += samples;
+    }
+
+    ipc::IExecutor *PluginBench::get_executor()
+    {
+        if (pExecutor != NULL)
+            return pExecutor;
+
+        ipc::NativeExecutor *exec = new ipc::NativeExecutor();
+        if (exec == NULL)
+            return NULL;
+        if (exec->start() != STATUS_OK)
+        {
+            delete exec;
+            return NULL;
+        }
+
+        return pExecutor = exec;
+    }
+
+    const position_t *PluginBench::position()
+    {
+        return &sPosition;
+    }
+}
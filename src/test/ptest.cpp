@@ -46,6 +46,8 @@ namespace test
             free(stats->time_cost);
         if (stats->rel != NULL)
             free(stats->rel);
+        if (stats->rtf != NULL)
+            free(stats->rtf);
     }
 
     void PerformanceTest::estimate(size_t *len, const char *text)
@@ -55,7 +57,7 @@ namespace test
             *len = slen;
     }
 
-    void PerformanceTest::gather_stats(const char *key, double time, wsize_t iterations)
+    void PerformanceTest::gather_stats(const char *key, double time, wsize_t iterations, size_t samples, size_t sample_rate)
     {
         size_t count    = __test_stats.size();
         stats_t *stats  = __test_stats.add();
@@ -69,6 +71,11 @@ namespace test
         stats->performance  = NULL;
         stats->time_cost    = NULL;
         stats->rel          = NULL;
+        stats->rtf          = NULL;
+        stats->seconds      = time;
+        stats->count        = iterations;
+        stats->samples      = samples;
+        stats->sample_rate  = sample_rate;
 
         if (key == NULL)
         {
@@ -121,6 +128,12 @@ namespace test
             n = asprintf(&stats->performance, "%.2f", (iterations / time));
         if (n >= 0)
             n = asprintf(&stats->time_cost, "%.4f", (1000000.0 * time) / iterations);
+        if ((n >= 0) && (samples > 0) && (sample_rate > 0))
+        {
+            n = asprintf(&stats->rtf, "%.2f", (double(iterations) * samples) / (double(sample_rate) * time));
+            if (n < 0)
+                stats->rtf = NULL;
+        }
 
         if ((n < 0) ||
             (stats->key == NULL) ||
@@ -179,6 +192,8 @@ namespace test
         size_t performance  = strlen("Perf[i/s]");
         size_t time_cost    = strlen("Cost[us/i]");
         size_t rel          = strlen("Rel[%]");
+        size_t rtf          = strlen("RTF");
+        bool rtf_col        = false;
 
         // Estimate size of all columns
         for (size_t i=0, n=__test_stats.size(); i < n; ++i)
@@ -193,6 +208,9 @@ namespace test
             estimate(&performance, stats->performance);
             estimate(&time_cost, stats->time_cost);
             estimate(&rel, stats->rel);
+            estimate(&rtf, stats->rtf);
+            if (stats->rtf != NULL)
+                rtf_col         = true;
         }
 
         // Output table header
@@ -204,6 +222,8 @@ namespace test
         out_text(out, n_iterations, "Est", 1, "─", "┬");
         out_text(out, performance, "Perf[i/s]", 1, "─", "┬");
         out_text(out, time_cost, "Cost[us/i]", 1, "─", "┬");
+        if (rtf_col)
+            out_text(out, rtf, "RTF", 1, "─", "┬");
         out_text(out, rel, "Rel[%]", 1, "─", "┐\n");
 
         int separator = 0;
@@ -224,6 +244,8 @@ namespace test
                     out_text(out, n_iterations, NULL, 1, "─", "┼");
                     out_text(out, performance, NULL, 1, "─", "┼");
                     out_text(out, time_cost, NULL, 1, "─", "┼");
+                    if (rtf_col)
+                        out_text(out, rtf, NULL, 1, "─", "┼");
                     out_text(out, rel, NULL, 1, "─", "┤\n");
                 }
                 else if (separator == 2)
@@ -236,6 +258,8 @@ namespace test
                     out_text(out, n_iterations, NULL, 1, "═", "╪");
                     out_text(out, performance, NULL, 1, "═", "╪");
                     out_text(out, time_cost, NULL, 1, "═", "╪");
+                    if (rtf_col)
+                        out_text(out, rtf, NULL, 1, "═", "╪");
                     out_text(out, rel, NULL, 1, "═", "╡\n");
                 }
                 separator = 0;
@@ -248,6 +272,8 @@ namespace test
                 out_text(out, n_iterations, stats->n_iterations, 1, " ", "│");
                 out_text(out, performance, stats->performance, 1, " ", "│");
                 out_text(out, time_cost, stats->time_cost, 1, " ", "│");
+                if (rtf_col)
+                    out_text(out, rtf, stats->rtf, 1, " ", "│");
                 out_text(out, rel, stats->rel, 1, " ", "│\n");
             }
             else
@@ -263,9 +289,125 @@ namespace test
         out_text(out, n_iterations, NULL, 1, "─", "┴");
         out_text(out, performance, NULL, 1, "─", "┴");
         out_text(out, time_cost, NULL, 1, "─", "┴");
+        if (rtf_col)
+            out_text(out, rtf, NULL, 1, "─", "┴");
         out_text(out, rel, NULL, 1, "─", "┘\n");
     }
 
+    void PerformanceTest::out_json_string(FILE *out, const char *text)
+    {
+        fputc('\"', out);
+        for ( ; (text != NULL) && (*text != '\0'); ++text)
+        {
+            uint8_t c = *text;
+            switch (c)
+            {
+                case '\"': fputs("\\\"", out); break;
+                case '\\': fputs("\\\\", out); break;
+                case '\n': fputs("\\n", out); break;
+                case '\r': fputs("\\r", out); break;
+                case '\t': fputs("\\t", out); break;
+                default:
+                    if (c < 0x20)
+                        fprintf(out, "\\u%04x", int(c));
+                    else
+                        fputc(c, out);
+                    break;
+            }
+        }
+        fputc('\"', out);
+    }
+
+    void PerformanceTest::out_csv_string(FILE *out, const char *text)
+    {
+        fputc('\"', out);
+        for ( ; (text != NULL) && (*text != '\0'); ++text)
+        {
+            if (*text == '\"')
+                fputc('\"', out);
+            fputc(*text, out);
+        }
+        fputc('\"', out);
+    }
+
+    void PerformanceTest::dump_json(FILE *out, const dsp::info_t *info) const
+    {
+        for (size_t i=0, n=__test_stats.size(); i < n; ++i)
+        {
+            stats_t *stats = __test_stats.at(i);
+            if ((stats->key == NULL) || (stats->count <= 0) || (stats->seconds <= 0.0))
+                continue;
+
+            double ips = stats->count / stats->seconds;
+
+            fputs("{\"test\":", out);
+            out_json_string(out, full_name());
+            fputs(",\"case\":", out);
+            out_json_string(out, stats->key);
+            if (info != NULL)
+            {
+                fputs(",\"arch\":", out);
+                out_json_string(out, info->arch);
+                fputs(",\"cpu\":", out);
+                out_json_string(out, info->cpu);
+                fputs(",\"features\":", out);
+                out_json_string(out, info->features);
+            }
+            fprintf(out, ",\"time\":%.6f,\"iterations\":%lld,\"ips\":%.6f,\"us_per_iter\":%.6f",
+                    stats->seconds, (long long)(stats->count), ips, 1000000.0 / ips);
+            if (stats->samples > 0)
+                fprintf(out, ",\"samples\":%lld,\"samples_per_s\":%.6f,\"ns_per_sample\":%.6f",
+                        (long long)(stats->samples), ips * stats->samples, 1000000000.0 / (ips * stats->samples));
+            else
+                fputs(",\"samples\":null,\"samples_per_s\":null,\"ns_per_sample\":null", out);
+            if ((stats->samples > 0) && (stats->sample_rate > 0))
+                fprintf(out, ",\"sample_rate\":%lld,\"rtf\":%.6f",
+                        (long long)(stats->sample_rate), (ips * stats->samples) / stats->sample_rate);
+            else
+                fputs(",\"sample_rate\":null,\"rtf\":null", out);
+            fputs("}\n", out);
+        }
+    }
+
+    void PerformanceTest::dump_csv_header(FILE *out)
+    {
+        fputs("test,case,arch,cpu,features,time,iterations,ips,us_per_iter,samples,samples_per_s,ns_per_sample,sample_rate,rtf\n", out);
+    }
+
+    void PerformanceTest::dump_csv(FILE *out, const dsp::info_t *info) const
+    {
+        for (size_t i=0, n=__test_stats.size(); i < n; ++i)
+        {
+            stats_t *stats = __test_stats.at(i);
+            if ((stats->key == NULL) || (stats->count <= 0) || (stats->seconds <= 0.0))
+                continue;
+
+            double ips = stats->count / stats->seconds;
+
+            out_csv_string(out, full_name());
+            fputc(',', out);
+            out_csv_string(out, stats->key);
+            fputc(',', out);
+            out_csv_string(out, (info != NULL) ? info->arch : NULL);
+            fputc(',', out);
+            out_csv_string(out, (info != NULL) ? info->cpu : NULL);
+            fputc(',', out);
+            out_csv_string(out, (info != NULL) ? info->features : NULL);
+            fprintf(out, ",%.6f,%lld,%.6f,%.6f",
+                    stats->seconds, (long long)(stats->count), ips, 1000000.0 / ips);
+            if (stats->samples > 0)
+                fprintf(out, ",%lld,%.6f,%.6f",
+                        (long long)(stats->samples), ips * stats->samples, 1000000000.0 / (ips * stats->samples));
+            else
+                fputs(",,,", out);
+            if ((stats->samples > 0) && (stats->sample_rate > 0))
+                fprintf(out, ",%lld,%.6f\n",
+                        (long long)(stats->sample_rate), (ips * stats->samples) / stats->sample_rate);
+            else
+                fputs(",,\n", out);
+        }
+    }
+
     void PerformanceTest::free_stats()
     {
         for (size_t i=0, n=__test_stats.size(); i < n; ++i)
@@ -0,0 +1,120 @@
+/*
+ * gain.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/dynamics/Compressor.h>
+#include <core/dynamics/Expander.h>
+#include <core/dynamics/Gate.h>
+#include <core/dynamics/DynamicProcessor.h>
+
+#define BUF_SIZE        0x1000
+#define SAMPLE_RATE     48000
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for gain curves: per-sample evaluation vs block evaluation
+PTEST_BEGIN("core.dynamics", gain, 5, 1000)
+
+    void test_compressor(float *out, const float *in)
+    {
+        Compressor c;
+        c.set_sample_rate(SAMPLE_RATE);
+        c.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        c.set_knee(GAIN_AMP_M_6_DB);
+        c.set_ratio(4.0f);
+        c.update_settings();
+
+        PTEST_SLOOP("compressor scalar", BUF_SIZE,
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                out[i]      = c.reduction(in[i]);
+        );
+        PTEST_SLOOP("compressor block", BUF_SIZE,
+            c.reduction(out, in, BUF_SIZE);
+        );
+    }
+
+    void test_expander(float *out, const float *in)
+    {
+        Expander e;
+        e.set_sample_rate(SAMPLE_RATE);
+        e.set_mode(EM_DOWNWARD);
+        e.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        e.set_knee(GAIN_AMP_M_6_DB);
+        e.set_ratio(2.0f);
+        e.update_settings();
+
+        PTEST_SLOOP("expander scalar", BUF_SIZE,
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                out[i]      = e.amplification(in[i]);
+        );
+        PTEST_SLOOP("expander block", BUF_SIZE,
+            e.amplification(out, in, BUF_SIZE);
+        );
+    }
+
+    void test_gate(float *out, const float *in)
+    {
+        Gate g;
+        g.set_sample_rate(SAMPLE_RATE);
+        g.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        g.set_zone(GAIN_AMP_M_6_DB, GAIN_AMP_M_12_DB);
+        g.set_reduction(GAIN_AMP_M_48_DB);
+        g.set_timings(10.0f, 100.0f);
+        g.update_settings();
+
+        PTEST_SLOOP("gate scalar", BUF_SIZE,
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                out[i]      = g.process(NULL, in[i]);
+        );
+        PTEST_SLOOP("gate block", BUF_SIZE,
+            g.process(out, NULL, in, BUF_SIZE);
+        );
+    }
+
+    void test_dynamic_processor(float *out, const float *in)
+    {
+        DynamicProcessor p;
+        p.set_sample_rate(SAMPLE_RATE);
+        p.set_in_ratio(1.5f);
+        p.set_out_ratio(4.0f);
+        p.set_dot(0, GAIN_AMP_M_48_DB, GAIN_AMP_M_36_DB, GAIN_AMP_M_6_DB);
+        p.set_dot(1, GAIN_AMP_M_24_DB, GAIN_AMP_M_18_DB, GAIN_AMP_M_6_DB);
+        p.update_settings();
+
+        PTEST_SLOOP("dynamic processor scalar", BUF_SIZE,
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                out[i]      = p.reduction(in[i]);
+        );
+        PTEST_SLOOP("dynamic processor block", BUF_SIZE,
+            p.reduction(out, in, BUF_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 2, 64);
+        float *out      = &in[BUF_SIZE];
+
+        // Envelope that covers all regions of the curves
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = expf(-9.0f * float(rand()) / RAND_MAX);
+
+        test_compressor(out, in);
+        PTEST_SEPARATOR;
+        test_expander(out, in);
+        PTEST_SEPARATOR;
+        test_gate(out, in);
+        PTEST_SEPARATOR;
+        test_dynamic_processor(out, in);
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,70 @@
+/*
+ * limiter.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/dynamics/Limiter.h>
+
+#define BUF_SIZE        0x2000
+#define SAMPLE_RATE     (48000 * 8)
+#define LOOKAHEAD       5.0f
+
+using namespace dsp;
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for limiter on dense loud signal (worst case for peak search)
+PTEST_BEGIN("core.dynamics", limiter, 5, 100)
+
+    void call(const char *label, float *out, float *gain, const float *in, limiter_mode_t mode)
+    {
+        printf("Testing %s limiter on %d samples...\n", label, int(BUF_SIZE));
+
+        Limiter l;
+        l.init(SAMPLE_RATE, LOOKAHEAD * 2.0f);
+        l.set_mode(mode);
+        l.set_sample_rate(SAMPLE_RATE);
+        l.set_lookahead(LOOKAHEAD);
+        l.set_threshold(GAIN_AMP_M_12_DB);
+        l.set_attack(LOOKAHEAD);
+        l.set_release(10.0f);
+        l.set_knee(GAIN_AMP_0_DB);
+        l.update_settings();
+
+        PTEST_SLOOP(label, BUF_SIZE,
+            l.process(out, gain, in, in, BUF_SIZE);
+        );
+
+        l.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 3, 64);
+        float *out      = &in[BUF_SIZE];
+        float *gain     = &out[BUF_SIZE];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = (float(rand()) / RAND_MAX - 0.5f) * 8.0f;
+
+        call("herm thin", out, gain, in, LM_HERM_THIN);
+        call("herm wide", out, gain, in, LM_HERM_WIDE);
+        call("exp thin", out, gain, in, LM_EXP_THIN);
+        call("exp wide", out, gain, in, LM_EXP_WIDE);
+        call("line thin", out, gain, in, LM_LINE_THIN);
+        call("line wide", out, gain, in, LM_LINE_WIDE);
+        PTEST_SEPARATOR;
+
+        call("mixed herm", out, gain, in, LM_MIXED_HERM);
+        call("mixed exp", out, gain, in, LM_MIXED_EXP);
+        call("mixed line", out, gain, in, LM_MIXED_LINE);
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
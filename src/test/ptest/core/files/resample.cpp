@@ -0,0 +1,55 @@
+/*
+ * resample.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/files/AudioFile.h>
+
+#define SRC_SAMPLES     0x10000
+#define CHANNELS        2
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for audio file resampling
+PTEST_BEGIN("core.files", resample, 10, 100)
+
+    void call(const char *label, const float *data, size_t src_sr, size_t dst_sr)
+    {
+        printf("Testing %s resampling of %d samples...\n", label, int(SRC_SAMPLES));
+
+        AudioFile af;
+
+        PTEST_SLOOP(label, SRC_SAMPLES * CHANNELS,
+            af.create_samples(CHANNELS, src_sr, SRC_SAMPLES);
+            for (size_t i=0; i<CHANNELS; ++i)
+                dsp::copy(af.channel(i), data, SRC_SAMPLES);
+            af.resample(dst_sr);
+        );
+
+        af.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        float *data     = new float[SRC_SAMPLES];
+        for (size_t i=0; i<SRC_SAMPLES; ++i)
+            data[i]         = float(rand()) / RAND_MAX - 0.5f;
+
+        call("44100 -> 88200", data, 44100, 88200);
+        call("96000 -> 48000", data, 96000, 48000);
+        PTEST_SEPARATOR;
+
+        call("44100 -> 96000", data, 44100, 96000);
+        call("44100 -> 48000", data, 44100, 48000);
+        call("48000 -> 44100", data, 48000, 44100);
+        call("96000 -> 44100", data, 96000, 44100);
+        PTEST_SEPARATOR;
+
+        delete [] data;
+    }
+PTEST_END
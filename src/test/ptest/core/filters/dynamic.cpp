@@ -0,0 +1,107 @@
+/*
+ * dynamic.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/filters/DynamicFilters.h>
+
+#define BUF_SIZE        0x2000
+#define SAMPLE_RATE     48000
+
+using namespace dsp;
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for dynamic filters: exact and interpolated coefficients
+PTEST_BEGIN("core.filters", dynamic, 5, 1000)
+
+    void init_filter(DynamicFilters *df, size_t type, size_t step)
+    {
+        filter_params_t fp;
+        fp.nType        = type;
+        fp.fFreq        = 1000.0f;
+        fp.fFreq2       = 4000.0f;
+        fp.fGain        = 1.0f;
+        fp.nSlope       = 2;
+        fp.fQuality     = 0.0f;
+
+        df->init(1);
+        df->set_sample_rate(SAMPLE_RATE);
+        df->set_params(0, &fp);
+        df->set_filter_active(0, true);
+        df->set_interpolation(step);
+    }
+
+    void call(const char *label, float *out, const float *in, const float *gain, const float *ref, size_t type, size_t step, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "%s, step=%d", label, int(step));
+        printf("Testing %s dynamic filter on %d samples...\n", buf, int(count));
+
+        DynamicFilters df;
+        init_filter(&df, type, step);
+
+        // Estimate error against the exact computation
+        df.process(0, out, in, gain, count);
+        float err = 0.0f;
+        for (size_t i=0; i<count; ++i)
+        {
+            float d = fabs(out[i] - ref[i]);
+            if (d > err)
+                err     = d;
+        }
+        printf("  maximum absolute error:   %e\n", err);
+
+        PTEST_SLOOP(buf, count,
+            df.process(0, out, in, gain, count);
+        );
+
+        df.destroy();
+    }
+
+    void test(const char *label, float *out, const float *in, const float *gain, float *ref, size_t type)
+    {
+        DynamicFilters df;
+        init_filter(&df, type, 1);
+        df.process(0, ref, in, gain, BUF_SIZE);
+        df.destroy();
+
+        call(label, out, in, gain, ref, type, 1, BUF_SIZE);
+        call(label, out, in, gain, ref, type, 4, BUF_SIZE);
+        call(label, out, in, gain, ref, type, 8, BUF_SIZE);
+        call(label, out, in, gain, ref, type, 16, BUF_SIZE);
+        call(label, out, in, gain, ref, type, 32, BUF_SIZE);
+        PTEST_SEPARATOR;
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 4, 64);
+        float *gain     = &in[BUF_SIZE];
+        float *out      = &gain[BUF_SIZE];
+        float *ref      = &out[BUF_SIZE];
+
+        // Prepare input signal and envelope similar to the compressor's one
+        float g = 1.0f, t = 1.0f;
+        for (size_t i=0; i < BUF_SIZE; ++i)
+        {
+            if (!(i % 0x400))
+                t               = expf(-(rand() % 24) * M_LN10 / 20.0f);
+            g              += (t - g) * 0.004f;
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+            gain[i]         = g;
+        }
+
+        test("LRX hi-shelf", out, in, gain, ref, FLT_BT_LRX_HISHELF);
+        test("LRX ladder-pass", out, in, gain, ref, FLT_BT_LRX_LADDERPASS);
+        test("MT LRX ladder-pass", out, in, gain, ref, FLT_MT_LRX_LADDERPASS);
+        test("RLC bell", out, in, gain, ref, FLT_BT_RLC_BELL);
+
+        free_aligned(data);
+    }
+PTEST_END
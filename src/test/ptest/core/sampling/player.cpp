@@ -0,0 +1,117 @@
+/*
+ * player.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/sampling/SamplePlayer.h>
+
+#define BUF_SIZE        0x100
+#define SAMPLES         16
+#define SAMPLE_LENGTH   0x10000
+#define FADEOUT         0x4000
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for sample player with many simultaneous voices
+PTEST_BEGIN("core.sampling", player, 5, 1000)
+
+    // Mixing of each voice with separate call, as the player did before
+    void mix_separate(float *dst, const float * const *src, size_t voices)
+    {
+        for (size_t i=0; i<voices; ++i)
+            dsp::scale_add3(dst, src[i % SAMPLES], 0.5f, BUF_SIZE);
+    }
+
+    // Per-sample fadeout, as the player did before
+    void fade_separate(float *dst, const float * const *src, size_t voices)
+    {
+        float fgain = 0.5f / (FADEOUT + 1);
+        for (size_t i=0; i<voices; ++i)
+        {
+            const float *s  = src[i % SAMPLES];
+            for (size_t j=0; j<BUF_SIZE; ++j)
+                dst[j]         += s[j] * fgain * (FADEOUT - j);
+        }
+    }
+
+    void trigger(SamplePlayer &sp, size_t voices, bool fade)
+    {
+        for (size_t i=sp.active(); i<voices; ++i)
+        {
+            sp.play(i % SAMPLES, 0, 0.5f, 0);
+            if (fade)
+                sp.cancel_all(i % SAMPLES, 0, FADEOUT, 0);
+        }
+    }
+
+    void test_voices(float *out, const float * const *src, SamplePlayer &sp, size_t voices)
+    {
+        char buf[80];
+
+        sprintf(buf, "%d voices separate", int(voices));
+        printf("Testing %s...\n", buf);
+        PTEST_SLOOP(buf, BUF_SIZE,
+            mix_separate(out, src, voices);
+        );
+
+        sprintf(buf, "%d voices pooled", int(voices));
+        printf("Testing %s...\n", buf);
+        sp.set_polyphony(voices);
+        sp.stop();
+        PTEST_SLOOP(buf, BUF_SIZE,
+            trigger(sp, voices, false);
+            sp.process(out, BUF_SIZE);
+        );
+
+        sprintf(buf, "%d voices scalar fadeout", int(voices));
+        printf("Testing %s...\n", buf);
+        PTEST_SLOOP(buf, BUF_SIZE,
+            fade_separate(out, src, voices);
+        );
+
+        sprintf(buf, "%d voices pooled fadeout", int(voices));
+        printf("Testing %s...\n", buf);
+        sp.stop();
+        PTEST_SLOOP(buf, BUF_SIZE,
+            trigger(sp, voices, true);
+            sp.process(out, BUF_SIZE);
+        );
+
+        sp.stop();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *out      = alloc_aligned<float>(data, BUF_SIZE, 64);
+        const float *src[SAMPLES];
+
+        SamplePlayer sp;
+        sp.init(SAMPLES, 256);
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            Sample *s       = new Sample;
+            s->init(1, SAMPLE_LENGTH, SAMPLE_LENGTH);
+            float *buf      = s->getBuffer(0);
+            for (size_t j=0; j<SAMPLE_LENGTH; ++j)
+                buf[j]          = float(rand()) / RAND_MAX - 0.5f;
+            src[i]          = buf;
+            sp.bind(i, s);
+        }
+
+        test_voices(out, src, sp, 8);
+        PTEST_SEPARATOR;
+        test_voices(out, src, sp, 64);
+        PTEST_SEPARATOR;
+        test_voices(out, src, sp, 256);
+        PTEST_SEPARATOR;
+
+        sp.destroy(true);
+        free_aligned(data);
+    }
+PTEST_END
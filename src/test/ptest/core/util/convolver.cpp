@@ -25,16 +25,16 @@ using namespace lsp;
 // Performance test for equalizer module
 PTEST_BEGIN("core.util", convolver, 10, 500)
 
-    void call(float *out, const float *in, const float *conv, size_t count, size_t rank)
+    void call(float *out, const float *in, const float *conv, size_t count, size_t rank, bool bg)
     {
         char buf[80];
-        sprintf(buf, "length=%d, rank=%d", int(count), int(rank));
+        sprintf(buf, "length=%d, rank=%d, bg=%s", int(count), int(rank), (bg) ? "true" : "false");
         printf("Testing convolver %s ...\n", buf);
 
         Convolver c;
-        c.init(conv,  count, rank, 0.0f);
+        c.init(conv,  count, rank, 0.0f, bg);
 
-        PTEST_LOOP(buf,
+        PTEST_SLOOP(buf, STEP_SIZE,
                 c.process(out, in, STEP_SIZE);
         );
 
@@ -60,7 +60,10 @@ PTEST_BEGIN("core.util", convolver, 10, 500)
         for (size_t i=0, len=MIN_LENGTH; i<=LEN_STEPS; i++, len <<= LEN_SHIFT)
         {
             for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
-                CALL(out, in, conv, len, rank);
+            {
+                CALL(out, in, conv, len, rank, false);
+                CALL(out, in, conv, len, rank, true);
+            }
 
             PTEST_SEPARATOR;
         }
@@ -0,0 +1,56 @@
+/*
+ * dither.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/util/Dither.h>
+#include <core/util/Randomizer.h>
+
+#define BUF_SIZE        0x1000
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for dither: per-sample random generator vs block random generator
+PTEST_BEGIN("core.util", dither, 5, 1000)
+
+    // The former implementation of the dither: one call of random generator per sample
+    void legacy_dither(Randomizer &rnd, float *out, const float *in, float gain, float delta, size_t count)
+    {
+        while (count--)
+            *(out++) = *(in++) * gain + (rnd.random(RND_TRIANGLE) - 0.5f) * delta;
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 2, 64);
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+
+        Randomizer rnd;
+        rnd.init(0);
+        float delta     = 4.0f / 65536.0f;
+        float gain      = 1.0f - 0.5f * delta;
+
+        Dither d;
+        d.init(0);
+        d.set_bits(16);
+
+        PTEST_SLOOP("legacy 16 bit", BUF_SIZE,
+            legacy_dither(rnd, out, in, gain, delta, BUF_SIZE);
+        );
+        PTEST_SLOOP("block 16 bit", BUF_SIZE,
+            d.process(out, in, BUF_SIZE);
+        );
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
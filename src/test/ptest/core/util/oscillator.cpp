@@ -0,0 +1,60 @@
+/*
+ * oscillator.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/util/Oscillator.h>
+
+#define SRATE           48000
+#define BUF_SIZE        0x1000
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for oscillator: analytic synthesis vs wavetable synthesis
+PTEST_BEGIN("core.util", oscillator, 5, 1000)
+
+    void test_function(const char *label, fg_function_t func, over_mode_t mode, float *out)
+    {
+        Oscillator osc;
+        osc.init();
+        osc.set_sample_rate(SRATE);
+        osc.set_function(func);
+        osc.set_frequency(440.0f);
+        osc.set_oversampler_mode(mode);
+
+        char buf[80];
+        for (size_t wt=0; wt<2; ++wt)
+        {
+            osc.set_wavetable(wt);
+            osc.update_settings();
+
+            sprintf(buf, "%s %s", label, (wt) ? "wavetable" : "analytic");
+            PTEST_SLOOP(buf, BUF_SIZE,
+                osc.process_overwrite(out, BUF_SIZE);
+            );
+        }
+
+        osc.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *out      = alloc_aligned<float>(data, BUF_SIZE, 64);
+
+        test_function("sine", FG_SINE, OM_NONE, out);
+        test_function("squared cosine", FG_SQUARED_COSINE, OM_NONE, out);
+        PTEST_SEPARATOR;
+        test_function("bl sawtooth x4", FG_BL_SAWTOOTH, OM_LANCZOS_4X3, out);
+        test_function("bl sawtooth x8", FG_BL_SAWTOOTH, OM_LANCZOS_8X3, out);
+        test_function("bl trapezoid x8", FG_BL_TRAPEZOID, OM_LANCZOS_8X3, out);
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
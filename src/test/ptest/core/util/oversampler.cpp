@@ -0,0 +1,72 @@
+/*
+ * oversampler.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/util/Oversampler.h>
+
+#define BUF_SIZE        0x400
+#define SAMPLE_RATE     48000
+
+using namespace dsp;
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for oversampler: lanczos and half-band modes
+PTEST_BEGIN("core.util", oversampler, 5, 1000)
+
+    void call(const char *label, float *out, const float *in, over_mode_t mode)
+    {
+        Oversampler os;
+        IOversamplerCallback cb;
+
+        os.init();
+        os.set_sample_rate(SAMPLE_RATE);
+        os.set_mode(mode);
+        os.update_settings();
+
+        char buf[80];
+        sprintf(buf, "%s, latency=%d", label, int(os.latency()));
+        printf("Testing %s oversampling on %d samples...\n", buf, int(BUF_SIZE));
+
+        PTEST_SLOOP(buf, BUF_SIZE,
+            os.process(out, in, BUF_SIZE, &cb);
+        );
+
+        os.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 2, 64);
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+
+        call("lanczos 2x2", out, in, OM_LANCZOS_2X2);
+        call("lanczos 2x3", out, in, OM_LANCZOS_2X3);
+        call("half-band FIR 2x", out, in, OM_HALFBAND_2X);
+        call("half-band IIR 2x", out, in, OM_HALFBAND_IIR_2X);
+        PTEST_SEPARATOR;
+
+        call("lanczos 4x2", out, in, OM_LANCZOS_4X2);
+        call("lanczos 4x3", out, in, OM_LANCZOS_4X3);
+        call("half-band FIR 4x", out, in, OM_HALFBAND_4X);
+        call("half-band IIR 4x", out, in, OM_HALFBAND_IIR_4X);
+        PTEST_SEPARATOR;
+
+        call("lanczos 8x2", out, in, OM_LANCZOS_8X2);
+        call("lanczos 8x3", out, in, OM_LANCZOS_8X3);
+        call("half-band FIR 8x", out, in, OM_HALFBAND_8X);
+        call("half-band IIR 8x", out, in, OM_HALFBAND_IIR_8X);
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
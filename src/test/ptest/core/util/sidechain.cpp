@@ -0,0 +1,100 @@
+/*
+ * sidechain.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/util/Sidechain.h>
+
+#define SRATE           48000
+#define BUF_SIZE        0x1000
+#define MAX_REACTIVITY  250.0f
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for sidechain: per-sample sliding window vs block sliding window
+PTEST_BEGIN("core.util", sidechain, 5, 1000)
+
+    // The former implementation of the sliding window: add one sample, remove one sample
+    float legacy_mean(float *dst, const float *head, const float *tail, float sum, float k, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            sum            += head[i] - tail[i];
+            dst[i]          = (sum < 0.0f) ? 0.0f : sum * k;
+        }
+        return sum;
+    }
+
+    float legacy_rms(float *dst, const float *head, const float *tail, float sum, float k, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float h         = head[i];
+            float t         = tail[i];
+            sum            += h*h - t*t;
+            dst[i]          = (sum < 0.0f) ? 0.0f : sqrtf(sum * k);
+        }
+        return sum;
+    }
+
+    void test_sidechain(const char *label, size_t mode, float reactivity, float *out, const float *in)
+    {
+        Sidechain sc;
+        sc.init(1, MAX_REACTIVITY);
+        sc.set_sample_rate(SRATE);
+        sc.set_mode(mode);
+        sc.set_reactivity(reactivity);
+
+        char buf[80];
+        sprintf(buf, "%s sidechain, %.0f ms", label, reactivity);
+        printf("Testing %s...\n", buf);
+
+        PTEST_SLOOP(buf, BUF_SIZE,
+            sc.process(out, &in, BUF_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t window   = millis_to_samples(SRATE, 10.0f);
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 2 + window, 64);
+        float *out      = &in[BUF_SIZE + window];
+
+        for (size_t i=0; i < BUF_SIZE + window; ++i)
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+
+        const float *head   = &in[window];
+        float k             = 1.0f / window;
+
+        PTEST_SLOOP("legacy mean", BUF_SIZE,
+            legacy_mean(out, head, in, 0.0f, k, BUF_SIZE);
+        );
+        PTEST_SLOOP("sliding mean", BUF_SIZE,
+            dsp::sliding_mean(out, head, in, 0.0f, k, BUF_SIZE);
+        );
+        PTEST_SEPARATOR;
+
+        PTEST_SLOOP("legacy rms", BUF_SIZE,
+            legacy_rms(out, head, in, 0.0f, k, BUF_SIZE);
+        );
+        PTEST_SLOOP("sliding rms", BUF_SIZE,
+            dsp::sliding_rms(out, head, in, 0.0f, k, BUF_SIZE);
+        );
+        PTEST_SEPARATOR;
+
+        test_sidechain("peak", SCM_PEAK, 10.0f, out, in);
+        test_sidechain("peak", SCM_PEAK, 100.0f, out, in);
+        test_sidechain("uniform", SCM_UNIFORM, 10.0f, out, in);
+        test_sidechain("rms", SCM_RMS, 10.0f, out, in);
+        test_sidechain("lpf", SCM_LPF, 10.0f, out, in);
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -36,6 +36,14 @@ IF_ARCH_X86(
     }
 )
 
+IF_ARCH_X86_64(
+    namespace avx
+    {
+        void x64_fastconv_parse(float *dst, const float *src, size_t rank);
+        void x64_fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
+    }
+)
+
 IF_ARCH_ARM(
     namespace neon_d32
     {
@@ -149,6 +157,11 @@ PTEST_BEGIN("dsp.fft", fastconv, 30, 1000)
                     sse::fastconv_parse, sse::fastconv_parse_apply);
             )
 
+            IF_ARCH_X86_64(
+                call("avx::x64_fastconv_fft", out, tmp, conv, in, cv, rank,
+                    avx::x64_fastconv_parse, avx::x64_fastconv_parse_apply);
+            )
+
             IF_ARCH_ARM(
                 call("neon_d32::fft", out, tmp, tmp2, conv, in, cv, rank,
                     neon_d32::direct_fft, neon_d32::complex_mul3, neon_d32::reverse_fft, neon_d32::add2);
@@ -16,6 +16,9 @@ namespace native
 {
     void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
     void packed_direct_fft(float *dst, const float *src, size_t rank);
+    bool init_fft_plan(dsp::fft_plan_t *plan, size_t rank);
+    void destroy_fft_plan(dsp::fft_plan_t *plan);
+    void planned_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan);
 }
 
 IF_ARCH_X86(
@@ -26,6 +29,13 @@ IF_ARCH_X86(
     }
 )
 
+IF_ARCH_X86_64(
+    namespace sse
+    {
+        void x64_planned_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan);
+    }
+)
+
 IF_ARCH_ARM(
     namespace neon_d32
     {
@@ -38,6 +48,7 @@ IF_ARCH_ARM(
 typedef void (* direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
 typedef void (* conv_direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
 typedef void (* packed_direct_fft_t) (float *dst, const float *src, size_t rank);
+typedef void (* planned_direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, const dsp::fft_plan_t *plan);
 
 //-----------------------------------------------------------------------------
 // Performance test for complex multiplication
@@ -71,6 +82,20 @@ PTEST_BEGIN("dsp.fft", fft, 30, 1000)
         )
     }
 
+    void call(const char *label, float *fft_re, float *fft_im, const float *sig_re, const float *sig_im, const dsp::fft_plan_t *plan, planned_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(1 << plan->rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(plan->rank));
+
+        PTEST_LOOP(buf,
+            fft(fft_re, fft_im, sig_re, sig_im, plan);
+        )
+    }
+
     PTEST_MAIN
     {
         size_t fft_size = 1 << MAX_RANK;
@@ -90,15 +115,22 @@ PTEST_BEGIN("dsp.fft", fft, 30, 1000)
 
         for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
         {
+            dsp::fft_plan_t plan;
+            if (!native::init_fft_plan(&plan, i))
+                break;
+
             call("native::direct_fft", fft_re, fft_im, sig_re, sig_im, i, native::direct_fft);
             call("native::packed_direct_fft", fft_re, sig_re, i, native::packed_direct_fft);
+            call("native::planned_direct_fft", fft_re, fft_im, sig_re, sig_im, &plan, native::planned_direct_fft);
 
             IF_ARCH_X86(call("sse::direct_fft", fft_re, fft_im, sig_re, sig_im, i, sse::direct_fft));
             IF_ARCH_X86(call("sse::packed_direct_fft", fft_re, sig_re, i, sse::packed_direct_fft));
+            IF_ARCH_X86_64(call("sse::x64_planned_direct_fft", fft_re, fft_im, sig_re, sig_im, &plan, sse::x64_planned_direct_fft));
 
             IF_ARCH_ARM(call("neon_d32::direct_fft", fft_re, fft_im, sig_re, sig_im, i, neon_d32::direct_fft));
             IF_ARCH_ARM(call("neon_d32::packed_direct_fft", fft_re, sig_re, i, neon_d32::packed_direct_fft));
 
+            native::destroy_fft_plan(&plan);
             PTEST_SEPARATOR;
         }
 
@@ -0,0 +1,114 @@
+/*
+ * mc.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+
+#define FTEST_BUF_SIZE  0x200
+#define CHANNELS        8
+#define STAGES          8
+
+namespace native
+{
+    void biquad_process_x8(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_mc4(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+    void biquad_process_mc8(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void biquad_process_x8(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_mc4(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+        void biquad_process_mc8(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+    }
+
+    IF_ARCH_X86_64(
+        namespace avx
+        {
+            void x64_biquad_process_x8(float *dst, const float *src, size_t count, biquad_t *f);
+        }
+    )
+)
+
+typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, biquad_t *f);
+typedef void (* biquad_process_mc_t)(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+
+//-----------------------------------------------------------------------------
+// Performance test for multi-channel biquad processing: 8 channels of 8 stages each
+PTEST_BEGIN("dsp.filters", mc, 30, 10000)
+
+    void init_filter(biquad_t *f)
+    {
+        memset(f, 0, sizeof(biquad_t));
+        for (size_t i=0; i<8; ++i)
+            f->x8.a0[i]     = 1.0f;
+    }
+
+    void process_per_channel(const char *text, float *out, const float *in, size_t count, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s static filters on %d channels of %d samples ...\n", text, int(CHANNELS), int(count));
+
+        biquad_t f[CHANNELS] __lsp_aligned64;
+        for (size_t i=0; i<CHANNELS; ++i)
+            init_filter(&f[i]);
+
+        PTEST_LOOP(text,
+            for (size_t i=0; i<CHANNELS; ++i)
+                process(&out[i*count], &in[i*count], count, &f[i]);
+        );
+    }
+
+    void process_mc(const char *text, float *out, const float *in, size_t count, size_t lanes, biquad_process_mc_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s static filters on %d channels of %d samples ...\n", text, int(CHANNELS), int(count));
+
+        biquad_t f[STAGES] __lsp_aligned64;
+        for (size_t i=0; i<STAGES; ++i)
+            init_filter(&f[i]);
+
+        PTEST_LOOP(text,
+            for (size_t i=0; i<CHANNELS; i += lanes)
+                process(&out[i*count], &in[i*count], count, f, STAGES);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        float *out          = new float[FTEST_BUF_SIZE * CHANNELS];
+        float *in           = new float[FTEST_BUF_SIZE * CHANNELS];
+
+        for (size_t i=0; i<FTEST_BUF_SIZE * CHANNELS; ++i)
+        {
+            in[i]               = (i % 1) ? 1.0f : -1.0f;
+            out[i]              = 0.0f;
+        }
+
+        process_per_channel("native::biquad_process_x8 x8", out, in, FTEST_BUF_SIZE, native::biquad_process_x8);
+        IF_ARCH_X86(process_per_channel("sse::biquad_process_x8 x8", out, in, FTEST_BUF_SIZE, sse::biquad_process_x8));
+        IF_ARCH_X86_64(process_per_channel("avx::x64_biquad_process_x8 x8", out, in, FTEST_BUF_SIZE, avx::x64_biquad_process_x8));
+        PTEST_SEPARATOR;
+
+        process_mc("native::biquad_process_mc4 x2", out, in, FTEST_BUF_SIZE, 4, native::biquad_process_mc4);
+        IF_ARCH_X86(process_mc("sse::biquad_process_mc4 x2", out, in, FTEST_BUF_SIZE, 4, sse::biquad_process_mc4));
+        PTEST_SEPARATOR;
+
+        process_mc("native::biquad_process_mc8 x1", out, in, FTEST_BUF_SIZE, 8, native::biquad_process_mc8);
+        IF_ARCH_X86(process_mc("sse::biquad_process_mc8 x1", out, in, FTEST_BUF_SIZE, 8, sse::biquad_process_mc8));
+        PTEST_SEPARATOR;
+
+        delete [] out;
+        delete [] in;
+    }
+
+PTEST_END
@@ -0,0 +1,70 @@
+/*
+ * dynamics.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <test/PluginBench.h>
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// End-to-end performance test for dynamic processing plugins
+PTEST_BEGIN("plugins", dynamics, 1, 10)
+
+    void call(const char *id, long sample_rate, size_t block)
+    {
+        PluginBench bench;
+        if (bench.init(id, sample_rate, block) != STATUS_OK)
+            PTEST_FAIL_MSG("Could not instantiate plugin %s", id);
+
+        // Deep processing to keep the gain curves active
+        bench.set_value("al*", GAIN_AMP_M_24_DB);   // Attack threshold
+        bench.set_value("cr*", 8.0f);               // Ratio
+        bench.set_value("kn*", GAIN_AMP_M_6_DB);    // Knee
+        bench.set_value("th", GAIN_AMP_M_24_DB);    // Limiter threshold
+        bench.set_value("cbe*", 1.0f);              // Multiband compressor: enable all bands
+        bench.wait_loaded(1000);
+
+        char buf[80];
+        sprintf(buf, "%s %dk x%d", id, int(sample_rate / 1000), int(block));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_RLOOP(buf, block, sample_rate,
+            bench.process(block);
+        );
+
+        bench.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        static const char *plugins[] =
+        {
+            "compressor_stereo",
+            "sc_compressor_stereo",
+            "dyna_processor_stereo",
+            "expander_stereo",
+            "gate_stereo",
+            "limiter_stereo",
+            "mb_compressor_stereo",
+            NULL
+        };
+        static const long srates[]      = { 48000, 96000 };
+        static const size_t blocks[]    = { 64, 256, 1024 };
+
+        const char **list = (argc > 0) ? argv : plugins;
+        size_t count = (argc > 0) ? argc : (sizeof(plugins) / sizeof(const char *) - 1);
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<sizeof(srates)/sizeof(long); ++j)
+                for (size_t k=0; k<sizeof(blocks)/sizeof(size_t); ++k)
+                    call(list[i], srates[j], blocks[k]);
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
@@ -0,0 +1,68 @@
+/*
+ * equalizers.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <test/PluginBench.h>
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// End-to-end performance test for equalizer plugins
+PTEST_BEGIN("plugins", equalizers, 1, 10)
+
+    void call(const char *id, long sample_rate, size_t block)
+    {
+        PluginBench bench;
+        if (bench.init(id, sample_rate, block) != STATUS_OK)
+            PTEST_FAIL_MSG("Could not instantiate plugin %s", id);
+
+        // Enable all bands and the FFT analysis
+        bench.set_value("ft*", 1.0f);               // Parametric equalizer filter type: bell
+        bench.set_value("g*_*", GAIN_AMP_P_6_DB);   // Band gain
+        bench.set_value("g_in", GAIN_AMP_0_DB);     // Restore input gain
+        bench.set_value("g_out", GAIN_AMP_0_DB);    // Restore output gain
+        bench.set_value("fft", 1.0f);               // FFT analysis: post-eq
+        bench.wait_loaded(1000);
+
+        char buf[80];
+        sprintf(buf, "%s %dk x%d", id, int(sample_rate / 1000), int(block));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_RLOOP(buf, block, sample_rate,
+            bench.process(block);
+        );
+
+        bench.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        static const char *plugins[] =
+        {
+            "para_equalizer_x16_stereo",
+            "para_equalizer_x32_stereo",
+            "para_equalizer_x32_ms",
+            "graph_equalizer_x16_stereo",
+            "graph_equalizer_x32_stereo",
+            NULL
+        };
+        static const long srates[]      = { 48000, 96000 };
+        static const size_t blocks[]    = { 64, 256, 1024 };
+
+        const char **list = (argc > 0) ? argv : plugins;
+        size_t count = (argc > 0) ? argc : (sizeof(plugins) / sizeof(const char *) - 1);
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<sizeof(srates)/sizeof(long); ++j)
+                for (size_t k=0; k<sizeof(blocks)/sizeof(size_t); ++k)
+                    call(list[i], srates[j], blocks[k]);
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
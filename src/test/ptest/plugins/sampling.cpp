@@ -0,0 +1,75 @@
+/*
+ * sampling.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <test/PluginBench.h>
+#include <core/LSPString.h>
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// End-to-end performance test for sampling plugins
+PTEST_BEGIN("plugins", sampling, 1, 10)
+
+    LSPString sFile;
+
+    void call(const char *id, long sample_rate, size_t block)
+    {
+        PluginBench bench;
+        if (bench.init(id, sample_rate, block) != STATUS_OK)
+            PTEST_FAIL_MSG("Could not instantiate plugin %s", id);
+
+        // Load the sample into all slots, samplers are triggered by MIDI notes,
+        // triggers are triggered by noise bursts of the input signal
+        if (bench.set_path("sf*", sFile.get_utf8()) <= 0)
+            PTEST_FAIL_MSG("Plugin %s has no sample file ports", id);
+        if (bench.wait_loaded(10000) != STATUS_OK)
+            PTEST_FAIL_MSG("Plugin %s failed to load sample file", id);
+
+        char buf[80];
+        sprintf(buf, "%s %dk x%d", id, int(sample_rate / 1000), int(block));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_RLOOP(buf, block, sample_rate,
+            bench.process(block);
+        );
+
+        bench.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        static const char *plugins[] =
+        {
+            "sampler_stereo",
+            "multisampler_x12",
+            "multisampler_x24_do",
+            "trigger_stereo",
+            "trigger_midi_stereo",
+            NULL
+        };
+        static const long srates[]      = { 48000, 96000 };
+        static const size_t blocks[]    = { 64, 256, 1024 };
+
+        if (!sFile.fmt_utf8("tmp/ptest-%s.lspc", full_name()))
+            PTEST_FAIL_MSG("Could not format file name");
+        if (PluginBench::write_sample(sFile.get_utf8(), 2, 24000, 48000) != STATUS_OK)
+            PTEST_FAIL_MSG("Could not write sample file %s", sFile.get_utf8());
+
+        const char **list = (argc > 0) ? argv : plugins;
+        size_t count = (argc > 0) ? argc : (sizeof(plugins) / sizeof(const char *) - 1);
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<sizeof(srates)/sizeof(long); ++j)
+                for (size_t k=0; k<sizeof(blocks)/sizeof(size_t); ++k)
+                    call(list[i], srates[j], blocks[k]);
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
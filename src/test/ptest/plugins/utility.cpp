@@ -0,0 +1,65 @@
+/*
+ * utility.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <test/PluginBench.h>
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// End-to-end performance test for analyzers, delays and other utility plugins
+PTEST_BEGIN("plugins", utility, 1, 10)
+
+    void call(const char *id, long sample_rate, size_t block)
+    {
+        PluginBench bench;
+        if (bench.init(id, sample_rate, block) != STATUS_OK)
+            PTEST_FAIL_MSG("Could not instantiate plugin %s", id);
+
+        bench.wait_loaded(1000);
+
+        char buf[80];
+        sprintf(buf, "%s %dk x%d", id, int(sample_rate / 1000), int(block));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_RLOOP(buf, block, sample_rate,
+            bench.process(block);
+        );
+
+        bench.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        static const char *plugins[] =
+        {
+            "spectrum_analyzer_x2",
+            "spectrum_analyzer_x8",
+            "phase_detector",
+            "comp_delay_x2_stereo",
+            "slap_delay_stereo",
+            "oscillator_mono",
+            "latency_meter",
+            "profiler_stereo",
+            NULL
+        };
+        static const long srates[]      = { 48000, 96000 };
+        static const size_t blocks[]    = { 64, 256, 1024 };
+
+        const char **list = (argc > 0) ? argv : plugins;
+        size_t count = (argc > 0) ? argc : (sizeof(plugins) / sizeof(const char *) - 1);
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<sizeof(srates)/sizeof(long); ++j)
+                for (size_t k=0; k<sizeof(blocks)/sizeof(size_t); ++k)
+                    call(list[i], srates[j], blocks[k]);
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
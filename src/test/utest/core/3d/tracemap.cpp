@@ -0,0 +1,212 @@
+/*
+ * tracemap.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/3d/TraceMap3D.h>
+#include <core/3d/Object3D.h>
+#include <core/3d/RaySource3D.h>
+#include <core/3d/TraceCapture3D.h>
+#include <core/sampling/Sample.h>
+
+#define OBJECTS         8
+#define TRIANGLES       256
+#define RAYS            4096
+#define SRATE           48000
+#define IR_LENGTH       0x4000
+#define IR_RAYS         2000
+
+using namespace lsp;
+
+UTEST_BEGIN("core.3d", tracemap)
+
+    class TestTraceMap: public TraceMap3D
+    {
+        public:
+            typedef TraceMap3D::capture3d_t capture_t;
+
+        public:
+            bool build()
+            {
+                return build_bvh();
+            }
+
+            void trace(capture_t *ix, const raytrace3d_t *rt)
+            {
+                raytrace_step(ix, rt);
+            }
+
+            // Reference implementation: check each triangle of each segment
+            void trace_brute(capture_t *ix, const raytrace3d_t *rt)
+            {
+                point3d_t i;
+
+                for (segment_t *seg = pRoot; seg != NULL; seg = seg->pNext)
+                {
+                    const triangle3d_t *t = seg->vTriangles;
+                    for (size_t count=seg->nItems; count > 0; count--, t++)
+                    {
+                        if (has_triangle(&rt->x, t))
+                            continue;
+
+                        float dist      = dsp::find_intersection3d_rt(&i, &rt->r, t);
+                        if ((dist < 0.0f) || (dist > ix->p.w))
+                            continue;
+
+                        if (fabs(dist - ix->p.w) > DSP_3D_TOLERANCE)
+                            ix->n = 0;
+                        ix->p       = i;
+                        ix->p.w     = dist;
+
+                        if (ix->n < DSP_3D_MAXISECT)
+                        {
+                            size_t idx      = ix->n++;
+                            ix->t[idx]      = t;
+                            ix->m[idx]      = seg->pMaterial;
+                            ix->pSeg[idx]   = seg;
+                        }
+                    }
+                }
+            }
+    };
+
+    static float rnd(float min, float max)
+    {
+        return min + (max - min) * (float(rand()) / RAND_MAX);
+    }
+
+    void build_room(Object3D *obj)
+    {
+        static const int faces[12][3] =
+        {
+            { 0, 1, 3 }, { 0, 3, 2 }, { 4, 5, 7 }, { 4, 7, 6 },
+            { 0, 1, 5 }, { 0, 5, 4 }, { 2, 3, 7 }, { 2, 7, 6 },
+            { 0, 2, 6 }, { 0, 6, 4 }, { 1, 3, 7 }, { 1, 7, 5 }
+        };
+
+        for (size_t i=0; i<8; ++i)
+            UTEST_ASSERT(obj->add_vertex((i & 1) ? 10.0f : -10.0f, (i & 2) ? 10.0f : -10.0f, (i & 4) ? 5.0f : -5.0f) >= 0);
+        for (size_t i=0; i<12; ++i)
+            UTEST_ASSERT(obj->add_triangle(faces[i][0], faces[i][1], faces[i][2]) == STATUS_OK);
+    }
+
+    void build_random(Object3D *obj)
+    {
+        for (size_t i=0; i<TRIANGLES; ++i)
+        {
+            float x = rnd(-9.0f, 9.0f), y = rnd(-9.0f, 9.0f), z = rnd(-4.0f, 4.0f);
+            ssize_t a = obj->add_vertex(x, y, z);
+            ssize_t b = obj->add_vertex(x + rnd(-0.5f, 0.5f), y + rnd(-0.5f, 0.5f), z + rnd(-0.5f, 0.5f));
+            ssize_t c = obj->add_vertex(x + rnd(-0.5f, 0.5f), y + rnd(-0.5f, 0.5f), z + rnd(-0.5f, 0.5f));
+            UTEST_ASSERT((a >= 0) && (b >= 0) && (c >= 0));
+            UTEST_ASSERT(obj->add_triangle(a, b, c) == STATUS_OK);
+        }
+    }
+
+    void raytrace(Sample *smp, Object3D *room, size_t threads)
+    {
+        TraceMap3D tm;
+        RaySource3D rs;
+        TraceCapture3D capt;
+
+        // Build the capture surface
+        Object3D *surface = capt.build_surface(1);
+        UTEST_ASSERT(surface != NULL);
+        dsp::init_matrix3d_translate(surface->get_matrix(), 3.0f, 2.0f, 1.0f);
+
+        UTEST_ASSERT(smp->init(1, IR_LENGTH));
+        capt.init(smp, 0);
+        capt.set_sample_rate(SRATE);
+
+        rs.init(12345);
+        rs.set_type(RS3DT_SPHERIC);
+
+        UTEST_ASSERT(tm.add_object(room));
+        UTEST_ASSERT(tm.add_object(surface, &capt));
+        UTEST_ASSERT(tm.add_source(&rs));
+        tm.set_threads(threads);
+        UTEST_ASSERT(tm.raytrace(IR_RAYS) == STATUS_OK);
+
+        tm.destroy();
+        surface->destroy();
+        delete surface;
+    }
+
+    void test_determinism(Object3D *room)
+    {
+        Sample ref, smp;
+        material3d_t m = *(room->get_material());
+        m.absorption        = 0.5f;
+        room->set_material(&m);
+
+        raytrace(&ref, room, 1);
+
+        float energy = 0.0f;
+        for (size_t i=0; i<IR_LENGTH; ++i)
+            energy     += fabs(ref.getBuffer(0)[i]);
+        UTEST_ASSERT_MSG(energy > 0.0f, "No rays have been captured");
+
+        UTEST_FOREACH(threads, 2, 3, 8)
+        {
+            printf("Testing raytrace determinism for %d threads...\n", int(threads));
+            raytrace(&smp, room, threads);
+            if (memcmp(ref.getBuffer(0), smp.getBuffer(0), IR_LENGTH * sizeof(float)) != 0)
+                UTEST_FAIL_MSG("Result of raytracing with %d threads differs from the single-threaded one", int(threads));
+            smp.destroy();
+        }
+
+        ref.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        Object3D room, objs[OBJECTS];
+        TestTraceMap tm;
+
+        build_room(&room);
+        UTEST_ASSERT(tm.add_object(&room));
+        for (size_t i=0; i<OBJECTS; ++i)
+        {
+            build_random(&objs[i]);
+            UTEST_ASSERT(tm.add_object(&objs[i]));
+        }
+        UTEST_ASSERT(tm.build());
+
+        // Results of tree traversal should match results of the exhaustive search
+        raytrace3d_t rt;
+        TestTraceMap::capture_t ix1, ix2;
+
+        for (size_t i=0; i<RAYS; ++i)
+        {
+            rt.x.n      = 0;
+            dsp::init_ray_dxyz(&rt.r,
+                    rnd(-8.0f, 8.0f), rnd(-8.0f, 8.0f), rnd(-4.0f, 4.0f),
+                    rnd(-0.5f, 0.5f), rnd(-0.5f, 0.5f), (i % 7) ? rnd(-0.5f, 0.5f) : 0.0f
+                );
+
+            dsp::init_intersection3d(&ix1);
+            dsp::init_intersection3d(&ix2);
+            tm.trace_brute(&ix1, &rt);
+            tm.trace(&ix2, &rt);
+
+            UTEST_ASSERT_MSG(ix1.n > 0, "Ray #%d has not hit the room", int(i));
+            if ((ix1.n != ix2.n) || (fabs(ix1.p.w - ix2.p.w) > DSP_3D_TOLERANCE))
+                UTEST_FAIL_MSG("Ray #%d: intersection differs: n=%d, dist=%f vs n=%d, dist=%f",
+                        int(i), int(ix1.n), ix1.p.w, int(ix2.n), ix2.p.w);
+        }
+
+        tm.destroy();
+
+        // Raytracing result should not depend on the number of threads
+        test_determinism(&room);
+
+        for (size_t i=0; i<OBJECTS; ++i)
+            objs[i].destroy();
+        room.destroy();
+    }
+
+UTEST_END
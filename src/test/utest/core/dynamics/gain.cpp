@@ -0,0 +1,191 @@
+/*
+ * gain.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/dynamics/Compressor.h>
+#include <core/dynamics/Expander.h>
+#include <core/dynamics/Gate.h>
+#include <core/dynamics/DynamicProcessor.h>
+
+#define SRATE       48000
+#define POINTS      1001
+#define DB_MIN      -100.0f
+#define DB_MAX      20.0f
+#define TOLERANCE   1e-3f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.dynamics", gain)
+
+    void check(const char *label, const float *in, const float *block, const float *scalar)
+    {
+        for (size_t i=0; i<POINTS; ++i)
+        {
+            float a     = block[i];
+            float b     = scalar[i];
+            if (fabs(a - b) > TOLERANCE * (fabs(b) + GAIN_AMP_MIN))
+                UTEST_FAIL_MSG("%s: gain differs at level %.6f: block=%.6f, scalar=%.6f",
+                        label, in[i], a, b);
+        }
+    }
+
+    void test_compressor(const float *in, float *block, float *scalar, size_t mode)
+    {
+        Compressor c;
+        c.set_sample_rate(SRATE);
+        c.set_mode(mode);
+        c.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        c.set_knee(GAIN_AMP_M_6_DB);
+        c.set_ratio(4.0f);
+        c.set_timings(10.0f, 100.0f);
+        c.update_settings();
+
+        c.reduction(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = c.reduction(in[i]);
+        check((mode == CM_UPWARD) ? "upward compressor reduction" : "downward compressor reduction", in, block, scalar);
+
+        c.curve(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = c.curve(in[i]);
+        check((mode == CM_UPWARD) ? "upward compressor curve" : "downward compressor curve", in, block, scalar);
+    }
+
+    void test_expander(const float *in, float *block, float *scalar, size_t mode)
+    {
+        Expander e;
+        e.set_sample_rate(SRATE);
+        e.set_mode(mode);
+        e.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        e.set_knee(GAIN_AMP_M_6_DB);
+        e.set_ratio(2.0f);
+        e.set_timings(10.0f, 100.0f);
+        e.update_settings();
+
+        e.amplification(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = e.amplification(in[i]);
+        check((mode == EM_UPWARD) ? "upward expander amplification" : "downward expander amplification", in, block, scalar);
+
+        e.curve(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = e.curve(in[i]);
+        check((mode == EM_UPWARD) ? "upward expander curve" : "downward expander curve", in, block, scalar);
+    }
+
+    void test_gate(const float *in, float *block, float *scalar)
+    {
+        Gate g;
+        g.set_sample_rate(SRATE);
+        g.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        g.set_zone(GAIN_AMP_M_6_DB, GAIN_AMP_M_12_DB);
+        g.set_reduction(GAIN_AMP_M_48_DB);
+        g.set_timings(10.0f, 100.0f);
+        g.update_settings();
+
+        for (size_t hyst=0; hyst<2; ++hyst)
+        {
+            g.amplification(block, in, POINTS, hyst);
+            for (size_t i=0; i<POINTS; ++i)
+                scalar[i]   = g.amplification(in[i], hyst);
+            check((hyst) ? "gate hysteresis amplification" : "gate amplification", in, block, scalar);
+
+            g.curve(block, in, POINTS, hyst);
+            for (size_t i=0; i<POINTS; ++i)
+                scalar[i]   = g.curve(in[i], hyst);
+            check((hyst) ? "gate hysteresis curve" : "gate curve", in, block, scalar);
+        }
+
+        // Block processing should switch curves at the same samples as per-sample processing
+        Gate sg;
+        sg.set_sample_rate(SRATE);
+        sg.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_36_DB);
+        sg.set_zone(GAIN_AMP_M_6_DB, GAIN_AMP_M_12_DB);
+        sg.set_reduction(GAIN_AMP_M_48_DB);
+        sg.set_timings(1.0f, 1.0f);
+        sg.update_settings();
+
+        g.set_timings(1.0f, 1.0f);
+        g.update_settings();
+
+        float *sig      = new float[POINTS];
+        for (size_t i=0; i<POINTS; ++i)
+            sig[i]          = fabs(in[(i * 37) % POINTS]);
+
+        for (size_t i=0, step=1; i<POINTS; step = (step * 7 + 3) % 61 + 1)
+        {
+            size_t to_do    = ((POINTS - i) > step) ? step : POINTS - i;
+            g.process(&block[i], NULL, &sig[i], to_do);
+            i              += to_do;
+        }
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]       = sg.process(NULL, sig[i]);
+        check("gate processing", sig, block, scalar);
+
+        delete [] sig;
+    }
+
+    void test_dynamic_processor(const float *in, float *block, float *scalar)
+    {
+        DynamicProcessor p;
+        p.set_sample_rate(SRATE);
+        p.set_in_ratio(1.5f);
+        p.set_out_ratio(4.0f);
+        p.set_dot(0, GAIN_AMP_M_48_DB, GAIN_AMP_M_36_DB, GAIN_AMP_M_6_DB);
+        p.set_dot(1, GAIN_AMP_M_24_DB, GAIN_AMP_M_18_DB, GAIN_AMP_M_6_DB);
+        p.set_attack_time(0, 10.0f);
+        p.set_release_time(0, 100.0f);
+        p.update_settings();
+
+        p.reduction(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = p.reduction(in[i]);
+        check("dynamic processor reduction", in, block, scalar);
+
+        p.curve(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = p.curve(in[i]);
+        check("dynamic processor curve", in, block, scalar);
+
+        p.model(block, in, POINTS);
+        for (size_t i=0; i<POINTS; ++i)
+            scalar[i]   = p.model(in[i]);
+        check("dynamic processor model", in, block, scalar);
+    }
+
+    UTEST_MAIN
+    {
+        float *in       = new float[POINTS];
+        float *block    = new float[POINTS];
+        float *scalar   = new float[POINTS];
+
+        // Logarithmic scale of levels with alternating sign
+        for (size_t i=0; i<POINTS; ++i)
+        {
+            float db    = DB_MIN + (DB_MAX - DB_MIN) * i / (POINTS - 1);
+            in[i]       = expf(db * M_LN10 / 20.0f);
+            if (i & 1)
+                in[i]       = -in[i];
+        }
+
+        printf("Testing compressor...\n");
+        test_compressor(in, block, scalar, CM_DOWNWARD);
+        test_compressor(in, block, scalar, CM_UPWARD);
+        printf("Testing expander...\n");
+        test_expander(in, block, scalar, EM_DOWNWARD);
+        test_expander(in, block, scalar, EM_UPWARD);
+        printf("Testing gate...\n");
+        test_gate(in, block, scalar);
+        printf("Testing dynamic processor...\n");
+        test_dynamic_processor(in, block, scalar);
+
+        delete [] in;
+        delete [] block;
+        delete [] scalar;
+    }
+UTEST_END
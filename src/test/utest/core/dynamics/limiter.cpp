@@ -0,0 +1,84 @@
+/*
+ * limiter.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/dynamics/Limiter.h>
+
+#define SRATE       48000
+#define SAMPLES     0x8000
+#define THRESHOLD   GAIN_AMP_M_6_DB
+#define TOLERANCE   1e-4f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.dynamics", limiter)
+
+    void test_mode(const char *label, limiter_mode_t mode, const float *in)
+    {
+        printf("Testing %s limiter mode...\n", label);
+
+        float *out      = new float[SAMPLES];
+        float *gain     = new float[SAMPLES];
+
+        Limiter l;
+        UTEST_ASSERT(l.init(SRATE, 20.0f));
+        l.set_mode(mode);
+        l.set_sample_rate(SRATE);
+        l.set_lookahead(5.0f);
+        l.set_threshold(THRESHOLD);
+        l.set_attack(5.0f);
+        l.set_release(10.0f);
+        l.set_knee(GAIN_AMP_0_DB);
+        l.update_settings();
+
+        // Process data with blocks of different size
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 13 + 7) % 0x1fff + 1)
+        {
+            size_t to_do    = ((SAMPLES - i) > step) ? step : SAMPLES - i;
+            l.process(&out[i], &gain[i], &in[i], &in[i], to_do);
+            i              += to_do;
+        }
+
+        // Output signal should not exceed the threshold
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            float s         = fabs(out[i] * gain[i]);
+            if (s > THRESHOLD + TOLERANCE)
+                UTEST_FAIL_MSG("Output sample %d exceeds the threshold: %.6f > %.6f", int(i), s, THRESHOLD);
+            if ((gain[i] < 0.0f) || (gain[i] > 1.0f + TOLERANCE))
+                UTEST_FAIL_MSG("Invalid gain at sample %d: %.6f", int(i), gain[i]);
+        }
+
+        l.destroy();
+
+        delete [] out;
+        delete [] gain;
+    }
+
+    UTEST_MAIN
+    {
+        float *in       = new float[SAMPLES];
+
+        // Loud noise modulated by slow envelope
+        for (size_t i=0; i<SAMPLES; ++i)
+            in[i]           = (float(rand()) / RAND_MAX - 0.5f) * 4.0f * (1.0f + 0.5f * sinf(i * 0.001f));
+
+        test_mode("herm thin", LM_HERM_THIN, in);
+        test_mode("herm duck", LM_HERM_DUCK, in);
+        test_mode("exp wide", LM_EXP_WIDE, in);
+        test_mode("exp tail", LM_EXP_TAIL, in);
+        test_mode("line thin", LM_LINE_THIN, in);
+        test_mode("line wide", LM_LINE_WIDE, in);
+        test_mode("mixed herm", LM_MIXED_HERM, in);
+        test_mode("mixed exp", LM_MIXED_EXP, in);
+        test_mode("mixed line", LM_MIXED_LINE, in);
+
+        delete [] in;
+    }
+
+UTEST_END
@@ -0,0 +1,189 @@
+/*
+ * audio_stream.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <core/LSPString.h>
+#include <core/files/lspc/lspc.h>
+#include <core/files/lspc/LSPCAudioWriter.h>
+#include <core/files/AudioStream.h>
+#include <core/files/AudioStreamer.h>
+#include <core/sampling/SamplePlayer.h>
+
+#define TOTAL_FRAMES        100003
+#define CHANNELS            2
+#define HEAD_SIZE           4000
+#define BLOCK_SIZE          1024
+#define BLOCKS              4
+#define PROCESS_SIZE        300
+
+using namespace lsp;
+
+UTEST_BEGIN("core.files", audio_stream)
+
+    UTEST_TIMELIMIT(60)
+
+    static float sample_value(size_t channel, size_t i)
+    {
+        float v = float((i * 7) % 1001) / 1000.0f - 0.5f;
+        return (channel & 1) ? -v : v;
+    }
+
+    void create_file(const LSPString *path)
+    {
+        LSPCFile fd;
+        LSPCAudioWriter aw;
+        lspc_audio_parameters_t p;
+
+        UTEST_ASSERT(fd.create(path) == STATUS_OK);
+
+        p.channels          = CHANNELS;
+        p.sample_format     = LSPC_SAMPLE_FMT_F32LE;
+        p.sample_rate       = 48000;
+        p.codec             = LSPC_CODEC_PCM;
+        p.frames            = TOTAL_FRAMES;
+        UTEST_ASSERT(aw.open(&fd, &p) == STATUS_OK);
+
+        float frame[CHANNELS];
+        for (size_t i=0; i<TOTAL_FRAMES; ++i)
+        {
+            for (size_t j=0; j<CHANNELS; ++j)
+                frame[j]    = sample_value(j, i);
+            UTEST_ASSERT(aw.write_frames(frame, 1) == STATUS_OK);
+        }
+
+        UTEST_ASSERT(aw.close() == STATUS_OK);
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+    }
+
+    void check_data(const float *buf, size_t channel, size_t offset, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float v = sample_value(channel, offset + i);
+            if (!float_equals_absolute(buf[i], v, 1e-6f))
+                UTEST_FAIL_MSG("Data differs at sample %d of channel %d: %.6f vs %.6f",
+                        int(offset + i), int(channel), buf[i], v);
+        }
+    }
+
+    void test_read(AudioStream *as)
+    {
+        static const size_t offsets[] = { 0, 10, 3990, 50000, 1234, 99000, 100000, 70000 };
+        float *buf = new float[BLOCK_SIZE];
+        UTEST_ASSERT(buf != NULL);
+
+        UTEST_ASSERT(as->channels() == CHANNELS);
+        UTEST_ASSERT(as->samples() == TOTAL_FRAMES);
+        UTEST_ASSERT(as->sample_rate() == 48000);
+        UTEST_ASSERT(as->head_length() == HEAD_SIZE);
+
+        for (size_t j=0; j<CHANNELS; ++j)
+            check_data(as->head(j), j, 0, HEAD_SIZE);
+
+        // Perform random-access reads, including backward seeks
+        for (size_t i=0; i<sizeof(offsets)/sizeof(size_t); ++i)
+        {
+            for (size_t j=0; j<CHANNELS; ++j)
+            {
+                size_t count    = TOTAL_FRAMES - offsets[i];
+                if (count > BLOCK_SIZE)
+                    count           = BLOCK_SIZE;
+                printf("Reading %d samples at offset %d of channel %d...\n", int(count), int(offsets[i]), int(j));
+                UTEST_ASSERT(as->read(j, buf, offsets[i], BLOCK_SIZE) == ssize_t(count));
+                check_data(buf, j, offsets[i], count);
+            }
+        }
+
+        UTEST_ASSERT(as->read(0, buf, TOTAL_FRAMES, BLOCK_SIZE) == 0);
+        UTEST_ASSERT(as->read(CHANNELS, buf, 0, BLOCK_SIZE) < 0);
+
+        delete [] buf;
+    }
+
+    void wait_streamer(AudioStreamer *st)
+    {
+        for (size_t i=0; (i < 10000) && (st->pending() > 0); ++i)
+            ipc::Thread::sleep(1);
+        UTEST_ASSERT_MSG(st->pending() == 0, "I/O thread did not load requested blocks");
+    }
+
+    void test_player(AudioStream *as, AudioStreamer *st, size_t length)
+    {
+        printf("Playing streamed sample, streamer=%p...\n", st);
+
+        SamplePlayer sp;
+        UTEST_ASSERT(sp.init(1, 4));
+        sp.set_streamer(st);
+
+        Sample *s = new Sample();
+        UTEST_ASSERT(s != NULL);
+        UTEST_ASSERT(s->init_stream(as));
+        UTEST_ASSERT(s->valid());
+        UTEST_ASSERT(s->length() == TOTAL_FRAMES);
+        UTEST_ASSERT(sp.bind(0, s));
+
+        float *buf  = new float[PROCESS_SIZE];
+        UTEST_ASSERT(buf != NULL);
+
+        // Play the second channel with delay
+        UTEST_ASSERT(sp.play(0, 1, 0.5f, PROCESS_SIZE / 2));
+
+        for (size_t off = 0; off < TOTAL_FRAMES + PROCESS_SIZE; off += PROCESS_SIZE)
+        {
+            if (st != NULL)
+                wait_streamer(st);
+            sp.process(buf, PROCESS_SIZE);
+
+            for (size_t i=0; i<PROCESS_SIZE; ++i)
+            {
+                ssize_t k   = ssize_t(off + i) - PROCESS_SIZE / 2;
+                float v     = ((k >= 0) && (k < ssize_t(length))) ? 0.5f * sample_value(1, k) : 0.0f;
+                if (!float_equals_absolute(buf[i], v, 1e-6f))
+                    UTEST_FAIL_MSG("Output differs at sample %d: %.6f vs %.6f", int(off + i), buf[i], v);
+            }
+        }
+
+        sp.destroy(true);
+        delete [] buf;
+
+        // The stream should be released by the I/O thread
+        if (st != NULL)
+        {
+            UTEST_ASSERT(st->underruns() == 0);
+            for (size_t i=0; (i < 10000) && (as->in_use()); ++i)
+                ipc::Thread::sleep(1);
+        }
+        UTEST_ASSERT(!as->in_use());
+    }
+
+    UTEST_MAIN
+    {
+        LSPString path;
+        UTEST_ASSERT(path.fmt_utf8("tmp/utest-%s.lspc", full_name()));
+        create_file(&path);
+
+        AudioStream as;
+        UTEST_ASSERT(as.open(path.get_utf8(), HEAD_SIZE) == STATUS_OK);
+        UTEST_ASSERT(as.valid());
+        test_read(&as);
+
+        // Without streamer only the resident head is played
+        test_player(&as, NULL, HEAD_SIZE);
+
+        AudioStreamer st;
+        UTEST_ASSERT(st.init(2, BLOCKS, BLOCK_SIZE) == STATUS_OK);
+        UTEST_ASSERT(st.block_size() == BLOCK_SIZE);
+        test_player(&as, &st, TOTAL_FRAMES);
+        st.destroy();
+
+        UTEST_ASSERT(as.close() == STATUS_OK);
+        UTEST_ASSERT(!as.valid());
+    }
+
+UTEST_END
@@ -0,0 +1,99 @@
+/*
+ * resample.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <core/files/AudioFile.h>
+
+#define SRC_SAMPLES         0x30000
+#define MARGIN              64
+
+using namespace lsp;
+
+UTEST_BEGIN("core.files", resample)
+
+    void init_file(AudioFile *af, size_t channels, size_t sample_rate, float freq)
+    {
+        UTEST_ASSERT(af->create_samples(channels, sample_rate, SRC_SAMPLES) == STATUS_OK);
+        for (size_t c=0; c<channels; ++c)
+        {
+            float *dst  = af->channel(c);
+            UTEST_ASSERT(dst != NULL);
+            for (size_t i=0; i<SRC_SAMPLES; ++i)
+                dst[i]      = sin(2.0 * M_PI * freq * i / sample_rate + c);
+        }
+    }
+
+    void test_sine(size_t src_sr, size_t dst_sr, float freq, float tolerance)
+    {
+        printf("Testing resampling of %.1f Hz sine %d -> %d...\n", freq, int(src_sr), int(dst_sr));
+
+        AudioFile af;
+        init_file(&af, 2, src_sr, freq);
+        UTEST_ASSERT(af.resample(dst_sr) == STATUS_OK);
+        UTEST_ASSERT(af.sample_rate() == dst_sr);
+        UTEST_ASSERT(af.channels() == 2);
+
+        size_t length   = (size_t(SRC_SAMPLES) * dst_sr) / src_sr;
+        UTEST_ASSERT(af.samples() >= length);
+
+        for (size_t c=0; c<2; ++c)
+        {
+            const float *dst = af.channel(c);
+            for (size_t i=MARGIN; i<length - MARGIN; ++i)
+            {
+                float v     = sin(2.0 * M_PI * freq * i / dst_sr + c);
+                if (!float_equals_absolute(dst[i], v, tolerance))
+                    UTEST_FAIL_MSG("Channel %d differs at sample %d: %.6f vs %.6f", int(c), int(i), dst[i], v);
+            }
+        }
+
+        af.destroy();
+    }
+
+    void test_alias(size_t src_sr, size_t dst_sr, float freq, float level)
+    {
+        printf("Testing rejection of %.1f Hz sine %d -> %d...\n", freq, int(src_sr), int(dst_sr));
+
+        AudioFile af;
+        init_file(&af, 1, src_sr, freq);
+        UTEST_ASSERT(af.resample(dst_sr) == STATUS_OK);
+
+        size_t length   = (size_t(SRC_SAMPLES) * dst_sr) / src_sr;
+        const float *dst = af.channel(0);
+        float peak      = 0.0f;
+        for (size_t i=MARGIN; i<length - MARGIN; ++i)
+        {
+            if (peak < fabs(dst[i]))
+                peak            = fabs(dst[i]);
+        }
+
+        printf("  peak level of aliased signal: %.6f\n", peak);
+        UTEST_ASSERT_MSG(peak < level, "Aliased signal is too loud: %.6f", peak);
+
+        af.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        // Integer ratios
+        test_sine(44100, 88200, 1000.0f, 1e-3f);
+        test_sine(96000, 48000, 1000.0f, 1e-3f);
+
+        // Rational ratios
+        test_sine(44100, 96000, 1000.0f, 1e-3f);
+        test_sine(44100, 48000, 3000.0f, 1e-3f);
+        test_sine(48000, 44100, 3000.0f, 1e-3f);
+        test_sine(96000, 44100, 1000.0f, 1e-3f);
+
+        // Frequencies above the new Nyquist frequency should be suppressed
+        test_alias(96000, 48000, 36000.0f, 1e-2f);
+        test_alias(48000, 22050, 20000.0f, 1e-2f);
+    }
+
+UTEST_END
@@ -0,0 +1,99 @@
+/*
+ * dynamic.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+#include <core/filters/DynamicFilters.h>
+
+#define BUF_SIZE        0x2000
+#define SAMPLE_RATE     48000
+#define SEED            0x5eed1234
+#define TOL_4           1e-3f       /* Maximum absolute error for step=4, input amplitude is 0.5 */
+#define TOL_8           4e-3f       /* Maximum absolute error for step=8 */
+#define TOL_16          1.2e-2f     /* Maximum absolute error for step=16 */
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Interpolated coefficients of dynamic filters should stay close to exact ones
+UTEST_BEGIN("core.filters", dynamic)
+
+    void process(FloatBuffer &out, const FloatBuffer &in, const FloatBuffer &gain, size_t type, size_t step)
+    {
+        filter_params_t fp;
+        fp.nType        = type;
+        fp.fFreq        = 1000.0f;
+        fp.fFreq2       = 4000.0f;
+        fp.fGain        = 1.0f;
+        fp.nSlope       = 2;
+        fp.fQuality     = 0.0f;
+
+        DynamicFilters df;
+        UTEST_ASSERT(df.init(1) == STATUS_OK);
+        df.set_sample_rate(SAMPLE_RATE);
+        UTEST_ASSERT(df.set_params(0, &fp));
+        UTEST_ASSERT(df.set_filter_active(0, true));
+        df.set_interpolation(step);
+        UTEST_ASSERT(df.get_interpolation() == step);
+
+        df.process(0, out, in, gain, out.size());
+        df.destroy();
+
+        UTEST_ASSERT_MSG(out.valid(), "Output buffer corrupted");
+    }
+
+    void test(const char *label, const FloatBuffer &in, const FloatBuffer &gain, size_t type, size_t step, float tol)
+    {
+        FloatBuffer ref(BUF_SIZE);
+        FloatBuffer out(BUF_SIZE);
+
+        process(ref, in, gain, type, 1);
+        process(out, in, gain, type, step);
+
+        float err = 0.0f;
+        for (size_t i=0; i<BUF_SIZE; ++i)
+        {
+            float d = fabs(out[i] - ref[i]);
+            if (d > err)
+                err     = d;
+        }
+
+        printf("Testing %s dynamic filter, step=%d: maximum error %e\n", label, int(step), err);
+        UTEST_ASSERT_MSG(err <= tol, "%s, step=%d: maximum error %e exceeds %e", label, int(step), err, tol);
+    }
+
+    void test(const char *label, const FloatBuffer &in, const FloatBuffer &gain, size_t type)
+    {
+        test(label, in, gain, type, 4, TOL_4);
+        test(label, in, gain, type, 8, TOL_8);
+        test(label, in, gain, type, 16, TOL_16);
+    }
+
+    UTEST_MAIN
+    {
+        FloatBuffer in(BUF_SIZE);
+        FloatBuffer gain(BUF_SIZE);
+
+        // Prepare input signal and envelope similar to the compressor's one
+        srand(SEED);
+        float g = 1.0f, t = 1.0f;
+        for (size_t i=0; i < BUF_SIZE; ++i)
+        {
+            if (!(i % 0x400))
+                t               = expf(-(rand() % 24) * M_LN10 / 20.0f);
+            g              += (t - g) * 0.004f;
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+            gain[i]         = g;
+        }
+
+        test("LRX hi-shelf", in, gain, FLT_BT_LRX_HISHELF);
+        test("LRX ladder-pass", in, gain, FLT_BT_LRX_LADDERPASS);
+        test("MT LRX ladder-pass", in, gain, FLT_MT_LRX_LADDERPASS);
+        test("RLC bell", in, gain, FLT_BT_RLC_BELL);
+    }
+UTEST_END
@@ -0,0 +1,140 @@
+/*
+ * spsc_queue.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/SPSCQueue.h>
+
+#define TOTAL_ITEMS     0x10000
+#define QUEUE_SIZE      100
+
+using namespace lsp;
+
+UTEST_BEGIN("core.ipc", spsc_queue)
+
+    UTEST_TIMELIMIT(60)
+
+    typedef struct item_t
+    {
+        uint32_t    index;
+        float       value;
+    } item_t;
+
+    class Producer: public ipc::Thread
+    {
+        private:
+            ipc::SPSCQueue<item_t> *queue;
+            size_t retries;
+
+        public:
+            explicit Producer(ipc::SPSCQueue<item_t> *q) { queue = q; retries = 0; }
+            virtual ~Producer() {}
+
+            virtual status_t run()
+            {
+                item_t item;
+                for (size_t i=0; i<TOTAL_ITEMS; )
+                {
+                    item.index  = i;
+                    item.value  = i * 0.5f;
+                    if (queue->push(item))
+                        ++i;
+                    else
+                    {
+                        ++retries;
+                        ipc::Thread::sleep(1);
+                    }
+                }
+                return STATUS_OK;
+            }
+
+            inline size_t get_retries() const { return retries; }
+    };
+
+    void test_single_thread()
+    {
+        ipc::SPSCQueue<item_t> q;
+        item_t item;
+
+        printf("Testing single-threaded access...\n");
+
+        // Empty queue
+        UTEST_ASSERT(q.capacity() == 0);
+        UTEST_ASSERT(!q.pop(&item));
+        item.index  = 0;
+        UTEST_ASSERT(!q.push(item));
+        UTEST_ASSERT(q.dropped() == 1);
+
+        // Capacity is rounded to the power of two
+        UTEST_ASSERT(q.init(QUEUE_SIZE));
+        UTEST_ASSERT(q.capacity() == 128);
+        UTEST_ASSERT(q.dropped() == 0);
+
+        // Overflow and FIFO order, several rounds to wrap the positions
+        for (size_t round=0; round<3; ++round)
+        {
+            for (size_t i=0; i<q.capacity(); ++i)
+            {
+                item.index  = round * 1000 + i;
+                UTEST_ASSERT(q.push(item));
+            }
+            item.index  = 0;
+            UTEST_ASSERT(!q.push(item));
+            UTEST_ASSERT(q.dropped() == round + 1);
+
+            for (size_t i=0; i<q.capacity(); ++i)
+            {
+                UTEST_ASSERT(q.pop(&item));
+                UTEST_ASSERT(item.index == round * 1000 + i);
+            }
+            UTEST_ASSERT(!q.pop(&item));
+        }
+
+        UTEST_ASSERT(q.pushed() == q.capacity() * 3);
+        q.destroy();
+        UTEST_ASSERT(q.capacity() == 0);
+    }
+
+    void test_multiple_threads()
+    {
+        ipc::SPSCQueue<item_t> q;
+        item_t item;
+
+        printf("Testing producer and consumer threads...\n");
+        UTEST_ASSERT(q.init(QUEUE_SIZE));
+
+        Producer p(&q);
+        UTEST_ASSERT(p.start() == STATUS_OK);
+
+        for (size_t i=0; i<TOTAL_ITEMS; )
+        {
+            if (!q.pop(&item))
+            {
+                ipc::Thread::sleep(1);
+                continue;
+            }
+
+            if ((item.index != i) || (item.value != i * 0.5f))
+                UTEST_FAIL_MSG("Item #%d has been received instead of #%d", int(item.index), int(i));
+            ++i;
+        }
+
+        UTEST_ASSERT(p.join() == STATUS_OK);
+        UTEST_ASSERT(p.get_result() == STATUS_OK);
+        UTEST_ASSERT(!q.pop(&item));
+        UTEST_ASSERT(q.pushed() == TOTAL_ITEMS);
+        UTEST_ASSERT(q.dropped() == p.get_retries());
+
+        printf("Transferred %d items, producer retries: %d\n", int(TOTAL_ITEMS), int(p.get_retries()));
+    }
+
+    UTEST_MAIN
+    {
+        test_single_thread();
+        test_multiple_threads();
+    }
+UTEST_END
@@ -0,0 +1,153 @@
+/*
+ * stealing.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/WorkStealingExecutor.h>
+
+using namespace lsp;
+
+#define TASKS           64
+#define TREE_DEPTH      8
+
+static const status_t statuses[] =
+{
+    STATUS_OK, STATUS_NOT_FOUND, STATUS_BAD_ARGUMENTS, STATUS_CANCELLED
+};
+
+UTEST_BEGIN("core.ipc", stealing)
+
+    class TestTask: public ipc::ITask
+    {
+        private:
+            size_t nDelay;
+            status_t nResult;
+
+        public:
+            explicit TestTask(size_t delay, status_t result) : nDelay(delay), nResult(result) {}
+            virtual ~TestTask() {}
+
+        public:
+            virtual status_t run()
+            {
+                ipc::Thread::sleep(nDelay);
+                return nResult;
+            }
+    };
+
+    class TreeTask: public ipc::ITask
+    {
+        private:
+            ipc::WorkStealingExecutor  *pExecutor;
+            size_t                      nDepth;
+            size_t                      nNodes;
+
+        public:
+            explicit TreeTask(ipc::WorkStealingExecutor *executor, size_t depth):
+                pExecutor(executor), nDepth(depth), nNodes(0) {}
+            virtual ~TreeTask() {}
+
+        public:
+            inline size_t nodes() const { return nNodes; }
+
+            virtual status_t run()
+            {
+                nNodes      = 1;
+                if (nDepth <= 0)
+                    return STATUS_OK;
+
+                // Fork two child tasks and wait for them
+                TreeTask left(pExecutor, nDepth - 1);
+                TreeTask right(pExecutor, nDepth - 1);
+                if (!pExecutor->fork(&left))
+                    return STATUS_UNKNOWN_ERR;
+                if (!pExecutor->fork(&right))
+                    return STATUS_UNKNOWN_ERR;
+
+                pExecutor->wait(&left);
+                pExecutor->wait(&right);
+                if ((!left.successful()) || (!right.successful()))
+                    return STATUS_UNKNOWN_ERR;
+
+                nNodes     += left.nodes() + right.nodes();
+                return STATUS_OK;
+            }
+    };
+
+    void test_submit()
+    {
+        TestTask *tasks[TASKS];
+
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            tasks[i] = new TestTask(10 + (rand() % 20), statuses[i % 4]);
+            UTEST_ASSERT(tasks[i] != NULL);
+            UTEST_ASSERT(tasks[i]->idle());
+        }
+
+        printf("Starting work-stealing executor...\n");
+        ipc::WorkStealingExecutor executor(4);
+        UTEST_ASSERT(executor.start() == STATUS_OK);
+        UTEST_ASSERT(executor.threads() == 4);
+
+        printf("Submitting tasks...\n");
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            UTEST_ASSERT(executor.submit(tasks[i]));
+            ipc::ITask::task_state_t ts = tasks[i]->state();
+            UTEST_ASSERT(
+                    (ts == ipc::ITask::TS_SUBMITTED) ||
+                    (ts == ipc::ITask::TS_RUNNING) ||
+                    (ts == ipc::ITask::TS_COMPLETED)
+                    );
+            UTEST_ASSERT(!executor.submit(tasks[i]));
+        }
+
+        printf("Shutting down executor...\n");
+        executor.shutdown();
+        UTEST_ASSERT(executor.pending() == 0);
+
+        printf("Checking tasks...\n");
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            UTEST_ASSERT(tasks[i]->completed());
+            UTEST_ASSERT(tasks[i]->code() == statuses[i % 4]);
+            UTEST_ASSERT(tasks[i]->reset());
+            UTEST_ASSERT(tasks[i]->idle());
+        }
+
+        printf("Destroying tasks...\n");
+        for (size_t i=0; i<TASKS; ++i)
+            delete tasks[i];
+    }
+
+    void test_fork()
+    {
+        printf("Starting work-stealing executor...\n");
+        ipc::WorkStealingExecutor executor(4);
+        UTEST_ASSERT(executor.start() == STATUS_OK);
+
+        printf("Submitting task tree of depth %d...\n", int(TREE_DEPTH));
+        TreeTask root(&executor, TREE_DEPTH);
+        UTEST_ASSERT(executor.submit(&root));
+        UTEST_ASSERT(executor.wait(&root));
+
+        UTEST_ASSERT(root.completed());
+        UTEST_ASSERT(root.successful());
+        UTEST_ASSERT(root.nodes() == (size_t(2) << TREE_DEPTH) - 1);
+
+        printf("Shutting down executor...\n");
+        executor.shutdown();
+    }
+
+    UTEST_MAIN
+    {
+        test_submit();
+        test_fork();
+    }
+
+UTEST_END
@@ -0,0 +1,245 @@
+/*
+ * task.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/NativeExecutor.h>
+
+#define POLL_ROUNDS         20000
+
+using namespace lsp;
+
+UTEST_BEGIN("core.ipc", task)
+
+    class ChainTask: public ipc::ITask
+    {
+        private:
+            size_t     *pCounter;
+            size_t      nOrder;
+            status_t    nResult;
+
+        public:
+            explicit ChainTask(size_t *counter, status_t result):
+                pCounter(counter), nOrder(0), nResult(result) {}
+            virtual ~ChainTask() {}
+
+        public:
+            inline size_t order() const { return nOrder; }
+
+            virtual status_t run()
+            {
+                nOrder      = ++(*pCounter);
+                return nResult;
+            }
+    };
+
+    class LongTask: public ipc::ITask
+    {
+        public:
+            explicit LongTask() {}
+            virtual ~LongTask() {}
+
+        public:
+            virtual status_t run()
+            {
+                // Wait for cancellation, but not more than 10 seconds
+                for (size_t i=0; i<1000; ++i)
+                {
+                    if (cancelled())
+                        return STATUS_CANCELLED;
+                    ipc::Thread::sleep(10);
+                }
+                return STATUS_OK;
+            }
+    };
+
+    // Executor that never sleeps, so the owner and the executor thread
+    // change and poll task states concurrently as often as possible
+    class SpinExecutor: public ipc::IExecutor
+    {
+        private:
+            ipc::ITask * volatile   pTask;
+
+        public:
+            explicit SpinExecutor(): pTask(NULL) {}
+            virtual ~SpinExecutor() {}
+
+        public:
+            virtual bool submit(ipc::ITask *task)
+            {
+                if ((!task->idle()) || (pTask != NULL))
+                    return false;
+                change_task_state(task, ipc::ITask::TS_SUBMITTED);
+                pTask       = task;
+                return true;
+            }
+
+            static status_t execute(void *arg)
+            {
+                SpinExecutor *self  = reinterpret_cast<SpinExecutor *>(arg);
+                while (!ipc::Thread::is_cancelled())
+                {
+                    ipc::ITask *task    = self->pTask;
+                    if (task == NULL)
+                    {
+                        ipc::Thread::yield();
+                        continue;
+                    }
+                    self->pTask         = NULL;
+                    run_task(task);
+                }
+                return STATUS_OK;
+            }
+    };
+
+    static void count_callback(ipc::ITask *task, void *arg)
+    {
+        size_t *counter = reinterpret_cast<size_t *>(arg);
+        ++(*counter);
+    }
+
+    void submit_task(ipc::IExecutor *executor, ipc::ITask *task)
+    {
+        // The submission may fail if executor's queue is busy
+        while (!executor->submit(task))
+        {
+            UTEST_ASSERT(task->idle());
+            ipc::Thread::sleep(1);
+        }
+    }
+
+    void wait_task(ipc::ITask *task)
+    {
+        while (!task->completed())
+            ipc::Thread::sleep(10);
+    }
+
+    void test_continuations(ipc::IExecutor *executor)
+    {
+        size_t counter = 0, calls = 0;
+        ChainTask t1(&counter, STATUS_OK), t2(&counter, STATUS_OK), t3(&counter, STATUS_OK);
+
+        printf("Testing chain of continuations...\n");
+        UTEST_ASSERT(t1.set_continuation(&t2));
+        UTEST_ASSERT(t2.set_continuation(&t3));
+        UTEST_ASSERT(t1.set_callback(count_callback, &calls));
+        UTEST_ASSERT(t2.set_callback(count_callback, &calls));
+        UTEST_ASSERT(t3.set_callback(count_callback, &calls));
+
+        submit_task(executor, &t1);
+        UTEST_ASSERT(!t1.set_continuation(NULL));
+        wait_task(&t3);
+
+        UTEST_ASSERT(t1.completed() && t2.completed() && t3.completed());
+        UTEST_ASSERT((t1.order() == 1) && (t2.order() == 2) && (t3.order() == 3));
+        UTEST_ASSERT(t3.code() == STATUS_OK);
+        UTEST_ASSERT(calls == 3);
+
+        printf("Testing failure propagation...\n");
+        UTEST_ASSERT(t1.reset() && t2.reset() && t3.reset());
+        ChainTask f(&counter, STATUS_NOT_FOUND);
+        UTEST_ASSERT(f.set_continuation(&t3));
+        UTEST_ASSERT(f.set_callback(count_callback, &calls));
+        UTEST_ASSERT(t1.set_continuation(&f));
+
+        counter = 0;
+        calls   = 0;
+        submit_task(executor, &t1);
+        wait_task(&t3);
+
+        UTEST_ASSERT((t1.order() == 1) && (f.order() == 2) && (t3.order() == 3)); // t3 keeps the old order
+        UTEST_ASSERT(counter == 2);
+        UTEST_ASSERT(t1.code() == STATUS_OK);
+        UTEST_ASSERT(f.code() == STATUS_NOT_FOUND);
+        UTEST_ASSERT(t3.code() == STATUS_NOT_FOUND);
+        UTEST_ASSERT(calls == 3);
+        UTEST_ASSERT(!t2.completed());
+    }
+
+    void test_cancellation(ipc::IExecutor *executor)
+    {
+        size_t counter = 0;
+        LongTask lt;
+        ChainTask t1(&counter, STATUS_OK), t2(&counter, STATUS_OK);
+
+        printf("Testing cancellation of running task...\n");
+        UTEST_ASSERT(lt.set_continuation(&t1));
+        submit_task(executor, &lt);
+        while (lt.submitted())
+            ipc::Thread::sleep(10);
+        UTEST_ASSERT(lt.cancel());
+        wait_task(&t1);
+
+        UTEST_ASSERT(lt.code() == STATUS_CANCELLED);
+        UTEST_ASSERT(t1.code() == STATUS_CANCELLED);
+        UTEST_ASSERT(counter == 0);
+        UTEST_ASSERT(!lt.cancel());
+        UTEST_ASSERT(lt.reset());
+        UTEST_ASSERT(!lt.cancelled());
+
+        printf("Testing cancellation of submitted task...\n");
+        UTEST_ASSERT(t2.cancel());
+        submit_task(executor, &t2);
+        wait_task(&t2);
+        UTEST_ASSERT(t2.code() == STATUS_CANCELLED);
+        UTEST_ASSERT(counter == 0);
+    }
+
+    void test_polling()
+    {
+        SpinExecutor executor;
+        ipc::Thread thread(SpinExecutor::execute, &executor);
+        UTEST_ASSERT(thread.start() == STATUS_OK);
+
+        size_t counter = 0;
+        ChainTask t1(&counter, STATUS_OK), t2(&counter, STATUS_OK);
+
+        printf("Testing polling of chain state...\n");
+        UTEST_ASSERT(t1.set_continuation(&t2));
+
+        for (size_t i=0; i<POLL_ROUNDS; ++i)
+        {
+            submit_task(&executor, &t1);
+
+            // The continuation should never be seen idle after the head has completed,
+            // otherwise the owner could reset or re-submit the chain while it is running
+            while (true)
+            {
+                bool head_done  = t1.completed();
+                bool cont_idle  = t2.idle();
+                if (head_done && cont_idle)
+                    UTEST_FAIL_MSG("Continuation is idle after completion of the head task, round=%d", int(i));
+                if (t2.completed())
+                    break;
+                ipc::Thread::yield();
+            }
+
+            UTEST_ASSERT(t1.completed());
+            UTEST_ASSERT(counter == (i + 1) * 2);
+            UTEST_ASSERT(t1.reset() && t2.reset());
+        }
+
+        thread.cancel();
+        thread.join();
+    }
+
+    UTEST_MAIN
+    {
+        printf("Starting native executor...\n");
+        ipc::NativeExecutor executor;
+        UTEST_ASSERT(executor.start() == STATUS_OK);
+
+        test_continuations(&executor);
+        test_cancellation(&executor);
+
+        printf("Shutting down executor...\n");
+        executor.shutdown();
+
+        test_polling();
+    }
+
+UTEST_END
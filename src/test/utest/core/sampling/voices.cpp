@@ -0,0 +1,209 @@
+/*
+ * voices.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+#include <dsp/dsp.h>
+#include <core/sampling/SamplePlayer.h>
+
+#define SAMPLES             8
+#define SAMPLE_LENGTH       1000
+#define BUF_SIZE            0x1000
+#define CANCEL_TIME         300
+#define TOLERANCE           1e-4f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.sampling", voices)
+
+    float vData[SAMPLES][SAMPLE_LENGTH];
+
+    typedef struct voice_t
+    {
+        size_t      id;
+        float       volume;
+        ssize_t     delay;
+        ssize_t     fadeout;        // Negative if not cancelled
+        ssize_t     fade_delay;     // Delay of the fadeout relative to CANCEL_TIME
+    } voice_t;
+
+    void init_player(SamplePlayer &sp, size_t polyphony)
+    {
+        UTEST_ASSERT(sp.init(SAMPLES, polyphony));
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            Sample *s = new Sample;
+            UTEST_ASSERT(s->init(1, SAMPLE_LENGTH, SAMPLE_LENGTH));
+            float *buf = s->getBuffer(0);
+            for (size_t j=0; j<SAMPLE_LENGTH; ++j)
+                vData[i][j] = float(rand()) / RAND_MAX - 0.5f;
+            dsp::copy(buf, vData[i], SAMPLE_LENGTH);
+            UTEST_ASSERT(sp.bind(i, s));
+        }
+    }
+
+    void render(SamplePlayer &sp, float *dst, size_t step)
+    {
+        for (size_t i=0; i<BUF_SIZE; )
+        {
+            size_t to_do    = ((BUF_SIZE - i) > step) ? step : BUF_SIZE - i;
+            sp.process(&dst[i], to_do);
+            i              += to_do;
+        }
+    }
+
+    void reference(float *dst, const voice_t *v, size_t n)
+    {
+        dsp::fill_zero(dst, BUF_SIZE);
+        for (size_t i=0; i<n; ++i)
+        {
+            const float *buf = vData[v[i].id];
+
+            for (size_t t=0; t<BUF_SIZE; ++t)
+            {
+                ssize_t off = ssize_t(t) - v[i].delay;
+                if ((off < 0) || (off >= SAMPLE_LENGTH))
+                    continue;
+                float gain  = v[i].volume;
+                if (v[i].fadeout >= 0)
+                {
+                    ssize_t h   = ssize_t(t) - CANCEL_TIME - v[i].fade_delay;
+                    if (h >= v[i].fadeout)
+                        gain        = 0.0f;
+                    else if (h >= 0)
+                        gain       *= float(v[i].fadeout - h) / (v[i].fadeout + 1);
+                }
+                dst[t]     += buf[off] * gain;
+            }
+        }
+    }
+
+    void test_mixing()
+    {
+        static const voice_t voices[] =
+        {
+            { 0, 1.0f, 0, -1, 0 },
+            { 1, 0.5f, 0, -1, 0 },
+            { 2, 0.7f, 0, 200, 0 },
+            { 3, 1.2f, 0, -1, 0 },
+            { 4, 0.3f, 0, 100, 17 },
+            { 5, 0.9f, 13, -1, 0 },
+            { 6, 1.1f, 101, 500, 3 },
+            { 7, 0.6f, 1000, -1, 0 },
+            { 0, 0.4f, 2000, -1, 0 },
+            { 1, 0.8f, 5, -1, 0 }
+        };
+        size_t n = sizeof(voices) / sizeof(voice_t);
+
+        UTEST_FOREACH(step, 1, 7, 16, 64, 100, 256, 1000)
+        {
+            printf("Testing mixing of %d voices with block size %d...\n", int(n), int(step));
+
+            SamplePlayer sp;
+            init_player(sp, 16);
+
+            FloatBuffer dst1(BUF_SIZE);
+            FloatBuffer dst2(BUF_SIZE);
+            reference(dst1, voices, n);
+
+            for (size_t i=0; i<n; ++i)
+                UTEST_ASSERT(sp.play(voices[i].id, 0, voices[i].volume, voices[i].delay));
+            UTEST_ASSERT(sp.active() == n);
+
+            // Render before cancel, cancel, render the rest
+            float *dptr = dst2;
+            for (size_t i=0; i<CANCEL_TIME; )
+            {
+                size_t to_do    = ((CANCEL_TIME - i) > step) ? step : CANCEL_TIME - i;
+                sp.process(&dptr[i], to_do);
+                i              += to_do;
+            }
+            for (size_t i=0; i<n; ++i)
+            {
+                if (voices[i].fadeout >= 0)
+                    UTEST_ASSERT(sp.cancel_all(voices[i].id, 0, voices[i].fadeout, voices[i].fade_delay) == 1);
+            }
+            for (size_t i=CANCEL_TIME; i<BUF_SIZE; )
+            {
+                size_t to_do    = ((BUF_SIZE - i) > step) ? step : BUF_SIZE - i;
+                sp.process(&dptr[i], to_do);
+                i              += to_do;
+            }
+
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+            UTEST_ASSERT(sp.active() == 0);
+            if (!dst1.equals_absolute(dst2, TOLERANCE))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output differs at sample %d: %.6f vs %.6f",
+                        int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+
+            sp.destroy(true);
+        }
+    }
+
+    void test_stealing()
+    {
+        printf("Testing voice stealing...\n");
+
+        static const voice_t voices[] =
+        {
+            { 0, 1.0f, 0, -1, 0 },
+            { 1, 0.5f, 10, -1, 0 },
+            { 2, 0.7f, 20, -1, 0 },
+            { 3, 1.2f, 30, -1, 0 }
+        };
+
+        SamplePlayer sp;
+        init_player(sp, 8);
+        sp.set_polyphony(3);
+        UTEST_ASSERT(sp.get_polyphony() == 3);
+
+        // The oldest voice should be stolen
+        for (size_t i=0; i<4; ++i)
+            UTEST_ASSERT(sp.play(voices[i].id, 0, voices[i].volume, voices[i].delay));
+        UTEST_ASSERT(sp.active() == 3);
+
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+        reference(dst1, &voices[1], 3);
+        render(sp, dst2, 64);
+
+        if (!dst1.equals_absolute(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output differs at sample %d: %.6f vs %.6f",
+                    int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        // Cancelled voice should be stolen before the oldest one
+        for (size_t i=0; i<3; ++i)
+            UTEST_ASSERT(sp.play(voices[i].id, 0, voices[i].volume, voices[i].delay));
+        UTEST_ASSERT(sp.cancel_all(1, 0, 1000, 0) == 1);
+        UTEST_ASSERT(sp.play(voices[3].id, 0, voices[3].volume, voices[3].delay));
+        UTEST_ASSERT(sp.active() == 3);
+        UTEST_ASSERT(sp.cancel_all(1, 0, 1000, 0) == 0);
+
+        // Decreasing the polyphony drops voices
+        sp.set_polyphony(1);
+        UTEST_ASSERT(sp.active() == 1);
+        sp.set_polyphony(0);
+        UTEST_ASSERT(sp.get_polyphony() == 8);
+
+        sp.destroy(true);
+    }
+
+    UTEST_MAIN
+    {
+        test_mixing();
+        test_stealing();
+    }
+UTEST_END
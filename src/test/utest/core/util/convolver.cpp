@@ -10,12 +10,16 @@
 #include <test/FloatBuffer.h>
 #include <test/helpers.h>
 #include <core/util/Convolver.h>
+#include <core/util/ConvolverCache.h>
+#include <core/util/ConvolverPool.h>
 
 using namespace lsp;
 
 #define CONV_SIZE       0x2000
 #define SRC_SIZE        0x2000
 #define SRC2_SIZE       0x20
+#define TAIL_CONV_SIZE  0x5000
+#define TAIL_SRC_SIZE   0x10000
 
 static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
 {
@@ -135,10 +139,163 @@ UTEST_BEGIN("core.util", convolver)
         c.destroy();
     }
 
+    void test_tail(size_t rank, bool background)
+    {
+        Convolver c;
+
+        FloatBuffer conv(TAIL_CONV_SIZE);
+        FloatBuffer src(TAIL_SRC_SIZE);
+        FloatBuffer dst1(src.size() + conv.size());
+        FloatBuffer dst2(src.size());
+
+        conv.randomize(-1.0f, 1.0f);
+        src.randomize(-1.0f, 1.0f);
+        dst1.fill_zero();
+        dst2.fill_zero();
+
+        printf("Testing tail convolution rank=%d, background=%d\n", int(rank), int(background));
+        UTEST_ASSERT(c.init(conv, conv.size(), rank, 0.25f, background));
+        dsp::convolve(dst1, src, conv, conv.size(), src.size());
+        convolve(c, dst2, src, src.size(), 61);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(conv.valid(), "Convolution buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        for (size_t i=0; i<dst2.size(); ++i)
+        {
+            if (!float_equals_absolute(dst1[i], dst2[i], 1e-2))
+                UTEST_FAIL_MSG("Output of convolver is invalid at sample=%d: %.5f vs %.5f",
+                        int(i), dst1[i], dst2[i]);
+        }
+
+        c.destroy();
+    }
+
+    void test_stall()
+    {
+        Convolver c1, c2;
+
+        FloatBuffer conv(TAIL_CONV_SIZE);
+        FloatBuffer src(TAIL_SRC_SIZE);
+        FloatBuffer dst1(src.size() + conv.size());
+        FloatBuffer dst2(src.size());
+
+        conv.randomize(-1.0f, 1.0f);
+        src.randomize(-1.0f, 1.0f);
+        dst1.fill_zero();
+        dst2.fill_zero();
+
+        printf("Testing convolution with stalled background worker\n");
+        UTEST_ASSERT(c1.init(conv, conv.size(), 9, 0.0f, true));
+        UTEST_ASSERT(c2.init(conv, conv.size(), 9, 0.5f, true));
+        UTEST_ASSERT(c1.background() && c2.background());
+        UTEST_ASSERT(ConvolverPool::threads() > 0);
+        dsp::convolve(dst1, src, conv, conv.size(), src.size());
+
+        // Worker claims the tail block and stalls in the middle of the signal,
+        // the RT thread should finish each frame without waiting for the worker
+        size_t part         = src.size() / 3;
+        convolve(c1, dst2, src, part, 64);
+        ConvolverPool::suspend();
+        convolve(c1, dst2.data(part), src.data(part), part, 64);
+        ConvolverPool::resume();
+        convolve(c1, dst2.data(part*2), src.data(part*2), src.size() - part*2, 64);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        for (size_t i=0; i<dst2.size(); ++i)
+        {
+            if (!float_equals_absolute(dst1[i], dst2[i], 1e-2))
+                UTEST_FAIL_MSG("Output of convolver is invalid at sample=%d: %.5f vs %.5f",
+                        int(i), dst1[i], dst2[i]);
+        }
+
+        // Worker threads are shared and stopped with the last convolver
+        c1.destroy();
+        UTEST_ASSERT(ConvolverPool::threads() > 0);
+        c2.destroy();
+        UTEST_ASSERT(ConvolverPool::threads() == 0);
+    }
+
+    void test_cache()
+    {
+        Convolver c1, c2;
+
+        FloatBuffer conv(TAIL_CONV_SIZE);
+        FloatBuffer src(TAIL_SRC_SIZE);
+        FloatBuffer dst1(src.size());
+        FloatBuffer dst2(src.size());
+
+        conv.randomize(-1.0f, 1.0f);
+        src.randomize(-1.0f, 1.0f);
+        dst1.fill_zero();
+        dst2.fill_zero();
+
+        printf("Testing shared convolution data\n");
+        size_t items        = ConvolverCache::size();
+
+        // Same impulse response should share the same data
+        ConvolverData *cd1  = ConvolverCache::get(conv, conv.size(), 12);
+        UTEST_ASSERT(cd1 != NULL);
+        ConvolverData *cd2  = ConvolverCache::get(conv, conv.size(), 12);
+        UTEST_ASSERT(cd1 == cd2);
+        UTEST_ASSERT(ConvolverCache::size() == (items + 1));
+
+        // Different rank or data should not share the data
+        ConvolverData *cd3  = ConvolverCache::get(conv, conv.size(), 11);
+        UTEST_ASSERT((cd3 != NULL) && (cd3 != cd1));
+        ConvolverData *cd4  = ConvolverCache::get(conv, conv.size() - 1, 12);
+        UTEST_ASSERT((cd4 != NULL) && (cd4 != cd1) && (cd4 != cd3));
+        FloatBuffer conv2(conv);
+        conv2[conv2.size() - 1] += 1.0f;
+        ConvolverData *cd5  = ConvolverCache::get(conv2, conv2.size(), 12);
+        UTEST_ASSERT((cd5 != NULL) && (cd5 != cd1) && (cd5 != cd3) && (cd5 != cd4));
+        UTEST_ASSERT(ConvolverCache::size() == (items + 4));
+        ConvolverCache::release(cd3);
+        ConvolverCache::release(cd4);
+        ConvolverCache::release(cd5);
+        UTEST_ASSERT(ConvolverCache::size() == (items + 1));
+
+        // Convolvers should produce the same output as for private data
+        UTEST_ASSERT(c1.init(cd1, 0.0f));
+        UTEST_ASSERT(c2.init(conv, conv.size(), 12, 0.0f));
+        ConvolverCache::release(cd1);
+        ConvolverCache::release(cd2);
+        UTEST_ASSERT(ConvolverCache::size() == (items + 1));
+
+        convolve(c1, dst1, src, src.size(), 128);
+        convolve(c2, dst2, src, src.size(), 128);
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        for (size_t i=0; i<dst2.size(); ++i)
+        {
+            if (!float_equals_absolute(dst1[i], dst2[i], 1e-5))
+                UTEST_FAIL_MSG("Output of convolvers differs at sample=%d: %.5f vs %.5f",
+                        int(i), dst1[i], dst2[i]);
+        }
+
+        // Last reference should remove data from cache
+        c1.destroy();
+        c2.destroy();
+        UTEST_ASSERT(ConvolverCache::size() == items);
+    }
+
     UTEST_MAIN
     {
         test_small();
         test_large();
+
+        for (size_t rank=CONVOLVER_RANK_MIN; rank <= 13; ++rank)
+        {
+            test_tail(rank, false);
+            test_tail(rank, true);
+        }
+
+        test_stall();
+        test_cache();
     }
 UTEST_END;
 
@@ -0,0 +1,153 @@
+/*
+ * oscillator.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/util/Oscillator.h>
+
+#define SRATE           48000
+#define SAMPLES         10000
+#define BLOCK_SIZE      1000
+
+using namespace lsp;
+
+UTEST_BEGIN("core.util", oscillator)
+
+    typedef struct wave_t
+    {
+        const char     *name;
+        fg_function_t   func;           // Function of the oscillator
+        float           max_error;      // Maximum allowed absolute error
+        float           rms_error;      // Maximum allowed RMS error
+    } wave_t;
+
+    void setup(Oscillator &osc, fg_function_t func, float freq, bool wavetable)
+    {
+        UTEST_ASSERT(osc.init());
+        osc.set_sample_rate(SRATE);
+        osc.set_function(func);
+        osc.set_frequency(freq);
+        osc.set_amplitude(0.7f);
+        osc.set_phase(0.3f);
+        osc.set_oversampler_mode(OM_NONE);
+        osc.set_squared_sinusoid_inversion(true);
+        osc.set_duty_ratio(0.3f);
+        osc.set_width(0.8f);
+        osc.set_trapezoid_ratios(0.3f, 0.2f);
+        osc.set_pulsetrain_ratios(0.4f, 0.3f);
+        osc.set_parabolic_width(0.6f);
+        osc.set_wavetable(wavetable);
+        osc.update_settings();
+    }
+
+    void synthesize(Oscillator &osc, float *dst)
+    {
+        for (size_t i=0; i<SAMPLES; i += BLOCK_SIZE)
+            osc.process_overwrite(&dst[i], BLOCK_SIZE);
+    }
+
+    void test_wave(const wave_t *w, float freq, float *a, float *b)
+    {
+        printf("Testing %s wave at %.1f Hz...\n", w->name, freq);
+
+        Oscillator osc, ref;
+        setup(osc, w->func, freq, true);
+        setup(ref, w->func, freq, false);
+        UTEST_ASSERT(osc.wavetable());
+
+        synthesize(osc, a);
+        synthesize(ref, b);
+        osc.destroy();
+        ref.destroy();
+
+        // Estimate errors
+        float max = 0.0f, rms = 0.0f;
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            float e     = fabs(a[i] - b[i]);
+            max         = (e > max) ? e : max;
+            rms        += e*e;
+        }
+        rms         = sqrtf(rms / SAMPLES);
+        printf("  maximum error: %.7f, RMS error: %.7f\n", max, rms);
+
+        UTEST_ASSERT_MSG(max <= w->max_error, "%s: maximum error %.7f exceeds %.7f", w->name, max, w->max_error);
+        UTEST_ASSERT_MSG(rms <= w->rms_error, "%s: RMS error %.7f exceeds %.7f", w->name, rms, w->rms_error);
+    }
+
+    void test_aliasing(const wave_t *w, float *a)
+    {
+        // 20 samples per period, harmonics above 10 would be aliased
+        float freq      = SRATE / 20;
+        printf("Testing aliasing of %s wave at %.1f Hz...\n", w->name, freq);
+
+        Oscillator osc;
+        setup(osc, w->func, freq, true);
+        synthesize(osc, a);
+        osc.destroy();
+
+        // Mip level should contain only harmonics below Nyquist frequency
+        float pass = 0.0f, stop = 0.0f;
+        for (size_t h=1; h<=10; ++h)
+        {
+            float re = 0.0f, im = 0.0f;
+            for (size_t i=0; i<20; ++i)
+            {
+                re         += a[i] * cosf(2.0f * M_PI * h * i / 20);
+                im         -= a[i] * sinf(2.0f * M_PI * h * i / 20);
+            }
+            if (h <= 8)
+                pass       += re*re + im*im;
+            else
+                stop       += re*re + im*im;
+        }
+        printf("  stop band to pass band energy: %.7f\n", stop / pass);
+        UTEST_ASSERT_MSG(stop <= pass * 1e-6f, "%s: harmonics above Nyquist frequency are present", w->name);
+    }
+
+    UTEST_MAIN
+    {
+        static const wave_t sinusoids[] =
+        {
+            { "sine",           FG_SINE,             2e-6f,  1e-6f   },
+            { "cosine",         FG_COSINE,           2e-6f,  1e-6f   },
+            { "squared sine",   FG_SQUARED_SINE,     2e-6f,  1e-6f   },
+            { "squared cosine", FG_SQUARED_COSINE,   2e-6f,  1e-6f   },
+            { NULL,             FG_MAX,              0.0f,   0.0f    }
+        };
+
+        // Band limited waves are compared with the analytic output without oversampling,
+        // the main difference is the Gibbs phenomenon near the discontinuities
+        static const wave_t bl_waves[] =
+        {
+            { "band limited rectangular", FG_BL_RECTANGULAR,   0.45f,  0.025f  },
+            { "band limited sawtooth",    FG_BL_SAWTOOTH,      2e-3f,  2e-4f   },
+            { "band limited trapezoid",   FG_BL_TRAPEZOID,     2e-3f,  2e-4f   },
+            { "band limited pulse train", FG_BL_PULSETRAIN,    0.3f,   0.02f   },
+            { "band limited parabolic",   FG_BL_PARABOLIC,     2e-3f,  2e-4f   },
+            { NULL,                       FG_MAX,              0.0f,   0.0f    }
+        };
+
+        float *a        = new float[SAMPLES];
+        float *b        = new float[SAMPLES];
+
+        for (const wave_t *w = sinusoids; w->name != NULL; ++w)
+        {
+            test_wave(w, 441.3f, a, b);
+            test_wave(w, 9876.5f, a, b);
+        }
+
+        for (const wave_t *w = bl_waves; w->name != NULL; ++w)
+        {
+            test_wave(w, 50.0f, a, b);
+            test_aliasing(w, a);
+        }
+
+        delete [] a;
+        delete [] b;
+    }
+UTEST_END
@@ -0,0 +1,118 @@
+/*
+ * oversampler.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <core/util/Oversampler.h>
+
+#define SRATE       48000
+#define FREQ        440.0f
+#define SAMPLES     0x4000
+#define SETTLE      0x400
+
+using namespace lsp;
+
+UTEST_BEGIN("core.util", oversampler)
+
+    class Callback: public IOversamplerCallback
+    {
+        public:
+            size_t      nSamples;
+
+        public:
+            explicit Callback(): nSamples(0) {}
+            virtual ~Callback() {}
+
+            virtual void process(float *out, const float *in, size_t samples)
+            {
+                dsp::copy(out, in, samples);
+                nSamples   += samples;
+            }
+    };
+
+    void init_oversampler(Oversampler *os, over_mode_t mode, size_t times)
+    {
+        UTEST_ASSERT(os->init());
+        os->set_sample_rate(SRATE);
+        os->set_mode(mode);
+        os->update_settings();
+        UTEST_ASSERT(os->get_oversampling() == times);
+    }
+
+    void test_mode(const char *label, over_mode_t mode, size_t times, float tolerance)
+    {
+        float *in   = new float[SAMPLES];
+        float *out  = new float[SAMPLES];
+        float *up   = new float[SAMPLES * 8];
+        float *down = new float[SAMPLES];
+
+        for (size_t i=0; i<SAMPLES; ++i)
+            in[i]       = sinf(2.0f * M_PI * FREQ * i / SRATE);
+
+        Oversampler os, us, ds;
+        Callback cb;
+        init_oversampler(&os, mode, times);
+        init_oversampler(&us, mode, times);
+        init_oversampler(&ds, mode, times);
+
+        size_t latency  = os.latency();
+        printf("Testing %s oversampling, latency=%d...\n", label, int(latency));
+
+        // Process data with blocks of different size
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 7 + 3) % 0x3ff + 1)
+        {
+            size_t to_do    = ((SAMPLES - i) > step) ? step : SAMPLES - i;
+            os.process(&out[i], &in[i], to_do, &cb);
+            i              += to_do;
+        }
+        UTEST_ASSERT(cb.nSamples == SAMPLES * times);
+
+        // Perform upsampling and downsampling separately
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 3 + 2) % 0x3ff + 1)
+        {
+            size_t to_do    = ((SAMPLES - i) > step) ? step : SAMPLES - i;
+            us.upsample(&up[i * times], &in[i], to_do);
+            i              += to_do;
+        }
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 5 + 1) % 0x3ff + 1)
+        {
+            size_t to_do    = ((SAMPLES - i) > step) ? step : SAMPLES - i;
+            ds.downsample(&down[i], &up[i * times], to_do);
+            i              += to_do;
+        }
+
+        // Output should be delayed input
+        for (size_t i=SETTLE; i<SAMPLES; ++i)
+        {
+            if (!float_equals_absolute(out[i], in[i - latency], tolerance))
+                UTEST_FAIL_MSG("process(): output differs at sample %d: %.6f vs %.6f", int(i), out[i], in[i - latency]);
+            if (!float_equals_absolute(down[i], in[i - latency], tolerance))
+                UTEST_FAIL_MSG("downsample(): output differs at sample %d: %.6f vs %.6f", int(i), down[i], in[i - latency]);
+        }
+
+        ds.destroy();
+        us.destroy();
+        os.destroy();
+
+        delete [] in;
+        delete [] out;
+        delete [] up;
+        delete [] down;
+    }
+
+    UTEST_MAIN
+    {
+        test_mode("half-band FIR 2x", OM_HALFBAND_2X, 2, 5e-4f);
+        test_mode("half-band FIR 4x", OM_HALFBAND_4X, 4, 5e-4f);
+        test_mode("half-band FIR 8x", OM_HALFBAND_8X, 8, 5e-4f);
+        test_mode("half-band IIR 2x", OM_HALFBAND_IIR_2X, 2, 5e-2f);
+        test_mode("half-band IIR 4x", OM_HALFBAND_IIR_4X, 4, 5e-2f);
+        test_mode("half-band IIR 8x", OM_HALFBAND_IIR_8X, 8, 5e-2f);
+    }
+
+UTEST_END
@@ -0,0 +1,106 @@
+/*
+ * sidechain.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <core/util/Sidechain.h>
+
+#define SRATE           48000
+#define REACTIVITY      1.0f            /* 48 samples */
+#define MAX_REACTIVITY  100.0f
+#define SAMPLES         20000           /* Covers several refresh periods */
+#define TOLERANCE       1e-3f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.util", sidechain)
+
+    float reference(size_t mode, const float *src, size_t i, size_t window)
+    {
+        float max = 0.0f, sum = 0.0f, sqr = 0.0f;
+        for (size_t j=0; j<window; ++j)
+        {
+            float s     = (i >= j) ? fabs(src[i - j]) : 0.0f;
+            max         = (s > max) ? s : max;
+            sum        += s;
+            sqr        += s*s;
+        }
+
+        switch (mode)
+        {
+            case SCM_PEAK:      return max;
+            case SCM_UNIFORM:   return sum / window;
+            case SCM_RMS:       return sqrtf(sqr / window);
+            default:            break;
+        }
+        return 0.0f;
+    }
+
+    void check(const char *label, size_t mode, const float *src, const float *dst, size_t window)
+    {
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            float ref   = reference(mode, src, i, window);
+            if (!float_equals_adaptive(dst[i], ref, TOLERANCE))
+                UTEST_FAIL_MSG("%s: output differs at sample %d: %.6f vs reference %.6f",
+                        label, int(i), dst[i], ref);
+        }
+    }
+
+    void test_mode(const char *label, size_t mode, const float *src, float *dst)
+    {
+        size_t window   = millis_to_samples(SRATE, REACTIVITY);
+        printf("Testing %s sidechain on window of %d samples...\n", label, int(window));
+
+        // Block processing with blocks of variable size
+        Sidechain sc;
+        UTEST_ASSERT(sc.init(1, MAX_REACTIVITY));
+        sc.set_sample_rate(SRATE);
+        sc.set_mode(mode);
+        sc.set_reactivity(REACTIVITY);
+
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 13 + 5) % 1031 + 1)
+        {
+            size_t to_do    = ((SAMPLES - i) > step) ? step : SAMPLES - i;
+            const float *in = &src[i];
+            sc.process(&dst[i], &in, to_do);
+            i              += to_do;
+        }
+        check(label, mode, src, dst, window);
+
+        // Per-sample processing
+        Sidechain ss;
+        UTEST_ASSERT(ss.init(1, MAX_REACTIVITY));
+        ss.set_sample_rate(SRATE);
+        ss.set_mode(mode);
+        ss.set_reactivity(REACTIVITY);
+
+        for (size_t i=0; i<SAMPLES; ++i)
+            dst[i]          = ss.process(&src[i]);
+        check(label, mode, src, dst, window);
+    }
+
+    UTEST_MAIN
+    {
+        float *src      = new float[SAMPLES];
+        float *dst      = new float[SAMPLES];
+
+        // Random signal with bursts of different loudness
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            float amp       = (i & 0x400) ? 1.0f : 0.01f;
+            src[i]          = amp * (float(rand()) / RAND_MAX - 0.5f);
+        }
+
+        test_mode("peak", SCM_PEAK, src, dst);
+        test_mode("uniform", SCM_UNIFORM, src, dst);
+        test_mode("rms", SCM_RMS, src, dst);
+
+        delete [] src;
+        delete [] dst;
+    }
+UTEST_END
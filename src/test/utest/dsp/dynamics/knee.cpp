@@ -0,0 +1,105 @@
+/*
+ * knee.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-4f
+
+namespace native
+{
+    void dyn_gain(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count);
+    void dyn_curve(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void dyn_gain(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count);
+        void dyn_curve(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count);
+    }
+)
+
+typedef void (* dyn_knee_func_t)(float *dst, const float *src, const dsp::dyn_knee_t *knee, size_t count);
+
+UTEST_BEGIN("dsp.dynamics", knee)
+
+    void init_knee(dsp::dyn_knee_t *k, size_t flat)
+    {
+        // Downward compressor-like curve: -24 dB threshold, 12 dB knee, ratio 4:1
+        float ks        = logf(0.063f / 2.0f);
+        float ke        = logf(0.063f * 2.0f);
+        k->start        = expf(ks);
+        k->end          = expf(ke);
+
+        for (size_t i=0; i<4; ++i)
+        {
+            k->lo[i]        = 0.0f;
+            k->knee[i]      = 0.0f;
+            k->hi[i]        = 0.0f;
+        }
+
+        k->knee[1]      = -0.375f / (ke - ks);
+        k->knee[2]      = 0.375f * (ks + ke) / (ke - ks);
+        k->knee[3]      = -0.375f * ks * ke / (ke - ks);
+        k->hi[2]        = -0.75f;
+        k->hi[3]        = 0.75f * logf(0.063f);
+
+        // Force non-constant low region to disable the flat-gain shortcut
+        if (!flat)
+            k->lo[2]        = 0.1f;
+    }
+
+    void call(const char *text, size_t align, dyn_knee_func_t func1, dyn_knee_func_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        dsp::dyn_knee_t knee;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 16, 24, 32, 33, 64, 65, 100, 255, 256, 257, 999, 0x1fff)
+        {
+            for (size_t mask=0; mask <= 0x07; ++mask)
+            {
+                printf("Testing %s on count=%d, mask=0x%x...\n", text, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer dst1(count, align, mask & 0x02);
+                FloatBuffer dst2(dst1);
+                src.randomize_sign();
+                init_knee(&knee, mask & 0x04);
+
+                // Call functions
+                func1(dst1, src, &knee, count);
+                func2(dst2, src, &knee, count);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            text, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        IF_ARCH_X86(call("sse:dyn_gain", 16, native::dyn_gain, sse::dyn_gain));
+        IF_ARCH_X86(call("sse:dyn_curve", 16, native::dyn_curve, sse::dyn_curve));
+    }
+UTEST_END;
@@ -9,7 +9,7 @@
 #include <test/FloatBuffer.h>
 #include <dsp/dsp.h>
 
-#define MIN_RANK    6
+#define MIN_RANK    3
 
 #ifdef ARCH_ARM
     #define MAX_RANK    12
@@ -29,6 +29,7 @@ namespace native
     void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
     void fastconv_restore(float *dst, float *src, size_t rank);
     void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+    void fastconv_accumulate(float *dst, const float *c1, const float *c2, size_t rank);
 }
 
 IF_ARCH_X86(
@@ -38,6 +39,18 @@ IF_ARCH_X86(
         void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
         void fastconv_restore(float *dst, float *src, size_t rank);
         void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void fastconv_accumulate(float *dst, const float *c1, const float *c2, size_t rank);
+    }
+)
+
+IF_ARCH_X86_64(
+    namespace avx
+    {
+        void x64_fastconv_parse(float *dst, const float *src, size_t rank);
+        void x64_fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
+        void x64_fastconv_restore(float *dst, float *src, size_t rank);
+        void x64_fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void x64_fastconv_accumulate(float *dst, const float *c1, const float *c2, size_t rank);
     }
 )
 
@@ -59,6 +72,8 @@ typedef void (* fastconv_restore_t)(float *dst, float *src, size_t rank);
 
 typedef void (* fastconv_apply_t)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+typedef void (* fastconv_accumulate_t)(float *dst, const float *c1, const float *c2, size_t rank);
+
 UTEST_BEGIN("dsp.fft", fastconv)
 
     // This is long-time test, raise time limit for it to one second
@@ -266,17 +281,88 @@ UTEST_BEGIN("dsp.fft", fastconv)
         }
     }
 
+    void call_acc(const char *label, size_t align,
+            fastconv_parse_t parse,
+            fastconv_accumulate_t accumulate
+        )
+    {
+        if (!UTEST_SUPPORTED(parse))
+            return;
+        if (!UTEST_SUPPORTED(accumulate))
+            return;
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank ++)
+        {
+            for (size_t mask=0; mask <= 0x07; ++mask)
+            {
+                printf("Testing '%s' for FFT rank=%d, mask=0x%x\n", label, rank, mask);
+
+                FloatBuffer src1(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src2(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer fa1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fa2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer acc1(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer acc2(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer dst1(1 << rank, align, mask & 0x04);
+                FloatBuffer dst2(1 << rank, align, mask & 0x04);
+
+                native::fastconv_parse(fa1, src1, rank);
+                native::fastconv_parse(fb1, src2, rank);
+                parse(fa2, src1, rank);
+                parse(fb2, src2, rank);
+                acc1.copy(fa1);
+                acc2.copy(fa2);
+
+                // Accumulate the convolution twice
+                native::fastconv_accumulate(acc1, fa1, fb1, rank);
+                native::fastconv_accumulate(acc1, fb1, fa1, rank);
+                UTEST_ASSERT_MSG(acc1.valid(), "Buffer ACC1 corrupted");
+                accumulate(acc2, fa2, fb2, rank);
+                accumulate(acc2, fb2, fa2, rank);
+                UTEST_ASSERT_MSG(acc2.valid(), "Buffer ACC2 corrupted");
+                UTEST_ASSERT_MSG(fa2.valid(), "Buffer FA2 corrupted");
+                UTEST_ASSERT_MSG(fb2.valid(), "Buffer FB2 corrupted");
+
+                native::fastconv_restore(dst1, acc1, rank);
+                native::fastconv_restore(dst2, acc2, rank);
+                UTEST_ASSERT_MSG(dst1.valid(), "Buffer DST1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Buffer DST2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src1.dump("src1");
+                    src2.dump("src2");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+
+                    ssize_t diff = dst2.last_diff();
+                    UTEST_FAIL_MSG("DST1 differs DST2 for test '%s' at sample %d (%.5f vs %.5f)",
+                            label, int(diff), dst1.get(diff), dst2.get(diff));
+                }
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         // Do tests
         IF_ARCH_X86(call_pr("sse::fastconv_parse + sse::fastconv_restore", 16, sse::fastconv_parse, sse::fastconv_restore));
+        IF_ARCH_X86_64(call_pr("avx::x64_fastconv_parse + avx::x64_fastconv_restore", 32, avx::x64_fastconv_parse, avx::x64_fastconv_restore));
         IF_ARCH_ARM(call_pr("neon_d32::fastconv_parse + neon_d32::fastconv_restore", 16, neon_d32::fastconv_parse, neon_d32::fastconv_restore));
 
         IF_ARCH_X86(call_pa("sse::fastconv_parse + sse::fastconv_apply", 16, sse::fastconv_parse, sse::fastconv_apply));
+        IF_ARCH_X86_64(call_pa("avx::x64_fastconv_parse + avx::x64_fastconv_apply", 32, avx::x64_fastconv_parse, avx::x64_fastconv_apply));
         IF_ARCH_ARM(call_pa("neon_d32::fastconv_parse + neon_d32::fastconv_apply", 16, neon_d32::fastconv_parse, neon_d32::fastconv_apply));
 
         IF_ARCH_X86(call_pap("sse::fastconv_parse + sse::fastconv_parse_apply", 16, sse::fastconv_parse, sse::fastconv_parse_apply));
+        IF_ARCH_X86_64(call_pap("avx::x64_fastconv_parse + avx::x64_fastconv_parse_apply", 32, avx::x64_fastconv_parse, avx::x64_fastconv_parse_apply));
         IF_ARCH_ARM(call_pap("neon_d32::fastconv_parse + neon_d32::fastconv_parse_apply", 16, neon_d32::fastconv_parse, neon_d32::fastconv_parse_apply));
+
+        IF_ARCH_X86(call_acc("sse::fastconv_parse + sse::fastconv_accumulate", 16, sse::fastconv_parse, sse::fastconv_accumulate));
+        IF_ARCH_X86_64(call_acc("avx::x64_fastconv_parse + avx::x64_fastconv_accumulate", 32, avx::x64_fastconv_parse, avx::x64_fastconv_accumulate));
     }
 UTEST_END;
 
@@ -0,0 +1,147 @@
+/*
+ * rfft.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+#include <dsp/dsp.h>
+
+#define TOLERANCE       5e-2
+
+namespace native
+{
+    void packed_direct_fft(float *dst, const float *src, size_t rank);
+    void real_direct_fft(float *dst, const float *src, size_t rank);
+    void real_reverse_fft(float *dst, const float *src, size_t rank);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void real_direct_fft(float *dst, const float *src, size_t rank);
+        void real_reverse_fft(float *dst, const float *src, size_t rank);
+    }
+)
+
+typedef void (* real_fft_t)(float *dst, const float *src, size_t rank);
+
+UTEST_BEGIN("dsp.fft", rfft)
+
+    void check_spectrum(size_t rank)
+    {
+        size_t count = 1 << rank;
+        FloatBuffer src(count, 16, true);
+        FloatBuffer dst(count, 16, true);
+        FloatBuffer csrc(count*2, 16, true);
+        FloatBuffer cdst(count*2, 16, true);
+        FloatBuffer spec(count, 16, true);
+
+        // Compute the spectrum of the same signal with the complex FFT
+        for (size_t i=0; i<count; ++i)
+        {
+            csrc[i*2]       = src[i];
+            csrc[i*2+1]     = 0.0f;
+        }
+
+        printf("Checking spectrum of 'native::real_direct_fft' for rank=%d\n", int(rank));
+
+        native::real_direct_fft(dst, src, rank);
+        native::packed_direct_fft(cdst, csrc, rank);
+
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        UTEST_ASSERT_MSG(cdst.valid(), "Complex destination buffer corrupted");
+
+        // Re-pack the complex spectrum into real FFT format
+        spec[0]         = cdst[0];
+        if (rank > 0)
+            spec[1]         = cdst[count];
+        for (size_t i=2; i<count; ++i)
+            spec[i]         = cdst[i];
+
+        UTEST_ASSERT_MSG(spec.valid(), "Spectrum buffer corrupted");
+        if (!dst.equals_adaptive(spec, TOLERANCE))
+        {
+            ssize_t diff = dst.last_diff();
+            dst.dump("dst ");
+            spec.dump("spec");
+            UTEST_FAIL_MSG("Spectrum differs at sample %d (%.5f vs %.5f)",
+                    int(diff), dst.get(diff), spec.get(diff));
+        }
+
+        // Check that reverse transform restores the signal
+        native::real_reverse_fft(dst, dst, rank);
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        if (!dst.equals_adaptive(src, 1e-4))
+        {
+            ssize_t diff = dst.last_diff();
+            src.dump("src ");
+            dst.dump("dst ");
+            UTEST_FAIL_MSG("Reverse transform differs at sample %d (%.5f vs %.5f)",
+                    int(diff), src.get(diff), dst.get(diff));
+        }
+    }
+
+    void call(const char *label, size_t align, real_fft_t func1, real_fft_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (int same=0; same < 2; ++same)
+        {
+            for (size_t rank=0; rank<=16; ++rank)
+            {
+                size_t count = 1 << rank;
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    FloatBuffer src(count, align, mask & 0x01);
+                    FloatBuffer dst1(count, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, count);
+                        dsp::copy(dst2, src, count);
+                        func1(dst1, dst1, rank);
+                        func2(dst2, dst2, rank);
+                    }
+                    else
+                    {
+                        func1(dst1, src, rank);
+                        func2(dst2, src, rank);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if ((!dst1.equals_adaptive(dst2, TOLERANCE)))
+                    {
+                        ssize_t diff = dst1.last_diff();
+                        src.dump("src ");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst1.get(diff), dst2.get(diff));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t rank=0; rank<=12; ++rank)
+            check_spectrum(rank);
+
+        IF_ARCH_X86(call("sse::real_direct_fft", 16, native::real_direct_fft, sse::real_direct_fft));
+        IF_ARCH_X86(call("sse::real_reverse_fft", 16, native::real_reverse_fft, sse::real_reverse_fft));
+    }
+UTEST_END;
@@ -0,0 +1,94 @@
+/*
+ * interpolate.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count);
+    }
+)
+
+typedef void (* interpolate_cascades_t)(f_cascade_t *dst, const f_cascade_t *keys, size_t stride, size_t step, size_t count);
+
+UTEST_BEGIN("dsp.filters", interpolate)
+
+    void call(const char *label, interpolate_cascades_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(stride, 1, 3, 8)
+        {
+            UTEST_FOREACH(step, 1, 2, 7, 8, 32)
+            {
+                UTEST_FOREACH(count, 0, 1, 2, 3, 8, 9, 0x1f, 0x40, 0x1ff)
+                {
+                    printf("Testing %s on stride=%d, step=%d, count=%d...\n", label, int(stride), int(step), int(count));
+
+                    size_t keys         = (count + step - 1) / step + 1;
+                    size_t items        = (sizeof(f_cascade_t) / sizeof(float)) * stride;
+                    FloatBuffer src(items * keys);
+                    FloatBuffer dst(items * count);
+                    src.randomize_sign();
+                    dst.randomize_sign();
+                    FloatBuffer ref(dst);
+
+                    // Compute reference value
+                    const f_cascade_t *k    = reinterpret_cast<const f_cascade_t *>(src.data());
+                    f_cascade_t *r          = reinterpret_cast<f_cascade_t *>(ref.data());
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        const f_cascade_t *a    = &k[(i / step) * stride];
+                        const f_cascade_t *b    = &a[stride];
+                        float x                 = float(i % step) / step;
+                        f_cascade_t *c          = &r[i * stride];
+                        for (size_t j=0; j<4; ++j)
+                        {
+                            c->t[j]                 = a->t[j] + (b->t[j] - a->t[j]) * x;
+                            c->b[j]                 = a->b[j] + (b->b[j] - a->b[j]) * x;
+                        }
+                    }
+
+                    func(reinterpret_cast<f_cascade_t *>(dst.data()), k, stride, step, count);
+
+                    // Perform validation
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+                    UTEST_ASSERT_MSG(ref.valid(), "Reference buffer corrupted");
+
+                    if (!ref.equals_absolute(dst, TOLERANCE))
+                    {
+                        src.dump("src");
+                        ref.dump("ref");
+                        dst.dump("dst");
+                        UTEST_FAIL_MSG("Output of function '%s' differs at sample %d: %.6f vs %.6f",
+                                label, int(ref.last_diff()), ref.get_diff(), dst.get_diff());
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        call("native::interpolate_cascades", native::interpolate_cascades);
+        IF_ARCH_X86(call("sse::interpolate_cascades", sse::interpolate_cascades));
+    }
+
+UTEST_END
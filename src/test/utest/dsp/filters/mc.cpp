@@ -0,0 +1,168 @@
+/*
+ * mc.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <test/FloatBuffer.h>
+
+#define MAX_STAGES      4
+#define TOLERANCE       1e-3f
+
+namespace native
+{
+    void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_mc4(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+    void biquad_process_mc8(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void biquad_process_mc4(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+        void biquad_process_mc8(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+    }
+)
+
+typedef void (* biquad_process_mc_t)(float *dst, const float *src, size_t count, biquad_t *f, size_t stages);
+
+// Set of stable filters: a0, a1, a2, b1, b2
+static const float filters[][5] =
+{
+    { 1.79906213f, -3.38381839f, 1.59139514f, 1.8580488f, -0.863286555f },
+    { 1.16191483f, -2.20469999f, 1.04720736f, 1.88010871f, -0.88529253f },
+    { 1.13150513f, -2.18261695f, 1.05562544f, 1.91898823f, -0.924120247f },
+    { 1.11161804f, -2.19184852f, 1.08485937f, 1.96808743f, -0.97324127f },
+    { 0.992303491f, -1.98460698f, 0.992303491f, 1.98398674f, -0.985227287f }
+};
+
+#define FILTERS         (sizeof(filters) / sizeof(filters[0]))
+
+UTEST_BEGIN("dsp.filters", mc)
+
+    void init_filters(biquad_t *mc, biquad_t *x1, size_t lanes, size_t stages)
+    {
+        for (size_t j=0; j<stages; ++j)
+        {
+            biquad_t *f     = &mc[j];
+            dsp::fill_zero(f->d, BIQUAD_D_ITEMS);
+
+            for (size_t i=0; i<lanes; ++i)
+            {
+                const float *k  = filters[(i + j) % FILTERS];
+                biquad_x1_t *x  = &x1[i*MAX_STAGES + j].x1;
+                dsp::fill_zero(x1[i*MAX_STAGES + j].d, BIQUAD_D_ITEMS);
+
+                x->a[0]         = k[0];
+                x->a[1]         = k[0];
+                x->a[2]         = k[1];
+                x->a[3]         = k[2];
+                x->b[0]         = k[3];
+                x->b[1]         = k[4];
+                x->b[2]         = 0.0f;
+                x->b[3]         = 0.0f;
+
+                if (lanes == 4)
+                {
+                    f->x4.a0[i]     = k[0];
+                    f->x4.a1[i]     = k[1];
+                    f->x4.a2[i]     = k[2];
+                    f->x4.b1[i]     = k[3];
+                    f->x4.b2[i]     = k[4];
+                }
+                else
+                {
+                    f->x8.a0[i]     = k[0];
+                    f->x8.a1[i]     = k[1];
+                    f->x8.a2[i]     = k[2];
+                    f->x8.b1[i]     = k[3];
+                    f->x8.b2[i]     = k[4];
+                }
+            }
+        }
+    }
+
+    void call(const char *label, biquad_process_mc_t func, size_t lanes)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        biquad_t mc[MAX_STAGES] __lsp_aligned64;
+        biquad_t x1[MAX_STAGES * 8] __lsp_aligned64;
+
+        UTEST_FOREACH(stages, 1, 2, 3, 4)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 0x1f, 0x40, 0x1ff)
+            {
+                FloatBuffer src(count * lanes);
+                FloatBuffer dst1(count * lanes);
+                FloatBuffer dst2(count * lanes);
+                FloatBuffer tmp(count);
+                src.randomize_sign();
+
+                printf("Testing %s on input buffer size=%d, stages=%d...\n", label, int(count), int(stages));
+
+                init_filters(mc, x1, lanes, stages);
+
+                // Process each channel separately with cascade of x1 filters
+                for (size_t i=0; i<lanes; ++i)
+                {
+                    float *t = tmp.data();
+                    for (size_t k=0; k<count; ++k)
+                        t[k]    = src[k*lanes + i];
+                    for (size_t j=0; j<stages; ++j)
+                        native::biquad_process_x1(t, t, count, &x1[i*MAX_STAGES + j]);
+                    for (size_t k=0; k<count; ++k)
+                        dst1[k*lanes + i] = t[k];
+                }
+
+                // Process all channels at once
+                func(dst2, src, count, mc, stages);
+
+                // Perform validation
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                // Check filter memory
+                for (size_t j=0; j<stages; ++j)
+                {
+                    for (size_t i=0; i<lanes; ++i)
+                    {
+                        const float *d = x1[i*MAX_STAGES + j].d;
+                        float d0 = mc[j].d[i], d1 = mc[j].d[i + lanes];
+                        if ((float_equals_absolute(d[0], d0, TOLERANCE)) &&
+                            (float_equals_absolute(d[1], d1, TOLERANCE)))
+                            continue;
+                        UTEST_FAIL_MSG("Filter memory of stage %d, channel %d for test '%s' differs: {%.6f, %.6f} vs {%.6f, %.6f}",
+                                int(j), int(i), label, d[0], d[1], d0, d1);
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        call("native::biquad_process_mc4", native::biquad_process_mc4, 4);
+        IF_ARCH_X86(call("sse::biquad_process_mc4", sse::biquad_process_mc4, 4));
+
+        call("native::biquad_process_mc8", native::biquad_process_mc8, 8);
+        IF_ARCH_X86(call("sse::biquad_process_mc8", sse::biquad_process_mc8, 8));
+    }
+
+UTEST_END
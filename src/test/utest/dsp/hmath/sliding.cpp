@@ -0,0 +1,130 @@
+/*
+ * sliding.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+#define REFRESH         0x1000      /* Same as SIDECHAIN_REFRESH_RATE */
+#define SEED            0x12345678
+
+namespace native
+{
+    float sliding_mean(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+    float sliding_rms(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        float sliding_mean(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+        float sliding_rms(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+    }
+)
+
+typedef float (* sliding_t)(float *dst, const float *head, const float *tail, float sum, float k, size_t count);
+
+UTEST_BEGIN("dsp.hmath", sliding)
+
+    float window_sum(const float *s, size_t window, bool sqr)
+    {
+        float sum       = 0.0f;
+        for (size_t i=0; i<window; ++i)
+            sum            += (sqr) ? s[i] * s[i] : s[i];
+        return sum;
+    }
+
+    void call(const char *label, size_t align, bool sqr, sliding_t func1, sliding_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        srand(SEED);
+
+        UTEST_FOREACH(window, 1, 3, 16, 100)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 32, 65, 100, 999, 0x1fff)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s on window=%d, count=%d, mask=0x%x...\n", label, int(window), int(count), int(mask));
+
+                    FloatBuffer src(count + window, align, mask & 0x01);
+                    FloatBuffer dst1(count, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+                    src.randomize_0to1();
+
+                    // Call functions, re-compute the exact state of the window periodically as Sidechain does
+                    const float *s  = src;
+                    float k         = 1.0f / window;
+                    float a = 0.0f, b = 0.0f;
+                    for (size_t off=0; off < count; off += REFRESH)
+                    {
+                        size_t n        = ((count - off) > REFRESH) ? REFRESH : count - off;
+                        a               = window_sum(&s[off], window, sqr);
+                        b               = a;
+                        a               = func1(&dst1[off], &s[off + window], &s[off], a, k, n);
+                        b               = func2(&dst2[off], &s[off + window], &s[off], b, k, n);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers, the error of the window sum is absolute, so compare
+                    // squares of RMS values: the square root amplifies the error near zero
+                    const float *d1 = dst1, *d2 = dst2;
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        float v1        = (sqr) ? d1[i] * d1[i] : d1[i];
+                        float v2        = (sqr) ? d2[i] * d2[i] : d2[i];
+                        if (fabs(v1 - v2) <= TOLERANCE)
+                            continue;
+
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                label, int(i), d1[i], d2[i]);
+                    }
+                    if (fabs(a - b) > TOLERANCE * window)
+                        UTEST_FAIL_MSG("Result of function 1 (%f) differs result of function 2 (%f)", a, b);
+                }
+            }
+        }
+    }
+
+    void check_clamp(const char *label, sliding_t func)
+    {
+        printf("Testing clamping of %s...\n", label);
+
+        // Head and tail are equal, the negative sum stays negative and should produce zeros
+        FloatBuffer src(0x100, 16, false);
+        FloatBuffer dst(0x40, 16, false);
+        src.randomize_0to1();
+
+        const float *s  = src;
+        const float *d  = dst;
+        func(dst, s, s, -1e-6f, 1.0f / 16, 0x40);
+        for (size_t i=0; i<0x40; ++i)
+            UTEST_ASSERT_MSG(d[i] == 0.0f, "%s: value %.6f at sample %d is not clamped", label, d[i], int(i));
+    }
+
+    UTEST_MAIN
+    {
+        check_clamp("native:sliding_mean", native::sliding_mean);
+        check_clamp("native:sliding_rms", native::sliding_rms);
+        IF_ARCH_X86(check_clamp("sse:sliding_mean", sse::sliding_mean));
+        IF_ARCH_X86(check_clamp("sse:sliding_rms", sse::sliding_rms));
+
+        IF_ARCH_X86(call("sse:sliding_mean", 16, false, native::sliding_mean, sse::sliding_mean));
+        IF_ARCH_X86(call("sse:sliding_rms", 16, true, native::sliding_rms, sse::sliding_rms));
+    }
+UTEST_END
@@ -0,0 +1,74 @@
+/*
+ * lramp.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void lramp_add2(float *dst, const float *src, float v1, float v2, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void lramp_add2(float *dst, const float *src, float v1, float v2, size_t count);
+    }
+)
+
+typedef void (* lramp_add2_t)(float *dst, const float *src, float v1, float v2, size_t count);
+
+UTEST_BEGIN("dsp.pmath", lramp)
+
+    void call(const char *label, size_t align, lramp_add2_t func1, lramp_add2_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 32, 65, 100, 999, 0xffff)
+        {
+            for (size_t mask=0; mask <= 0x03; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer src(count, align, mask & 0x01);
+                FloatBuffer dst1(count, align, mask & 0x02);
+                src.randomize_sign();
+                dst1.randomize_sign();
+                FloatBuffer dst2(dst1);
+
+                // Call functions
+                func1(dst1, src, 0.75f, -0.25f, count);
+                func2(dst2, src, 0.75f, -0.25f, count);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_absolute(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        IF_ARCH_X86(call("sse:lramp_add2", 16, native::lramp_add2, sse::lramp_add2));
+    }
+UTEST_END
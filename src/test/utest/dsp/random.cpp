@@ -0,0 +1,114 @@
+/*
+ * random.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-6f
+#define STAT_SAMPLES    0x40000
+
+namespace native
+{
+    void init_prng(dsp::prng_t *rnd, uint32_t seed);
+    void rand_uniform(float *dst, dsp::prng_t *rnd, size_t count);
+    void rand_triangle(float *dst, dsp::prng_t *rnd, size_t count);
+    void rand_gaussian(float *dst, dsp::prng_t *rnd, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse2
+    {
+        void rand_uniform(float *dst, dsp::prng_t *rnd, size_t count);
+        void rand_triangle(float *dst, dsp::prng_t *rnd, size_t count);
+        void rand_gaussian(float *dst, dsp::prng_t *rnd, size_t count);
+    }
+)
+
+typedef void (* rand_t)(float *dst, dsp::prng_t *rnd, size_t count);
+
+UTEST_BEGIN("dsp", random)
+
+    void call(const char *label, size_t align, rand_t func1, rand_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        dsp::prng_t r1, r2;
+        native::init_prng(&r1, 0x12345678);
+        r2 = r1;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 32, 65, 100, 999, 0xffff)
+        {
+            for (size_t mask=0; mask <= 0x01; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer dst1(count, align, mask & 0x01);
+                FloatBuffer dst2(dst1);
+
+                // Call functions
+                func1(dst1, &r1, count);
+                func2(dst2, &r2, count);
+
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Compare buffers and generator states
+                if (!dst1.equals_absolute(dst2, TOLERANCE))
+                {
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+                UTEST_ASSERT_MSG(memcmp(&r1, &r2, sizeof(dsp::prng_t)) == 0, "Generator states differ");
+            }
+        }
+    }
+
+    void check_distribution(const char *label, rand_t func, float min, float max, float mean, float var)
+    {
+        printf("Testing distribution of %s...\n", label);
+
+        dsp::prng_t rnd;
+        native::init_prng(&rnd, 0xdeadbeef);
+
+        float *buf  = new float[STAT_SAMPLES];
+        func(buf, &rnd, STAT_SAMPLES);
+
+        double sum = 0.0, sqr = 0.0;
+        for (size_t i=0; i<STAT_SAMPLES; ++i)
+        {
+            float v     = buf[i];
+            UTEST_ASSERT_MSG((v >= min) && (v < max), "%s: value %.6f at sample %d is out of range", label, v, int(i));
+            sum        += v;
+            sqr        += v*v;
+        }
+        delete [] buf;
+
+        double m    = sum / STAT_SAMPLES;
+        double d    = sqr / STAT_SAMPLES - m*m;
+        printf("  mean: %.6f, variance: %.6f\n", m, d);
+
+        UTEST_ASSERT_MSG(fabs(m - mean) < 0.01, "%s: mean %.6f differs from %.6f", label, m, mean);
+        UTEST_ASSERT_MSG(fabs(d - var) < 0.01 * var, "%s: variance %.6f differs from %.6f", label, d, var);
+    }
+
+    UTEST_MAIN
+    {
+        check_distribution("uniform", native::rand_uniform, 0.0f, 1.0f, 0.5f, 1.0f / 12.0f);
+        check_distribution("triangle", native::rand_triangle, -1.0f, 1.0f, 0.0f, 1.0f / 6.0f);
+        check_distribution("gaussian", native::rand_gaussian, -3.5f, 3.5f, 0.0f, 1.0f);
+
+        IF_ARCH_X86(call("sse2:rand_uniform", 16, native::rand_uniform, sse2::rand_uniform));
+        IF_ARCH_X86(call("sse2:rand_triangle", 16, native::rand_triangle, sse2::rand_triangle));
+        IF_ARCH_X86(call("sse2:rand_gaussian", 16, native::rand_gaussian, sse2::rand_gaussian));
+    }
+UTEST_END
@@ -0,0 +1,85 @@
+/*
+ * halfband.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void halfband_upsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count);
+    void halfband_downsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void halfband_upsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count);
+        void halfband_downsample_2x(float *dst, const float *src, const float *c, size_t n, size_t count);
+    }
+)
+
+typedef void (* halfband_t)(float *dst, const float *src, const float *c, size_t n, size_t count);
+
+UTEST_BEGIN("dsp.resampling", halfband)
+
+    void call(const char *text, size_t align, bool up, halfband_t func1, halfband_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(n, 1, 2, 3, 4, 5, 6, 8, 13, 40)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 32, 100, 999)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s on n=%d, count=%d, mask=0x%x...\n", text, int(n), int(count), int(mask));
+
+                    size_t src_len  = (up) ? count + (n << 1) - 1 : (count << 1) + (n << 2) - 3;
+                    size_t dst_len  = (up) ? count << 1 : count;
+
+                    FloatBuffer src(src_len, align, mask & 0x01);
+                    FloatBuffer c(n, align, false);
+                    FloatBuffer dst1(dst_len, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+                    src.randomize_sign();
+                    c.randomize_sign();
+
+                    // Call functions
+                    func1(dst1, src, c, n, count);
+                    func2(dst2, src, c, n, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(c.valid(), "Coefficient buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                text, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        IF_ARCH_X86(call("sse:halfband_upsample_2x", 16, true, native::halfband_upsample_2x, sse::halfband_upsample_2x));
+        IF_ARCH_X86(call("sse:halfband_downsample_2x", 16, false, native::halfband_downsample_2x, sse::halfband_downsample_2x));
+    }
+UTEST_END;
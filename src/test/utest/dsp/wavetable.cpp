@@ -0,0 +1,103 @@
+/*
+ * wavetable.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TABLE_RANK      10
+#define TABLE_SIZE      (1 << TABLE_RANK)
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void wavetable(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse2
+    {
+        void wavetable(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count);
+    }
+)
+
+typedef void (* wavetable_t)(float *dst, const float *table, size_t rank, uint32_t phase, uint32_t step, float k, float b, size_t count);
+
+UTEST_BEGIN("dsp", wavetable)
+
+    void call(const char *label, size_t align, wavetable_t func1, wavetable_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        FloatBuffer table(TABLE_SIZE + 1, align);
+        table.randomize_sign();
+        table[TABLE_SIZE]   = table[0];
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 32, 65, 100, 999, 0xffff)
+        {
+            for (size_t mask=0; mask <= 0x01; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                FloatBuffer dst1(count, align, mask & 0x01);
+                FloatBuffer dst2(dst1);
+
+                uint32_t phase  = uint32_t(rand()) * 0x10001;
+                uint32_t step   = uint32_t(rand()) * 0x301;
+
+                // Call functions
+                func1(dst1, table, TABLE_RANK, phase, step, 0.75f, -0.25f, count);
+                func2(dst2, table, TABLE_RANK, phase, step, 0.75f, -0.25f, count);
+
+                UTEST_ASSERT_MSG(table.valid(), "Table corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_absolute(dst2, TOLERANCE))
+                {
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    void check_interpolation()
+    {
+        printf("Testing native::wavetable interpolation...\n");
+
+        float table[TABLE_SIZE + 1];
+        for (size_t i=0; i<=TABLE_SIZE; ++i)
+            table[i]        = (i < TABLE_SIZE) ? sinf(i * 2.0f * M_PI / TABLE_SIZE) : 0.0f;
+
+        float dst[0x100];
+        uint32_t step   = 0x00f0f0f1;
+        native::wavetable(dst, table, TABLE_RANK, 0, step, 1.0f, 0.0f, 0x100);
+
+        for (size_t i=0; i<0x100; ++i)
+        {
+            double p    = uint32_t(step * i) / 4294967296.0;
+            double x    = p * TABLE_SIZE;
+            size_t j    = size_t(x);
+            double ref  = table[j] + (table[j+1] - table[j]) * (x - j);
+            if (fabs(ref - dst[i]) > TOLERANCE)
+                UTEST_FAIL_MSG("Interpolation error at sample %d: %.6f vs %.6f", int(i), dst[i], ref);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_interpolation();
+        IF_ARCH_X86(call("sse2:wavetable", 16, native::wavetable, sse2::wavetable));
+    }
+UTEST_END